@@ -5575,6 +5575,14 @@ GrB_Info GxB_MatrixTupleIter_iterate_row
     GrB_Index rowIdx            // row index to iterate over
 ) ;
 
+// iterate over a range of rows [startRowIdx, endRowIdx)
+GrB_Info GxB_MatrixTupleIter_iterate_range
+(
+    GxB_MatrixTupleIter *iter,  // iterator to use
+    GrB_Index startRowIdx,      // first row index to iterate over
+    GrB_Index endRowIdx         // row index to stop at (exclusive)
+) ;
+
 // Advance iterator to the next none zero value
 GrB_Info GxB_MatrixTupleIter_next
 (
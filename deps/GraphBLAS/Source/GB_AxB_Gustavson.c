@@ -157,6 +157,33 @@ GrB_Info GB_AxB_Gustavson           // C=A*B or C<M>=A*B, Gustavson's method
         // FUTURE: if A and B are pattern-only and the semiring is AND_OR
         // or OR_AND (perhaps others) the C is pattern-only, and the values
         // of C do not need to be computed.  The work is done here.
+
+        #ifdef RG_STRUCTURED_BOOL
+        if (semiring == Rg_structured_bool)
+        {
+            // both operators of Rg_structured_bool ignore their inputs and
+            // return true, so C(i,j) is true for every entry in the pattern
+            // just computed.  The numerical phase, which would revisit every
+            // A(:,k) for each B(k,j), is skipped.  No typecasting is needed
+            // since the values of A and B are never read.
+            int64_t cnz = GB_NNZ (C) ;
+            C->type = GrB_BOOL ;
+            C->type_size = sizeof (bool) ;
+            GB_MALLOC_MEMORY (C->x, C->nzmax, sizeof (bool)) ;
+            if (C->x == NULL)
+            {
+                // out of memory
+                GB_FREE_ALL ;
+                return (GrB_OUT_OF_MEMORY) ;
+            }
+            C->x_shallow = false ;
+            memset (C->x, true, cnz * sizeof (bool)) ;
+            ASSERT_SAUNA_IS_RESET ;
+            ASSERT_OK (GB_check (C, "C structural for Gustavson C=A*B", GB0)) ;
+            (*mask_applied) = false ;
+            return (GrB_SUCCESS) ;
+        }
+        #endif
     }
 
     //==========================================================================
@@ -49,6 +49,32 @@ GrB_Info GxB_MatrixTupleIter_iterate_row
     return (GrB_SUCCESS);
 }
 
+GrB_Info GxB_MatrixTupleIter_iterate_range
+(
+    GxB_MatrixTupleIter *iter,
+    GrB_Index startRowIdx,
+    GrB_Index endRowIdx
+)
+{
+    GB_WHERE("GxB_MatrixTupleIter_iterate_range (iter, startRowIdx, endRowIdx)");
+    GB_RETURN_IF_NULL(iter);
+
+    if (startRowIdx > endRowIdx)
+    {
+        return (GB_ERROR(GrB_INVALID_INDEX, (GB_LOG, "Invalid row range")));
+    }
+
+    // Clip range to matrix dimensions.
+    if (endRowIdx > iter->nrows) endRowIdx = iter->nrows;
+    if (startRowIdx > endRowIdx) startRowIdx = endRowIdx;
+
+    iter->nvals = iter->A->p[endRowIdx];
+    iter->nnz_idx = iter->A->p[startRowIdx];
+    iter->row_idx = startRowIdx;
+    iter->p = 0;
+    return (GrB_SUCCESS);
+}
+
 // Advance iterator
 GrB_Info GxB_MatrixTupleIter_next
 (
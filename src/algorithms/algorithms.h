@@ -8,5 +8,6 @@
 #define _ALGORITHMS_H_
 
 #include "./all_paths.h"
+#include "./shortest_paths.h"
 
 #endif
@@ -4,8 +4,45 @@
 * This file is available under the Redis Labs Source Available License Agreement
 */
 
+#include <string.h>
+
 #include "all_paths.h"
 #include "../util/arr.h"
+#include "../util/rmalloc.h"
+
+// Make sure on path bitmap can hold node 'id',
+// graph might grow while paths are being computed.
+static void _AllPathsCtx_EnsureOnPath(AllPathsCtx *ctx, NodeID id) {
+    size_t words = id / 64 + 1;
+    if(words <= ctx->onPathWords) return;
+
+    size_t required = (Graph_RequiredMatrixDim(ctx->g) + 63) / 64;
+    if(required < words) required = words;
+    ctx->onPath = rm_realloc(ctx->onPath, required * sizeof(uint64_t));
+    memset(ctx->onPath + ctx->onPathWords, 0, (required - ctx->onPathWords) * sizeof(uint64_t));
+    ctx->onPathWords = required;
+}
+
+static inline bool _AllPathsCtx_IsOnPath(const AllPathsCtx *ctx, NodeID id) {
+    size_t word = id / 64;
+    if(word >= ctx->onPathWords) return false;
+    return (ctx->onPath[word] >> (id % 64)) & 1;
+}
+
+// Append node to current path.
+static void _AllPathsCtx_PushPath(AllPathsCtx *ctx, Node node) {
+    NodeID id = ENTITY_GET_ID(&node);
+    _AllPathsCtx_EnsureOnPath(ctx, id);
+    ctx->onPath[id / 64] |= ((uint64_t)1 << (id % 64));
+    ctx->path = Path_append(ctx->path, node);
+}
+
+// Remove last node from current path.
+static void _AllPathsCtx_PopPath(AllPathsCtx *ctx) {
+    Node node = Path_pop(ctx->path);
+    NodeID id = ENTITY_GET_ID(&node);
+    ctx->onPath[id / 64] &= ~((uint64_t)1 << (id % 64));
+}
 
 // Make sure context levels array have atleast 'level' entries,
 // Append given 'node' to given 'level' array.
@@ -37,10 +74,24 @@ AllPathsCtx* AllPathsCtx_New(Node *src, Graph *g, int *relationIDs, int relation
     ctx->relationCount = relationCount;
     ctx->levels = array_new(Node*, 1);
 	ctx->path = array_new(Node, 1);
+    ctx->onPathWords = (Graph_RequiredMatrixDim(g) + 63) / 64;
+    ctx->onPath = rm_calloc(ctx->onPathWords, sizeof(uint64_t));
+    ctx->neighbors = array_new(Edge, 32);
 	_AllPathsCtx_AddNodeToLevel(ctx, 0, src);
 	return ctx;
 }
 
+void AllPathsCtx_Reset(AllPathsCtx *ctx, Node *src) {
+    assert(ctx && src);
+
+    // Traversal might have been abandoned midway, unmark remaining path.
+    while(!Path_empty(ctx->path)) _AllPathsCtx_PopPath(ctx);
+
+    uint32_t levelsCount = array_len(ctx->levels);
+    for(uint32_t i = 0; i < levelsCount; i++) array_clear(ctx->levels[i]);
+    _AllPathsCtx_AddNodeToLevel(ctx, 0, src);
+}
+
 Path AllPathsCtx_NextPath(AllPathsCtx *ctx) {
     if(!ctx) return NULL;
     // As long as path is not empty OR there are neighbors to traverse.
@@ -53,7 +104,7 @@ Path AllPathsCtx_NextPath(AllPathsCtx *ctx) {
 			Node frontier = array_pop(ctx->levels[depth]);
 
             // Add frontier to path.
-            ctx->path = Path_append(ctx->path, frontier);
+            _AllPathsCtx_PushPath(ctx, frontier);
 
             // Update path depth.
             depth++;
@@ -61,33 +112,30 @@ Path AllPathsCtx_NextPath(AllPathsCtx *ctx) {
             // Introduce neighbors only if path depth < maximum path length.
             if(depth < ctx->maxLen) {
                 // Get frontier neighbors.
-                Edge *neighbors = array_new(Edge, 32);
+                array_clear(ctx->neighbors);
                 for(int i = 0; i < ctx->relationCount; i++) {
-                    Graph_GetNodeEdges(ctx->g, &frontier, ctx->dir, ctx->relationIDs[i], &neighbors);
+                    Graph_GetNodeEdges(ctx->g, &frontier, ctx->dir, ctx->relationIDs[i], &ctx->neighbors);
                 }
 
                 // Add unvisited neighbors to next level.
-                uint32_t neighborsCount = array_len(neighbors);
+                uint32_t neighborsCount = array_len(ctx->neighbors);
                 for(uint32_t i = 0; i < neighborsCount; i++) {
-                    // TODO might need to check direction!
+                    Edge *e = ctx->neighbors + i;
+                    NodeID neighborID = (ctx->dir == GRAPH_EDGE_DIR_OUTGOING) ?
+                                        Edge_GetDestNodeID(e) : Edge_GetSrcNodeID(e);
+                    if(_AllPathsCtx_IsOnPath(ctx, neighborID)) continue;
+
                     Node neighbor;
-                    if(ctx->dir == GRAPH_EDGE_DIR_OUTGOING) {
-                        Graph_GetNode(ctx->g, Edge_GetDestNodeID(neighbors+i), &neighbor);
-                    } else {
-                        Graph_GetNode(ctx->g, Edge_GetSrcNodeID(neighbors+i), &neighbor);
-                    }
-
-                    if(!Path_containsNode(ctx->path, &neighbor))
-                        _AllPathsCtx_AddNodeToLevel(ctx, depth, &neighbor);
+                    Graph_GetNode(ctx->g, neighborID, &neighbor);
+                    _AllPathsCtx_AddNodeToLevel(ctx, depth, &neighbor);
                 }
-                array_free(neighbors);
             }
 
             // See if we can return path.
-            if(depth >= ctx->minLen && depth <= ctx->maxLen) return Path_clone(ctx->path);
+            if(depth >= ctx->minLen && depth <= ctx->maxLen) return ctx->path;
 		} else {
             // No way to advance, backtrack.
-            Path_pop(ctx->path);
+            _AllPathsCtx_PopPath(ctx);
         }
 	}
     // Couldn't find a path.
@@ -98,6 +146,9 @@ void AllPathsCtx_Free(AllPathsCtx *ctx) {
     if(!ctx) return;
     uint32_t levelsCount = array_len(ctx->levels);
     for(int i = 0; i < levelsCount; i++) array_free(ctx->levels[i]);
+    array_free(ctx->levels);
+    array_free(ctx->neighbors);
+    rm_free(ctx->onPath);
     Path_free(ctx->path);
     rm_free(ctx);
     ctx = NULL;
@@ -13,6 +13,9 @@
  * 1. the last path computed, which we'll try to expand
  * 2. neighboring nodes discovered, each placed within a "level"
  * array containing all nodes discovered at a specific level.
+ * Nodes on the current path are marked within a bitmap,
+ * such that checking if a neighbor is already on the path
+ * doesn't depend on the path length.
  * */
 
 #ifndef _ALL_PATHS_H_
@@ -25,6 +28,9 @@
 typedef struct {
     Node **levels;          // Nodes reached at depth i.
     Path path;              // Current path.
+    uint64_t *onPath;       // Bitmap of nodes on current path.
+    size_t onPathWords;     // Number of words in onPath.
+    Edge *neighbors;        // Frontier neighbors, reused between expansions.
     Graph *g;               // Graph to traverse.
     int *relationIDs;       // edge type(s) to traverse.
     int relationCount;      // length of relationIDs.
@@ -44,8 +50,17 @@ AllPathsCtx* AllPathsCtx_New (
     unsigned int maxLen     // Path length must not exceed maxLen + 1 nodes.
 );
 
+// Restart traversal from a new source node,
+// reusing context's allocations.
+void AllPathsCtx_Reset (
+    AllPathsCtx *ctx,
+    Node *src               // Source node to traverse.
+);
+
 // Tries to produce a new path from given context
 // If no additional path can be computed return NULL.
+// Returned path is owned by the context and is only valid
+// until the next call, callers should clone it if needed.
 Path AllPathsCtx_NextPath (
     AllPathsCtx *ctx
 );
@@ -0,0 +1,159 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Redis Labs Source Available License Agreement
+*/
+
+#include "shortest_paths.h"
+#include "../util/rmalloc.h"
+
+// Counts the edges connecting each pair of nodes, per traversed relation.
+static void _ShortestPathsCtx_CountEdges(ShortestPathsCtx *ctx) {
+    GrB_Index n = Graph_RequiredMatrixDim(ctx->g);
+    for(int t = 0; t < 2; t++) {
+        ctx->edgeCounts[t] = rm_malloc(sizeof(GrB_Matrix) * ctx->relationCount);
+    }
+
+    for(int i = 0; i < ctx->relationCount; i++) {
+        GrB_Matrix C;
+        GrB_Matrix CT;
+        GrB_Matrix_new(&C, GrB_UINT64, n, n);
+        GrB_Matrix_new(&CT, GrB_UINT64, n, n);
+        Graph_CountRelationEdges(ctx->g, ctx->relationIDs[i], C);
+        GrB_transpose(CT, GrB_NULL, GrB_NULL, C, GrB_NULL);
+        ctx->edgeCounts[0][i] = C;
+        ctx->edgeCounts[1][i] = CT;
+    }
+}
+
+static void _ShortestPathsCtx_FreeEdgeCounts(ShortestPathsCtx *ctx) {
+    if(!ctx->edgeCounts[0]) return;
+    for(int t = 0; t < 2; t++) {
+        for(int i = 0; i < ctx->relationCount; i++) GrB_Matrix_free(ctx->edgeCounts[t] + i);
+        rm_free(ctx->edgeCounts[t]);
+        ctx->edgeCounts[t] = NULL;
+    }
+}
+
+// Matrix of the ith relation, transposed matrix is used to traverse relationships backward.
+static GrB_Matrix _ShortestPathsCtx_Matrix(ShortestPathsCtx *ctx, int i, bool transposed) {
+    int relation = ctx->relationIDs[i];
+    if(ctx->multiEdges) {
+        if(!ctx->edgeCounts[0]) _ShortestPathsCtx_CountEdges(ctx);
+        return ctx->edgeCounts[transposed][i];
+    }
+
+    if(transposed) return Graph_GetTransposedRelationMatrix(ctx->g, relation);
+    return Graph_GetRelationMatrix(ctx->g, relation);
+}
+
+static void _ShortestPathsCtx_Traverse(ShortestPathsCtx *ctx, int side, GrB_Matrix M) {
+    GrB_vxm(ctx->next, ctx->visited[side], GrB_PLUS_UINT64, GxB_PLUS_TIMES_UINT64,
+            ctx->frontier[side], M, ctx->desc);
+}
+
+/* Expands given side's frontier into next,
+ * each newly reached node counts the paths leading to it.
+ * Backward search goes against relationships,
+ * undirected search follows relationships both ways. */
+static void _ShortestPathsCtx_Expand(ShortestPathsCtx *ctx, int side) {
+    GrB_Vector_clear(ctx->next);
+    bool transposed = (side == 1) ^ (ctx->dir == GRAPH_EDGE_DIR_INCOMING);
+    for(int i = 0; i < ctx->relationCount; i++) {
+        _ShortestPathsCtx_Traverse(ctx, side, _ShortestPathsCtx_Matrix(ctx, i, transposed));
+        if(ctx->dir == GRAPH_EDGE_DIR_BOTH) {
+            _ShortestPathsCtx_Traverse(ctx, side, _ShortestPathsCtx_Matrix(ctx, i, !transposed));
+        }
+    }
+}
+
+ShortestPathsCtx* ShortestPathsCtx_New(const Graph *g, int *relationIDs, int relationCount,
+                                       GRAPH_EDGE_DIR dir, bool multiEdges,
+                                       unsigned int minHops, unsigned int maxHops) {
+    ShortestPathsCtx *ctx = rm_malloc(sizeof(ShortestPathsCtx));
+    ctx->g = g;
+    ctx->relationIDs = relationIDs;
+    ctx->relationCount = relationCount;
+    ctx->dir = dir;
+    ctx->multiEdges = multiEdges;
+    ctx->minHops = minHops;
+    ctx->maxHops = maxHops;
+    ctx->edgeCounts[0] = NULL;
+    ctx->edgeCounts[1] = NULL;
+
+    GrB_Index n = Graph_RequiredMatrixDim(g);
+    for(int side = 0; side < 2; side++) {
+        GrB_Vector_new(ctx->frontier + side, GrB_UINT64, n);
+        GrB_Vector_new(ctx->visited + side, GrB_BOOL, n);
+    }
+    GrB_Vector_new(&ctx->next, GrB_UINT64, n);
+    GrB_Vector_new(&ctx->meet, GrB_UINT64, n);
+    GrB_Descriptor_new(&ctx->desc);
+    GrB_Descriptor_set(ctx->desc, GrB_MASK, GrB_SCMP);
+
+    return ctx;
+}
+
+/* Once a side's new frontier intersects the other side's frontier,
+ * every shortest path passes through exactly one of the shared nodes. */
+uint64_t ShortestPathsCtx_Count(ShortestPathsCtx *ctx, NodeID src, NodeID dest) {
+    if(src == dest) return (ctx->minHops == 0) ? 1 : 0;
+    if(ctx->relationCount == 0) return 0;
+
+    NodeID ends[2] = {src, dest};
+    for(int side = 0; side < 2; side++) {
+        GrB_Vector_clear(ctx->frontier[side]);
+        GrB_Vector_clear(ctx->visited[side]);
+        GrB_Vector_setElement_UINT64(ctx->frontier[side], 1, ends[side]);
+        GrB_Vector_setElement_BOOL(ctx->visited[side], true, ends[side]);
+    }
+
+    uint64_t paths = 0;
+    GrB_Index nvals[2] = {1, 1};
+    for(unsigned int hops = 0; hops < ctx->maxHops; hops++) {
+        int side = (nvals[0] <= nvals[1]) ? 0 : 1;
+        _ShortestPathsCtx_Expand(ctx, side);
+
+        GrB_Vector_nvals(nvals + side, ctx->next);
+        if(nvals[side] == 0) break;
+
+        // Frontiers meet.
+        GrB_eWiseMult_Vector_BinaryOp(ctx->meet, NULL, NULL, GrB_TIMES_UINT64,
+                                      ctx->next, ctx->frontier[1 - side], NULL);
+        GrB_Vector_reduce_UINT64(&paths, NULL, GxB_PLUS_UINT64_MONOID, ctx->meet, NULL);
+        if(paths > 0) break;
+
+        GrB_eWiseAdd_Vector_BinaryOp(ctx->visited[side], NULL, NULL, GrB_LOR,
+                                     ctx->visited[side], ctx->next, NULL);
+        GrB_Vector t = ctx->frontier[side];
+        ctx->frontier[side] = ctx->next;
+        ctx->next = t;
+    }
+
+    return paths;
+}
+
+void ShortestPathsCtx_Rebind(ShortestPathsCtx *ctx) {
+    // Vectors must match the dimensions of graph's matrices.
+    GrB_Index n = Graph_RequiredMatrixDim(ctx->g);
+    for(int side = 0; side < 2; side++) {
+        GxB_Vector_resize(ctx->frontier[side], n);
+        GxB_Vector_resize(ctx->visited[side], n);
+    }
+    GxB_Vector_resize(ctx->next, n);
+    GxB_Vector_resize(ctx->meet, n);
+    _ShortestPathsCtx_FreeEdgeCounts(ctx);
+}
+
+void ShortestPathsCtx_Free(ShortestPathsCtx *ctx) {
+    if(!ctx) return;
+    _ShortestPathsCtx_FreeEdgeCounts(ctx);
+    for(int side = 0; side < 2; side++) {
+        GrB_Vector_free(ctx->frontier + side);
+        GrB_Vector_free(ctx->visited + side);
+    }
+    GrB_Vector_free(&ctx->next);
+    GrB_Vector_free(&ctx->meet);
+    GrB_Descriptor_free(&ctx->desc);
+    rm_free(ctx);
+}
@@ -0,0 +1,67 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Redis Labs Source Available License Agreement
+*/
+
+/*
+ * Counts the shortest paths connecting a source node to a destination node.
+ * Search is level synchronous and bidirectional, the smaller frontier
+ * is expanded at each level, forward over the relation matrices and
+ * backward over their transposes, until frontiers meet.
+ * Undirected searches expand over both matrices on either side,
+ * relationships of opposite directions are distinct paths.
+ * Each frontier counts the shortest paths reaching its nodes,
+ * when counting multi edges parallel relationships of the same type
+ * are distinct paths, otherwise they are counted once.
+ * */
+
+#ifndef _SHORTEST_PATHS_H_
+#define _SHORTEST_PATHS_H_
+
+#include "../graph/graph.h"
+#include "../../deps/GraphBLAS/Include/GraphBLAS.h"
+
+typedef struct {
+    const Graph *g;             // Graph to traverse.
+    int *relationIDs;           // Edge type(s) to traverse.
+    int relationCount;          // Length of relationIDs.
+    GRAPH_EDGE_DIR dir;         // Traverse direction.
+    bool multiEdges;            // Parallel relationships are distinct paths.
+    unsigned int minHops;       // Minimum number of hops, either 0 or 1.
+    unsigned int maxHops;       // Maximum number of hops.
+    GrB_Vector frontier[2];     // Forward and backward frontiers, path counts.
+    GrB_Vector visited[2];      // Nodes reached by each side.
+    GrB_Vector next;            // Expanded frontier.
+    GrB_Vector meet;            // Paths through nodes reached by both sides.
+    GrB_Descriptor desc;        // Complemented mask.
+    GrB_Matrix *edgeCounts[2];  // Multi edges per relation and transposed, NULL until required.
+} ShortestPathsCtx;
+
+// Create a new shortest paths context object.
+ShortestPathsCtx* ShortestPathsCtx_New (
+    const Graph *g,         // Graph to traverse.
+    int *relationIDs,       // Edge type(s) on which we'll traverse.
+    int relationCount,      // Length of relationIDs.
+    GRAPH_EDGE_DIR dir,     // Traversal direction.
+    bool multiEdges,        // Count parallel relationships as distinct paths.
+    unsigned int minHops,   // Path minimum length, either 0 or 1.
+    unsigned int maxHops    // Path maximum length.
+);
+
+// Counts the shortest paths from src to dest,
+// 0 if there are none within maxHops.
+uint64_t ShortestPathsCtx_Count (
+    ShortestPathsCtx *ctx,
+    NodeID src,             // Path start.
+    NodeID dest             // Path end.
+);
+
+// Graph changed, match graph's dimensions
+// and drop edge counts gathered so far.
+void ShortestPathsCtx_Rebind(ShortestPathsCtx *ctx);
+
+// Free context object.
+void ShortestPathsCtx_Free(ShortestPathsCtx *ctx);
+
+#endif
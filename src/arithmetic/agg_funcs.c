@@ -49,12 +49,20 @@ int __agg_sumReduceNext(AggCtx *ctx) {
     return AGG_OK;
 }
 
+int __agg_sumMerge(AggCtx *ctx, AggCtx *other) {
+    __agg_sumCtx *ac = Agg_FuncCtx(ctx);
+    __agg_sumCtx *oc = other->fctx;
+    ac->num += oc->num;
+    ac->total += oc->total;
+    return AGG_OK;
+}
+
 AggCtx* Agg_SumFunc() {
     __agg_sumCtx *ac = malloc(sizeof(__agg_sumCtx));
     ac->num = 0;
     ac->total = 0;
     
-    return Agg_Reduce(ac, __agg_sumStep, __agg_sumReduceNext);
+    return Agg_SetMerge(Agg_Reduce(ac, __agg_sumStep, __agg_sumReduceNext), __agg_sumMerge);
 }
 
 //------------------------------------------------------------------------
@@ -99,12 +107,20 @@ int __agg_avgReduceNext(AggCtx *ctx) {
     return AGG_OK;
 }
 
+int __agg_avgMerge(AggCtx *ctx, AggCtx *other) {
+    __agg_avgCtx *ac = Agg_FuncCtx(ctx);
+    __agg_avgCtx *oc = other->fctx;
+    ac->count += oc->count;
+    ac->total += oc->total;
+    return AGG_OK;
+}
+
 AggCtx* Agg_AvgFunc() {
     __agg_avgCtx *ac = malloc(sizeof(__agg_avgCtx));
     ac->count = 0;
     ac->total = 0;
     
-    return Agg_Reduce(ac, __agg_avgStep, __agg_avgReduceNext);
+    return Agg_SetMerge(Agg_Reduce(ac, __agg_avgStep, __agg_avgReduceNext), __agg_avgMerge);
 }
 
 //------------------------------------------------------------------------
@@ -140,12 +156,24 @@ int __agg_maxReduceNext(AggCtx *ctx) {
     return AGG_OK;
 }
 
+int __agg_maxMerge(AggCtx *ctx, AggCtx *other) {
+    __agg_maxCtx *ac = Agg_FuncCtx(ctx);
+    __agg_maxCtx *oc = other->fctx;
+    if(!oc->init) return AGG_OK;
+
+    if(!ac->init || SIValue_Order(ac->max, oc->max) < 0) {
+        ac->init = true;
+        ac->max = oc->max;
+    }
+    return AGG_OK;
+}
+
 AggCtx* Agg_MaxFunc() {
     __agg_maxCtx *ac = malloc(sizeof(__agg_maxCtx));
     // ac->max = SI_DoubleVal(DBL_MIN);
     ac->init = false;
     
-    return Agg_Reduce(ac, __agg_maxStep, __agg_maxReduceNext);
+    return Agg_SetMerge(Agg_Reduce(ac, __agg_maxStep, __agg_maxReduceNext), __agg_maxMerge);
 }
 
 //------------------------------------------------------------------------
@@ -181,12 +209,24 @@ int __agg_minReduceNext(AggCtx *ctx) {
     return AGG_OK;
 }
 
+int __agg_minMerge(AggCtx *ctx, AggCtx *other) {
+    __agg_minCtx *ac = Agg_FuncCtx(ctx);
+    __agg_minCtx *oc = other->fctx;
+    if(!oc->init) return AGG_OK;
+
+    if(!ac->init || SIValue_Order(ac->min, oc->min) > 0) {
+        ac->init = true;
+        ac->min = oc->min;
+    }
+    return AGG_OK;
+}
+
 AggCtx* Agg_MinFunc() {
     __agg_minCtx *ac = malloc(sizeof(__agg_minCtx));
     // ac->min = SI_DoubleVal(DBL_MAX);
     ac->init = false;
     
-    return Agg_Reduce(ac, __agg_minStep, __agg_minReduceNext);
+    return Agg_SetMerge(Agg_Reduce(ac, __agg_minStep, __agg_minReduceNext), __agg_minMerge);
 }
 
 //------------------------------------------------------------------------
@@ -210,11 +250,18 @@ int __agg_countReduceNext(AggCtx *ctx) {
     return AGG_OK;
 }
 
+int __agg_countMerge(AggCtx *ctx, AggCtx *other) {
+    __agg_countCtx *ac = Agg_FuncCtx(ctx);
+    __agg_countCtx *oc = other->fctx;
+    ac->count += oc->count;
+    return AGG_OK;
+}
+
 AggCtx* Agg_CountFunc() {
     __agg_countCtx *ac = malloc(sizeof(__agg_countCtx));
     ac->count = 0;
     
-    return Agg_Reduce(ac, __agg_countStep, __agg_countReduceNext);
+    return Agg_SetMerge(Agg_Reduce(ac, __agg_countStep, __agg_countReduceNext), __agg_countMerge);
 }
 
 //------------------------------------------------------------------------
@@ -397,6 +444,26 @@ int __agg_StdevReduceNext(AggCtx *ctx) {
     return AGG_OK;
 }
 
+int __agg_StdevMerge(AggCtx *ctx, AggCtx *other) {
+    __agg_stdevCtx *ac = Agg_FuncCtx(ctx);
+    __agg_stdevCtx *oc = other->fctx;
+
+    if (ac->count + oc->count > ac->values_allocated) {
+        ac->values_allocated = ac->count + oc->count;
+        ac->values = realloc(ac->values, sizeof(double) * ac->values_allocated);
+    }
+
+    memcpy(ac->values + ac->count, oc->values, sizeof(double) * oc->count);
+    ac->count += oc->count;
+    ac->total += oc->total;
+
+    // Other's values are no longer needed.
+    free(oc->values);
+    oc->values = NULL;
+    oc->count = 0;
+    return AGG_OK;
+}
+
 AggCtx* Agg_StdevFunc() {
     __agg_stdevCtx *ac = malloc(sizeof(__agg_stdevCtx));
     ac->is_sampled = 1;
@@ -404,7 +471,7 @@ AggCtx* Agg_StdevFunc() {
     ac->total = 0;
     ac->values = malloc(1024 * sizeof(double));
     ac->values_allocated = 1024;
-    return Agg_Reduce(ac, __agg_StdevStep, __agg_StdevReduceNext);
+    return Agg_SetMerge(Agg_Reduce(ac, __agg_StdevStep, __agg_StdevReduceNext), __agg_StdevMerge);
 }
 
 // StdevP is identical to Stdev save for an altered value we can check for with a bool
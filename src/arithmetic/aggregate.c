@@ -5,6 +5,7 @@
 */
 
 #include "aggregate.h"
+#include <assert.h>
 
 AggCtx *Agg_Reduce(void *ctx, StepFunc f, ReduceFunc reduce) {
   AggCtx *ac = Agg_NewCtx(ctx);
@@ -20,9 +21,15 @@ AggCtx *Agg_NewCtx(void *fctx) {
     ac->result = SI_NullVal();
     ac->Step = NULL;
     ac->ReduceNext = NULL;
+    ac->Merge = NULL;
     return ac;
 }
 
+AggCtx *Agg_SetMerge(AggCtx *ctx, MergeFunc merge) {
+  ctx->Merge = merge;
+  return ctx;
+}
+
 void AggCtx_Free(AggCtx *ctx) {
   free(ctx->fctx);
   SIValue_Free(&ctx->result);
@@ -42,6 +49,16 @@ int Agg_Finalize(AggCtx *ctx) {
   return ctx->ReduceNext(ctx);
 }
 
+int Agg_Merge(AggCtx *ctx, AggCtx *other) {
+  assert(ctx->Merge == other->Merge);
+  if(other->err) return Agg_SetError(ctx, other->err);
+  return ctx->Merge(ctx, other);
+}
+
+bool Agg_Mergeable(const AggCtx *ctx) {
+  return ctx->Merge != NULL;
+}
+
 inline void *Agg_FuncCtx(AggCtx *ctx) { return ctx->fctx; }
 
 inline void Agg_SetResult(struct AggCtx *ctx, SIValue v) {
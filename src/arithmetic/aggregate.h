@@ -8,6 +8,7 @@
 #define __SI_AGREGATE_H__
 
 #include <stdlib.h>
+#include <stdbool.h>
 
 #include "agg_ctx.h"
 #include "../value.h"
@@ -24,9 +25,12 @@
 
 typedef int (*StepFunc)(AggCtx *ctx, SIValue *argv, int argc);
 typedef int (*ReduceFunc)(AggCtx *ctx);
+typedef int (*MergeFunc)(AggCtx *ctx, AggCtx *other);
 
 AggCtx *Agg_Reduce(void *ctx, StepFunc f, ReduceFunc reduce);
 AggCtx *Agg_NewCtx(void *fctx);
+/* Sets the function combining partial states of two contexts. */
+AggCtx *Agg_SetMerge(AggCtx *ctx, MergeFunc merge);
 void AggCtx_Free(AggCtx *ctx);
 int Agg_SetError(AggCtx *ctx, AggError *err);
 void *Agg_FuncCtx(AggCtx *ctx);
@@ -34,5 +38,10 @@ void Agg_SetResult(AggCtx *ctx, SIValue v);
 
 int Agg_Step(AggCtx *ctx, SIValue *argv, int argc);
 int Agg_Finalize(AggCtx *ctx);
+/* Folds other's partial state into ctx, both must be of the same function,
+ * other is left drained and should only be freed afterwards. */
+int Agg_Merge(AggCtx *ctx, AggCtx *other);
+/* Returns true if partial states of ctx can be combined. */
+bool Agg_Mergeable(const AggCtx *ctx);
 
 #endif
@@ -8,6 +8,7 @@
 #include "../util/arr.h"
 #include "../util/rmalloc.h"
 #include <assert.h>
+#include <pthread.h>
 
 AlgebraicExpression *_AE_MUL(size_t operand_cap) {
     AlgebraicExpression *ae = malloc(sizeof(AlgebraicExpression));
@@ -17,6 +18,8 @@ AlgebraicExpression *_AE_MUL(size_t operand_cap) {
     ae->operands = malloc(sizeof(AlgebraicExpressionOperand) * ae->operand_cap);
     ae->edge = NULL;
     ae->edgeLength = NULL;
+    ae->products = NULL;
+    ae->masks = NULL;
     return ae;
 }
 
@@ -87,6 +90,18 @@ void _referred_variable_length_edges(TrieMap *ref_entities, Vector *matchPattern
     }
 }
 
+// Prepend operand as the first term in the expression ae.
+static void _AlgebraicExpression_PrependOperand(AlgebraicExpression *ae, const AlgebraicExpressionOperand *op) {
+    AlgebraicExpression_PrependTerm(ae, op->operand, op->transpose, op->free);
+    ae->operands[0].diagonal = op->diagonal;
+}
+
+// Appends label matrix L as the last term in the expression ae.
+static void _AlgebraicExpression_AppendLabel(AlgebraicExpression *ae, GrB_Matrix L) {
+    AlgebraicExpression_AppendTerm(ae, L, false, false);
+    ae->operands[ae->operand_count-1].diagonal = true;
+}
+
 /* Variable length expression must contain only a single operand, the edge being 
  * traversed multiple times, in cases such as (:labelA)-[e*]->(:labelB) both label A and B
  * are applied via a label matrix operand, this function migrates A and B from a
@@ -124,7 +139,7 @@ AlgebraicExpression** _AlgebraicExpression_IsolateVariableLenExps(AlgebraicExpre
             AlgebraicExpression *newExp = _AE_MUL(1);
             newExp->src_node = exp->src_node;
             newExp->dest_node = exp->src_node;
-            AlgebraicExpression_PrependTerm(newExp, op.operand, op.transpose, op.free);
+            _AlgebraicExpression_PrependOperand(newExp, &op);
             res[newExpCount++] = newExp;
         }
 
@@ -139,12 +154,12 @@ AlgebraicExpression** _AlgebraicExpression_IsolateVariableLenExps(AlgebraicExpre
             /* See if dest mat can be prepended to the following expression.
              * If not create a new expression. */            
             if(expIdx < *expCount-1 && !expressions[expIdx+1]->edgeLength) {
-                AlgebraicExpression_PrependTerm(expressions[expIdx+1], op.operand, op.transpose, op.free);
+                _AlgebraicExpression_PrependOperand(expressions[expIdx+1], &op);
             } else {
                 AlgebraicExpression *newExp = _AE_MUL(1);
                 newExp->src_node = exp->dest_node;
                 newExp->dest_node = exp->dest_node;
-                AlgebraicExpression_PrependTerm(newExp, op.operand, op.transpose, op.free);
+                _AlgebraicExpression_PrependOperand(newExp, &op);
                 res[newExpCount++] = newExp;
             }
         }
@@ -174,6 +189,7 @@ AlgebraicExpression **_AlgebraicExpression_Intermidate_Expressions(AlgebraicExpr
     WhereClause_ReferredEntities(ast->whereNode, ref_entities);
     DeleteClause_ReferredEntities(ast->deleteNode, ref_entities);    
     SetClause_ReferredEntities(ast->setNode, ref_entities);
+    MatchClause_ReferredEntities(ast->matchNode, ref_entities);
     _referred_edge_ends(ref_entities, q);
     _referred_variable_length_edges(ref_entities, matchPattern, q);
 
@@ -263,6 +279,90 @@ static inline void _AlgebraicExpression_Execute_MUL(GrB_Matrix C, GrB_Matrix A,
     assert(res == GrB_SUCCESS);
 }
 
+/* Select operators retaining entries A(i,j) where node j (columns)
+ * or node i (rows) is labeled, k is the label's bitmap. */
+static bool _select_labeled_columns(GrB_Index i, GrB_Index j, GrB_Index nrows, GrB_Index ncols,
+                                    const void *x, const void *k) {
+    const uint64_t *mask = (const uint64_t*)k;
+    return (mask[j / 64] >> (j % 64)) & 1;
+}
+
+static bool _select_labeled_rows(GrB_Index i, GrB_Index j, GrB_Index nrows, GrB_Index ncols,
+                                 const void *x, const void *k) {
+    const uint64_t *mask = (const uint64_t*)k;
+    return (mask[i / 64] >> (i % 64)) & 1;
+}
+
+static GxB_SelectOp _label_columns_op = NULL;
+static GxB_SelectOp _label_rows_op = NULL;
+static pthread_once_t _label_select_ops_once = PTHREAD_ONCE_INIT;
+
+static void _AlgebraicExpression_InitLabelSelectOps(void) {
+    // Type generic, entries values are never read.
+    GxB_SelectOp_new(&_label_columns_op, _select_labeled_columns, GrB_NULL);
+    GxB_SelectOp_new(&_label_rows_op, _select_labeled_rows, GrB_NULL);
+}
+
+/* Returns a bitmap of the nodes labeled by L, built once by scanning
+ * L's diagonal and rebuilt only if L's number of entries changed. */
+static const uint64_t *_AlgebraicExpression_LabelMask(AlgebraicExpression *ae, GrB_Matrix L, GrB_Index nvals) {
+    AlgebraicExpressionLabelMask *cached = NULL;
+    uint mask_count = (ae->masks) ? array_len(ae->masks) : 0;
+    for(uint i = 0; i < mask_count; i++) {
+        if(ae->masks[i].label == L) {
+            cached = ae->masks + i;
+            break;
+        }
+    }
+    if(cached && cached->nvals == nvals) return cached->mask;
+
+    if(!cached) {
+        AlgebraicExpressionLabelMask m = {.label = L, .nvals = 0, .mask = NULL};
+        if(!ae->masks) ae->masks = array_new(AlgebraicExpressionLabelMask, 1);
+        ae->masks = array_append(ae->masks, m);
+        cached = ae->masks + mask_count;
+    }
+
+    GrB_Index n;
+    GrB_Matrix_nrows(&n, L);
+    size_t words = (n + 63) / 64;
+    rm_free(cached->mask);
+    cached->mask = rm_calloc(words, sizeof(uint64_t));
+    cached->nvals = nvals;
+
+    bool depleted = false;
+    GrB_Index id;
+    GxB_MatrixTupleIter *iter;
+    GxB_MatrixTupleIter_new(&iter, L);
+    while(true) {
+        GxB_MatrixTupleIter_next(iter, &id, NULL, &depleted);
+        if(depleted) break;
+        cached->mask[id / 64] |= ((uint64_t)1 << (id % 64));
+    }
+    GxB_MatrixTupleIter_free(iter);
+
+    return cached->mask;
+}
+
+/* C = A * L or C = L * A where L is a diagonal label matrix,
+ * rather than multiplying, A's columns (rows) are masked by
+ * L's diagonal, retaining labeled nodes. */
+static inline void _AlgebraicExpression_Execute_LABEL(AlgebraicExpression *ae, GrB_Matrix C, GrB_Matrix A, GrB_Matrix L, bool rows) {
+    pthread_once(&_label_select_ops_once, _AlgebraicExpression_InitLabelSelectOps);
+
+    GrB_Index nvals;
+    GrB_Matrix_nvals(&nvals, L);
+    if(nvals == 0) {
+        GrB_Matrix_clear(C);
+        return;
+    }
+
+    const uint64_t *mask = _AlgebraicExpression_LabelMask(ae, L, nvals);
+    GxB_SelectOp op = (rows) ? _label_rows_op : _label_columns_op;
+    GrB_Info res = GxB_select(C, GrB_NULL, GrB_NULL, op, A, mask, GrB_NULL);
+    assert(res == GrB_SUCCESS);
+}
+
 // Reverse order of operand within expression,
 // A*B*C will become C*B*A. 
 void _AlgebraicExpression_ReverseOperandOrder(AlgebraicExpression *exp) {
@@ -286,6 +386,7 @@ void AlgebraicExpression_AppendTerm(AlgebraicExpression *ae, GrB_Matrix m, bool
 
     ae->operands[ae->operand_count].transpose = transposeOp;
     ae->operands[ae->operand_count].free = freeOp;
+    ae->operands[ae->operand_count].diagonal = false;
     ae->operands[ae->operand_count].operand = m;
     ae->operand_count++;
 }
@@ -307,6 +408,7 @@ void AlgebraicExpression_PrependTerm(AlgebraicExpression *ae, GrB_Matrix m, bool
 
     ae->operands[0].transpose = transposeOp;
     ae->operands[0].free = freeOp;
+    ae->operands[0].diagonal = false;
     ae->operands[0].operand = m;
 }
 
@@ -344,7 +446,7 @@ AlgebraicExpression **AlgebraicExpression_From_Query(const AST *ast, Vector *mat
             exp->src_node = src;
             if(src->label) {
                 GrB_Matrix srcMat = Node_GetMatrix(src);
-                AlgebraicExpression_AppendTerm(exp, srcMat, false, false);
+                _AlgebraicExpression_AppendLabel(exp, srcMat);
             }
         }
 
@@ -381,7 +483,7 @@ AlgebraicExpression **AlgebraicExpression_From_Query(const AST *ast, Vector *mat
 
         if(dest->label) {
             GrB_Matrix destMat = Node_GetMatrix(dest);
-            AlgebraicExpression_AppendTerm(exp, destMat, false, false);
+            _AlgebraicExpression_AppendLabel(exp, destMat);
         }
     }
 
@@ -396,68 +498,246 @@ AlgebraicExpression **AlgebraicExpression_From_Query(const AST *ast, Vector *mat
     return expressions;
 }
 
-/* Evaluates an algebraic expression,
- * evaluation is done right to left due to matrix CSC representation 
- * the right most operand in the expression is a tiny extremely sparse matrix
- * this allows us to avoid computing multiplications of large matrices.
- * In the case an operand is marked for transpose, we will perform
- * the transpose once and update the expression. */
-void AlgebraicExpression_Execute(AlgebraicExpression *ae, GrB_Matrix res) {
-    assert(ae && res);
-    size_t operand_count = ae->operand_count;
-    assert(operand_count > 1);
+static inline void _AlgebraicExpression_OperandDims(const AlgebraicExpressionOperand *op, GrB_Index *rows, GrB_Index *cols) {
+    GrB_Matrix_nrows(rows, op->operand);
+    GrB_Matrix_ncols(cols, op->operand);
+    if(op->transpose) {
+        GrB_Index t = *rows;
+        *rows = *cols;
+        *cols = t;
+    }
+}
 
-    AlgebraicExpressionOperand leftTerm;
-    AlgebraicExpressionOperand rightTerm;
-    // Operate on a clone of the expression.
-    AlgebraicExpressionOperand operands[operand_count];
-    memcpy(operands, ae->operands, sizeof(AlgebraicExpressionOperand) * operand_count);
-
-    /* Multiply left to right
-     * A*B*C*D
-     * X = A*B
-     * Y = X*C
-     * Z = Y*D */
-    for (int i = 1; i < operand_count; i++)
+// Returns the graph's transposed matrix of m, NULL if m isn't a relation matrix.
+static GrB_Matrix _AlgebraicExpression_GraphTranspose(GrB_Matrix m) {
+    Graph *g = GraphContext_GetFromTLS()->g;
+    if(m == Graph_GetZeroMatrix(g)) return m;
+    if(m == Graph_GetAdjacencyMatrix(g)) return Graph_GetTransposedRelationMatrix(g, GRAPH_NO_RELATION);
+
+    int relation_count = Graph_RelationTypeCount(g);
+    for(int i = 0; i < relation_count; i++) {
+        if(Graph_GetRelationMatrix(g, i) == m) return Graph_GetTransposedRelationMatrix(g, i);
+    }
+    return NULL;
+}
+
+/* Returns operand at position idx, in the case operand is marked for transpose
+ * transpose is performed once and the expression is updated. */
+static GrB_Matrix _AlgebraicExpression_Operand(AlgebraicExpression *ae, int idx) {
+    AlgebraicExpressionOperand *op = ae->operands + idx;
+    if(!op->transpose) return op->operand;
+
+    // Label matrices are diagonal, their own transpose.
+    if(op->diagonal) {
+        op->transpose = false;
+        return op->operand;
+    }
+
+    GrB_Matrix t = op->operand;
+    /* Graph matrices are immutable, reference the graph's
+     * transposed matrix, otherwise create a new matrix and transpose. */
+    if (!op->free)
     {
-        // Multiply and reduce.
-        leftTerm = operands[i-1];
-        rightTerm = operands[i];
-        
+        t = _AlgebraicExpression_GraphTranspose(op->operand);
+        if(t) {
+            op->operand = t;
+            op->transpose = false;
+            return t;
+        }
 
-        /* Incase we're required to transpose right hand side operand 
-         * perform transpose once and update original expression. */
-        if (rightTerm.transpose)
-        {
-            GrB_Matrix t = rightTerm.operand;
-            /* Graph matrices are immutable, create a new matrix. 
-             * and transpose. */
-            if (!rightTerm.free)
-            {
-                GrB_Index cols;
-                GrB_Matrix_ncols(&cols, rightTerm.operand);
-                GrB_Matrix_new(&t, GrB_BOOL, cols, cols);
+        GrB_Index cols;
+        GrB_Matrix_ncols(&cols, op->operand);
+        GrB_Matrix_new(&t, GrB_BOOL, cols, cols);
+    }
+    GrB_transpose(t, GrB_NULL, GrB_NULL, op->operand, GrB_NULL);
+
+    op->free = true;
+    op->operand = t;
+    op->transpose = false;
+    return t;
+}
+
+// Returns the cached product of operands [i..j], NULL if missing.
+static GrB_Matrix _AlgebraicExpression_GetProduct(const AlgebraicExpression *ae, int i, int j) {
+    if(!ae->products) return NULL;
+    // Operands pending transpose aren't final.
+    for(int k = i; k <= j; k++) if(ae->operands[k].transpose) return NULL;
+
+    uint product_count = array_len(ae->products);
+    for(uint p = 0; p < product_count; p++) {
+        AlgebraicExpressionProduct *product = ae->products + p;
+        if(array_len(product->operands) != j - i + 1) continue;
+        int k = i;
+        while(k <= j && product->operands[k-i] == ae->operands[k].operand) k++;
+        if(k > j) return product->product;
+    }
+    return NULL;
+}
+
+/* Estimated number of entries in and work required for the product
+ * of operands spanning l entries and r entries respectively,
+ * n being the dimension shared by the two. */
+static inline void _AlgebraicExpression_EstimateMul(double l, bool ldiagonal, double r, bool rdiagonal,
+                                                    double n, double rows, double cols,
+                                                    double *nnz, double *work) {
+    if(n < 1) n = 1;
+    if(rdiagonal) {
+        // Column selection, retaining the fraction of labeled nodes.
+        *work = l;
+        *nnz = l * (r / n);
+    } else if(ldiagonal) {
+        // Row selection.
+        *work = r;
+        *nnz = r * (l / n);
+    } else {
+        // Each entry in the left operand expands to an average row of the right.
+        *work = l + l * (r / n);
+        *nnz = l * (r / n);
+        if(*nnz > rows * cols) *nnz = rows * cols;
+    }
+}
+
+/* Computes the cheapest order of multiplication using dynamic programming,
+ * split[i*n+j] is set to the position k at which the product of operands
+ * [i..j] is parenthesized as [i..k] * [k+1..j].
+ * Products already cached cost nothing. */
+static void _AlgebraicExpression_OrderChain(const AlgebraicExpression *ae, int *split) {
+    int n = ae->operand_count;
+    double cost[n*n];
+    double nnz[n*n];
+    GrB_Index rows[n];
+    GrB_Index cols[n];
+
+    for(int i = 0; i < n; i++) {
+        GrB_Index nvals;
+        GrB_Matrix_nvals(&nvals, ae->operands[i].operand);
+        _AlgebraicExpression_OperandDims(ae->operands + i, rows + i, cols + i);
+        cost[i*n+i] = 0;
+        nnz[i*n+i] = nvals;
+        split[i*n+i] = i;
+    }
+
+    for(int len = 2; len <= n; len++) {
+        for(int i = 0; i + len <= n; i++) {
+            int j = i + len - 1;
+            GrB_Matrix cached = _AlgebraicExpression_GetProduct(ae, i, j);
+            cost[i*n+j] = -1;
+            for(int k = i; k < j; k++) {
+                double mul_nnz;
+                double mul_work;
+                _AlgebraicExpression_EstimateMul(nnz[i*n+k], (k == i && ae->operands[i].diagonal),
+                                                 nnz[(k+1)*n+j], (k+1 == j && ae->operands[j].diagonal),
+                                                 cols[k], rows[i], cols[j], &mul_nnz, &mul_work);
+                double c = cost[i*n+k] + cost[(k+1)*n+j] + mul_work;
+                // Prefer left to right evaluation on ties.
+                if(cost[i*n+j] < 0 || c < cost[i*n+j]) {
+                    cost[i*n+j] = c;
+                    nnz[i*n+j] = mul_nnz;
+                    split[i*n+j] = k;
+                }
+            }
+            if(cached) {
+                GrB_Index nvals;
+                GrB_Matrix_nvals(&nvals, cached);
+                cost[i*n+j] = 0;
+                nnz[i*n+j] = nvals;
             }
-            GrB_transpose(t, GrB_NULL, GrB_NULL, rightTerm.operand, GrB_NULL);
-
-            // Update local and original expressions.
-            rightTerm.free = true;
-            rightTerm.operand = t;
-            rightTerm.transpose = false;
-            ae->operands[i].free = rightTerm.free;
-            ae->operands[i].operand = rightTerm.operand;
-            ae->operands[i].transpose = rightTerm.transpose;
         }
-        _AlgebraicExpression_Execute_MUL(res, leftTerm.operand, rightTerm.operand, GrB_NULL);
+    }
+}
 
-        // Quick return if C is ZERO, there's no way to make progress.
-        GrB_Index nvals = 0;
-        GrB_Matrix_nvals(&nvals, res);
-        if(nvals == 0) break;
+static GrB_Matrix _AlgebraicExpression_Product(AlgebraicExpression *ae, const int *split, int i, int j);
+
+/* Computes the product of operands [i..j] into C,
+ * the left operand of each multiplication is accumulated in C,
+ * right operands are computed separately, cached when cache is set.
+ * Returns false if the product is empty. */
+static bool _AlgebraicExpression_Chain(AlgebraicExpression *ae, const int *split, int i, int j,
+                                       GrB_Matrix C, bool cache) {
+    int n = ae->operand_count;
+    int k = split[i*n+j];
+
+    GrB_Matrix left = _AlgebraicExpression_Operand(ae, i);
+    bool ldiagonal = (k == i && ae->operands[i].diagonal);
+    if(k > i && !_AlgebraicExpression_Chain(ae, split, i, k, C, cache)) return false;
+    if(k > i) left = C;
+
+    // Quick return if left is ZERO, there's no way to make progress.
+    GrB_Index nvals = 0;
+    GrB_Matrix_nvals(&nvals, left);
+    if(nvals == 0) {
+        GrB_Matrix_clear(C);
+        return false;
+    }
 
-        // Assign result and update operands count.
-        operands[i].operand = res;
+    GrB_Matrix tmp = NULL;
+    GrB_Matrix right = NULL;
+    bool rdiagonal = (k+1 == j && ae->operands[j].diagonal);
+    if(k+1 == j) {
+        right = _AlgebraicExpression_Operand(ae, j);
+    } else if(cache) {
+        right = _AlgebraicExpression_Product(ae, split, k+1, j);
+    } else {
+        GrB_Index rows;
+        GrB_Index cols;
+        GrB_Index ignored;
+        _AlgebraicExpression_OperandDims(ae->operands + k+1, &rows, &ignored);
+        _AlgebraicExpression_OperandDims(ae->operands + j, &ignored, &cols);
+        GrB_Matrix_new(&tmp, GrB_BOOL, rows, cols);
+        _AlgebraicExpression_Chain(ae, split, k+1, j, tmp, false);
+        right = tmp;
     }
+
+    if(rdiagonal) _AlgebraicExpression_Execute_LABEL(ae, C, left, right, false);
+    else if(ldiagonal) _AlgebraicExpression_Execute_LABEL(ae, C, right, left, true);
+    else _AlgebraicExpression_Execute_MUL(C, left, right, GrB_NULL);
+
+    if(tmp) GrB_Matrix_free(&tmp);
+
+    GrB_Matrix_nvals(&nvals, C);
+    return (nvals > 0);
+}
+
+/* Returns the product of operands [i..j], computing and caching it if missing,
+ * cached products are reused by later evaluations. */
+static GrB_Matrix _AlgebraicExpression_Product(AlgebraicExpression *ae, const int *split, int i, int j) {
+    GrB_Matrix product = _AlgebraicExpression_GetProduct(ae, i, j);
+    if(product) return product;
+
+    GrB_Index rows;
+    GrB_Index cols;
+    GrB_Index ignored;
+    _AlgebraicExpression_OperandDims(ae->operands + i, &rows, &ignored);
+    _AlgebraicExpression_OperandDims(ae->operands + j, &ignored, &cols);
+    GrB_Matrix_new(&product, GrB_BOOL, rows, cols);
+    _AlgebraicExpression_Chain(ae, split, i, j, product, false);
+
+    // Operands are final once the product has been computed.
+    AlgebraicExpressionProduct cached;
+    cached.product = product;
+    cached.operands = array_new(GrB_Matrix, j - i + 1);
+    for(int k = i; k <= j; k++) cached.operands = array_append(cached.operands, ae->operands[k].operand);
+    if(!ae->products) ae->products = array_new(AlgebraicExpressionProduct, 1);
+    ae->products = array_append(ae->products, cached);
+    return product;
+}
+
+/* Evaluates an algebraic expression,
+ * the left most operand in the expression is a tiny extremely sparse matrix
+ * which changes between evaluations, while the remaining operands don't.
+ * Multiplications are ordered by their estimated cost, usually left to right
+ * avoiding multiplications of large matrices, products which don't involve
+ * the left most operand are cached and reused by later evaluations.
+ * In the case an operand is marked for transpose, we will perform
+ * the transpose once and update the expression. */
+void AlgebraicExpression_Execute(AlgebraicExpression *ae, GrB_Matrix res) {
+    assert(ae && res);
+    int operand_count = ae->operand_count;
+    assert(operand_count > 1);
+
+    int split[operand_count * operand_count];
+    _AlgebraicExpression_OrderChain(ae, split);
+    _AlgebraicExpression_Chain(ae, split, 0, operand_count-1, res, true);
 }
 
 void AlgebraicExpression_RemoveTerm(AlgebraicExpression *ae, int idx, AlgebraicExpressionOperand *operand) {
@@ -472,6 +752,37 @@ void AlgebraicExpression_RemoveTerm(AlgebraicExpression *ae, int idx, AlgebraicE
     ae->operand_count--;
 }
 
+// Frees cached products and label masks.
+static void _AlgebraicExpression_FreeCaches(AlgebraicExpression *ae) {
+    if(ae->products) {
+        uint product_count = array_len(ae->products);
+        for(uint i = 0; i < product_count; i++) {
+            GrB_Matrix_free(&ae->products[i].product);
+            array_free(ae->products[i].operands);
+        }
+        array_free(ae->products);
+        ae->products = NULL;
+    }
+
+    if(ae->masks) {
+        uint mask_count = array_len(ae->masks);
+        for(uint i = 0; i < mask_count; i++) rm_free(ae->masks[i].mask);
+        array_free(ae->masks);
+        ae->masks = NULL;
+    }
+}
+
+bool AlgebraicExpression_Rebind(AlgebraicExpression *ae, const Graph *g) {
+    // Operands owned by the expression, e.g. A+B for [:A|:B], were computed from data.
+    for(int i = 0; i < ae->operand_count; i++) {
+        if(ae->operands[i].free) return false;
+    }
+
+    _AlgebraicExpression_FreeCaches(ae);
+    for(int i = 0; i < ae->operand_count; i++) Graph_SynchronizeMatrix(g, ae->operands[i].operand);
+    return true;
+}
+
 void AlgebraicExpression_Free(AlgebraicExpression* ae) {
     for(int i = 0; i < ae->operand_count; i++) {
         if(ae->operands[i].free) {
@@ -479,6 +790,7 @@ void AlgebraicExpression_Free(AlgebraicExpression* ae) {
         }
     }
 
+    _AlgebraicExpression_FreeCaches(ae);
     free(ae->operands);
     free(ae);
 }
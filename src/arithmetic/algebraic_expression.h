@@ -54,9 +54,25 @@ void AlgebraicExpressionNode_Free(AlgebraicExpressionNode *root);
 typedef struct  {
     bool transpose;         // Should the matrix be transposed.
     bool free;              // Should the matrix be freed?
+    bool diagonal;          // Is the matrix a diagonal label matrix.
     GrB_Matrix operand;
 } AlgebraicExpressionOperand;
 
+/* Product of consecutive operands within an algebraic expression,
+ * cached across evaluations. */
+typedef struct {
+    GrB_Matrix *operands;   // Multiplied operands.
+    GrB_Matrix product;     // Operands product.
+} AlgebraicExpressionProduct;
+
+/* Nodes set on the diagonal of a label matrix,
+ * cached across evaluations. */
+typedef struct {
+    GrB_Matrix label;       // Diagonal label matrix.
+    GrB_Index nvals;        // Number of labeled nodes when the mask was built.
+    uint64_t *mask;         // Bitmap of labeled nodes.
+} AlgebraicExpressionLabelMask;
+
 // Algebraic expression e.g. A*B*C
 typedef struct {
     AL_EXP_OP op;                           // Operation to perform.
@@ -67,6 +83,8 @@ typedef struct {
     Node *dest_node;                        // Nodes represented by the last operand rows.
     Edge *edge;                             // Edge represented by sole operand.
     AST_LinkLength *edgeLength;             // Repeatable edge length.
+    AlgebraicExpressionProduct *products;   // Cached partial products.
+    AlgebraicExpressionLabelMask *masks;    // Cached label masks.
 } AlgebraicExpression;
 
 /* Construct an algebraic expression from a query. */
@@ -81,6 +99,11 @@ void AlgebraicExpression_AppendTerm(AlgebraicExpression *ae, GrB_Matrix m, bool
 /* Prepend m as the first term in the expression ae. */
 void AlgebraicExpression_PrependTerm(AlgebraicExpression *ae, GrB_Matrix m, bool transposeOp, bool freeOp);
 
+/* Rebinds expression to the graph's current data, synchronizing graph matrix
+ * operands and dropping cached products and masks. Returns false if an operand
+ * was derived from the graph's data, in which case it can't be rebound. */
+bool AlgebraicExpression_Rebind(AlgebraicExpression *ae, const Graph *g);
+
 /* Removes operand at position idx */
 void AlgebraicExpression_RemoveTerm(AlgebraicExpression *ae, int idx, AlgebraicExpressionOperand *operand);
 
@@ -8,6 +8,7 @@
 #include "./aggregate.h"
 #include "./repository.h"
 #include "../graph/graph.h"
+#include "../util/arr.h"
 #include "../util/rmalloc.h"
 #include "../graph/graphcontext.h"
 #include "../util/triemap/triemap.h"
@@ -48,6 +49,14 @@ AR_ExpNode* AR_EXP_NewVariableOperandNode(const AST *ast, char *entity_prop, cha
     return node;
 }
 
+AR_ExpNode* AR_EXP_NewParamOperandNode(const AST_Param *param) {
+    AR_ExpNode *node = rm_calloc(1, sizeof(AR_ExpNode));
+    node->type = AR_EXP_OPERAND;
+    node->operand.type = AR_EXP_PARAM;
+    node->operand.param = param;
+    return node;
+}
+
 AR_ExpNode* AR_EXP_NewOpNode(char *func_name, int child_count) {
     AR_ExpNode *node = rm_calloc(1, sizeof(AR_ExpNode));
     node->type = AR_EXP_OP;    
@@ -89,6 +98,8 @@ AR_ExpNode* AR_EXP_BuildFromAST(const AST *ast, const AST_ArithmeticExpressionNo
     } else {
         if(exp->operand.type == AST_AR_EXP_CONSTANT) {
             root = AR_EXP_NewConstOperandNode(exp->operand.constant);
+        } else if(exp->operand.type == AST_AR_EXP_PARAM) {
+            root = AR_EXP_NewParamOperandNode(exp->operand.param);
         } else {
             root = AR_EXP_NewVariableOperandNode(ast,
                                                   exp->operand.variadic.property,
@@ -116,7 +127,91 @@ void _AR_EXP_UpdatePropIdx(AR_ExpNode *root, const Record r) {
     root->operand.variadic.entity_prop_idx = GraphContext_GetAttributeID(gc, root->operand.variadic.entity_prop);
 }
 
+// Fetch entity property value.
+static inline SIValue _AR_EXP_EvaluateProperty(AR_ExpNode *root, const Record r) {
+    GraphEntity *ge = Record_GetGraphEntity(r, root->operand.variadic.entity_alias_idx);
+    if(root->operand.variadic.entity_prop_idx == ATTRIBUTE_NOTFOUND) {
+        _AR_EXP_UpdatePropIdx(root, r);
+    }
+    SIValue *property = GraphEntity_GetProperty(ge, root->operand.variadic.entity_prop_idx);
+    if(property == PROPERTY_NOTFOUND) return SI_NullVal();
+    return SI_ShallowCopy(*property);
+}
+
+/* Compiled expression instruction types. */
+typedef enum {
+    AR_INSTR_CONSTANT,      // Push constant.
+    AR_INSTR_PARAM,         // Push parameter's bound value.
+    AR_INSTR_PROPERTY,      // Push entity's property.
+    AR_INSTR_RECORD,        // Push record entry.
+    AR_INSTR_CALL,          // Pop function arguments, push function's result.
+    AR_INSTR_AGGREGATE,     // Push aggregation result.
+} AR_InstrType;
+
+typedef struct {
+    AR_InstrType type;
+    union {
+        SIValue constant;
+        const AST_Param *param;
+        AR_ExpNode *node;       // Property or aggregation node.
+        int record_idx;
+        struct {
+            AR_Func f;
+            int argc;
+        } call;
+    };
+} AR_Instr;
+
+/* Instructions are laid out in post order,
+ * each function call is preceded by the instructions computing its arguments. */
+struct AR_ExpProgram {
+    AR_Instr *instructions;     // Array of instructions.
+    uint stack_size;            // Maximum number of values pushed at once.
+};
+
+static SIValue _AR_EXP_Execute(const AR_ExpProgram *program, const Record r) {
+    SIValue stack[program->stack_size];
+    uint top = 0;
+
+    uint instruction_count = array_len(program->instructions);
+    for(uint i = 0; i < instruction_count; i++) {
+        const AR_Instr *instr = program->instructions + i;
+        switch(instr->type) {
+            case AR_INSTR_CONSTANT:
+                stack[top++] = SI_ShallowCopy(instr->constant);
+                break;
+            case AR_INSTR_PARAM:
+                // Value is owned by parameter.
+                stack[top++] = SI_ShallowCopy(instr->param->value);
+                break;
+            case AR_INSTR_PROPERTY:
+                stack[top++] = _AR_EXP_EvaluateProperty(instr->node, r);
+                break;
+            case AR_INSTR_RECORD:
+                stack[top++] = Record_Get(r, instr->record_idx);
+                break;
+            case AR_INSTR_CALL:
+                // Arguments are replaced by the function's result.
+                top -= instr->call.argc;
+                stack[top] = instr->call.f(stack + top, instr->call.argc);
+                top++;
+                break;
+            case AR_INSTR_AGGREGATE:
+                // Aggregation function should be reduced by now.
+                stack[top++] = instr->node->op.agg_func->result;
+                break;
+            default:
+                assert(false);
+        }
+    }
+
+    assert(top == 1);
+    return stack[0];
+}
+
 SIValue AR_EXP_Evaluate(AR_ExpNode *root, const Record r) {
+    if(root->program) return _AR_EXP_Execute(root->program, r);
+
     SIValue result;
     /* Deal with Operation node. */
     if(root->type == AR_EXP_OP) {
@@ -137,17 +232,15 @@ SIValue AR_EXP_Evaluate(AR_ExpNode *root, const Record r) {
     } else {
         /* Deal with a constant node. */
         if(root->operand.type == AR_EXP_CONSTANT) {
-            result = root->operand.constant;
+            // Value is owned by expression.
+            result = SI_ShallowCopy(root->operand.constant);
+        } else if(root->operand.type == AR_EXP_PARAM) {
+            // Value is owned by parameter.
+            result = SI_ShallowCopy(root->operand.param->value);
         } else {
             // Fetch entity property value.
             if (root->operand.variadic.entity_prop != NULL) {
-                GraphEntity *ge = Record_GetGraphEntity(r, root->operand.variadic.entity_alias_idx);
-                if(root->operand.variadic.entity_prop_idx == ATTRIBUTE_NOTFOUND) {
-                    _AR_EXP_UpdatePropIdx(root, r);
-                }
-                SIValue *property = GraphEntity_GetProperty(ge, root->operand.variadic.entity_prop_idx);
-                if(property == PROPERTY_NOTFOUND) result = SI_NullVal();
-                else result = SI_ShallowCopy(*property);
+                result = _AR_EXP_EvaluateProperty(root, r);
             } else {
                 // Alias doesn't necessarily refers to a graph entity,
                 // it could also be a constant.
@@ -159,6 +252,93 @@ SIValue AR_EXP_Evaluate(AR_ExpNode *root, const Record r) {
     return result;
 }
 
+/* Returns true if node is a function call which can be evaluated
+ * once at compile time, calls with constant arguments to functions
+ * returning the same value for the same arguments. */
+static bool _AR_EXP_Foldable(const AR_ExpNode *node) {
+    if(node->type != AR_EXP_OP || node->op.type != AR_OP_FUNC) return false;
+    if(node->op.f == AR_RAND) return false;
+
+    for(int i = 0; i < node->op.child_count; i++) {
+        if(AR_EXP_GetOperandType(node->op.children[i]) != AR_EXP_CONSTANT) return false;
+    }
+    return true;
+}
+
+/* Replaces sub expressions made of constants with their value, bottom up. */
+static void _AR_EXP_FoldConstants(AR_ExpNode *node) {
+    if(node->type != AR_EXP_OP) return;
+
+    for(int i = 0; i < node->op.child_count; i++) {
+        _AR_EXP_FoldConstants(node->op.children[i]);
+    }
+    if(!_AR_EXP_Foldable(node)) return;
+
+    SIValue value = AR_EXP_Evaluate(node, NULL);
+    // Make sure constant owns its value, as it may refer to a child being freed.
+    if(SI_TYPE(value) == T_STRING && value.allocation != M_SELF) value = SI_Clone(value);
+
+    for(int i = 0; i < node->op.child_count; i++) AR_EXP_Free(node->op.children[i]);
+    rm_free(node->op.children);
+
+    // Turn node into a constant.
+    node->type = AR_EXP_OPERAND;
+    node->operand.type = AR_EXP_CONSTANT;
+    node->operand.constant = value;
+}
+
+// Appends instructions evaluating node, returns stack size required by node.
+static uint _AR_EXP_CompileNode(AR_ExpNode *node, AR_Instr **instructions) {
+    AR_Instr instr;
+    uint stack_size = 1;
+
+    if(node->type == AR_EXP_OP) {
+        if(node->op.type == AR_OP_AGGREGATE) {
+            instr.type = AR_INSTR_AGGREGATE;
+            instr.node = node;
+        } else {
+            // Argument i is computed while the i preceding arguments are on the stack.
+            for(int i = 0; i < node->op.child_count; i++) {
+                uint child_stack_size = i + _AR_EXP_CompileNode(node->op.children[i], instructions);
+                if(child_stack_size > stack_size) stack_size = child_stack_size;
+            }
+            instr.type = AR_INSTR_CALL;
+            instr.call.f = node->op.f;
+            instr.call.argc = node->op.child_count;
+        }
+    } else if(node->operand.type == AR_EXP_CONSTANT) {
+        instr.type = AR_INSTR_CONSTANT;
+        instr.constant = node->operand.constant;
+    } else if(node->operand.type == AR_EXP_PARAM) {
+        instr.type = AR_INSTR_PARAM;
+        instr.param = node->operand.param;
+    } else if(node->operand.variadic.entity_prop != NULL) {
+        // Attribute ID is resolved on first evaluation, as it might not exist yet.
+        instr.type = AR_INSTR_PROPERTY;
+        instr.node = node;
+    } else {
+        instr.type = AR_INSTR_RECORD;
+        instr.record_idx = node->operand.variadic.entity_alias_idx;
+    }
+
+    *instructions = array_append(*instructions, instr);
+    return stack_size;
+}
+
+void AR_EXP_Compile(AR_ExpNode *root) {
+    assert(root);
+    if(root->program) return;
+
+    _AR_EXP_FoldConstants(root);
+    // Operands are evaluated directly, a program wouldn't save any work.
+    if(root->type == AR_EXP_OPERAND) return;
+
+    AR_ExpProgram *program = rm_malloc(sizeof(AR_ExpProgram));
+    program->instructions = array_new(AR_Instr, 1);
+    program->stack_size = _AR_EXP_CompileNode(root, &program->instructions);
+    root->program = program;
+}
+
 void AR_EXP_Aggregate(const AR_ExpNode *root, const Record r) {
     if(root->type == AR_EXP_OP) {
         if(root->op.type == AR_OP_AGGREGATE) {
@@ -199,6 +379,21 @@ void AR_EXP_Reduce(const AR_ExpNode *root) {
     }
 }
 
+void AR_EXP_Merge(const AR_ExpNode *root, const AR_ExpNode *other) {
+    if(root->type == AR_EXP_OP) {
+        assert(other->type == AR_EXP_OP && root->op.child_count == other->op.child_count);
+        if(root->op.type == AR_OP_AGGREGATE) {
+            /* Merge. */
+            Agg_Merge(root->op.agg_func, other->op.agg_func);
+        } else {
+            /* Keep searching for aggregation nodes. */
+            for(int i = 0; i < root->op.child_count; i++) {
+                AR_EXP_Merge(root->op.children[i], other->op.children[i]);
+            }
+        }
+    }
+}
+
 void AR_EXP_CollectAliases(AR_ExpNode *root, TrieMap *aliases) {
     if (root->type == AR_EXP_OP) {
         for (int i = 0; i < root->op.child_count; i ++) {
@@ -288,6 +483,8 @@ void _AR_EXP_ToString(const AR_ExpNode *root, char **str, size_t *str_size, size
         if (root->operand.type == AR_EXP_CONSTANT) {
             size_t len = SIValue_ToString(root->operand.constant, (*str + *bytes_written), 64);
             *bytes_written += len;
+        } else if (root->operand.type == AR_EXP_PARAM) {
+            *bytes_written += sprintf((*str + *bytes_written), "$%.62s", root->operand.param->name);
         } else {
             if (root->operand.variadic.entity_prop != NULL) {
                 *bytes_written += sprintf(
@@ -300,6 +497,12 @@ void _AR_EXP_ToString(const AR_ExpNode *root, char **str, size_t *str_size, size
     }
 }
 
+bool AR_EXP_Mergeable(AR_ExpNode *root) {
+    AR_ExpNode *agg_node;
+    if(!AR_EXP_ContainsAggregation(root, &agg_node)) return true;
+    return Agg_Mergeable(agg_node->op.agg_func);
+}
+
 void AR_EXP_ToString(const AR_ExpNode *root, char **str) {
     size_t str_size = 0;
     size_t bytes_written = 0;
@@ -313,7 +516,12 @@ static AR_ExpNode* _AR_EXP_CloneOperand(AR_ExpNode* exp) {
     switch(exp->operand.type) {
         case AR_EXP_CONSTANT:
             clone->operand.type = AR_EXP_CONSTANT;
-            clone->operand.constant = exp->operand.constant;
+            // Folded constants own their value.
+            if(exp->operand.constant.allocation == M_SELF) {
+                clone->operand.constant = SI_Clone(exp->operand.constant);
+            } else {
+                clone->operand.constant = exp->operand.constant;
+            }
             break;
         case AR_EXP_VARIADIC:
             clone->operand.type = AR_EXP_VARIADIC;
@@ -324,6 +532,10 @@ static AR_ExpNode* _AR_EXP_CloneOperand(AR_ExpNode* exp) {
             }
             clone->operand.variadic.entity_prop_idx = exp->operand.variadic.entity_prop_idx;
             break;
+        case AR_EXP_PARAM:
+            clone->operand.type = AR_EXP_PARAM;
+            clone->operand.param = exp->operand.param;
+            break;
         default:
             assert(false);
             break;
@@ -353,10 +565,15 @@ AR_ExpNode* AR_EXP_Clone(AR_ExpNode* exp) {
             assert(false);
             break;
     }
+    if(exp->program) AR_EXP_Compile(clone);
     return clone;
 }
 
 void AR_EXP_Free(AR_ExpNode *root) {
+    if(root->program) {
+        array_free(root->program->instructions);
+        rm_free(root->program);
+    }
     if(root->type == AR_EXP_OP) {
         for(int child_idx = 0; child_idx < root->op.child_count; child_idx++) {
             AR_EXP_Free(root->op.children[child_idx]);
@@ -368,7 +585,7 @@ void AR_EXP_Free(AR_ExpNode *root) {
     } else {
         if (root->operand.type == AR_EXP_CONSTANT) {
             SIValue_Free(&root->operand.constant);
-        } else {
+        } else if (root->operand.type == AR_EXP_VARIADIC) {
             if (root->operand.variadic.entity_alias) rm_free(root->operand.variadic.entity_alias);
             if (root->operand.variadic.entity_prop) rm_free(root->operand.variadic.entity_prop);
         }
@@ -29,10 +29,11 @@ typedef enum {
 } AR_OPType;
 
 /* AR_OperandNodeType type of leaf node,
- * either a constant: 3, or a variable: node.property. */
+ * either a constant: 3, a variable: node.property, or a parameter: $name. */
 typedef enum {
     AR_EXP_CONSTANT,
     AR_EXP_VARIADIC,
+    AR_EXP_PARAM,
 } AR_OperandNodeType;
 
 /* AR_Func - Function pointer to an operation with an arithmetic expression */
@@ -90,7 +91,7 @@ typedef struct {
 } AR_OpNode;
 
 /* OperandNode represents either a constant numeric value, 
- * or a graph entity property. */
+ * a graph entity property or a query parameter. */
 typedef struct {
     union {
         SIValue constant;
@@ -100,10 +101,14 @@ typedef struct {
             char *entity_prop;
             Attribute_ID entity_prop_idx;
         } variadic;
+        const AST_Param *param;     // Evaluates to parameter's bound value.
     };
 	AR_OperandNodeType type;
 } AR_OperandNode;
 
+/* Compiled form of an expression tree, see AR_EXP_Compile. */
+typedef struct AR_ExpProgram AR_ExpProgram;
+
 /* AR_ExpNode a node within an arithmetic expression tree, 
  * This node can take one of two forms:
  * 1. OpNode
@@ -114,6 +119,7 @@ struct AR_ExpNode {
         AR_OpNode op;
     };
     AR_ExpNodeType type;
+    AR_ExpProgram *program;     /* Compiled expression, set on compiled roots only. */
 };
 
 typedef struct AR_ExpNode AR_ExpNode;
@@ -121,10 +127,19 @@ typedef struct AR_ExpNode AR_ExpNode;
 /* Return AR_OperandNodeType for operands and -1 for operations. */
 int AR_EXP_GetOperandType(AR_ExpNode *exp);
 
+/* Compiles expression tree for repeated evaluation, constant sub expressions
+ * are folded into constants and the tree is flattened into a sequence of
+ * instructions evaluated over a value stack, replacing recursive evaluation.
+ * Expression nodes might be replaced, root is updated in place. */
+void AR_EXP_Compile(AR_ExpNode *root);
+
 /* Evaluate arithmetic expression tree. */
 SIValue AR_EXP_Evaluate(AR_ExpNode *root, const Record r);
 void AR_EXP_Aggregate(const AR_ExpNode *root, const Record r);
 void AR_EXP_Reduce(const AR_ExpNode *root);
+/* Folds the aggregation state of other into root,
+ * both expressions must share the same structure. */
+void AR_EXP_Merge(const AR_ExpNode *root, const AR_ExpNode *other);
 
 /* Utility functions */
 /* Traverse an expression tree and add all graph entity aliases
@@ -136,6 +151,9 @@ void AR_EXP_CollectAliases(AR_ExpNode *root, TrieMap *aliases);
  * Please note an expression tree can only contain a single aggregation node. */
 int AR_EXP_ContainsAggregation(AR_ExpNode *root, AR_ExpNode **agg_node);
 
+/* Returns true if the aggregation states of expression tree can be merged. */
+bool AR_EXP_Mergeable(AR_ExpNode *root);
+
 /* Constructs string representation of arithmetic expression tree. */
 void AR_EXP_ToString(const AR_ExpNode *root, char **str);
 
@@ -145,6 +163,9 @@ AR_ExpNode* AR_EXP_NewConstOperandNode(SIValue constant);
 /* Construct a variable expression: n.v*/
 AR_ExpNode* AR_EXP_NewVariableOperandNode(const AST *ast, char *entity_prop, char *entity_alias);
 
+/* Construct a parameter expression: $name */
+AR_ExpNode* AR_EXP_NewParamOperandNode(const AST_Param *param);
+
 /* Construct an operation expression: toUpper(n.v) */
 AR_ExpNode* AR_EXP_NewOpNode(char *func_name, int child_count);
 
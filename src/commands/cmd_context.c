@@ -1,5 +1,6 @@
 #include "cmd_context.h"
 #include "../util/rmalloc.h"
+#include "../execution_plan/plan_cache.h"
 #include <assert.h>
 
 CommandCtx* CommandCtx_New
@@ -15,6 +16,8 @@ CommandCtx* CommandCtx_New
     context->bc = bc;
     context->ctx = ctx;
     context->ast = ast;    
+    context->cached = NULL;
+    context->query = NULL;
     context->argv = argv;
     context->argc = argc;
     context->graphName = NULL;
@@ -57,6 +60,8 @@ void CommandCtx_Free(CommandCtx* qctx) {
     }
 
     if(qctx->ast) AST_Free(qctx->ast);
+    if(qctx->cached) PlanCacheEntry_Free(qctx->cached);
     if(qctx->graphName) rm_free(qctx->graphName);
+    if(qctx->query) rm_free(qctx->query);
     rm_free(qctx);
 }
@@ -15,6 +15,8 @@ typedef struct {
     RedisModuleCtx *ctx;            // Redis module context.
     RedisModuleBlockedClient *bc;   // Blocked client.
     AST **ast;                      // Parsed AST.
+    struct PlanCacheEntry *cached;  // Cached plan to execute, owns its AST.
+    char *query;                    // Query text excluding parameters, plan cache key.
     char *graphName;                // Graph ID.
     double tic[2];                  // Timings.
     RedisModuleString **argv;       // Arguments.
@@ -17,6 +17,7 @@ GraphContext* _empty_graph_context() {
     gc = rm_malloc(sizeof(GraphContext));
     gc->g = Graph_New(1, 1);
     gc->index_count = 0;
+    gc->plan_cache = NULL;
     gc->attributes = NULL;
     gc->node_schemas = NULL;
     gc->string_mapping = NULL;
@@ -49,14 +50,23 @@ int MGraph_Explain(RedisModuleCtx *ctx, RedisModuleString **argv, int argc) {
     /* Parse query, get AST. */
     AST** ast = NULL;
     char *errMsg = NULL;
+    AST_Params *params = NULL;
     GraphContext *gc = NULL;
     ExecutionPlan *plan = NULL;
 
+    query = AST_Params_ParsePrefix(query, &params, &errMsg);
+    if(!query) {
+        RedisModule_ReplyWithError(ctx, errMsg);
+        free(errMsg);
+        return REDISMODULE_OK;
+    }
+
     ast = ParseQuery(query, strlen(query), &errMsg);
     if(!ast) {
         RedisModule_Log(ctx, "debug", "Error parsing query: %s", errMsg);
         RedisModule_ReplyWithError(ctx, errMsg);
         free(errMsg);
+        AST_Params_Free(params);
         return REDISMODULE_OK;
     }
     if(AST_Empty(ast[0])) {
@@ -64,6 +74,18 @@ int MGraph_Explain(RedisModuleCtx *ctx, RedisModuleString **argv, int argc) {
         goto cleanup;
     }
 
+    // Parameter values are optional, unbound parameters are NULL.
+    if(params) {
+        bool bound = AST_BindParams(ast, params, &errMsg);
+        AST_Params_Free(params);
+        params = NULL;
+        if(!bound) {
+            RedisModule_ReplyWithError(ctx, errMsg);
+            free(errMsg);
+            goto cleanup;
+        }
+    }
+
     // Perform query validations before and after ModifyAST.
     if(AST_PerformValidations(ctx, ast) != AST_VALID) return REDISMODULE_OK;
     ModifyAST(ast);
@@ -99,6 +121,7 @@ cleanup:
         ExecutionPlanFree(plan);
     }
     if(ast) AST_Free(ast);
+    AST_Params_Free(params);
     if(free_graph_ctx) GraphContext_Free(gc);
     return REDISMODULE_OK;
 }
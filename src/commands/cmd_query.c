@@ -8,8 +8,10 @@
 #include "cmd_context.h"
 #include "../graph/graph.h"
 #include "../query_executor.h"
+#include "../parser/parser_common.h"
 #include "../util/simple_timer.h"
 #include "../execution_plan/execution_plan.h"
+#include "../execution_plan/plan_cache.h"
 #include "../util/arr.h"
 #include "../util/rmalloc.h"
 
@@ -48,10 +50,56 @@ static void _index_operation(RedisModuleCtx *ctx, GraphContext *gc, AST_IndexNod
 }
 
 static inline bool _check_compact_flag(CommandCtx *qctx) {
-    // The only additional argument to check currently is whether the query results
-    // should be returned in compact form
-    return (qctx->argc > 3 &&
-            !strcasecmp(RedisModule_StringPtrLen(qctx->argv[3], NULL), "--compact"));
+    // Check whether the query results should be returned in compact form
+    for(int i = 3; i < qctx->argc; i++) {
+        if(!strcasecmp(RedisModule_StringPtrLen(qctx->argv[i], NULL), "--compact")) return true;
+    }
+    return false;
+}
+
+/* Determine number of threads the query may use,
+ * `--parallelism N` overrides module's configuration,
+ * N is capped by the number of threads in the thread pool.
+ * Returns false if N isn't a positive integer. */
+static bool _parse_parallelism(RedisModuleString **argv, int argc, long long *parallelism) {
+    *parallelism = _query_parallelism;
+    for(int i = 3; i < argc; i++) {
+        if(strcasecmp(RedisModule_StringPtrLen(argv[i], NULL), "--parallelism")) continue;
+        if(i+1 == argc) return false;
+        if(RedisModule_StringToLongLong(argv[i+1], parallelism) != REDISMODULE_OK) return false;
+        if(*parallelism < 1) return false;
+        if(*parallelism > _thread_count) *parallelism = _thread_count;
+        return true;
+    }
+    return true;
+}
+
+/* Plans of read-only queries are cached and reused by later invocations,
+ * procedure calls are excluded as their output might change between calls. */
+static bool _cacheable(const GraphContext *gc, AST **ast, bool readonly) {
+    if(!gc->plan_cache || !readonly) return false;
+    for(uint i = 0; i < array_len(ast); i++) {
+        if(ast[i]->callNode) return false;
+    }
+    return true;
+}
+
+/* Retrieves a cached plan for query,
+ * returns NULL if graph doesn't exist or query isn't cached. */
+static PlanCacheEntry *_checkout_cached_plan(RedisModuleCtx *ctx, RedisModuleString *graph_name,
+                                             const char *query, long long parallelism) {
+    if(_plan_cache_size == 0) return NULL;
+    GraphContext *gc = GraphContext_Retrieve(ctx, RedisModule_StringPtrLen(graph_name, NULL));
+    if(!gc || !gc->plan_cache) return NULL;
+    return PlanCache_Checkout(gc->plan_cache, query, parallelism);
+}
+
+// Hands a plan which won't be executed back to cache.
+static void _return_cached_plan(RedisModuleCtx *ctx, RedisModuleString *graph_name,
+                                PlanCacheEntry *cached) {
+    GraphContext *gc = GraphContext_Retrieve(ctx, RedisModule_StringPtrLen(graph_name, NULL));
+    assert(gc && gc->plan_cache);
+    PlanCache_Return(gc->plan_cache, cached);
 }
 
 static ResultSet* _prepare_resultset(RedisModuleCtx *ctx, AST **ast, bool compact) {
@@ -66,7 +114,10 @@ void _MGraph_Query(void *args) {
     CommandCtx *qctx = (CommandCtx*)args;
     RedisModuleCtx *ctx = CommandCtx_GetRedisCtx(qctx);
     ResultSet* resultSet = NULL;
-    AST **ast = qctx->ast;
+    PlanCacheEntry *cached = qctx->cached;
+    // Cached entries own their validated AST.
+    AST **ast = cached ? cached->ast : qctx->ast;
+    const char *query = qctx->query;
     bool readonly = AST_ReadOnly(ast);
     bool lockAcquired = false;
 
@@ -91,14 +142,21 @@ void _MGraph_Query(void *args) {
     }
 
     bool compact = _check_compact_flag(qctx);
+    long long parallelism;
+    _parse_parallelism(qctx->argv, qctx->argc, &parallelism);
+
+    // Cache is accessed by Redis main thread, create it while holding the global lock.
+    if(!gc->plan_cache && _plan_cache_size > 0) gc->plan_cache = PlanCache_New(_plan_cache_size);
 
     CommandCtx_ThreadSafeContextUnlock(qctx);
 
-    // Perform query validations before and after ModifyAST
-    if (AST_PerformValidations(ctx, ast) != AST_VALID) goto cleanup;
+    if(!cached) {
+        // Perform query validations before and after ModifyAST
+        if (AST_PerformValidations(ctx, ast) != AST_VALID) goto cleanup;
 
-    ModifyAST(ast);
-    if (AST_PerformValidations(ctx, ast) != AST_VALID) goto cleanup;
+        ModifyAST(ast);
+        if (AST_PerformValidations(ctx, ast) != AST_VALID) goto cleanup;
+    }
 
     // Acquire the appropriate lock.
     if(readonly) Graph_AcquireReadLock(gc->g);
@@ -109,9 +167,44 @@ void _MGraph_Query(void *args) {
         _index_operation(ctx, gc, ast[0]->indexNode);
     } else {
         resultSet = _prepare_resultset(ctx, ast, compact);
-        ExecutionPlan *plan = NewExecutionPlan(ctx, ast, resultSet, false);
+        uint64_t version = Graph_GetSchemaVersion(gc->g);
+        qctx->cached = NULL;
+
+        /* Plans are bound to the graph's schema and statistics at the time they were built,
+         * data modified since is picked up by rebinding the plan's operations. */
+        if(cached && cached->plan &&
+           (cached->version != version || !ExecutionPlan_Rebind(cached->plan))) {
+            ExecutionPlanFree(cached->plan);
+            cached->plan = NULL;
+        }
+
+        ExecutionPlan *plan = (cached) ? cached->plan : NULL;
+        if(plan) {
+            ExecutionPlan_SetResultSet(plan, resultSet);
+            // Operations reevaluate parameters on reset.
+            if(AST_Params_Count(ast[0]->params) > 0) ExecutionPlan_Reset(plan);
+        } else {
+            plan = NewExecutionPlan(ctx, ast, resultSet, false);
+            // Only read-only queries are executed by multiple threads.
+            if(readonly) ExecutionPlan_Parallelize(plan, ctx, ast, parallelism);
+        }
         ExecutionPlan_Execute(plan);
-        ExecutionPlanFree(plan);
+
+        if(!cached && _cacheable(gc, ast, readonly)) {
+            // Hand AST over to cache entry.
+            cached = PlanCacheEntry_New(query, parallelism, ast, NULL, version);
+            qctx->ast = NULL;
+        }
+
+        if(cached) {
+            // Release resources held by plan and return it to cache.
+            ExecutionPlan_Reset(plan);
+            cached->plan = plan;
+            cached->version = version;
+            PlanCache_Return(gc->plan_cache, cached);
+        } else {
+            ExecutionPlanFree(plan);
+        }
         ResultSet_Replay(resultSet);    // Send result-set back to client.
     }
 
@@ -144,20 +237,72 @@ int MGraph_Query(RedisModuleCtx *ctx, RedisModuleString **argv, int argc) {
     
     simple_tic(tic);
 
-    // Parse AST.
-    char *errMsg = NULL;    
+    long long parallelism;
+    if(!_parse_parallelism(argv, argc, &parallelism)) {
+        RedisModule_ReplyWithError(ctx, "Invalid parallelism, expecting a positive integer.");
+        return REDISMODULE_OK;
+    }
+
+    char *errMsg = NULL;
+    AST_Params *params = NULL;
     const char *query = RedisModule_StringPtrLen(argv[2], NULL);
 
-    AST **ast = ParseQuery(query, strlen(query), &errMsg);
-    if (!ast) {
-        RedisModule_Log(ctx, "debug", "Error parsing query: %s", errMsg);
+    // Separate parameters from query: CYPHER name=value ... query
+    query = AST_Params_ParsePrefix(query, &params, &errMsg);
+    if(!query) {
         RedisModule_ReplyWithError(ctx, errMsg);
         free(errMsg);
         return REDISMODULE_OK;
     }
-    if(AST_Empty(ast[0])) {
-        AST_Free(ast);
-        RedisModule_ReplyWithError(ctx, "Error empty query.");
+
+    /* Queries differing only by literals share a cached plan
+     * once literals are replaced by parameters. */
+    char *key = NULL;
+    if(_extract_literals && _plan_cache_size > 0) {
+        key = Query_ExtractLiterals(query, strlen(query), &params);
+    }
+    if(!key) key = rm_strdup(query);
+
+    // Reuse a cached plan, skipping query parsing and validations.
+    PlanCacheEntry *cached = _checkout_cached_plan(ctx, argv[1], key, parallelism);
+    AST **ast = (cached) ? cached->ast : NULL;
+
+    // Parse AST.
+    if(!ast) {
+        ast = ParseQuery(key, strlen(key), &errMsg);
+        if(!ast && strcmp(key, query) != 0) {
+            // Report errors against the original query.
+            free(errMsg);
+            ast = ParseQuery(query, strlen(query), &errMsg);
+            rm_free(key);
+            key = rm_strdup(query);
+        }
+        if (!ast) {
+            RedisModule_Log(ctx, "debug", "Error parsing query: %s", errMsg);
+            RedisModule_ReplyWithError(ctx, errMsg);
+            free(errMsg);
+            AST_Params_Free(params);
+            rm_free(key);
+            return REDISMODULE_OK;
+        }
+        if(AST_Empty(ast[0])) {
+            AST_Free(ast);
+            AST_Params_Free(params);
+            rm_free(key);
+            RedisModule_ReplyWithError(ctx, "Error empty query.");
+            return REDISMODULE_OK;
+        }
+    }
+
+    // Bind parameters, this query is the only user of AST.
+    bool bound = AST_BindParams(ast, params, &errMsg);
+    AST_Params_Free(params);
+    if(!bound) {
+        RedisModule_ReplyWithError(ctx, errMsg);
+        free(errMsg);
+        rm_free(key);
+        if(cached) _return_cached_plan(ctx, argv[1], cached);
+        else AST_Free(ast);
         return REDISMODULE_OK;
     }
 
@@ -170,14 +315,18 @@ int MGraph_Query(RedisModuleCtx *ctx, RedisModuleString **argv, int argc) {
     int flags = RedisModule_GetContextFlags(ctx);
     if (flags & (REDISMODULE_CTX_FLAGS_MULTI | REDISMODULE_CTX_FLAGS_LUA)) {
       // Run query on Redis main thread.
-      context = CommandCtx_New(ctx, NULL, ast, argv[1], argv, argc);
+      context = CommandCtx_New(ctx, NULL, (cached) ? NULL : ast, argv[1], argv, argc);
+      context->cached = cached;
+      context->query = key;
       context->tic[0] = tic[0];
       context->tic[1] = tic[1];
       _MGraph_Query(context);
     } else {
       // Run query on a dedicated thread.
       RedisModuleBlockedClient *bc = RedisModule_BlockClient(ctx, NULL, NULL, NULL, 0);
-      context = CommandCtx_New(NULL, bc, ast, argv[1], argv, argc);
+      context = CommandCtx_New(NULL, bc, (cached) ? NULL : ast, argv[1], argv, argc);
+      context->cached = cached;
+      context->query = key;
       context->tic[0] = tic[0];
       context->tic[1] = tic[1];
       thpool_add_work(_thpool, _MGraph_Query, context);
@@ -11,6 +11,10 @@
 #include "../util/thpool/thpool.h"
 
 extern threadpool _thpool;
+extern long long _thread_count;
+extern long long _query_parallelism;
+extern long long _plan_cache_size;
+extern long long _extract_literals;
 
 int MGraph_Query(RedisModuleCtx *ctx, RedisModuleString **argv, int argc);
 
@@ -8,6 +8,22 @@
 #include <unistd.h>
 #include <string.h>
 #include <assert.h>
+#include <stdbool.h>
+
+// Scans module arguments for param, expecting configuration
+// to be in the form of key value pairs.
+// Returns true and sets value if param is specified.
+static bool _Config_GetLongLong(RedisModuleString **argv, int argc, const char *param, long long *value) {
+    if(argc%2 != 0) return false;
+
+    for(int i = 0; i < argc; i+=2) {
+        const char *key = RedisModule_StringPtrLen(argv[i], NULL);
+        if(strcasecmp(key, param) == 0) {
+            return (RedisModule_StringToLongLong(argv[i+1], value) == REDISMODULE_OK);
+        }
+    }
+    return false;
+}
 
 long long Config_GetThreadCount(RedisModuleCtx *ctx, RedisModuleString **argv, int argc) {
     // Default.    
@@ -15,17 +31,7 @@ long long Config_GetThreadCount(RedisModuleCtx *ctx, RedisModuleString **argv, i
     long long threadCount = (CPUCount != -1) ? CPUCount : 1;
 
     // Number of thread specified in configuration?
-    // Expecting configuration to be in the form of key value pairs.
-    if(argc%2 == 0) {
-        // Scan arguments for THREAD_COUNT.
-        for(int i = 0; i < argc; i+=2) {
-            const char *param = RedisModule_StringPtrLen(argv[i], NULL);
-            if(strcasecmp(param, THREAD_COUNT) == 0) {
-                RedisModule_StringToLongLong(argv[i+1], &threadCount);
-                break;
-            }
-        }
-    }
+    _Config_GetLongLong(argv, argc, THREAD_COUNT, &threadCount);
     
     // Sanity.
     assert(threadCount > 0);
@@ -38,3 +44,61 @@ long long Config_GetThreadCount(RedisModuleCtx *ctx, RedisModuleString **argv, i
 
     return threadCount;
 }
+
+long long Config_GetQueryParallelism(RedisModuleCtx *ctx, RedisModuleString **argv, int argc) {
+    // Default, queries are executed by a single thread.
+    long long parallelism = 1;
+    _Config_GetLongLong(argv, argc, QUERY_PARALLELISM, &parallelism);
+
+    // Sanity.
+    if(parallelism < 1) {
+        RedisModule_Log(ctx,
+                        "warning",
+                        "Invalid query parallelism: %lld, using a single thread per query.",
+                        parallelism);
+        parallelism = 1;
+    }
+
+    return parallelism;
+}
+
+long long Config_GetSortSpillThreshold(RedisModuleCtx *ctx, RedisModuleString **argv, int argc) {
+    // Default, 512MB.
+    long long threshold = 512 * 1024 * 1024;
+    _Config_GetLongLong(argv, argc, SORT_SPILL_THRESHOLD, &threshold);
+
+    // Sanity.
+    if(threshold < 0) {
+        RedisModule_Log(ctx,
+                        "warning",
+                        "Invalid sort spill threshold: %lld, sort will not spill to disk.",
+                        threshold);
+        threshold = 0;
+    }
+
+    return threshold;
+}
+
+long long Config_GetPlanCacheSize(RedisModuleCtx *ctx, RedisModuleString **argv, int argc) {
+    // Default, 64 plans per graph.
+    long long size = 64;
+    _Config_GetLongLong(argv, argc, PLAN_CACHE_SIZE, &size);
+
+    // Sanity.
+    if(size < 0) {
+        RedisModule_Log(ctx,
+                        "warning",
+                        "Invalid plan cache size: %lld, plans will not be cached.",
+                        size);
+        size = 0;
+    }
+
+    return size;
+}
+
+long long Config_GetExtractLiterals(RedisModuleCtx *ctx, RedisModuleString **argv, int argc) {
+    // Default, literals are kept.
+    long long extract = 0;
+    _Config_GetLongLong(argv, argc, EXTRACT_LITERALS, &extract);
+    return (extract != 0);
+}
@@ -10,6 +10,10 @@
 #include "redismodule.h"
 
 #define THREAD_COUNT "THREAD_COUNT" // Config param, number of threads in thread pool
+#define QUERY_PARALLELISM "QUERY_PARALLELISM" // Config param, number of threads a single query may use
+#define SORT_SPILL_THRESHOLD "SORT_SPILL_THRESHOLD" // Config param, bytes buffered by sort before spilling to disk
+#define PLAN_CACHE_SIZE "PLAN_CACHE_SIZE" // Config param, number of execution plans cached per graph
+#define EXTRACT_LITERALS "EXTRACT_LITERALS" // Config param, replace query literals with parameters
 
 // Tries to fetch number of threads from
 // command line arguments if specified
@@ -21,4 +25,40 @@ long long Config_GetThreadCount (
     int argc
 );
 
+// Tries to fetch the number of threads a single query
+// may use from command line arguments if specified
+// otherwise returns 1, queries are executed by a single thread.
+long long Config_GetQueryParallelism (
+    RedisModuleCtx *ctx,
+    RedisModuleString **argv,
+    int argc
+);
+
+// Tries to fetch the number of bytes a sort operation may buffer
+// before spilling sorted runs to disk from command line arguments
+// if specified otherwise returns 512MB, 0 disables spilling.
+long long Config_GetSortSpillThreshold (
+    RedisModuleCtx *ctx,
+    RedisModuleString **argv,
+    int argc
+);
+
+// Tries to fetch the number of execution plans cached per graph
+// from command line arguments if specified
+// otherwise returns 64, 0 disables plan caching.
+long long Config_GetPlanCacheSize (
+    RedisModuleCtx *ctx,
+    RedisModuleString **argv,
+    int argc
+);
+
+// Tries to fetch whether query literals are replaced with
+// parameters prior to plan cache lookup from command line arguments
+// if specified otherwise returns 0, literals are kept.
+long long Config_GetExtractLiterals (
+    RedisModuleCtx *ctx,
+    RedisModuleString **argv,
+    int argc
+);
+
 #endif
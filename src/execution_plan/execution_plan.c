@@ -14,6 +14,7 @@
 #include "../graph/entities/edge.h"
 #include "./optimizations/optimizer.h"
 #include "./optimizations/optimizations.h"
+#include "./optimizations/cost_model.h"
 #include "../arithmetic/algebraic_expression.h"
 
 /* Checks if parent has given child, if so returns 1
@@ -278,6 +279,7 @@ static AR_ExpNode** _ReturnClause_GetExpressions(const AST *ast) {
     for(unsigned int i = 0; i < elem_count; i++) {
         AST_ReturnElementNode *elem = return_node->returnElements[i];
         AR_ExpNode *exp = AR_EXP_BuildFromAST(ast, elem->exp);
+        AR_EXP_Compile(exp);
         exps = array_append(exps, exp);
     }
 
@@ -297,6 +299,7 @@ static AR_ExpNode** _WithClause_GetExpressions(const AST *ast) {
     for(unsigned int i = 0; i < elem_count; i++) {
         AST_WithElementNode *elem = with_node->exps[i];
         AR_ExpNode *exp = AR_EXP_BuildFromAST(ast, elem->exp);
+        AR_EXP_Compile(exp);
         exps = array_append(exps, exp);
     }
 
@@ -315,12 +318,58 @@ static AR_ExpNode** _OrderClause_GetExpressions(const AST *ast) {
 
 	for(unsigned int i = 0; i < exp_count; i++) {
 		AR_ExpNode *exp = AR_EXP_BuildFromAST(ast, order_node->expressions[i]);
+		AR_EXP_Compile(exp);
 		exps = array_append(exps, exp);
 	}
 
 	return exps;
 }
 
+/* Creates a scan operation producing the source nodes of exp,
+ * the first operand of exp is dropped when replaced by a label scan. */
+static OpBase *_ExecutionPlan_EntryPointScan(Graph *g, AlgebraicExpression *exp, AST *ast) {
+    Node *n = exp->src_node;
+    if(!n->label) return NewAllNodeScanOp(g, n, ast);
+
+    /* There's no longer need for the label matrix operand
+     * as it's been replaced by label scan. */
+    if(exp->operand_count > 0 && exp->operands[0].operand == Node_GetMatrix(n)) {
+        AlgebraicExpression_RemoveTerm(exp, 0, NULL);
+    }
+    return NewNodeByLabelScanOp(n, ast);
+}
+
+/* Variable length traversal only needs to produce each reachable node once
+ * when query returns distinct rows and rows aren't aggregated or used for updates,
+ * reachable nodes are found within [minHops, maxHops] by shortest distance,
+ * which is exact as long as minHops is at most 1. */
+static bool _ExecutionPlan_ReachOnly(const AlgebraicExpression *exp, const AST *ast) {
+    if(exp->edgeLength->minHops > 1) return false;
+    if(!ast->returnNode || !ast->returnNode->distinct) return false;
+    if(ReturnClause_ContainsAggregation(ast->returnNode)) return false;
+    if(ast->withNode || ast->createNode || ast->mergeNode ||
+       ast->deleteNode || ast->setNode) return false;
+    return true;
+}
+
+static OpBase *_ExecutionPlan_TraverseOp(Graph *g, AlgebraicExpression *exp, AST *ast) {
+    if(exp->edgeLength && _ExecutionPlan_ReachOnly(exp, ast)) {
+        return NewCondVarLenReachOp(exp,
+                                    exp->edgeLength->minHops,
+                                    exp->edgeLength->maxHops,
+                                    g,
+                                    ast);
+    }
+    if(exp->edgeLength) {
+        return NewCondVarLenTraverseOp(exp,
+                                       exp->edgeLength->minHops,
+                                       exp->edgeLength->maxHops,
+                                       g,
+                                       ast);
+    }
+    return NewCondTraverseOp(exp, ast);
+}
+
 ExecutionPlan* _NewExecutionPlan(RedisModuleCtx *ctx, AST *ast, ResultSet *result_set) {
     GraphContext *gc = GraphContext_GetFromTLS();
     Graph *g = gc->g;
@@ -353,10 +402,19 @@ ExecutionPlan* _NewExecutionPlan(RedisModuleCtx *ctx, AST *ast, ResultSet *resul
 
         // For every pattern in match clause.
         size_t patternCount = Vector_Size(ast->matchNode->patterns);
+
+        /* Shortest paths are searched for once their end nodes are matched
+         * by the other patterns. */
+        Vector *shortestPaths = NewVector(Vector*, 0);
+        for(int i = 0; i < patternCount; i++) {
+            Vector *pattern;
+            Vector_Get(ast->matchNode->patterns, i, &pattern);
+            if(MatchClause_ShortestPathLink(pattern)) Vector_Push(shortestPaths, pattern);
+        }
         
         /* Incase we're dealing with multiple patterns
          * we'll simply join them all together with a join operation. */
-        bool multiPattern = patternCount > 1;
+        bool multiPattern = (patternCount - Vector_Size(shortestPaths)) > 1;
         OpBase *cartesianProduct = NULL;
         if(multiPattern) {
             cartesianProduct = NewCartesianProductOp(AST_AliasCount(ast));
@@ -369,71 +427,34 @@ ExecutionPlan* _NewExecutionPlan(RedisModuleCtx *ctx, AST *ast, ResultSet *resul
         for(int i = 0; i < patternCount; i++) {
             Vector *pattern;
             Vector_Get(ast->matchNode->patterns, i, &pattern);
+            if(MatchClause_ShortestPathLink(pattern)) continue;
 
             if(Vector_Size(pattern) > 1) {
                 size_t expCount = 0;
                 AlgebraicExpression **exps = AlgebraicExpression_From_Query(ast, pattern, q, &expCount);
 
-                TRAVERSE_ORDER order = determineTraverseOrder(filter_tree, exps, expCount);
-                if(order == TRAVERSE_ORDER_FIRST) {
-                    AlgebraicExpression *exp = exps[0];
-                    selectEntryPoint(exp, filter_tree);
-
-                    // Create SCAN operation.
-                    if(exp->src_node->label) {
-                        /* There's no longer need for the first matrix operand
-                         * as it's been replaced by label scan. */
-                        AlgebraicExpression_RemoveTerm(exp, 0, NULL);
-                        op = NewNodeByLabelScanOp(exp->src_node, ast);
-                        Vector_Push(traversals, op);
-                    } else {
-                        op = NewAllNodeScanOp(g, exp->src_node, ast);
-                        Vector_Push(traversals, op);
-                    }
-                    for(int i = 0; i < expCount; i++) {
-                        if(exps[i]->operand_count == 0) continue;
-                        if(exps[i]->edgeLength) {
-                            op = NewCondVarLenTraverseOp(exps[i],
-                                                         exps[i]->edgeLength->minHops,
-                                                         exps[i]->edgeLength->maxHops,
-                                                         g,
-                                                         ast);
-                        }
-                        else {
-                            op = NewCondTraverseOp(exps[i], ast);
-                        }
-                        Vector_Push(traversals, op);
-                    }
-                } else {
-                    AlgebraicExpression *exp = exps[expCount-1];
-                    selectEntryPoint(exp, filter_tree);
-                    // Create SCAN operation.
-                    if(exp->dest_node->label) {
-                        /* There's no longer need for the first matrix operand
-                         * as it's been replaced by label scan. */
-                        AlgebraicExpression_RemoveTerm(exp, 0, NULL);
-                        op = NewNodeByLabelScanOp(exp->dest_node, ast);
-                        Vector_Push(traversals, op);
-                    } else {
-                        op = NewAllNodeScanOp(g, exp->dest_node, ast);
-                        Vector_Push(traversals, op);
-                    }
-
-                    for(int i = expCount-1; i >= 0; i--) {
-                        if(exps[i]->operand_count == 0) continue;
-                        AlgebraicExpression_Transpose(exps[i]);
-                        if(exps[i]->edgeLength) {
-                            op = NewCondVarLenTraverseOp(exps[i],
-                                                         exps[i]->edgeLength->minHops,
-                                                         exps[i]->edgeLength->maxHops,
-                                                         g,
-                                                         ast);
-                        }
-                        else {
-                            op = NewCondTraverseOp(exps[i], ast);
-                        }
-                        Vector_Push(traversals, op);
-                    }
+                /* Scan entry node, expressions to its left are traversed
+                 * transposed, from right to left, followed by the expressions to its right. */
+                int entry = determineTraverseOrder(filter_tree, exps, expCount);
+
+                // Create SCAN operation, using the first expression to traverse.
+                AlgebraicExpression *exp = exps[entry > 0 ? entry - 1 : 0];
+                if(entry > 0) AlgebraicExpression_Transpose(exp);
+                op = _ExecutionPlan_EntryPointScan(g, exp, ast);
+                Vector_Push(traversals, op);
+
+                for(int i = entry - 1; i >= 0; i--) {
+                    if(exps[i]->operand_count == 0) continue;
+                    // Expression leading to the entry point is already transposed.
+                    if(i < entry - 1) AlgebraicExpression_Transpose(exps[i]);
+                    op = _ExecutionPlan_TraverseOp(g, exps[i], ast);
+                    Vector_Push(traversals, op);
+                }
+
+                for(int i = entry; i < expCount; i++) {
+                    if(exps[i]->operand_count == 0) continue;
+                    op = _ExecutionPlan_TraverseOp(g, exps[i], ast);
+                    Vector_Push(traversals, op);
                 }
                 // Free the expressions array, as its parts have been converted into operations
                 free(exps);
@@ -469,6 +490,20 @@ ExecutionPlan* _NewExecutionPlan(RedisModuleCtx *ctx, AST *ast, ResultSet *resul
             Vector_Clear(traversals);
         }
         Vector_Free(traversals);
+
+        for(int i = 0; i < Vector_Size(shortestPaths); i++) {
+            Vector *pattern;
+            AST_NodeEntity *src;
+            AST_LinkEntity *link;
+            AST_NodeEntity *dest;
+            Vector_Get(shortestPaths, i, &pattern);
+            Vector_Get(pattern, 0, &src);
+            Vector_Get(pattern, 1, &link);
+            Vector_Get(pattern, 2, &dest);
+            op = NewShortestPathOp(g, ast, src, link, dest);
+            Vector_Push(ops, op);
+        }
+        Vector_Free(shortestPaths);
     }
 
     if(ast->unwindNode) {
@@ -522,7 +557,8 @@ ExecutionPlan* _NewExecutionPlan(RedisModuleCtx *ctx, AST *ast, ResultSet *resul
     }
 
     if(ast->returnNode && ast->returnNode->distinct) {
-        op = NewDistinctOp();
+        // Pre-size distinct set by the number of nodes in the graph.
+        op = NewDistinctOp(Graph_NodeCount(gc->g));
         Vector_Push(ops, op);
     }
 
@@ -532,12 +568,12 @@ ExecutionPlan* _NewExecutionPlan(RedisModuleCtx *ctx, AST *ast, ResultSet *resul
     }
 
     if(ast->skipNode) {
-        OpBase *op_skip = NewSkipOp(ast->skipNode->skip);
+        OpBase *op_skip = NewSkipOp(ast->skipNode);
         Vector_Push(ops, op_skip);
     }
 
     if(ast->limitNode) {
-        OpBase *op_limit = NewLimitOp(ast->limitNode->limit);
+        OpBase *op_limit = NewLimitOp(ast->limitNode);
         Vector_Push(ops, op_limit);
     }
 
@@ -655,9 +691,141 @@ ExecutionPlan* NewExecutionPlan(RedisModuleCtx *ctx, AST **ast, ResultSet *resul
         optimizePlan(plan, ast[i]);
     }
 
+    /* Filters are fused into scans once every segment had been optimized,
+     * as optimizations expect filters to be standalone operations. */
+    fuseScanFilters(plan);
+    plan->version = Graph_GetVersion(GraphContext_GetFromTLS()->g);
+
     return plan;
 }
 
+/* Operations which process each record independently of others,
+ * multiple copies of these can run concurrently. */
+static inline bool _ParallelSafeOperation(const OpBase *op) {
+    return (op->type == OPType_FILTER ||
+            op->type == OPType_CONDITIONAL_TRAVERSE ||
+            op->type == OPType_CONDITIONAL_VAR_LEN_TRAVERSE ||
+            op->type == OPType_CONDITIONAL_VAR_LEN_REACH ||
+            op->type == OPType_SHORTEST_PATH ||
+            op->type == OPType_EXPAND_INTO ||
+            op->type == OPType_PROJECT);
+}
+
+/* Operations at which parallel pipelines are merged. */
+static inline bool _PipelineBreaker(const OpBase *op) {
+    return (op->type == OPType_AGGREGATE ||
+            op->type == OPType_SORT ||
+            op->type == OPType_DISTINCT ||
+            op->type == OPType_SKIP ||
+            op->type == OPType_LIMIT ||
+            op->type == OPType_RESULTS);
+}
+
+static OpBase *_ExecutionPlan_SegmentTap(OpBase *segment) {
+    while(segment->childCount) segment = segment->children[0];
+    return segment;
+}
+
+/* Locates the topmost operation of the pipeline feeding the first
+ * pipeline breaker, returns NULL if plan doesn't qualify for parallel execution. */
+static OpBase *_ExecutionPlan_ParallelSegment(OpBase *root) {
+    // Plan must be a single chain of operations.
+    OpBase *op = root;
+    while(op->childCount == 1) op = op->children[0];
+    if(op->childCount > 1) return NULL;
+
+    // Chain must start with a partitionable scan.
+    if(op->type != OPType_ALL_NODE_SCAN &&
+       op->type != OPType_NODE_BY_LABEL_SCAN &&
+       op->type != OPType_INDEX_SCAN) return NULL;
+
+    // Climb up to the first pipeline breaker.
+    while(op->parent && _ParallelSafeOperation(op->parent)) op = op->parent;
+    if(!op->parent || !_PipelineBreaker(op->parent)) return NULL;
+    return op;
+}
+
+static void _ExecutionPlan_SetMorsels(OpBase *tap, MorselDispenser *morsels) {
+    switch(tap->type) {
+        case OPType_ALL_NODE_SCAN:
+            AllNodeScanSetMorsels(tap, morsels);
+            break;
+        case OPType_NODE_BY_LABEL_SCAN:
+            NodeByLabelScanSetMorsels(tap, morsels);
+            break;
+        case OPType_INDEX_SCAN:
+            IndexScanSetMorsels(tap, morsels);
+            break;
+        default:
+            assert(false);
+    }
+}
+
+/* Estimated number of morsels consumed by scan,
+ * index scans' output size is unknown. */
+static uint64_t _ExecutionPlan_TapMorsels(const OpBase *tap, const Graph *g) {
+    double nodes;
+    switch(tap->type) {
+        case OPType_ALL_NODE_SCAN:
+            nodes = Graph_NodeCount(g);
+            break;
+        case OPType_NODE_BY_LABEL_SCAN:
+            nodes = CostModel_LabelCardinality(((NodeByLabelScan*)tap)->node->label);
+            break;
+        default:
+            return UINT64_MAX;
+    }
+    return (uint64_t)(nodes + MORSEL_SIZE - 1) / MORSEL_SIZE;
+}
+
+void ExecutionPlan_Parallelize(ExecutionPlan *plan, RedisModuleCtx *ctx, AST **ast, uint workers) {
+    if(workers < 2) return;
+
+    OpBase *segment = _ExecutionPlan_ParallelSegment(plan->root);
+    if(!segment) return;
+
+    /* Scan's input is split into morsels, shared by all copies of the scan. */
+    OpBase *tap = _ExecutionPlan_SegmentTap(segment);
+    GraphContext *gc = GraphContext_GetFromTLS();
+    MorselDispenser *morsels;
+    if(tap->type == OPType_INDEX_SCAN) {
+        morsels = Morsel_NewIndexDispenser(((IndexScan*)tap)->iter);
+    } else {
+        morsels = Morsel_NewRangeDispenser(Graph_RequiredMatrixDim(gc->g));
+    }
+    _ExecutionPlan_SetMorsels(tap, morsels);
+
+    /* When segment feeds an aggregation, each worker aggregates its own
+     * partition, groups are merged by the original aggregation. */
+    OpBase *breaker = segment->parent;
+    bool partitioned = (breaker->type == OPType_AGGREGATE && AggregateMergeable(breaker));
+
+    OpBase *gather = NewGatherOp();
+    GatherSetInputSize(gather, _ExecutionPlan_TapMorsels(tap, gc->g));
+    ExecutionPlan_PushBelow(segment, gather);
+
+    /* Build a copy of the plan for each additional worker,
+     * the segment matching ours is handed to gather. */
+    for(uint i = 1; i < workers; i++) {
+        ExecutionPlan *copy = NewExecutionPlan(ctx, ast, plan->result_set, false);
+        OpBase *copy_segment = _ExecutionPlan_ParallelSegment(copy->root);
+        if(!copy_segment ||
+           copy_segment->type != segment->type ||
+           copy_segment->parent->type != breaker->type ||
+           _ExecutionPlan_SegmentTap(copy_segment)->type != tap->type) {
+            ExecutionPlanFree(copy);
+            break;
+        }
+        _ExecutionPlan_SetMorsels(_ExecutionPlan_SegmentTap(copy_segment), Morsel_Share(morsels));
+        if(partitioned) {
+            AggregateAddPartial(breaker, copy_segment->parent);
+            GatherAddStream(gather, copy, copy_segment->parent);
+        } else {
+            GatherAddStream(gather, copy, copy_segment);
+        }
+    }
+}
+
 void _ExecutionPlan_Print(const OpBase *op, RedisModuleCtx *ctx, char *buffer, int ident, int *op_count) {
     if(!op) return;
 
@@ -695,8 +863,9 @@ void _ExecutionPlanInit(OpBase *root) {
 }
 
 void ExecutionPlanInit(ExecutionPlan *plan) {
-    if(!plan) return;
+    if(!plan || plan->initialized) return;
     _ExecutionPlanInit(plan->root);
+    plan->initialized = true;
 }
 
 ResultSet* ExecutionPlan_Execute(ExecutionPlan *plan) {
@@ -708,6 +877,35 @@ ResultSet* ExecutionPlan_Execute(ExecutionPlan *plan) {
     return plan->result_set;
 }
 
+void ExecutionPlan_Reset(ExecutionPlan *plan) {
+    OpBase_Reset(plan->root);
+}
+
+static bool _ExecutionPlan_Rebind(OpBase *op) {
+    if(op->rebind && op->rebind(op) != OP_OK) return false;
+    for(int i = 0; i < op->childCount; i++) {
+        if(!_ExecutionPlan_Rebind(op->children[i])) return false;
+    }
+    return true;
+}
+
+bool ExecutionPlan_Rebind(ExecutionPlan *plan) {
+    uint64_t version = Graph_GetVersion(GraphContext_GetFromTLS()->g);
+    if(plan->version == version) return true;
+    if(!_ExecutionPlan_Rebind(plan->root)) return false;
+
+    // Operations might hold positions within data which changed since.
+    ExecutionPlan_Reset(plan);
+    plan->version = version;
+    return true;
+}
+
+void ExecutionPlan_SetResultSet(ExecutionPlan *plan, ResultSet *result_set) {
+    plan->result_set = result_set;
+    Results *results = (Results*)ExecutionPlan_LocateOp(plan->root, OPType_RESULTS);
+    if(results) results->result_set = result_set;
+}
+
 void _ExecutionPlanFreeRecursive(OpBase* op) {
     for(int i = 0; i < op->childCount; i++) {
         _ExecutionPlanFreeRecursive(op->children[i]);
@@ -27,6 +27,8 @@ typedef struct {
     QueryGraph *query_graph;
     ResultSet *result_set;
     FT_FilterNode *filter_tree;
+    bool initialized;           // Plan operations were initialized.
+    uint64_t version;           // Graph version plan's operations are bound to.
 } ExecutionPlan;
 
 /* Creates a new execution plan from AST */
@@ -37,6 +39,19 @@ ExecutionPlan* NewExecutionPlan (
     bool explain            // Construct execution plan, do not execute
 );
 
+/* Splits the pipeline feeding the plan's first pipeline breaker
+ * (aggregate, sort, distinct, skip, limit, results) into workers copies,
+ * each scanning a different portion of the graph on its own thread.
+ * An aggregation over mergeable functions is computed by each worker
+ * on its own portion and combined once all workers are done.
+ * Plan is left intact if it doesn't qualify for parallel execution. */
+void ExecutionPlan_Parallelize (
+    ExecutionPlan *plan,    // Plan to parallelize
+    RedisModuleCtx *ctx,    // Module-level context
+    AST **ast,              // Query parsed AST, used to build pipeline copies
+    uint workers            // Degree of parallelism
+);
+
 /* Prints execution plan. */
 void ExecutionPlan_Print(const ExecutionPlan *plan, RedisModuleCtx *ctx);
 
@@ -64,9 +79,23 @@ OpBase* ExecutionPlan_LocateOp(OpBase *root, OPType type);
  * e.g. SCAN operations */
 void ExecutionPlan_Taps(OpBase *root, OpBase ***taps);
 
+/* Initializes plan operations, called once prior to execution. */
+void ExecutionPlanInit(ExecutionPlan *plan);
+
 /* Executes plan */
 ResultSet* ExecutionPlan_Execute(ExecutionPlan *plan);
 
+/* Resets plan operations, such that plan can be executed again. */
+void ExecutionPlan_Reset(ExecutionPlan *plan);
+
+/* Rebinds plan operations to the graph's current data, such that a plan
+ * built against an older graph version can be executed again, plan is reset.
+ * Returns false if an operation can't be rebound, the plan should be rebuilt. */
+bool ExecutionPlan_Rebind(ExecutionPlan *plan);
+
+/* Directs plan's results into result_set. */
+void ExecutionPlan_SetResultSet(ExecutionPlan *plan, ResultSet *result_set);
+
 /* Free execution plan */
 void ExecutionPlanFree(ExecutionPlan *plan);
 
@@ -0,0 +1,75 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Redis Labs Source Available License Agreement
+*/
+
+#include "morsel.h"
+#include "../util/rmalloc.h"
+#include <assert.h>
+
+static MorselDispenser *_Morsel_New(uint64_t end, IndexIter *iter) {
+    MorselDispenser *dispenser = rm_malloc(sizeof(MorselDispenser));
+    dispenser->next = 0;
+    dispenser->end = end;
+    dispenser->iter = iter;
+    dispenser->refcount = 1;
+    assert(pthread_mutex_init(&dispenser->lock, NULL) == 0);
+    return dispenser;
+}
+
+MorselDispenser *Morsel_NewRangeDispenser(uint64_t end) {
+    return _Morsel_New(end, NULL);
+}
+
+MorselDispenser *Morsel_NewIndexDispenser(IndexIter *iter) {
+    assert(iter);
+    return _Morsel_New(0, iter);
+}
+
+MorselDispenser *Morsel_Share(MorselDispenser *dispenser) {
+    __atomic_fetch_add(&dispenser->refcount, 1, __ATOMIC_RELAXED);
+    return dispenser;
+}
+
+bool Morsel_NextRange(MorselDispenser *dispenser, uint64_t *start, uint64_t *end) {
+    assert(dispenser->iter == NULL);
+    uint64_t s = __atomic_fetch_add(&dispenser->next, MORSEL_SIZE, __ATOMIC_RELAXED);
+    if(s >= dispenser->end) return false;
+
+    *start = s;
+    *end = s + MORSEL_SIZE;
+    if(*end > dispenser->end) *end = dispenser->end;
+    return true;
+}
+
+uint Morsel_NextIDs(MorselDispenser *dispenser, GrB_Index *ids, uint cap) {
+    assert(dispenser->iter);
+    uint count = 0;
+    GrB_Index *id;
+
+    pthread_mutex_lock(&dispenser->lock);
+    while(count < cap && (id = IndexIter_Next(dispenser->iter))) ids[count++] = *id;
+    pthread_mutex_unlock(&dispenser->lock);
+
+    return count;
+}
+
+void Morsel_SetEnd(MorselDispenser *dispenser, uint64_t end) {
+    pthread_mutex_lock(&dispenser->lock);
+    dispenser->end = end;
+    pthread_mutex_unlock(&dispenser->lock);
+}
+
+void Morsel_Reset(MorselDispenser *dispenser) {
+    pthread_mutex_lock(&dispenser->lock);
+    __atomic_store_n(&dispenser->next, 0, __ATOMIC_RELAXED);
+    if(dispenser->iter) IndexIter_Reset(dispenser->iter);
+    pthread_mutex_unlock(&dispenser->lock);
+}
+
+void Morsel_Free(MorselDispenser *dispenser) {
+    if(__atomic_sub_fetch(&dispenser->refcount, 1, __ATOMIC_RELAXED) > 0) return;
+    pthread_mutex_destroy(&dispenser->lock);
+    rm_free(dispenser);
+}
@@ -0,0 +1,56 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Redis Labs Source Available License Agreement
+*/
+
+#ifndef __MORSEL_H__
+#define __MORSEL_H__
+
+#include <pthread.h>
+#include <stdint.h>
+#include "../index/index.h"
+
+#define MORSEL_SIZE 1024    // Number of node IDs handed out at once.
+
+/* MorselDispenser splits the input of a scan operation into small
+ * chunks (morsels), which are handed out on demand to the copies
+ * of a scan running on different threads.
+ * Morsels are either ID ranges, or batches of IDs pulled from
+ * an index iterator shared by all copies. */
+typedef struct {
+    uint64_t next;          // Start of next ID range.
+    uint64_t end;           // End of ID range (exclusive).
+    IndexIter *iter;        // Shared index iterator, NULL when dispensing ID ranges.
+    pthread_mutex_t lock;   // Guards index iterator.
+    uint refcount;          // Number of scan operations using dispenser.
+} MorselDispenser;
+
+/* Creates a dispenser over node IDs [0, end). */
+MorselDispenser *Morsel_NewRangeDispenser(uint64_t end);
+
+/* Creates a dispenser over node IDs produced by iter,
+ * iter is not owned by the dispenser. */
+MorselDispenser *Morsel_NewIndexDispenser(IndexIter *iter);
+
+/* Registers an additional user of the dispenser. */
+MorselDispenser *Morsel_Share(MorselDispenser *dispenser);
+
+/* Retrieves the next ID range [start, end),
+ * returns false once all ranges were handed out. */
+bool Morsel_NextRange(MorselDispenser *dispenser, uint64_t *start, uint64_t *end);
+
+/* Fills ids with up to cap IDs pulled from the shared index iterator,
+ * returns number of IDs retrieved, 0 once iterator is depleted. */
+uint Morsel_NextIDs(MorselDispenser *dispenser, GrB_Index *ids, uint cap);
+
+/* Sets the end of the dispensed ID range, as the graph grew or shrank. */
+void Morsel_SetEnd(MorselDispenser *dispenser, uint64_t end);
+
+/* Rewinds dispenser to its initial state. */
+void Morsel_Reset(MorselDispenser *dispenser);
+
+/* Releases a reference to dispenser, frees it once unused. */
+void Morsel_Free(MorselDispenser *dispenser);
+
+#endif
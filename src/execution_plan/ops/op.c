@@ -17,6 +17,7 @@ void OpBase_Init(OpBase *op) {
     op->init = NULL;
     op->consume = NULL;
     op->reset = NULL;
+    op->rebind = NULL;
     op->free = NULL;
 }
 
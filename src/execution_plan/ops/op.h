@@ -41,6 +41,9 @@ typedef enum {
     OPType_EXPAND_INTO = (1<<20),
     OPType_NODE_BY_ID_SEEK = (1<<21),
     OPType_PROC_CALL = (1<<22),
+    OPType_GATHER = (1<<23),
+    OPType_CONDITIONAL_VAR_LEN_REACH = (1<<24),
+    OPType_SHORTEST_PATH = (1<<25),
 } OPType;
 
 #define OP_SCAN (OPType_ALL_NODE_SCAN | OPType_NODE_BY_LABEL_SCAN | OPType_INDEX_SCAN | OPType_NODE_BY_ID_SEEK)
@@ -57,6 +60,7 @@ struct OpBase;
 typedef OpResult (*fpInit)(struct OpBase*);
 typedef Record (*fpConsume)(struct OpBase*);
 typedef OpResult (*fpReset)(struct OpBase*);
+typedef OpResult (*fpRebind)(struct OpBase*);
 typedef void (*fpFree)(struct OpBase*);
 
 struct OpBase {
@@ -64,6 +68,7 @@ struct OpBase {
     fpInit init;                // Called once before execution.
     fpConsume consume;          // Produce next record.
     fpReset reset;              // Reset operation state.
+    fpRebind rebind;            // Rebind state derived from graph's data, NULL if there's none.
     fpFree free;                // Free operation.
     char *name;                 // Operation name.
     Vector *modifies;           // List of aliases, this op modifies.
@@ -11,6 +11,7 @@
 #include "../../grouping/group.h"
 #include "../../query_executor.h"
 #include "../../arithmetic/aggregate.h"
+#include "../../arithmetic/repository.h"
 
 static AR_ExpNode** _getOrderExpressions(OpBase *op) {
     if(op == NULL) return NULL;
@@ -47,22 +48,36 @@ static void _classify_expressions(OpAggregate *op) {
     }
 }
 
-static AR_ExpNode** _build_aggregated_expressions(OpAggregate *op) {
-    AR_ExpNode **agg_exps = array_new(AR_ExpNode*, 1);
-    
+/* Collects the aggregation node of each aggregated expression,
+ * these act as templates for per group aggregation state. */
+static void _collect_aggregation_nodes(OpAggregate *op) {
+    op->agg_nodes = array_new(AR_ExpNode*, 1);
+
     for(uint i = 0; i < array_len(op->expressions); i++) {
         if(op->expression_classification[i] == NONE_AGGREGATED) continue;
-        AR_ExpNode *exp = AR_EXP_Clone(op->expressions[i]);
-        agg_exps = array_append(agg_exps, exp);
+        AR_ExpNode *agg_node;
+        AR_EXP_ContainsAggregation(op->expressions[i], &agg_node);
+        op->agg_nodes = array_append(op->agg_nodes, agg_node);
     }
+}
 
-    return agg_exps;
+/* Get a fresh aggregation context for each aggregated expression. */
+static AggCtx** _build_aggregation_functions(OpAggregate *op) {
+    uint agg_count = array_len(op->agg_nodes);
+    if(agg_count == 0) return NULL;
+
+    AggCtx **funcs = rm_malloc(sizeof(AggCtx*) * agg_count);
+    for(uint i = 0; i < agg_count; i++) {
+        Agg_GetFunc(op->agg_nodes[i]->op.func_name, &funcs[i]);
+    }
+    return funcs;
 }
 
 static Group* _CreateGroup(OpAggregate *op, Record r) {
     /* Create a new group
      * Get a fresh copy of aggregation functions. */
-    AR_ExpNode **agg_exps = _build_aggregated_expressions(op);
+    uint agg_count = array_len(op->agg_nodes);
+    AggCtx **funcs = _build_aggregation_functions(op);
 
     /* Clone group keys. */
     uint key_count = array_len(op->none_aggregated_expressions);
@@ -75,8 +90,8 @@ static Group* _CreateGroup(OpAggregate *op, Record r) {
     }
 
     /* There's no need to keep a reference to record if we're not sorting groups. */
-    if(!op->order_exps) op->group = NewGroup(key_count, group_keys, agg_exps, NULL);
-    else op->group = NewGroup(key_count, group_keys, agg_exps, r);
+    if(!op->order_exps) op->group = NewGroup(key_count, group_keys, agg_count, funcs, NULL);
+    else op->group = NewGroup(key_count, group_keys, agg_count, funcs, r);
 
     return op->group;
 }
@@ -90,60 +105,28 @@ static void _ComputeGroupKey(OpAggregate *op, Record r) {
     }
 }
 
-static void _ComputeGroupKeyStr(OpAggregate *op, char **key) {
-    uint none_agg_exp_count = array_len(op->none_aggregated_expressions);
-    if(none_agg_exp_count == 0) {
-        *key = rm_strdup("SINGLE_GROUP");
-        return;
-    }
-
-    // Determine required size for group key string representation.
-    size_t key_len = SIValue_StringConcatLen(op->group_keys, none_agg_exp_count);
-    *key = rm_malloc(sizeof(char) * key_len);
-    SIValue_StringConcat(op->group_keys, none_agg_exp_count, *key, key_len);
-}
-
 /* Retrieves group under which given record belongs to,
  * creates group if one doesn't exists. */
 static Group* _GetGroup(OpAggregate *op, Record r) {
-    char *group_key_str;
     // Construct group key.
     _ComputeGroupKey(op, r);
-
-    // First group created.
-    if(!op->group) {
-        op->group = _CreateGroup(op, r);
-        Group_KeyStr(op->group, &group_key_str);
-        CacheGroupAdd(op->groups, group_key_str, op->group);
-        rm_free(group_key_str);
-        return op->group;
-    }
-
-    // Evaluate none-aggregated fields, see if they match
-    // the last accessed group.
-    bool reuseLastAccessedGroup = true;
     uint expCount = array_len(op->none_aggregated_expressions);
-    for(uint i = 0; i < expCount; i++) {
-        if( reuseLastAccessedGroup &&
-            SIValue_Compare(op->group->keys[i], op->group_keys[i]) == 0 ) {
-            reuseLastAccessedGroup = true;
-        } else {
-            reuseLastAccessedGroup = false;
+
+    // See if we can reuse last accessed group,
+    // otherwise lookup group by key.
+    if(!op->group || !ValueTable_KeysEqual(op->group->keys, op->group_keys, expCount)) {
+        uint64_t hash = CacheGroupHash(op->groups, op->group_keys);
+        op->group = CacheGroupGet(op->groups, op->group_keys, hash);
+        if(!op->group) {
+            // Group does not exists, create it, group takes ownership over keys.
+            op->group = _CreateGroup(op, r);
+            CacheGroupAdd(op->groups, hash, op->group);
+            return op->group;
         }
     }
 
-    // See if we can reuse last accessed group.
-    if(reuseLastAccessedGroup) return op->group;
-
-    // Can't reuse last accessed group, lookup group by identifier key.
-    _ComputeGroupKeyStr(op, &group_key_str);
-    op->group = CacheGroupGet(op->groups, group_key_str);
-    if(op->group) return op->group;
-
-    // Group does not exists, create it.
-    op->group = _CreateGroup(op, r);
-    CacheGroupAdd(op->groups, group_key_str, op->group);
-    rm_free(group_key_str);
+    // Group exists, computed keys are no longer needed.
+    for(uint i = 0; i < expCount; i++) SIValue_Free(&op->group_keys[i]);
     return op->group;
 }
 
@@ -153,10 +136,13 @@ static void _aggregateRecord(OpAggregate *op, Record r) {
     assert(group);
 
     // Aggregate group expressions.
-    uint aggFuncCount = array_len(group->aggregationFunctions);
-    for(uint i = 0; i < aggFuncCount; i++) {
-        AR_ExpNode *exp = group->aggregationFunctions[i];
-        AR_EXP_Aggregate(exp, r);
+    for(uint i = 0; i < group->func_count; i++) {
+        AR_ExpNode *agg_node = op->agg_nodes[i];
+        SIValue args[agg_node->op.child_count];
+        for(int j = 0; j < agg_node->op.child_count; j++) {
+            args[j] = AR_EXP_Evaluate(agg_node->op.children[j], r);
+        }
+        Agg_Step(group->aggregationFunctions[i], args, agg_node->op.child_count);
     }
 
     /* Free record, incase it is not group representative.
@@ -164,30 +150,74 @@ static void _aggregateRecord(OpAggregate *op, Record r) {
     Record_Free(r);
 }
 
+/* Folds groups built by partial aggregations into op's groups. */
+static void _mergePartials(OpAggregate *op) {
+    uint partial_count = array_len(op->partials);
+    for(uint i = 0; i < partial_count; i++) {
+        Group *partial_group;
+        OpAggregate *partial = op->partials[i];
+        CacheGroupIterator *it = CacheGroupIter(partial->groups);
+
+        while(CacheGroupIterNext(it, &partial_group)) {
+            uint64_t hash = CacheGroupHash(op->groups, partial_group->keys);
+            Group *group = CacheGroupGet(op->groups, partial_group->keys, hash);
+
+            if(!group) {
+                /* Group is new to op, take over partial group's keys
+                 * and representative record, aggregation state is
+                 * merged below. */
+                group = NewGroup(partial_group->key_count, partial_group->keys,
+                                 array_len(op->agg_nodes), _build_aggregation_functions(op), NULL);
+                group->r = partial_group->r;
+                partial_group->keys = NULL;
+                partial_group->r = NULL;
+                CacheGroupAdd(op->groups, hash, group);
+            }
+
+            for(uint j = 0; j < group->func_count; j++) {
+                Agg_Merge(group->aggregationFunctions[j], partial_group->aggregationFunctions[j]);
+            }
+        }
+        CacheGroupIterator_Free(it);
+    }
+}
+
+/* Evaluates aggregated expression against group's aggregation state. */
+static SIValue _evaluateAggregation(OpAggregate *op, AR_ExpNode *exp, uint aggIdx, Group *group) {
+    AggCtx *ctx = group->aggregationFunctions[aggIdx];
+    Agg_Finalize(ctx);
+
+    /* Temporarily bind group's state to the expression's aggregation node. */
+    AR_ExpNode *agg_node = op->agg_nodes[aggIdx];
+    AggCtx *node_ctx = agg_node->op.agg_func;
+    agg_node->op.agg_func = ctx;
+    SIValue res = AR_EXP_Evaluate(exp, NULL);
+    agg_node->op.agg_func = node_ctx;
+
+    return res;
+}
+
 /* Returns a record populated with group data. */
 static Record _handoff(OpAggregate *op) {
-    char *key;
     Group *group;
     if(!op->groupIter) return NULL;
-    if(!CacheGroupIterNext(op->groupIter, &key, &group)) return NULL;
+    if(!CacheGroupIterNext(op->groupIter, &group)) return NULL;
 
     Record r = Record_New(op->exp_count + op->order_exp_count);
 
     // Populate record.
-    uint aggIdx = 0; // Index into group aggregated expressions.
+    uint aggIdx = 0; // Index into group aggregation functions.
     uint keyIdx = 0; // Index into group keys.
     
     for(uint i = 0; i < op->exp_count; i++) {
         SIValue res;
         if(op->expression_classification[i] == AGGREGATED) {
             // Aggregated expression, get aggregated value.
-            AR_ExpNode *exp = group->aggregationFunctions[aggIdx++];
-            AR_EXP_Reduce(exp);
-            res = AR_EXP_Evaluate(exp, NULL);
+            res = _evaluateAggregation(op, op->expressions[i], aggIdx++, group);
             Record_AddScalar(r, i, res);
         } else {
             // None aggregated expression.
-            res = group->keys[keyIdx++];
+            res = SI_ShallowCopy(group->keys[keyIdx++]);
             Record_Add(r, i, res);
         }
 
@@ -227,7 +257,10 @@ OpBase* NewAggregateOp(AST *ast, AR_ExpNode **expressions, char **aliases) {
     aggregate->group = NULL;
     aggregate->groupIter = NULL;
     aggregate->group_keys = NULL;
-    aggregate->groups = CacheGroupNew();
+    aggregate->agg_nodes = NULL;
+    aggregate->groups = NULL;
+    aggregate->partial = false;
+    aggregate->partials = NULL;
 
     OpBase_Init(&aggregate->op);
     aggregate->op.name = "Aggregate";
@@ -245,9 +278,26 @@ OpBase* NewAggregateOp(AST *ast, AR_ExpNode **expressions, char **aliases) {
     return (OpBase*)aggregate;
 }
 
+bool AggregateMergeable(const OpBase *opBase) {
+    const OpAggregate *op = (const OpAggregate*)opBase;
+    for(uint i = 0; i < op->exp_count; i++) {
+        if(!AR_EXP_Mergeable(op->expressions[i])) return false;
+    }
+    return true;
+}
+
+void AggregateAddPartial(OpBase *opBase, OpBase *partial) {
+    assert(partial->type == OPType_AGGREGATE);
+    OpAggregate *op = (OpAggregate*)opBase;
+    if(!op->partials) op->partials = array_new(OpAggregate*, 1);
+    ((OpAggregate*)partial)->partial = true;
+    op->partials = array_append(op->partials, (OpAggregate*)partial);
+}
+
 OpResult AggregateInit(OpBase *opBase) {
     OpAggregate *op = (OpAggregate*)opBase;
     _classify_expressions(op);
+    _collect_aggregation_nodes(op);
     AR_ExpNode **order_exps = _getOrderExpressions(opBase->parent);
     if (order_exps) {
         op->order_exps = order_exps;
@@ -257,6 +307,7 @@ OpResult AggregateInit(OpBase *opBase) {
     /* Allocate memory for group keys. */
     uint noneAggExpCount = array_len(op->none_aggregated_expressions);
     if(noneAggExpCount) op->group_keys = rm_malloc(sizeof(SIValue) * noneAggExpCount);
+    op->groups = CacheGroupNew(noneAggExpCount);
     return OP_OK;
 }
 
@@ -269,6 +320,13 @@ Record AggregateConsume(OpBase *opBase) {
     Record r;
     while((r = child->consume(child))) _aggregateRecord(op, r);
 
+    // Partial aggregations hand their groups over to parent aggregation.
+    if(op->partial) return NULL;
+
+    /* Partial aggregations are done by now,
+     * as child depletes only once all partitions are consumed. */
+    if(op->partials) _mergePartials(op);
+
     op->groupIter = CacheGroupIter(op->groups);
     return _handoff(op);
 }
@@ -276,8 +334,10 @@ Record AggregateConsume(OpBase *opBase) {
 OpResult AggregateReset(OpBase *opBase) {
     OpAggregate *op = (OpAggregate*)opBase;
 
+    uint noneAggExpCount = array_len(op->none_aggregated_expressions);
     FreeGroupCache(op->groups);
-    op->groups = CacheGroupNew();
+    op->groups = CacheGroupNew(noneAggExpCount);
+    op->group = NULL;
 
     if(op->groupIter) {
         CacheGroupIterator_Free(op->groupIter);
@@ -295,6 +355,8 @@ void AggregateFree(OpBase *opBase) {
     if(op->groupIter) CacheGroupIterator_Free(op->groupIter);
     if(op->expression_classification) rm_free(op->expression_classification);
     if(op->none_aggregated_expressions) array_free(op->none_aggregated_expressions);
+    if(op->partials) array_free(op->partials);
+    if(op->agg_nodes) array_free(op->agg_nodes);
 
     if(op->expressions) {
         uint expCount = array_len(op->expressions);
@@ -303,5 +365,5 @@ void AggregateFree(OpBase *opBase) {
     }
     array_free(op->aliases);
 
-    FreeGroupCache(op->groups);
+    if(op->groups) FreeGroupCache(op->groups);
 }
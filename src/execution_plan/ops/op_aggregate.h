@@ -24,7 +24,7 @@ typedef enum {
 /* Aggregate
  * aggregates graph according to  
  * return clause */
- typedef struct {
+ typedef struct OpAggregate {
     OpBase op;
     AST *ast;
     char **aliases;
@@ -34,13 +34,25 @@ typedef enum {
     unsigned short order_exp_count;
     AR_ExpNode **none_aggregated_expressions;      /* Array of arithmetic expression. */
     ExpClassification *expression_classification;  /* classifies expression as aggregated/none aggregated.  */
+    AR_ExpNode **agg_nodes;                        /* Aggregation node of each aggregated expression. */
     Group *group;                                  /* Last accessed group. */
-    TrieMap *groups;
+    CacheGroup *groups;
     SIValue *group_keys;                           /* Array of values composing an aggregated group. */
     CacheGroupIterator *groupIter;
+    bool partial;                                  /* Aggregates a single partition, groups are collected by a parent aggregation. */
+    struct OpAggregate **partials;                 /* Aggregations over additional partitions, merged upon depletion. */
  } OpAggregate;
 
 OpBase* NewAggregateOp(AST *ast, AR_ExpNode **expressions, char **aliases);
+
+/* Returns true if all aggregation functions used by op can be merged. */
+bool AggregateMergeable(const OpBase *opBase);
+
+/* Introduce an aggregation over a different partition of op's input,
+ * partial is switched to only build groups, which op merges into its own
+ * once its child is depleted. */
+void AggregateAddPartial(OpBase *opBase, OpBase *partial);
+
 OpResult AggregateInit(OpBase *opBase);
 Record AggregateConsume(OpBase *opBase);
 OpResult AggregateReset(OpBase *opBase);
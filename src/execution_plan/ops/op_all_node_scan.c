@@ -6,10 +6,17 @@
 
 #include "op_all_node_scan.h"
 #include "../../parser/ast.h"
+#include <assert.h>
+#include <string.h>
 
 OpBase* NewAllNodeScanOp(const Graph *g, Node *n, AST *ast) {
     AllNodeScan *allNodeScan = malloc(sizeof(AllNodeScan));
+    allNodeScan->g = g;
     allNodeScan->iter = Graph_ScanNodes(g);
+    allNodeScan->morsels = NULL;
+    allNodeScan->filterTree = NULL;
+    allNodeScan->selection = 0;
+    memset(allNodeScan->batch, 0, sizeof(allNodeScan->batch));
 
     allNodeScan->nodeRecIdx = AST_GetAliasID(ast, n->alias);
     allNodeScan->recLength = AST_AliasCount(ast);
@@ -20,6 +27,7 @@ OpBase* NewAllNodeScanOp(const Graph *g, Node *n, AST *ast) {
     allNodeScan->op.type = OPType_ALL_NODE_SCAN;
     allNodeScan->op.consume = AllNodeScanConsume;
     allNodeScan->op.reset = AllNodeScanReset;
+    allNodeScan->op.rebind = AllNodeScanRebind;
     allNodeScan->op.free = AllNodeScanFree;
     allNodeScan->op.modifies = NewVector(char*, 1);
 
@@ -28,26 +36,112 @@ OpBase* NewAllNodeScanOp(const Graph *g, Node *n, AST *ast) {
     return (OpBase*)allNodeScan;
 }
 
+// Replace iterator with one scanning the next morsel.
+static bool _AllNodeScan_NextMorsel(AllNodeScan *op) {
+    uint64_t start;
+    uint64_t end;
+    if(!Morsel_NextRange(op->morsels, &start, &end)) return false;
+
+    DataBlockIterator_Free(op->iter);
+    op->iter = Graph_ScanNodeRange(op->g, start, end);
+    return true;
+}
+
+void AllNodeScanSetMorsels(OpBase *opBase, MorselDispenser *morsels) {
+    AllNodeScan *op = (AllNodeScan*)opBase;
+    op->morsels = morsels;
+    // Start off with an empty range, morsels are pulled on demand.
+    DataBlockIterator_Free(op->iter);
+    op->iter = Graph_ScanNodeRange(op->g, 0, 0);
+}
+
+void AllNodeScanSetFilter(OpBase *opBase, FT_FilterNode *filterTree) {
+    AllNodeScan *op = (AllNodeScan*)opBase;
+    assert(!op->filterTree);
+    op->filterTree = filterTree;
+    op->op.name = "Filtered All Node Scan";
+}
+
+// Retrieves the next scanned node, returns NULL when depleted.
+static Entity *_AllNodeScan_Next(AllNodeScan *op) {
+    Entity *en;
+    while((en = (Entity*)DataBlockIterator_Next(op->iter)) == NULL) {
+        // Current morsel depleted, move to the next one.
+        if(!op->morsels || !_AllNodeScan_NextMorsel(op)) return NULL;
+    }
+    return en;
+}
+
+// Produces the next record passing filters, nodes are filtered in batches.
+static Record _AllNodeScan_NextFiltered(AllNodeScan *op) {
+    while(!op->selection) {
+        Entity *en;
+        uint count = 0;
+        while(count < FILTER_BATCH_SIZE && (en = _AllNodeScan_Next(op))) {
+            // Reuse records rejected by filters.
+            if(!op->batch[count]) op->batch[count] = Record_New(op->recLength);
+            Node *n = Record_GetNode(op->batch[count], op->nodeRecIdx);
+            n->entity = en;
+            count++;
+        }
+        if(count == 0) return NULL;
+
+        op->selection = (count == FILTER_BATCH_SIZE) ? ~0ULL : (1ULL << count) - 1;
+        FilterTree_applyFiltersBatch(op->filterTree, op->batch, count, &op->selection);
+    }
+
+    // Hand out the next selected record.
+    int i = __builtin_ctzll(op->selection);
+    op->selection &= op->selection - 1;
+    Record r = op->batch[i];
+    op->batch[i] = NULL;
+    return r;
+}
+
 Record AllNodeScanConsume(OpBase *opBase) {
     AllNodeScan *op = (AllNodeScan*)opBase;
+    if(op->filterTree) return _AllNodeScan_NextFiltered(op);
+
+    Entity *en = _AllNodeScan_Next(op);
+    if(!en) return NULL;
 
-    Entity *en = (Entity*)DataBlockIterator_Next(op->iter);
-    if(en == NULL) return NULL;
-    
     Record r = Record_New(op->recLength);
     Node *n = Record_GetNode(r, op->nodeRecIdx);
     n->entity = en;
-
     return r;
 }
 
 OpResult AllNodeScanReset(OpBase *op) {
     AllNodeScan *allNodeScan = (AllNodeScan*)op;
-    DataBlockIterator_Reset(allNodeScan->iter);
+    // Drop selected records of the current batch, records are kept for reuse.
+    allNodeScan->selection = 0;
+    if(allNodeScan->morsels) {
+        Morsel_Reset(allNodeScan->morsels);
+        AllNodeScanSetMorsels(op, allNodeScan->morsels);
+    } else {
+        DataBlockIterator_Reset(allNodeScan->iter);
+    }
+    return OP_OK;
+}
+
+OpResult AllNodeScanRebind(OpBase *op) {
+    AllNodeScan *allNodeScan = (AllNodeScan*)op;
+    // Iterators are bound to the number of nodes at the time of their creation.
+    if(allNodeScan->morsels) {
+        Morsel_SetEnd(allNodeScan->morsels, Graph_RequiredMatrixDim(allNodeScan->g));
+    } else {
+        DataBlockIterator_Free(allNodeScan->iter);
+        allNodeScan->iter = Graph_ScanNodes(allNodeScan->g);
+    }
     return OP_OK;
 }
 
 void AllNodeScanFree(OpBase *ctx) {
     AllNodeScan *op = (AllNodeScan *)ctx;    
     DataBlockIterator_Free(op->iter);
+    if(op->morsels) Morsel_Free(op->morsels);
+    if(op->filterTree) FilterTree_Free(op->filterTree);
+    for(int i = 0; i < FILTER_BATCH_SIZE; i++) {
+        if(op->batch[i]) Record_Free(op->batch[i]);
+    }
 }
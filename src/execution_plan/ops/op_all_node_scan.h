@@ -13,12 +13,19 @@
 #include "../../graph/query_graph.h"
 #include "../../graph/entities/node.h"
 #include "../../util/datablock/datablock_iterator.h"
+#include "../morsel.h"
+#include "../../filter_tree/filter_tree.h"
 
 /* AllNodesScan
  * Scans entire graph */
  typedef struct {
     OpBase op;
+    const Graph *g;
     DataBlockIterator *iter;
+    MorselDispenser *morsels;   // Shared ID ranges, NULL when scanning entire graph.
+    FT_FilterNode *filterTree;  // Filters applied to scanned nodes, NULL if none.
+    Record batch[FILTER_BATCH_SIZE];    // Scanned records, rejected records are reused.
+    uint64_t selection;                 // Batch records passing filters, yet to be produced.
     uint nodeRecIdx;
     uint recLength;  // Number of entries in a record.
  } AllNodeScan;
@@ -26,6 +33,12 @@
 OpBase* NewAllNodeScanOp(const Graph *g, Node *n, AST *ast);
 Record AllNodeScanConsume(OpBase *opBase);
 OpResult AllNodeScanReset(OpBase *op);
+OpResult AllNodeScanRebind(OpBase *op);
+/* Restrict scan to ID ranges handed out by morsels. */
+void AllNodeScanSetMorsels(OpBase *op, MorselDispenser *morsels);
+/* Applies filterTree to scanned nodes in batches, records are only produced
+ * for nodes passing the filters, scan takes ownership over filterTree. */
+void AllNodeScanSetFilter(OpBase *op, FT_FilterNode *filterTree);
 void AllNodeScanFree(OpBase *ctx);
 
 #endif
@@ -6,11 +6,15 @@
 
 #include "op_cartesian_product.h"
 #include "../../parser/ast.h"
+#include "../../util/arr.h"
+#include "../../util/rmalloc.h"
 
 OpBase* NewCartesianProductOp(int record_len) {
     CartesianProduct *cp = malloc(sizeof(CartesianProduct));
     cp->init = true;    
     cp->r = Record_New(record_len);
+    cp->buffers = NULL;
+    cp->buffered_bytes = 0;
 
     // Set our Op operations
     OpBase_Init(&cp->op);
@@ -23,30 +27,114 @@ OpBase* NewCartesianProductOp(int record_len) {
     return (OpBase*)cp;
 }
 
+static inline size_t _RecordSize(const Record r) {
+    return sizeof(Entry) * (Record_length(r) + 1);
+}
+
+static void _StreamBuffer_Clear(CartesianProduct *cp, StreamBuffer *buffer) {
+    for(uint i = 0; i < array_len(buffer->records); i++) {
+        cp->buffered_bytes -= _RecordSize(buffer->records[i]);
+        Record_Free(buffer->records[i]);
+    }
+    array_clear(buffer->records);
+    buffer->cursor = 0;
+    buffer->materialized = false;
+}
+
+// Drop buffered records, stream will be re-executed from now on.
+static void _StreamBuffer_Abandon(CartesianProduct *cp, StreamBuffer *buffer) {
+    if(!buffer->records) return;
+    _StreamBuffer_Clear(cp, buffer);
+    array_free(buffer->records);
+    buffer->records = NULL;
+}
+
+static void _InitBuffers(CartesianProduct *cp) {
+    if(cp->buffers) return;
+    // Last stream is consumed only once, no need to buffer it.
+    int inner_streams = cp->op.childCount - 1;
+    cp->buffers = rm_malloc(sizeof(StreamBuffer) * inner_streams);
+    for(int i = 0; i < inner_streams; i++) {
+        cp->buffers[i].records = array_new(Record, 32);
+        cp->buffers[i].cursor = 0;
+        cp->buffers[i].materialized = false;
+    }
+}
+
+/* Pulls a record from stream streamIdx, either by consuming the stream
+ * or by replaying its buffer. owned is set to true if the caller
+ * is responsible for freeing the returned record. */
+static Record _ConsumeStream(CartesianProduct *cp, int streamIdx, bool *owned) {
+    OpBase *child = cp->op.children[streamIdx];
+    *owned = true;
+    if(streamIdx == cp->op.childCount - 1) return child->consume(child);
+
+    StreamBuffer *buffer = &cp->buffers[streamIdx];
+    if(buffer->materialized) {
+        *owned = false;
+        if(buffer->cursor < array_len(buffer->records)) return buffer->records[buffer->cursor++];
+        return NULL;
+    }
+
+    Record r = child->consume(child);
+    if(!buffer->records) return r;
+
+    if(!r) {
+        // Stream depleted, from now on replay buffered records.
+        buffer->materialized = true;
+        buffer->cursor = array_len(buffer->records);
+        return NULL;
+    }
+
+    size_t record_size = _RecordSize(r);
+    if(cp->buffered_bytes + record_size > CARTESIAN_PRODUCT_MATERIALIZE_CAP) {
+        // Memory cap reached, fallback to re-executing the stream.
+        _StreamBuffer_Abandon(cp, buffer);
+        return r;
+    }
+
+    cp->buffered_bytes += record_size;
+    buffer->records = array_append(buffer->records, r);
+    *owned = false;
+    return r;
+}
+
 static void _ResetStreams(CartesianProduct *cp, int streamIdx) {
-    // Reset each child stream, Reset propagates upwards.
-    for(int i = 0; i < streamIdx; i++) OpBase_Reset(cp->op.children[i]);    
+    for(int i = 0; i < streamIdx; i++) {
+        StreamBuffer *buffer = &cp->buffers[i];
+        if(buffer->materialized) {
+            // Replay buffered records.
+            buffer->cursor = 0;
+            continue;
+        }
+        // Partially buffered stream is about to be re-executed.
+        if(buffer->records) _StreamBuffer_Clear(cp, buffer);
+        // Reset child stream, Reset propagates upwards.
+        OpBase_Reset(cp->op.children[i]);
+    }
+}
+
+static void _MergeStreamRecord(CartesianProduct *cp, Record r, bool owned) {
+    Record_Merge(&cp->r, r);
+    if(owned) Record_Free(r);
 }
 
 static int _PullFromStreams(CartesianProduct *op) {
+    bool owned;
     for(int i = 1; i < op->op.childCount; i++) {
-        OpBase *child = op->op.children[i];
-        Record childRecord = child->consume(child);
+        Record childRecord = _ConsumeStream(op, i, &owned);
 
         if(childRecord) {
-            Record_Merge(&op->r, childRecord);
-            Record_Free(childRecord);
+            _MergeStreamRecord(op, childRecord, owned);
             /* Managed to get new data
              * Reset streams [0-i] */
             _ResetStreams(op, i);
 
             // Pull from resetted streams.
             for(int j = 0; j < i; j++) {
-                child = op->op.children[j];
-                childRecord = child->consume(child);
+                childRecord = _ConsumeStream(op, j, &owned);
                 if(childRecord) {
-                    Record_Merge(&op->r, childRecord);
-                    Record_Free(childRecord);                    
+                    _MergeStreamRecord(op, childRecord, owned);
                 } else {
                     return 0;
                 }
@@ -63,34 +151,30 @@ static int _PullFromStreams(CartesianProduct *op) {
 
 Record CartesianProductConsume(OpBase *opBase) {
     CartesianProduct *op = (CartesianProduct*)opBase;
-    OpResult res;
-    OpBase *child;
     Record childRecord;
+    bool owned;
 
     if(op->init) {
         op->init = false;
+        _InitBuffers(op);
 
         for(int i = 0; i < op->op.childCount; i++) {
-            child = op->op.children[i];
-            childRecord = child->consume(child);
+            childRecord = _ConsumeStream(op, i, &owned);
             if(!childRecord) {
                 // TODO: leak childRecord.
                 return NULL;
             }
-            Record_Merge(&op->r, childRecord);
-            Record_Free(childRecord);
+            _MergeStreamRecord(op, childRecord, owned);
         }
         return Record_Clone(op->r);
     }
 
     // Pull from first stream.
-    child = op->op.children[0];
-    childRecord = child->consume(child);
+    childRecord = _ConsumeStream(op, 0, &owned);
         
     if(childRecord) {
         // Managed to get data from first stream.
-        Record_Merge(&op->r, childRecord);
-        Record_Free(childRecord);
+        _MergeStreamRecord(op, childRecord, owned);
     } else {
         // Failed to get data from first stream,
         // try pulling other streams for data.
@@ -101,13 +185,28 @@ Record CartesianProductConsume(OpBase *opBase) {
     return Record_Clone(op->r);
 }
 
+static void _FreeBuffers(CartesianProduct *cp) {
+    if(!cp->buffers) return;
+    for(int i = 0; i < cp->op.childCount - 1; i++) {
+        _StreamBuffer_Abandon(cp, &cp->buffers[i]);
+    }
+    rm_free(cp->buffers);
+    cp->buffers = NULL;
+}
+
 OpResult CartesianProductReset(OpBase *opBase) {
     CartesianProduct *op = (CartesianProduct*)opBase;
     op->init = true;
+
+    /* Buffered records are only valid throughout a single execution,
+     * streams might produce different records once re-executed,
+     * e.g. a cached plan executed with different parameters. */
+    _FreeBuffers(op);
     return OP_OK;
 }
 
 void CartesianProductFree(OpBase *opBase) {
     CartesianProduct *op = (CartesianProduct*)opBase;
+    _FreeBuffers(op);
     Record_Free(op->r);
 }
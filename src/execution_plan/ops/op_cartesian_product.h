@@ -10,14 +10,29 @@
 #include "op.h"
 #include "../../parser/ast.h"
 
-/* Cartesian product AKA Join. 
- * Currently this operation is a NOP 
- * once execution plan refactoring will take place 
- * we'll implement its logic. */
+/* Maximum number of bytes a single cartesian product operation
+ * may spend on materializing its inner streams, once exceeded
+ * streams fall back to being re-executed on every reset. */
+#define CARTESIAN_PRODUCT_MATERIALIZE_CAP (64 * 1024 * 1024)
+
+/* Buffered records of an inner stream. */
+typedef struct {
+    Record *records;    // Buffered records, NULL if materialization was abandoned.
+    uint cursor;        // Replay position within records.
+    bool materialized;  // Stream had been fully buffered.
+} StreamBuffer;
+
+/* Cartesian product AKA Join.
+ * Inner streams (all but the last child) are consumed once,
+ * their records are buffered and replayed whenever the stream
+ * needs to be reset, instead of re-executing the stream.
+ * Buffers are dropped once the operation itself is reset. */
  typedef struct {
      OpBase op;
      bool init;
      Record r;
+     StreamBuffer *buffers;     // One buffer per inner stream.
+     size_t buffered_bytes;     // Memory consumed by buffers.
  } CartesianProduct;
 
 OpBase* NewCartesianProductOp(int record_len);
@@ -25,4 +40,4 @@ Record CartesianProductConsume(OpBase *opBase);
 OpResult CartesianProductReset(OpBase *opBase);
 void CartesianProductFree(OpBase *opBase);
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,166 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Redis Labs Source Available License Agreement
+*/
+
+#include <assert.h>
+
+#include "./op_cond_var_len_reach.h"
+#include "../../util/rmalloc.h"
+#include "../../util/matrix_pool.h"
+
+/* Expands every source in the current batch hop by hop,
+ * until maxHops is reached or no new nodes are discovered.
+ * F initially holds the sources, once done V holds every node reached. */
+static void _expand(CondVarLenReach *op) {
+    GrB_Index nvals;
+    GrB_Matrix_apply(op->V, NULL, NULL, GrB_IDENTITY_BOOL, op->F, NULL);
+
+    for(unsigned int hop = 0; hop < op->maxHops; hop++) {
+        // N = F * A
+        AlgebraicExpression_PrependTerm(op->ae, op->F, false, false);
+        AlgebraicExpression_Execute(op->ae, op->N);
+        AlgebraicExpression_RemoveTerm(op->ae, 0, NULL);
+
+        // Discard visited nodes, N<!V> = N
+        GrB_Matrix_apply(op->N, op->V, NULL, GrB_IDENTITY_BOOL, op->N, op->desc);
+        GrB_Matrix_nvals(&nvals, op->N);
+        if(nvals == 0) break;
+
+        // V += N, N becomes the frontier for the next hop.
+        GrB_eWiseAdd_Matrix_BinaryOp(op->V, NULL, NULL, GrB_LOR, op->V, op->N, NULL);
+        GrB_Matrix t = op->F;
+        op->F = op->N;
+        op->N = t;
+    }
+
+    GrB_Matrix_clear(op->F);
+    GrB_Matrix_clear(op->N);
+
+    if(op->iter == NULL) GxB_MatrixTupleIter_new(&op->iter, op->V);
+    else GxB_MatrixTupleIter_reuse(op->iter, op->V);
+}
+
+OpBase* NewCondVarLenReachOp(AlgebraicExpression *ae, unsigned int minHops, unsigned int maxHops, Graph *g, AST *ast) {
+    assert(ae && minHops <= 1 && minHops <= maxHops && g && ae->operand_count == 1);
+
+    CondVarLenReach *reach = calloc(1, sizeof(CondVarLenReach));
+    reach->g = g;
+    reach->ae = ae;
+    reach->srcNodeIdx = AST_GetAliasID(ast, ae->src_node->alias);
+    reach->destNodeIdx = AST_GetAliasID(ast, ae->dest_node->alias);
+    reach->minHops = minHops;
+    reach->maxHops = maxHops;
+    reach->iter = NULL;
+    reach->recordsLen = 0;
+    reach->recordsCap = 16;
+    reach->records = rm_calloc(reach->recordsCap, sizeof(Record));
+    reach->sources = rm_malloc(reach->recordsCap * sizeof(NodeID));
+
+    size_t required_dim = Graph_RequiredMatrixDim(g);
+    reach->F = MatrixPool_Borrow(GrB_BOOL, reach->recordsCap, required_dim);
+    reach->N = MatrixPool_Borrow(GrB_BOOL, reach->recordsCap, required_dim);
+    reach->V = MatrixPool_Borrow(GrB_BOOL, reach->recordsCap, required_dim);
+
+    GrB_Descriptor_new(&reach->desc);
+    GrB_Descriptor_set(reach->desc, GrB_MASK, GrB_SCMP);
+    GrB_Descriptor_set(reach->desc, GrB_OUTP, GrB_REPLACE);
+
+    // Set our Op operations
+    OpBase_Init(&reach->op);
+    reach->op.name = "Conditional Variable Length Reach";
+    reach->op.type = OPType_CONDITIONAL_VAR_LEN_REACH;
+    reach->op.consume = CondVarLenReachConsume;
+    reach->op.reset = CondVarLenReachReset;
+    reach->op.rebind = CondVarLenReachRebind;
+    reach->op.free = CondVarLenReachFree;
+    reach->op.modifies = NewVector(char*, 1);
+
+    const char *modified = ae->dest_node->alias;
+    Vector_Push(reach->op.modifies, modified);
+
+    return (OpBase*)reach;
+}
+
+Record CondVarLenReachConsume(OpBase *opBase) {
+    CondVarLenReach *op = (CondVarLenReach*)opBase;
+    OpBase *child = op->op.children[0];
+
+    bool depleted = true;
+    GrB_Index row;
+    NodeID dest_id;
+
+    while(true) {
+        if(op->iter) {
+            GxB_MatrixTupleIter_next(op->iter, &row, &dest_id, &depleted);
+            // Source is reachable from itself only by a path of length 0.
+            if(!depleted && op->minHops > 0 && dest_id == op->sources[row]) continue;
+        }
+
+        // Managed to get a tuple, break.
+        if(!depleted) break;
+
+        // Run out of tuples, free old records and ask child for data.
+        for(int i = 0; i < op->recordsLen; i++) Record_Free(op->records[i]);
+
+        for(op->recordsLen = 0; op->recordsLen < op->recordsCap; op->recordsLen++) {
+            Record childRecord = child->consume(child);
+            if(!childRecord) break;
+
+            op->records[op->recordsLen] = childRecord;
+            Node *n = Record_GetNode(childRecord, op->srcNodeIdx);
+            op->sources[op->recordsLen] = ENTITY_GET_ID(n);
+            GrB_Matrix_setElement_BOOL(op->F, true, op->recordsLen, op->sources[op->recordsLen]);
+        }
+
+        // No data.
+        if(op->recordsLen == 0) return NULL;
+
+        _expand(op);
+    }
+
+    Record r = op->records[row];
+    Node *destNode = Record_GetNode(r, op->destNodeIdx);
+    Graph_GetNode(op->g, dest_id, destNode);
+    return Record_Clone(r);
+}
+
+OpResult CondVarLenReachReset(OpBase *ctx) {
+    CondVarLenReach *op = (CondVarLenReach*)ctx;
+    for(int i = 0; i < op->recordsLen; i++) Record_Free(op->records[i]);
+    op->recordsLen = 0;
+    if(op->iter) {
+        GxB_MatrixTupleIter_free(op->iter);
+        op->iter = NULL;
+    }
+    GrB_Matrix_clear(op->F);
+    GrB_Matrix_clear(op->V);
+    return OP_OK;
+}
+
+OpResult CondVarLenReachRebind(OpBase *ctx) {
+    CondVarLenReach *op = (CondVarLenReach*)ctx;
+    if(!AlgebraicExpression_Rebind(op->ae, op->g)) return OP_ERR;
+
+    size_t required_dim = Graph_RequiredMatrixDim(op->g);
+    GxB_Matrix_resize(op->F, op->recordsCap, required_dim);
+    GxB_Matrix_resize(op->N, op->recordsCap, required_dim);
+    GxB_Matrix_resize(op->V, op->recordsCap, required_dim);
+    return OP_OK;
+}
+
+void CondVarLenReachFree(OpBase *ctx) {
+    CondVarLenReach *op = (CondVarLenReach*)ctx;
+    if(op->iter) GxB_MatrixTupleIter_free(op->iter);
+    if(op->F) MatrixPool_Return(&op->F);
+    if(op->N) MatrixPool_Return(&op->N);
+    if(op->V) MatrixPool_Return(&op->V);
+    GrB_free(&op->desc);
+    AlgebraicExpression_Free(op->ae);
+    if(op->records) {
+        for(int i = 0; i < op->recordsLen; i++) Record_Free(op->records[i]);
+        rm_free(op->records);
+    }
+    rm_free(op->sources);
+}
@@ -0,0 +1,48 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Redis Labs Source Available License Agreement
+*/
+
+#ifndef __OP_COND_VAR_LEN_REACH_H
+#define __OP_COND_VAR_LEN_REACH_H
+
+#include "op.h"
+#include "../../parser/ast.h"
+#include "../../graph/graph.h"
+#include "../../arithmetic/algebraic_expression.h"
+#include "../../../deps/GraphBLAS/Include/GraphBLAS.h"
+
+/* OP Variable length reach,
+ * produces each node reachable from source within [minHops, maxHops] hops once,
+ * regardless of the number of paths leading to it.
+ * Sources are processed in batches, each hop expands the frontier of
+ * every source in the batch with a single matrix multiplication,
+ * nodes visited in earlier hops are masked out.
+ * As distances are shortest path lengths, minHops must not exceed 1. */
+typedef struct {
+    OpBase op;
+    Graph *g;
+    AlgebraicExpression *ae;
+    int srcNodeIdx;             // Node set by operation.
+    int destNodeIdx;            // Node set by operation.
+    unsigned int minHops;       // Minimum number of hops to perform.
+    unsigned int maxHops;       // Maximum number of hops to perform.
+    GrB_Matrix F;               // Frontier, row i holds nodes first reached by source i.
+    GrB_Matrix N;               // Next frontier.
+    GrB_Matrix V;               // Visited nodes.
+    GrB_Descriptor desc;        // Complemented mask, replace output.
+    GxB_MatrixTupleIter *iter;  // Iterator over V.
+    NodeID *sources;            // Source node ID of each record.
+    int recordsCap;             // Max number of records to process.
+    int recordsLen;             // Number of records to process.
+    Record *records;            // Array of records.
+} CondVarLenReach;
+
+OpBase* NewCondVarLenReachOp(AlgebraicExpression *ae, unsigned int minHops, unsigned int maxHops, Graph *g, AST *ast);
+Record CondVarLenReachConsume(OpBase *opBase);
+OpResult CondVarLenReachReset(OpBase *ctx);
+OpResult CondVarLenReachRebind(OpBase *ctx);
+void CondVarLenReachFree(OpBase *ctx);
+
+#endif
@@ -88,19 +88,22 @@ Record CondVarLenTraverseConsume(OpBase *opBase) {
 
         Node *srcNode = Record_GetNode(op->r, op->srcNodeIdx);
 
-        AllPathsCtx_Free(op->allPathsCtx);
-        op->allPathsCtx = AllPathsCtx_New(srcNode,
-                                          op->g,
-                                          op->relationIDs,
-                                          op->relationIDsCount,
-                                          op->traverseDir,
-                                          op->minHops,
-                                          op->maxHops);
+        if(op->allPathsCtx) {
+            AllPathsCtx_Reset(op->allPathsCtx, srcNode);
+        } else {
+            op->allPathsCtx = AllPathsCtx_New(srcNode,
+                                              op->g,
+                                              op->relationIDs,
+                                              op->relationIDsCount,
+                                              op->traverseDir,
+                                              op->minHops,
+                                              op->maxHops);
+        }
     }
 
-    // For the timebeing we only care for the last node in path
-    Node n = Path_pop(p);
-    Path_free(p);
+    // For the timebeing we only care for the last node in path,
+    // path is owned by the context, no need to copy it.
+    Node n = p[Path_len(p) - 1];
 
     Record_AddNode(op->r, op->destNodeIdx, n);
     return Record_Clone(op->r);
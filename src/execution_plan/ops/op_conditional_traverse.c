@@ -6,6 +6,7 @@
 
 #include "op_conditional_traverse.h"
 #include "../../util/arr.h"
+#include "../../util/matrix_pool.h"
 #include "../../GraphBLASExt/GxB_Delete.h"
 
 static void _setupTraversedRelations(CondTraverse *op, GraphContext *gc) {
@@ -68,7 +69,8 @@ void _traverse(CondTraverse *op) {
 // which will be considered when evaluating an algebraic expression.
 static int _determinRecordCap(const AST *ast) {
     int recordsCap = 16;    // Default.
-    if(ast->limitNode) recordsCap = MIN(recordsCap, ast->limitNode->limit);
+    // Parameterized limit might change between executions.
+    if(ast->limitNode && !ast->limitNode->param) recordsCap = MIN(recordsCap, ast->limitNode->limit);
     return recordsCap;
 }
 
@@ -91,8 +93,8 @@ OpBase* NewCondTraverseOp(AlgebraicExpression *algebraic_expression, AST *ast) {
     traverse->recordsCap = _determinRecordCap(ast);
     traverse->records = rm_calloc(traverse->recordsCap, sizeof(Record));
     size_t required_dim = Graph_RequiredMatrixDim(gc->g);
-    GrB_Matrix_new(&traverse->M, GrB_BOOL, traverse->recordsCap, required_dim);
-    GrB_Matrix_new(&traverse->F, GrB_BOOL, traverse->recordsCap, required_dim);
+    traverse->M = MatrixPool_Borrow(GrB_BOOL, traverse->recordsCap, required_dim);
+    traverse->F = MatrixPool_Borrow(GrB_BOOL, traverse->recordsCap, required_dim);
 
     // Set our Op operations
     OpBase_Init(&traverse->op);
@@ -101,6 +103,7 @@ OpBase* NewCondTraverseOp(AlgebraicExpression *algebraic_expression, AST *ast) {
     traverse->op.consume = CondTraverseConsume;
     traverse->op.init = CondTraverseInit;
     traverse->op.reset = CondTraverseReset;
+    traverse->op.rebind = CondTraverseRebind;
     traverse->op.free = CondTraverseFree;
     traverse->op.modifies = NewVector(char*, 1);
 
@@ -216,7 +219,10 @@ Record CondTraverseConsume(OpBase *opBase) {
 
 OpResult CondTraverseReset(OpBase *ctx) {
     CondTraverse *op = (CondTraverse*)ctx;
-    if(op->r) Record_Free(op->r);
+    // Current record is one of the buffered records.
+    op->r = NULL;
+    for(int i = 0; i < op->recordsLen; i++) Record_Free(op->records[i]);
+    op->recordsLen = 0;
     if(op->edges) array_clear(op->edges);
     if(op->iter) {
         GxB_MatrixTupleIter_free(op->iter);
@@ -226,12 +232,23 @@ OpResult CondTraverseReset(OpBase *ctx) {
     return OP_OK;
 }
 
+OpResult CondTraverseRebind(OpBase *ctx) {
+    CondTraverse *op = (CondTraverse*)ctx;
+    if(!AlgebraicExpression_Rebind(op->algebraic_expression, op->graph)) return OP_ERR;
+
+    // Filter and result matrices must match the dimensions of graph's matrices.
+    size_t required_dim = Graph_RequiredMatrixDim(op->graph);
+    GxB_Matrix_resize(op->F, op->recordsCap, required_dim);
+    GxB_Matrix_resize(op->M, op->recordsCap, required_dim);
+    return OP_OK;
+}
+
 /* Frees CondTraverse */
 void CondTraverseFree(OpBase *ctx) {
     CondTraverse *op = (CondTraverse*)ctx;
     if(op->iter) GxB_MatrixTupleIter_free(op->iter);
-    if(op->F) GrB_Matrix_free(&op->F);
-    if(op->M) GrB_Matrix_free(&op->M);
+    if(op->F) MatrixPool_Return(&op->F);
+    if(op->M) MatrixPool_Return(&op->M);
     if(op->edges) array_free(op->edges);
     if(op->algebraic_expression) AlgebraicExpression_Free(op->algebraic_expression);
     if(op->edgeRelationTypes) array_free(op->edgeRelationTypes);
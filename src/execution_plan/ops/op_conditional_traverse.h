@@ -49,6 +49,9 @@ Record CondTraverseConsume(OpBase *opBase);
 /* Restart iterator */
 OpResult CondTraverseReset(OpBase *ctx);
 
+/* Rebinds algebraic expression and matrices to the graph's current data. */
+OpResult CondTraverseRebind(OpBase *ctx);
+
 /* Frees Traverse*/
 void CondTraverseFree(OpBase *ctx);
 
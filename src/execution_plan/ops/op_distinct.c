@@ -5,13 +5,11 @@
 */
 
 #include "op_distinct.h"
-#include "xxhash/xxhash.h"
-#include "util/arr.h" 
-#include "util/triemap/triemap.h" 
 
-OpBase* NewDistinctOp(ResultSet *resultset) {
+OpBase* NewDistinctOp(uint64_t expected_cardinality) {
     OpDistinct *self = malloc(sizeof(OpDistinct));
-    self->trie = NewTrieMap();
+    if(expected_cardinality > DISTINCT_MAX_PRESIZE) expected_cardinality = DISTINCT_MAX_PRESIZE;
+    self->seen = RecordSet_New(expected_cardinality);
 
     OpBase_Init(&self->op);
     self->op.name = "Distinct";
@@ -31,19 +29,18 @@ Record DistinctConsume(OpBase *opBase) {
         Record r = child->consume(child);
         if(!r) return NULL;
 
-        unsigned long long const hash = Record_Hash64(r);
-        int is_new = TrieMap_Add(self->trie, (char *) &hash, sizeof(hash), NULL, TrieMap_DONT_CARE_REPLACE);
-        if(is_new)
-            return r;
+        if(RecordSet_Add(self->seen, r)) return r;
         Record_Free(r);
     }
 }
 
 OpResult DistinctReset(OpBase *ctx) {
+    OpDistinct *self = (OpDistinct*)ctx;
+    RecordSet_Clear(self->seen);
     return OP_OK;
 }
 
 void DistinctFree(OpBase *ctx) {
     OpDistinct *self = (OpDistinct*)ctx;
-    TrieMap_Free(self->trie, TrieMap_NOP_CB);
+    RecordSet_Free(self->seen);
 }
@@ -7,15 +7,18 @@
 #pragma once
 
 #include "op.h"
-#include "resultset/resultset.h"
-#include "util/triemap/triemap.h"
+#include "../record_set.h"
+
+#define DISTINCT_MAX_PRESIZE (1 << 14)  // Upper bound on number of records the set is pre-sized for.
 
 typedef struct {
     OpBase op;
-    TrieMap *trie;
+    RecordSet *seen;    // Records passed on so far.
 } OpDistinct;
 
-OpBase* NewDistinctOp();
+/* Creates a new distinct operation,
+ * expected_cardinality is an estimate of the number of distinct records. */
+OpBase* NewDistinctOp(uint64_t expected_cardinality);
 Record DistinctConsume(OpBase *opBase);
 OpResult DistinctReset(OpBase *ctx);
 void DistinctFree(OpBase *ctx);
@@ -0,0 +1,310 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Redis Labs Source Available License Agreement
+*/
+
+#include "op_gather.h"
+#include "../../util/arr.h"
+#include "../../util/rmalloc.h"
+#include "../../util/thpool/thpool.h"
+#include <assert.h>
+
+extern threadpool _thpool;         // Thread pool executing queries.
+extern long long _thread_count;    // Number of threads in thread pool.
+extern pthread_key_t _tlsGCKey;    // Thread local storage graph context key.
+
+static uint _gather_pending = 0;   // Number of submitted jobs not yet picked up by the pool.
+
+typedef struct {
+    GatherChannel *channel;
+    uint generation;    // Channel's generation at submission.
+} GatherJob;
+
+static GatherChannel *_GatherChannel_New(void) {
+    GatherChannel *channel = rm_malloc(sizeof(GatherChannel));
+    channel->streams = NULL;
+    channel->stream_count = 0;
+    channel->next_stream = 0;
+    channel->active_workers = 0;
+    channel->generation = 0;
+    channel->refcount = 1;
+    channel->shutdown = false;
+    channel->gc = NULL;
+    channel->queue = rm_malloc(sizeof(Record) * GATHER_QUEUE_CAP);
+    channel->queue_head = 0;
+    channel->queue_len = 0;
+    assert(pthread_mutex_init(&channel->lock, NULL) == 0);
+    assert(pthread_cond_init(&channel->not_empty, NULL) == 0);
+    assert(pthread_cond_init(&channel->not_full, NULL) == 0);
+    return channel;
+}
+
+// Drops a reference to channel, freeing it once unreferenced.
+static void _GatherChannel_Release(GatherChannel *channel) {
+    pthread_mutex_lock(&channel->lock);
+    bool last = (--channel->refcount == 0);
+    pthread_mutex_unlock(&channel->lock);
+    if(!last) return;
+
+    rm_free(channel->queue);
+    pthread_mutex_destroy(&channel->lock);
+    pthread_cond_destroy(&channel->not_empty);
+    pthread_cond_destroy(&channel->not_full);
+    rm_free(channel);
+}
+
+// Claims the next unclaimed stream, returns NULL if there are none.
+// Expects channel's lock to be held.
+static OpBase *_GatherChannel_Claim(GatherChannel *channel) {
+    if(channel->shutdown || channel->next_stream == channel->stream_count) return NULL;
+    return channel->streams[channel->next_stream++];
+}
+
+OpBase* NewGatherOp(void) {
+    Gather *gather = malloc(sizeof(Gather));
+    gather->streams = array_new(OpBase*, 1);
+    gather->plans = array_new(ExecutionPlan*, 1);
+    gather->current = NULL;
+    gather->morsels = UINT64_MAX;
+    gather->started = false;
+    gather->channel = _GatherChannel_New();
+
+    // Set our Op operations
+    OpBase_Init(&gather->op);
+    gather->op.name = "Gather";
+    gather->op.type = OPType_GATHER;
+    gather->op.init = GatherInit;
+    gather->op.consume = GatherConsume;
+    gather->op.reset = GatherReset;
+    gather->op.rebind = GatherRebind;
+    gather->op.free = GatherFree;
+
+    return (OpBase*)gather;
+}
+
+void GatherAddStream(OpBase *opBase, ExecutionPlan *plan, OpBase *stream) {
+    Gather *op = (Gather*)opBase;
+    op->plans = array_append(op->plans, plan);
+    op->streams = array_append(op->streams, stream);
+}
+
+void GatherSetInputSize(OpBase *opBase, uint64_t morsels) {
+    Gather *op = (Gather*)opBase;
+    op->morsels = morsels;
+}
+
+OpResult GatherInit(OpBase *opBase) {
+    Gather *op = (Gather*)opBase;
+    assert(op->op.childCount == 1);
+    op->channel->gc = GraphContext_GetFromTLS();
+
+    // Initialize execution plans owning worker streams.
+    for(uint i = 0; i < array_len(op->plans); i++) ExecutionPlanInit(op->plans[i]);
+    return OP_OK;
+}
+
+// Enqueue record, blocks while queue is full.
+// Returns false if gather is shutting down.
+static bool _Gather_Push(GatherChannel *channel, Record r) {
+    pthread_mutex_lock(&channel->lock);
+    while(channel->queue_len == GATHER_QUEUE_CAP && !channel->shutdown) {
+        pthread_cond_wait(&channel->not_full, &channel->lock);
+    }
+
+    if(channel->shutdown) {
+        pthread_mutex_unlock(&channel->lock);
+        return false;
+    }
+
+    uint tail = (channel->queue_head + channel->queue_len) % GATHER_QUEUE_CAP;
+    channel->queue[tail] = r;
+    channel->queue_len++;
+    pthread_cond_signal(&channel->not_empty);
+    pthread_mutex_unlock(&channel->lock);
+    return true;
+}
+
+/* Thread pool job, consumes an unclaimed stream.
+ * The job is a no-op if gather was stopped since it was submitted
+ * or if the calling thread already claimed all streams. */
+static void _Gather_Worker(void *arg) {
+    GatherJob *job = (GatherJob*)arg;
+    GatherChannel *channel = job->channel;
+    uint generation = job->generation;
+    rm_free(job);
+    __atomic_sub_fetch(&_gather_pending, 1, __ATOMIC_RELAXED);
+
+    OpBase *stream = NULL;
+    pthread_mutex_lock(&channel->lock);
+    if(channel->generation == generation) stream = _GatherChannel_Claim(channel);
+    if(stream) channel->active_workers++;
+    pthread_mutex_unlock(&channel->lock);
+
+    if(stream) {
+        // Expressions evaluated by the stream access the graph context.
+        pthread_setspecific(_tlsGCKey, channel->gc);
+
+        Record r;
+        while((r = stream->consume(stream))) {
+            if(!_Gather_Push(channel, r)) {
+                Record_Free(r);
+                break;
+            }
+        }
+
+        pthread_mutex_lock(&channel->lock);
+        channel->active_workers--;
+        pthread_cond_broadcast(&channel->not_empty);
+        pthread_mutex_unlock(&channel->lock);
+    }
+
+    _GatherChannel_Release(channel);
+}
+
+/* Determines the number of jobs to submit, the calling thread and each
+ * worker should get at least GATHER_MORSELS_PER_THREAD morsels, and jobs
+ * may only occupy pool threads which aren't busy executing queries or
+ * other queries' workers. Under a high query load no jobs are submitted. */
+static uint _Gather_WorkerCount(const Gather *op) {
+    if(!_thpool) return 0;
+    uint64_t count = array_len(op->streams);
+
+    uint64_t threads = op->morsels / GATHER_MORSELS_PER_THREAD;
+    if(threads < 1) threads = 1;
+    if(count > threads - 1) count = threads - 1;
+
+    // The calling thread is one of the pool's threads.
+    long busy = thpool_num_threads_working(_thpool);
+    if(busy < 1) busy = 1;
+    busy += __atomic_load_n(&_gather_pending, __ATOMIC_RELAXED);
+    long idle = _thread_count - busy;
+    if(idle < 0) idle = 0;
+    if(count > (uint64_t)idle) count = idle;
+
+    return count;
+}
+
+static void _Gather_StartWorkers(Gather *op) {
+    GatherChannel *channel = op->channel;
+    uint worker_count = _Gather_WorkerCount(op);
+    op->started = true;
+    op->current = op->op.children[0];
+
+    pthread_mutex_lock(&channel->lock);
+    channel->streams = op->streams;
+    channel->stream_count = array_len(op->streams);
+    channel->next_stream = 0;
+    channel->shutdown = false;
+    channel->refcount += worker_count;
+    pthread_mutex_unlock(&channel->lock);
+
+    __atomic_add_fetch(&_gather_pending, worker_count, __ATOMIC_RELAXED);
+    for(uint i = 0; i < worker_count; i++) {
+        GatherJob *job = rm_malloc(sizeof(GatherJob));
+        job->channel = channel;
+        job->generation = channel->generation;
+        thpool_add_work(_thpool, _Gather_Worker, job);
+    }
+}
+
+/* Signal workers to stop, wait for running workers to exit
+ * and drop buffered records, jobs still pending are left as no-ops. */
+static void _Gather_StopWorkers(Gather *op) {
+    if(!op->started) return;
+    GatherChannel *channel = op->channel;
+
+    pthread_mutex_lock(&channel->lock);
+    channel->shutdown = true;
+    channel->generation++;
+    channel->streams = NULL;
+    channel->stream_count = 0;
+    channel->next_stream = 0;
+    pthread_cond_broadcast(&channel->not_full);
+    while(channel->active_workers > 0) pthread_cond_wait(&channel->not_empty, &channel->lock);
+
+    for(uint i = 0; i < channel->queue_len; i++) {
+        Record_Free(channel->queue[(channel->queue_head + i) % GATHER_QUEUE_CAP]);
+    }
+    channel->queue_head = 0;
+    channel->queue_len = 0;
+    pthread_mutex_unlock(&channel->lock);
+
+    op->current = NULL;
+    op->started = false;
+}
+
+// Dequeue record produced by workers, if wait is set
+// blocks until a record is available or all workers exited.
+static Record _Gather_Pop(GatherChannel *channel, bool wait) {
+    pthread_mutex_lock(&channel->lock);
+    while(wait && channel->queue_len == 0 && channel->active_workers > 0) {
+        pthread_cond_wait(&channel->not_empty, &channel->lock);
+    }
+
+    Record r = NULL;
+    if(channel->queue_len > 0) {
+        r = channel->queue[channel->queue_head];
+        channel->queue_head = (channel->queue_head + 1) % GATHER_QUEUE_CAP;
+        channel->queue_len--;
+        pthread_cond_signal(&channel->not_full);
+    }
+    pthread_mutex_unlock(&channel->lock);
+
+    return r;
+}
+
+// Claims a stream no job has picked up, for the calling thread to consume.
+static OpBase *_Gather_Steal(Gather *op) {
+    pthread_mutex_lock(&op->channel->lock);
+    OpBase *stream = _GatherChannel_Claim(op->channel);
+    pthread_mutex_unlock(&op->channel->lock);
+    return stream;
+}
+
+Record GatherConsume(OpBase *opBase) {
+    Gather *op = (Gather*)opBase;
+    if(!op->started) _Gather_StartWorkers(op);
+
+    // Prefer records produced by workers, freeing up room in the queue.
+    Record r = _Gather_Pop(op->channel, false);
+    if(r) return r;
+
+    /* Calling thread participates by consuming gather's child,
+     * followed by streams whose jobs haven't started. */
+    while(op->current) {
+        r = op->current->consume(op->current);
+        if(r) return r;
+        op->current = _Gather_Steal(op);
+    }
+
+    // All streams claimed, wait for workers.
+    return _Gather_Pop(op->channel, true);
+}
+
+OpResult GatherReset(OpBase *opBase) {
+    Gather *op = (Gather*)opBase;
+    _Gather_StopWorkers(op);
+    // Gather's child is reset by the caller, reset worker streams.
+    for(uint i = 0; i < array_len(op->streams); i++) OpBase_Reset(op->streams[i]);
+    return OP_OK;
+}
+
+OpResult GatherRebind(OpBase *opBase) {
+    Gather *op = (Gather*)opBase;
+    _Gather_StopWorkers(op);
+    for(uint i = 0; i < array_len(op->plans); i++) {
+        if(!ExecutionPlan_Rebind(op->plans[i])) return OP_ERR;
+    }
+    return OP_OK;
+}
+
+void GatherFree(OpBase *opBase) {
+    Gather *op = (Gather*)opBase;
+    _Gather_StopWorkers(op);
+    _GatherChannel_Release(op->channel);
+
+    for(uint i = 0; i < array_len(op->plans); i++) ExecutionPlanFree(op->plans[i]);
+    array_free(op->plans);
+    array_free(op->streams);
+}
@@ -0,0 +1,68 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Redis Labs Source Available License Agreement
+*/
+
+#pragma once
+
+#include <pthread.h>
+#include "op.h"
+#include "../execution_plan.h"
+#include "../../graph/graphcontext.h"
+
+#define GATHER_QUEUE_CAP 1024  // Maximum number of records buffered by gather.
+#define GATHER_MORSELS_PER_THREAD 4  // Minimal number of input morsels per thread.
+
+/* State shared between gather and the thread pool jobs consuming its streams,
+ * jobs may be dequeued by the pool after gather is reset or freed,
+ * the channel is released once gather and all of its jobs are done with it. */
+typedef struct {
+    OpBase **streams;           // Streams awaiting a worker, owned by gather.
+    uint stream_count;          // Number of streams workers may claim.
+    uint next_stream;           // Next stream to be claimed.
+    uint active_workers;        // Number of workers still producing records.
+    uint generation;            // Incremented whenever workers are stopped.
+    uint refcount;              // Gather plus pending jobs.
+    bool shutdown;              // Workers should stop producing.
+    GraphContext *gc;           // Graph context, propagated to workers.
+    Record *queue;              // Ring buffer of produced records.
+    uint queue_head;            // Position of oldest record in queue.
+    uint queue_len;             // Number of records in queue.
+    pthread_mutex_t lock;       // Guards queue and worker state.
+    pthread_cond_t not_empty;   // Signaled when a record is enqueued or a worker exits.
+    pthread_cond_t not_full;    // Signaled when a record is dequeued or on shutdown.
+} GatherChannel;
+
+/* Gather runs several copies of a pipeline segment in parallel
+ * and merges their output into a single stream.
+ * Gather's child is consumed by the calling thread, additional copies
+ * are owned by copies of the execution plan, each consumed by a job
+ * submitted to the query thread pool. Jobs are only submitted for idle
+ * pool threads and only when the input is large enough to share.
+ * Once its child is depleted the calling thread consumes streams
+ * no job has claimed yet, so a query never waits on a busy pool. */
+typedef struct {
+    OpBase op;
+    OpBase **streams;           // Pipeline segments, one per worker.
+    ExecutionPlan **plans;      // Execution plans owning streams.
+    OpBase *current;            // Stream consumed by the calling thread.
+    uint64_t morsels;           // Estimated number of morsels in segment's input.
+    bool started;               // Jobs were submitted.
+    GatherChannel *channel;     // State shared with jobs.
+} Gather;
+
+OpBase* NewGatherOp(void);
+
+/* Adds an additional stream, owned by plan, to be consumed by a worker thread. */
+void GatherAddStream(OpBase *opBase, ExecutionPlan *plan, OpBase *stream);
+
+/* Sets the estimated number of morsels segments will consume,
+ * limiting the number of workers, by default input size is unknown. */
+void GatherSetInputSize(OpBase *opBase, uint64_t morsels);
+
+OpResult GatherInit(OpBase *opBase);
+Record GatherConsume(OpBase *opBase);
+OpResult GatherReset(OpBase *opBase);
+OpResult GatherRebind(OpBase *opBase);
+void GatherFree(OpBase *opBase);
@@ -6,11 +6,19 @@
 
 #include "op_index_scan.h"
 #include "../../parser/ast.h"
+#include "../../util/arr.h"
+#include "../../util/rmalloc.h"
 
 OpBase *NewIndexScanOp(Graph *g, Node *node, IndexIter *iter, AST *ast) {
   IndexScan *indexScan = malloc(sizeof(IndexScan));
   indexScan->g = g;
   indexScan->iter = iter;
+  indexScan->idx = NULL;
+  indexScan->bounds = NULL;
+  indexScan->morsels = NULL;
+  indexScan->ids = NULL;
+  indexScan->id_count = 0;
+  indexScan->id_idx = 0;
   indexScan->nodeRecIdx = AST_GetAliasID(ast, node->alias);
   indexScan->recLength = AST_AliasCount(ast);
 
@@ -28,10 +36,69 @@ OpBase *NewIndexScanOp(Graph *g, Node *node, IndexIter *iter, AST *ast) {
   return (OpBase*)indexScan;
 }
 
+static inline bool _IndexScan_Indexable(SIType t) {
+  return (t == T_STRING) || (t & SI_NUMERIC);
+}
+
+// Bound values of different types can't be applied to the same iterator.
+static inline bool _IndexScan_Compatible(SIType a, SIType b) {
+  return (a == T_STRING) ? (b == T_STRING) : (a & SI_NUMERIC) && (b & SI_NUMERIC);
+}
+
+/* Rebuilds iterator from bounds, according to the current values of parameters.
+ * The iterator traverses values of a single type, preferring the type of constant bounds,
+ * parameters of other types are skipped as the filters they originate from are retained. */
+static void _IndexScan_ApplyBounds(IndexScan *op) {
+  uint count = array_len(op->bounds);
+  SIType type = T_NULL;
+  for(uint i = 0; i < count && type == T_NULL; i++) {
+    if(AR_EXP_GetOperandType(op->bounds[i].exp) != AR_EXP_CONSTANT) continue;
+    SIValue v = AR_EXP_Evaluate(op->bounds[i].exp, NULL);
+    if(_IndexScan_Indexable(v.type)) type = v.type;
+  }
+  for(uint i = 0; i < count && type == T_NULL; i++) {
+    SIValue v = AR_EXP_Evaluate(op->bounds[i].exp, NULL);
+    if(_IndexScan_Indexable(v.type)) type = v.type;
+  }
+
+  IndexIter_ClearBounds(op->iter, op->idx, type);
+  for(uint i = 0; i < count; i++) {
+    SIValue v = AR_EXP_Evaluate(op->bounds[i].exp, NULL);
+    if(_IndexScan_Compatible(v.type, type)) IndexIter_ApplyBound(op->iter, &v, op->bounds[i].op);
+  }
+}
+
+void IndexScanSetBounds(OpBase *ctx, Index *idx, IndexBound *bounds) {
+  IndexScan *op = (IndexScan*)ctx;
+  op->idx = idx;
+  op->bounds = bounds;
+  _IndexScan_ApplyBounds(op);
+}
+
+void IndexScanSetMorsels(OpBase *ctx, MorselDispenser *morsels) {
+  IndexScan *op = (IndexScan*)ctx;
+  op->morsels = morsels;
+  op->ids = rm_malloc(sizeof(GrB_Index) * MORSEL_SIZE);
+  op->id_count = 0;
+  op->id_idx = 0;
+}
+
+static EntityID *_IndexScan_NextMorselID(IndexScan *op) {
+  if(op->id_idx == op->id_count) {
+    // Current morsel depleted, move to the next one.
+    op->id_count = Morsel_NextIDs(op->morsels, op->ids, MORSEL_SIZE);
+    op->id_idx = 0;
+    if(op->id_count == 0) return NULL;
+  }
+  return &op->ids[op->id_idx++];
+}
+
 Record IndexScanConsume(OpBase *opBase) {
   IndexScan *op = (IndexScan*)opBase;
 
-  EntityID *nodeId = IndexIter_Next(op->iter);
+  EntityID *nodeId;
+  if(op->morsels) nodeId = _IndexScan_NextMorselID(op);
+  else nodeId = IndexIter_Next(op->iter);
   if (!nodeId) return NULL;
 
   Record r = Record_New(op->recLength);
@@ -45,11 +112,28 @@ Record IndexScanConsume(OpBase *opBase) {
 
 OpResult IndexScanReset(OpBase *ctx) {
   IndexScan *indexScan = (IndexScan*)ctx;
-  IndexIter_Reset(indexScan->iter);
+  // Parameters might have been rebound since last execution.
+  if(indexScan->bounds) _IndexScan_ApplyBounds(indexScan);
+  if(indexScan->morsels) {
+    Morsel_Reset(indexScan->morsels);
+    indexScan->id_count = 0;
+    indexScan->id_idx = 0;
+  } else {
+    IndexIter_Reset(indexScan->iter);
+  }
   return OP_OK;
 }
 
 void IndexScanFree(OpBase *op) {
   IndexScan *indexScan = (IndexScan *)op;
   IndexIter_Free(indexScan->iter);
+  if(indexScan->bounds) {
+    uint count = array_len(indexScan->bounds);
+    for(uint i = 0; i < count; i++) AR_EXP_Free(indexScan->bounds[i].exp);
+    array_free(indexScan->bounds);
+  }
+  if(indexScan->morsels) {
+    Morsel_Free(indexScan->morsels);
+    rm_free(indexScan->ids);
+  }
 }
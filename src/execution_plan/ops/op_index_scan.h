@@ -10,9 +10,16 @@
 #include "op.h"
 #include "../../parser/ast.h"
 #include "../../graph/graph.h"
+#include "../morsel.h"
 #include "../../index/index.h"
 #include "../../graph/entities/node.h"
+#include "../../arithmetic/arithmetic_expression.h"
 
+/* Bound applied to the index iterator: property op exp. */
+typedef struct {
+    AR_ExpNode *exp;    // Bounding value, either a constant or a parameter.
+    int op;             // Relation between property and bounding value.
+} IndexBound;
 
 typedef struct {
     OpBase op;
@@ -20,6 +27,12 @@ typedef struct {
     uint recLength;  // Number of entries in a record.
     Graph *g;
     IndexIter *iter;
+    Index *idx;                 // Scanned index, set when bounds are parameterized.
+    IndexBound *bounds;         // Bounds iterator is rebuilt from on every reset.
+    MorselDispenser *morsels;   // Shared index iterator, NULL when scanning on our own.
+    GrB_Index *ids;             // IDs of current morsel.
+    uint id_count;              // Number of IDs in current morsel.
+    uint id_idx;                // Position within current morsel.
 } IndexScan;
 
 /* Creates a new IndexScan operation */
@@ -32,6 +45,14 @@ Record IndexScanConsume(OpBase *opBase);
 /* Restart iterator */
 OpResult IndexScanReset(OpBase *ctx);
 
+/* Bounds the scan by expressions evaluated on every reset,
+ * allowing query parameters to be rebound between executions.
+ * The operation takes ownership over bounds. */
+void IndexScanSetBounds(OpBase *ctx, Index *idx, IndexBound *bounds);
+
+/* Pull node IDs in batches from the index iterator shared through morsels. */
+void IndexScanSetMorsels(OpBase *ctx, MorselDispenser *morsels);
+
 /* Frees IndexScan */
 void IndexScanFree(OpBase *ctx);
 
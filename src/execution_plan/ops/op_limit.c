@@ -6,9 +6,10 @@
 
 #include "op_limit.h"
 
-OpBase* NewLimitOp(unsigned int l) {
+OpBase* NewLimitOp(const AST_LimitNode *limitNode) {
     OpLimit *limit = malloc(sizeof(OpLimit));
-    limit->limit = l;
+    limit->limitNode = limitNode;
+    limit->limit = limitNode->limit;
     limit->consumed = 0;
 
     // Set our Op operations
@@ -36,6 +37,7 @@ Record LimitConsume(OpBase *op) {
 
 OpResult LimitReset(OpBase *ctx) {
     OpLimit *limit = (OpLimit*)ctx;
+    limit->limit = limit->limitNode->limit;
     limit->consumed = 0;
     return OP_OK;
 }
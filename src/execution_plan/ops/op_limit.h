@@ -8,14 +8,16 @@
 #define _OP_LIMIT_H_
 
 #include "op.h"
+#include "../../parser/clauses/limit.h"
 
 typedef struct {
     OpBase op;
+    const AST_LimitNode *limitNode; // Limit clause, a parameter might change limit between executions.
     unsigned int limit;     // Max number of records to consume.
     unsigned int consumed;  // Number of records consumed so far.
 } OpLimit;
 
-OpBase* NewLimitOp(unsigned int limit);
+OpBase* NewLimitOp(const AST_LimitNode *limitNode);
 
 Record LimitConsume(OpBase *op);
 
@@ -37,18 +37,21 @@ OpBase* NewOpNodeByIdSeekOp
     op_nodeByIdSeek->minInclusive = minInclusive;
     op_nodeByIdSeek->maxInclusive = maxInclusive;
 
-    // The smallest possible entity ID is 0.
+    // The smallest possible entity ID is 0, inclusive.
     op_nodeByIdSeek->minId = minId;
-    if(minId == ID_RANGE_UNBOUND) op_nodeByIdSeek->minId = 0;
+    if(minId == ID_RANGE_UNBOUND) {
+        op_nodeByIdSeek->minId = 0;
+        op_nodeByIdSeek->minInclusive = true;
+    }
 
     // The largest possible entity ID is the same as Graph_RequiredMatrixDim.
+    op_nodeByIdSeek->maxBound = maxId;
     if(maxId == ID_RANGE_UNBOUND) maxId = Graph_RequiredMatrixDim(op_nodeByIdSeek->g);
     op_nodeByIdSeek->maxId = MIN(Graph_RequiredMatrixDim(op_nodeByIdSeek->g), maxId);
 
     op_nodeByIdSeek->currentId = op_nodeByIdSeek->minId;
-    /* Advance current ID when min is not inclusive and 
-     * minimum range is specified. */
-    if(!minInclusive && minId != ID_RANGE_UNBOUND) op_nodeByIdSeek->currentId++;
+    // Advance current ID when min is not inclusive.
+    if(!op_nodeByIdSeek->minInclusive) op_nodeByIdSeek->currentId++;
 
     op_nodeByIdSeek->nodeRecIdx = nodeRecIdx;
     op_nodeByIdSeek->recLength = AST_AliasCount(ast);
@@ -58,6 +61,7 @@ OpBase* NewOpNodeByIdSeekOp
     op_nodeByIdSeek->op.type = OPType_NODE_BY_ID_SEEK;
     op_nodeByIdSeek->op.consume = OpNodeByIdSeekConsume;
     op_nodeByIdSeek->op.reset = OpNodeByIdSeekReset;
+    op_nodeByIdSeek->op.rebind = OpNodeByIdSeekRebind;
     op_nodeByIdSeek->op.free = OpNodeByIdSeekFree;
 
     return (OpBase*)op_nodeByIdSeek;
@@ -96,6 +100,15 @@ OpResult OpNodeByIdSeekReset(OpBase *ctx) {
     return OP_OK;
 }
 
+OpResult OpNodeByIdSeekRebind(OpBase *ctx) {
+    OpNodeByIdSeek *op = (OpNodeByIdSeek*)ctx;
+    // Upper bound is clipped by the number of nodes in the graph.
+    NodeID maxId = op->maxBound;
+    if(maxId == ID_RANGE_UNBOUND) maxId = Graph_RequiredMatrixDim(op->g);
+    op->maxId = MIN(Graph_RequiredMatrixDim(op->g), maxId);
+    return OP_OK;
+}
+
 void OpNodeByIdSeekFree(OpBase *ctx) {
 
 }
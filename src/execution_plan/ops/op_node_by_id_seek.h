@@ -21,6 +21,7 @@ typedef struct {
     NodeID minId;           // Min ID to fetch.
     bool minInclusive;      // Include min ID.
     NodeID maxId;           // Max ID to fetch.
+    NodeID maxBound;        // Max ID specified by query, ID_RANGE_UNBOUND if unspecified.
     bool maxInclusive;      // Include max ID.
     NodeID currentId;       // Current ID fetched.
 } OpNodeByIdSeek;
@@ -45,6 +46,11 @@ OpResult OpNodeByIdSeekReset
     OpBase *ctx
 );
 
+OpResult OpNodeByIdSeekRebind
+(
+    OpBase *ctx
+);
+
 void OpNodeByIdSeekFree
 (
     OpBase *ctx
@@ -6,6 +6,8 @@
 
 #include "op_node_by_label_scan.h"
 #include "../../parser/ast.h"
+#include <assert.h>
+#include <string.h>
 
 OpBase *NewNodeByLabelScanOp(Node *node, AST *ast) {
     NodeByLabelScan *nodeByLabelScan = malloc(sizeof(NodeByLabelScan));
@@ -13,6 +15,10 @@ OpBase *NewNodeByLabelScanOp(Node *node, AST *ast) {
     nodeByLabelScan->g = gc->g;
     nodeByLabelScan->node = node;
     nodeByLabelScan->_zero_matrix = NULL;
+    nodeByLabelScan->morsels = NULL;
+    nodeByLabelScan->filterTree = NULL;
+    nodeByLabelScan->selection = 0;
+    memset(nodeByLabelScan->batch, 0, sizeof(nodeByLabelScan->batch));
     nodeByLabelScan->nodeRecIdx = AST_GetAliasID(ast, node->alias);
     nodeByLabelScan->recLength = AST_AliasCount(ast);
 
@@ -32,6 +38,7 @@ OpBase *NewNodeByLabelScanOp(Node *node, AST *ast) {
     nodeByLabelScan->op.type = OPType_NODE_BY_LABEL_SCAN;
     nodeByLabelScan->op.consume = NodeByLabelScanConsume;
     nodeByLabelScan->op.reset = NodeByLabelScanReset;
+    nodeByLabelScan->op.rebind = NodeByLabelScanRebind;
     nodeByLabelScan->op.free = NodeByLabelScanFree;
     
     nodeByLabelScan->op.modifies = NewVector(char*, 1);
@@ -40,14 +47,68 @@ OpBase *NewNodeByLabelScanOp(Node *node, AST *ast) {
     return (OpBase*)nodeByLabelScan;
 }
 
+void NodeByLabelScanSetMorsels(OpBase *ctx, MorselDispenser *morsels) {
+    NodeByLabelScan *op = (NodeByLabelScan*)ctx;
+    op->morsels = morsels;
+    // Start off with an empty range, morsels are pulled on demand.
+    GxB_MatrixTupleIter_iterate_range(op->iter, 0, 0);
+}
+
+void NodeByLabelScanSetFilter(OpBase *ctx, FT_FilterNode *filterTree) {
+    NodeByLabelScan *op = (NodeByLabelScan*)ctx;
+    assert(!op->filterTree);
+    op->filterTree = filterTree;
+    op->op.name = "Filtered Node By Label Scan";
+}
+
+// Retrieves the next scanned node ID, returns false when depleted.
+static bool _NodeByLabelScan_NextID(NodeByLabelScan *op, GrB_Index *nodeId) {
+    bool depleted = false;
+    GxB_MatrixTupleIter_next(op->iter, NULL, nodeId, &depleted);
+    while(depleted && op->morsels) {
+        // Current morsel depleted, move to the next one.
+        uint64_t start;
+        uint64_t end;
+        if(!Morsel_NextRange(op->morsels, &start, &end)) return false;
+        GxB_MatrixTupleIter_iterate_range(op->iter, start, end);
+        GxB_MatrixTupleIter_next(op->iter, NULL, nodeId, &depleted);
+    }
+    return !depleted;
+}
+
+// Produces the next record passing filters, nodes are filtered in batches.
+static Record _NodeByLabelScan_NextFiltered(NodeByLabelScan *op) {
+    while(!op->selection) {
+        GrB_Index nodeId;
+        uint count = 0;
+        while(count < FILTER_BATCH_SIZE && _NodeByLabelScan_NextID(op, &nodeId)) {
+            // Reuse records rejected by filters.
+            if(!op->batch[count]) op->batch[count] = Record_New(op->recLength);
+            Node *n = Record_GetNode(op->batch[count], op->nodeRecIdx);
+            Graph_GetNode(op->g, nodeId, n);
+            count++;
+        }
+        if(count == 0) return NULL;
+
+        op->selection = (count == FILTER_BATCH_SIZE) ? ~0ULL : (1ULL << count) - 1;
+        FilterTree_applyFiltersBatch(op->filterTree, op->batch, count, &op->selection);
+    }
+
+    // Hand out the next selected record.
+    int i = __builtin_ctzll(op->selection);
+    op->selection &= op->selection - 1;
+    Record r = op->batch[i];
+    op->batch[i] = NULL;
+    return r;
+}
+
 Record NodeByLabelScanConsume(OpBase *opBase) {
     NodeByLabelScan *op = (NodeByLabelScan*)opBase;
-    
+    if(op->filterTree) return _NodeByLabelScan_NextFiltered(op);
+
     GrB_Index nodeId;
-    bool depleted = false;    
-    GxB_MatrixTupleIter_next(op->iter, NULL, &nodeId, &depleted);
-    if(depleted) return NULL;
-    
+    if(!_NodeByLabelScan_NextID(op, &nodeId)) return NULL;
+
     Record r = Record_New(op->recLength);
     // Get a pointer to a heap allocated node.
     Node *n = Record_GetNode(r, op->nodeRecIdx);
@@ -58,7 +119,28 @@ Record NodeByLabelScanConsume(OpBase *opBase) {
 
 OpResult NodeByLabelScanReset(OpBase *ctx) {
     NodeByLabelScan *op = (NodeByLabelScan*)ctx;
-    GxB_MatrixTupleIter_reset(op->iter);
+    // Drop selected records of the current batch, records are kept for reuse.
+    op->selection = 0;
+    if(op->morsels) {
+        Morsel_Reset(op->morsels);
+        GxB_MatrixTupleIter_iterate_range(op->iter, 0, 0);
+    } else {
+        GxB_MatrixTupleIter_reset(op->iter);
+    }
+    return OP_OK;
+}
+
+OpResult NodeByLabelScanRebind(OpBase *ctx) {
+    NodeByLabelScan *op = (NodeByLabelScan*)ctx;
+    // Label didn't exist when the scan was built, introducing it changes the schema.
+    if(op->_zero_matrix) return OP_OK;
+
+    GraphContext *gc = GraphContext_GetFromTLS();
+    Schema *schema = GraphContext_GetSchema(gc, op->node->label, SCHEMA_NODE);
+    assert(schema);
+    // Iterator is bound to the number of labeled nodes at the time of its creation.
+    GxB_MatrixTupleIter_reuse(op->iter, Graph_GetLabelMatrix(op->g, schema->id));
+    if(op->morsels) Morsel_SetEnd(op->morsels, Graph_RequiredMatrixDim(op->g));
     return OP_OK;
 }
 
@@ -66,6 +148,12 @@ void NodeByLabelScanFree(OpBase *op) {
     NodeByLabelScan *nodeByLabelScan = (NodeByLabelScan*)op;
     GxB_MatrixTupleIter_free(nodeByLabelScan->iter);
     
+    if(nodeByLabelScan->morsels) Morsel_Free(nodeByLabelScan->morsels);
+    if(nodeByLabelScan->filterTree) FilterTree_Free(nodeByLabelScan->filterTree);
+    for(int i = 0; i < FILTER_BATCH_SIZE; i++) {
+        if(nodeByLabelScan->batch[i]) Record_Free(nodeByLabelScan->batch[i]);
+    }
+
     if(nodeByLabelScan->_zero_matrix != NULL) {
         GrB_Matrix_free(&nodeByLabelScan->_zero_matrix);
     }
@@ -11,6 +11,8 @@
 #include "../../parser/ast.h"
 #include "../../graph/graph.h"
 #include "../../graph/entities/node.h"
+#include "../morsel.h"
+#include "../../filter_tree/filter_tree.h"
 #include "../../../deps/GraphBLAS/Include/GraphBLAS.h"
 
 /* NodeByLabelScan, scans entire label. */
@@ -23,6 +25,10 @@ typedef struct {
     Graph *g;
     GxB_MatrixTupleIter *iter;
     GrB_Matrix _zero_matrix;    /* Fake matrix, in-case label does not exists. */
+    MorselDispenser *morsels;   /* Shared ID ranges, NULL when scanning entire label. */
+    FT_FilterNode *filterTree;  /* Filters applied to scanned nodes, NULL if none. */
+    Record batch[FILTER_BATCH_SIZE];    /* Scanned records, rejected records are reused. */
+    uint64_t selection;                 /* Batch records passing filters, yet to be produced. */
 } NodeByLabelScan;
 
 /* Creates a new NodeByLabelScan operation */
@@ -35,6 +41,16 @@ Record NodeByLabelScanConsume(OpBase *opBase);
 /* Restart iterator */
 OpResult NodeByLabelScanReset(OpBase *ctx);
 
+/* Rebinds iterator to the label's current nodes. */
+OpResult NodeByLabelScanRebind(OpBase *ctx);
+
+/* Restrict scan to ID ranges handed out by morsels. */
+void NodeByLabelScanSetMorsels(OpBase *ctx, MorselDispenser *morsels);
+
+/* Applies filterTree to scanned nodes in batches, records are only produced
+ * for nodes passing the filters, scan takes ownership over filterTree. */
+void NodeByLabelScanSetFilter(OpBase *ctx, FT_FilterNode *filterTree);
+
 /* Frees NodeByLabelScan */
 void NodeByLabelScanFree(OpBase *ctx);
 
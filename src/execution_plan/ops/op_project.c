@@ -127,6 +127,8 @@ Record ProjectConsume(OpBase *opBase) {
 }
 
 OpResult ProjectReset(OpBase *ctx) {
+    OpProject *op = (OpProject*)ctx;
+    op->singleResponse = false;
     return OP_OK;
 }
 
@@ -0,0 +1,108 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Redis Labs Source Available License Agreement
+*/
+
+#include <assert.h>
+
+#include "./op_shortest_path.h"
+#include "../../util/arr.h"
+#include "../../graph/graphcontext.h"
+
+static void _setupTraversedRelations(ShortestPath *op, const AST_LinkEntity *link) {
+    GraphContext *gc = GraphContext_GetFromTLS();
+    int relationCount = AST_LinkEntity_LabelCount(link);
+
+    if(relationCount > 0) {
+        op->relationIDs = array_new(int, relationCount);
+        for(int i = 0; i < relationCount; i++) {
+            Schema *s = GraphContext_GetSchema(gc, link->labels[i], SCHEMA_EDGE);
+            if(!s) continue;
+            op->relationIDs = array_append(op->relationIDs, s->id);
+        }
+    } else {
+        op->relationIDs = array_new(int, 1);
+        op->relationIDs = array_append(op->relationIDs, GRAPH_NO_RELATION);
+    }
+}
+
+OpBase* NewShortestPathOp(Graph *g, AST *ast, const AST_NodeEntity *src, const AST_LinkEntity *link, const AST_NodeEntity *dest) {
+    assert(g && src && link && dest && link->shortestPath != N_SHORTEST_PATH_NONE);
+
+    ShortestPath *op = calloc(1, sizeof(ShortestPath));
+    op->g = g;
+    op->type = link->shortestPath;
+    op->srcNodeIdx = AST_GetAliasID(ast, src->alias);
+    op->destNodeIdx = AST_GetAliasID(ast, dest->alias);
+    op->pending = 0;
+    op->r = NULL;
+    _setupTraversedRelations(op, link);
+
+    GRAPH_EDGE_DIR dir = GRAPH_EDGE_DIR_OUTGOING;
+    if(link->direction == N_RIGHT_TO_LEFT) dir = GRAPH_EDGE_DIR_INCOMING;
+    else if(link->direction == N_DIR_UNKNOWN) dir = GRAPH_EDGE_DIR_BOTH;
+    unsigned int minHops = (link->length) ? link->length->minHops : 1;
+    unsigned int maxHops = (link->length) ? link->length->maxHops : 1;
+    // allShortestPaths produces a record for each of the parallel relationships.
+    bool multiEdges = (op->type == N_SHORTEST_PATH_ALL);
+    op->ctx = ShortestPathsCtx_New(g, op->relationIDs, array_len(op->relationIDs),
+                                   dir, multiEdges, minHops, maxHops);
+
+    // Set our Op operations
+    OpBase_Init(&op->op);
+    op->op.name = (op->type == N_SHORTEST_PATH_ALL) ? "All Shortest Paths" : "Shortest Path";
+    op->op.type = OPType_SHORTEST_PATH;
+    op->op.consume = ShortestPathConsume;
+    op->op.reset = ShortestPathReset;
+    op->op.rebind = ShortestPathRebind;
+    op->op.free = ShortestPathFree;
+
+    return (OpBase*)op;
+}
+
+Record ShortestPathConsume(OpBase *opBase) {
+    ShortestPath *op = (ShortestPath*)opBase;
+    OpBase *child = op->op.children[0];
+
+    while(op->pending == 0) {
+        Record childRecord = child->consume(child);
+        if(!childRecord) return NULL;
+
+        if(op->r) Record_Free(op->r);
+        op->r = childRecord;
+
+        Node *src = Record_GetNode(op->r, op->srcNodeIdx);
+        Node *dest = Record_GetNode(op->r, op->destNodeIdx);
+        uint64_t paths = ShortestPathsCtx_Count(op->ctx, ENTITY_GET_ID(src), ENTITY_GET_ID(dest));
+        op->pending = (op->type == N_SHORTEST_PATH_ALL) ? paths : MIN(paths, 1);
+    }
+
+    // Hand over the record once it's produced for the last time.
+    op->pending--;
+    if(op->pending > 0) return Record_Clone(op->r);
+    Record r = op->r;
+    op->r = NULL;
+    return r;
+}
+
+OpResult ShortestPathReset(OpBase *ctx) {
+    ShortestPath *op = (ShortestPath*)ctx;
+    if(op->r) Record_Free(op->r);
+    op->r = NULL;
+    op->pending = 0;
+    return OP_OK;
+}
+
+OpResult ShortestPathRebind(OpBase *ctx) {
+    ShortestPath *op = (ShortestPath*)ctx;
+    ShortestPathsCtx_Rebind(op->ctx);
+    return OP_OK;
+}
+
+void ShortestPathFree(OpBase *ctx) {
+    ShortestPath *op = (ShortestPath*)ctx;
+    if(op->r) Record_Free(op->r);
+    ShortestPathsCtx_Free(op->ctx);
+    array_free(op->relationIDs);
+}
@@ -0,0 +1,41 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Redis Labs Source Available License Agreement
+*/
+
+#ifndef __OP_SHORTEST_PATH_H
+#define __OP_SHORTEST_PATH_H
+
+#include "op.h"
+#include "../../parser/ast.h"
+#include "../../graph/graph.h"
+#include "../../algorithms/algorithms.h"
+
+/* OP Shortest path,
+ * for each record, counts the shortest paths connecting
+ * its source and destination nodes, both bound by earlier operations.
+ * Undirected patterns traverse relationships both ways,
+ * relationships of opposite directions are distinct paths.
+ * shortestPath produces the record once if a path is found,
+ * allShortestPaths produces it once per shortest path,
+ * parallel relationships of the same type are distinct paths. */
+typedef struct {
+    OpBase op;
+    Graph *g;
+    AST_ShortestPathType type;
+    int srcNodeIdx;             // Path start, read from record.
+    int destNodeIdx;            // Path end, read from record.
+    int *relationIDs;           // Relation(s) we're traversing.
+    ShortestPathsCtx *ctx;      // Path search.
+    uint64_t pending;           // Number of times current record is yet to be produced.
+    Record r;                   // Current record.
+} ShortestPath;
+
+OpBase* NewShortestPathOp(Graph *g, AST *ast, const AST_NodeEntity *src, const AST_LinkEntity *link, const AST_NodeEntity *dest);
+Record ShortestPathConsume(OpBase *opBase);
+OpResult ShortestPathReset(OpBase *ctx);
+OpResult ShortestPathRebind(OpBase *ctx);
+void ShortestPathFree(OpBase *ctx);
+
+#endif
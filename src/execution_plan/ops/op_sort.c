@@ -12,31 +12,18 @@
 #include "../../util/qsort.h"
 #include "../../util/rmalloc.h"
 
-static bool _record_islt(Record a, Record b, const OpSort *op) {    
-    // First N values in record correspond to RETURN expressions
-    // N .. M values correspond to ORDER-BY expressions
-    // Query: RETURN A.V, B.V, C.V ORDER BY B.W, C.V*A.V
-    // Record
-    // ------------------------------------
-    // |  V0  |  V1  |  V2  |  V3  |  V4  |
-    // ------------------------------------
-    // V0 - A.V
-    // V1 - B.V
-    // V2 - C.V
-    // V3 - B.W
-    // V4 - C.V*A.
-    uint offset = op->offset;
-    uint comparables = array_len(op->expressions);
-
-    for(uint i = 0; i < comparables; i++) {
-        SIValue aVal = Record_Get(a, offset+i);
-        SIValue bVal = Record_Get(b, offset+i);
-        int rel = SIValue_Order(aVal, bVal);
-        if(rel == 0) continue;  // Elements are equal; try next ORDER BY element
-        rel *= op->direction;   // Flip value for descending order.
-        return rel > 0;         // Return true if the current left element is less than the right.
-    }
-    return false;   // b >= a
+/* Buffered record along with its sort key,
+ * prefix holds the key's leading bytes to avoid most memcmp calls. */
+typedef struct {
+    uint64_t prefix;
+    const unsigned char *key;
+    size_t len;
+    Record r;
+} SortEntry;
+
+static inline bool _entry_isgt(const SortEntry *a, const SortEntry *b) {
+    if(a->prefix != b->prefix) return a->prefix > b->prefix;
+    return SortKey_Compare(a->key, a->len, b->key, b->len) > 0;
 }
 
 // Compares two records on a subset of fields
@@ -74,10 +61,152 @@ static int _heap_elem_compare(const void *A, const void *B, const void *udata) {
     return _record_compare(aRec, bRec, op) * op->direction;
 }
 
+/* Buffer is sorted in reverse, such that records are produced
+ * by popping from its end. */
+#define ENTRY_SORT(a, b) (_entry_isgt((a), (b)))
+
+// Computes record's sort key, first N values in record correspond to RETURN expressions.
+static size_t _compute_key(OpSort *op, Record r) {
+    size_t len = op->keys.len;
+    op->key_offsets = array_append(op->key_offsets, len);
+
+    bool descending = (op->direction == DIR_DESC);
+    uint comparables = array_len(op->expressions);
+    for(uint i = 0; i < comparables; i++) {
+        SortKeyBuffer_Append(&op->keys, Record_Get(r, op->offset + i), descending);
+    }
+    return op->keys.len - len;
+}
+
+/* Sorts buffered records by comparing their precomputed keys,
+ * rather than evaluating SIValue_Order per comparison. */
+static void _sort_buffer(OpSort *op) {
+    uint record_count = array_len(op->buffer);
+    if(record_count > 1) {
+        SortEntry *entries = rm_malloc(sizeof(SortEntry) * record_count);
+        for(uint i = 0; i < record_count; i++) {
+            uint64_t key_end = (i + 1 < record_count) ? op->key_offsets[i + 1] : op->keys.len;
+            entries[i].key = op->keys.data + op->key_offsets[i];
+            entries[i].len = key_end - op->key_offsets[i];
+            entries[i].prefix = SortKey_Prefix(entries[i].key, entries[i].len);
+            entries[i].r = op->buffer[i];
+        }
+
+        QSORT(SortEntry, entries, record_count, ENTRY_SORT);
+        for(uint i = 0; i < record_count; i++) op->buffer[i] = entries[i].r;
+        rm_free(entries);
+    }
+
+    // Keys are no longer required.
+    SortKeyBuffer_Clear(&op->keys);
+    array_clear(op->key_offsets);
+}
+
+// Recomputes the keys of buffered records, following their current order.
+static void _rebuild_keys(OpSort *op) {
+    SortKeyBuffer_Clear(&op->keys);
+    array_clear(op->key_offsets);
+    uint record_count = array_len(op->buffer);
+    for(uint i = 0; i < record_count; i++) _compute_key(op, op->buffer[i]);
+}
+
+/* Sorts buffered records and writes them to a new run,
+ * returns false if run could not be written, in which case
+ * records remain buffered along with their keys. */
+static bool _spill(OpSort *op) {
+    // Retry spilling only once another threshold worth of records is buffered.
+    op->buffered_bytes = 0;
+
+    FILE *file = tmpfile();
+    if(!file) return false;
+
+    uint record_count = array_len(op->buffer);
+    _sort_buffer(op);
+
+    // Buffer is sorted in reverse, write records in output order.
+    bool written = true;
+    for(int i = record_count - 1; i >= 0 && written; i--) {
+        written = Record_Serialize(op->buffer[i], file);
+    }
+    if(written) written = (fflush(file) == 0);
+
+    if(!written) {
+        fclose(file);
+        // Sorting consumed the keys, later sorts require them.
+        _rebuild_keys(op);
+        return false;
+    }
+
+    for(uint i = 0; i < record_count; i++) Record_Free(op->buffer[i]);
+    array_clear(op->buffer);
+
+    SortRun run = {.file = file, .head = NULL};
+    if(!op->runs) op->runs = array_new(SortRun, 2);
+    op->runs = array_append(op->runs, run);
+    return true;
+}
+
+/* Retrieves run's next record, a run without a file
+ * is made of the records remaining in memory. */
+static Record _run_next(OpSort *op, SortRun *run) {
+    if(run->file) return Record_Deserialize(run->file);
+    if(array_len(op->buffer) > 0) return array_pop(op->buffer);
+    return NULL;
+}
+
+// Compares the heads of two runs, such that the next record to produce is on top.
+static int _run_compare(const void *A, const void *B, const void *udata) {
+    OpSort* op = (OpSort*)udata;
+    const SortRun *a = A;
+    const SortRun *b = B;
+    return -(_record_compare(a->head, b->head, op) * op->direction);
+}
+
+// Prepare spilled runs to be merged.
+static void _merge_runs(OpSort *op) {
+    // Remaining buffered records form the last run, kept in memory.
+    if(array_len(op->buffer) > 0) {
+        _sort_buffer(op);
+        SortRun run = {.file = NULL, .head = NULL};
+        op->runs = array_append(op->runs, run);
+    }
+
+    uint run_count = array_len(op->runs);
+    op->merge = heap_new(_run_compare, op);
+    for(uint i = 0; i < run_count; i++) {
+        SortRun *run = op->runs + i;
+        if(run->file) rewind(run->file);
+        run->head = _run_next(op, run);
+        if(run->head) heap_offer(&op->merge, run);
+    }
+}
+
+static void _free_runs(OpSort *op) {
+    if(op->merge) {
+        heap_free(op->merge);
+        op->merge = NULL;
+    }
+
+    if(!op->runs) return;
+    uint run_count = array_len(op->runs);
+    for(uint i = 0; i < run_count; i++) {
+        SortRun *run = op->runs + i;
+        if(run->head) Record_Free(run->head);
+        if(run->file) fclose(run->file);  // Temporary file is removed once closed.
+    }
+    array_free(op->runs);
+    op->runs = NULL;
+}
+
 static void _accumulate(OpSort *op, Record r) {
     if(!op->limit) {
         /* Not using a heap and there's room for record. */
         op->buffer = array_append(op->buffer, r);
+        size_t key_len = _compute_key(op, r);
+        if(_sort_spill_threshold > 0) {
+            op->buffered_bytes += Record_MemoryUsage(r) + key_len + sizeof(uint64_t);
+            if(op->buffered_bytes > _sort_spill_threshold) _spill(op);
+        }
         return;
     }
 
@@ -97,6 +226,16 @@ static void _accumulate(OpSort *op, Record r) {
 }
 
 static Record _handoff(OpSort *op) {
+    if(op->merge) {
+        // Produce smallest head and advance its run.
+        SortRun *run = heap_poll(op->merge);
+        if(!run) return NULL;
+        Record r = run->head;
+        run->head = _run_next(op, run);
+        if(run->head) heap_offer(&op->merge, run);
+        return r;
+    }
+
     if(array_len(op->buffer) > 0) return array_pop(op->buffer);
     return NULL;
 }
@@ -115,6 +254,26 @@ uint _determineOffset(OpBase *op) {
     return _determineOffset(op->children[0]);
 }
 
+/* Determine number of records to produce, parameters
+ * might change SKIP and LIMIT between executions. */
+static void _SetLimit(OpSort *sort) {
+    const AST *ast = sort->ast;
+    sort->limit = 0;
+    if(ast->limitNode) {
+        sort->limit = ast->limitNode->limit;
+        if(ast->skipNode) {
+            sort->limit += ast->skipNode->skip;
+        }
+    }
+
+    if(sort->limit) {
+        if(!sort->heap) sort->heap = heap_new(_heap_elem_compare, sort);
+    } else if(!sort->key_offsets) {
+        if(!sort->buffer) sort->buffer = array_new(Record, 32);
+        sort->key_offsets = array_new(uint64_t, 32);
+    }
+}
+
 OpBase *NewSortOp(const AST *ast, AR_ExpNode **expressions) {
     assert(expressions && array_len(expressions) > 0);
     OpSort *sort = malloc(sizeof(OpSort));
@@ -125,16 +284,13 @@ OpBase *NewSortOp(const AST *ast, AR_ExpNode **expressions) {
     sort->expressions = expressions;
     sort->heap = NULL;
     sort->buffer = NULL;
+    sort->key_offsets = NULL;
+    SortKeyBuffer_Init(&sort->keys);
+    sort->buffered_bytes = 0;
+    sort->runs = NULL;
+    sort->merge = NULL;
 
-    if(ast->limitNode) {
-        sort->limit = ast->limitNode->limit;
-        if(ast->skipNode) {
-            sort->limit += ast->skipNode->skip;
-        }
-    }
-
-    if(sort->limit) sort->heap = heap_new(_heap_elem_compare, sort);
-    else sort->buffer = array_new(Record, 32);
+    _SetLimit(sort);
 
     // Set our Op operations
     OpBase_Init(&sort->op);
@@ -148,11 +304,6 @@ OpBase *NewSortOp(const AST *ast, AR_ExpNode **expressions) {
     return (OpBase*)sort;
 }
 
-/* `op` is an actual variable in the caller function. Using it in a
- * macro like this is rather ugly, but the macro passed to QSORT must
- * accept only 2 arguments. */
-#define RECORD_SORT(a, b) (_record_islt((*a), (*b), op))
-
 OpResult SortInit(OpBase *opBase) {
     OpSort *op = (OpSort*) opBase;
     op->offset = _determineOffset(opBase->children[0]);
@@ -175,13 +326,16 @@ Record SortConsume(OpBase *opBase) {
     }
     if(!newData) return NULL;
 
-    if(op->buffer) {
-        QSORT(Record, op->buffer, array_len(op->buffer), RECORD_SORT);
+    if(op->runs) {
+        // Records were spilled, merge sorted runs.
+        _merge_runs(op);
+    } else if(!op->limit) {
+        _sort_buffer(op);
     } else {
         // Heap, responses need to be reversed.
         int record_idx = 0;
         int records_count = heap_count(op->heap);
-        op->buffer = array_new(Record, records_count);
+        if(!op->buffer) op->buffer = array_new(Record, records_count);
 
         /* Pop items from heap */
         while(records_count > 0) {
@@ -216,6 +370,12 @@ OpResult SortReset(OpBase *ctx) {
         }
     }
 
+    if(op->key_offsets) array_clear(op->key_offsets);
+    SortKeyBuffer_Clear(&op->keys);
+    _free_runs(op);
+    op->buffered_bytes = 0;
+    _SetLimit(op);
+
     return OP_OK;
 }
 
@@ -241,6 +401,10 @@ void SortFree(OpBase *ctx) {
         array_free(op->buffer);
     }
 
+    if(op->key_offsets) array_free(op->key_offsets);
+    SortKeyBuffer_Free(&op->keys);
+    _free_runs(op);
+
     for(int i = 0; i < array_len(op->expressions); i++) AR_EXP_Free(op->expressions[i]);
     array_free(op->expressions);
 }
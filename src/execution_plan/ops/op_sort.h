@@ -9,17 +9,33 @@
 
 #include "op.h"
 #include "../../util/heap.h"
+#include "../../util/sort_key.h"
 #include "../../arithmetic/arithmetic_expression.h"
 
 #define DIR_DESC -1
 #define DIR_ASC 1
 
+/* Number of buffered bytes above which sorted runs are spilled to disk,
+ * 0 keeps all records in memory. */
+extern long long _sort_spill_threshold;
+
+/* Sorted run spilled to a temporary file. */
+typedef struct {
+    FILE *file;                 // Serialized records, in output order.
+    Record head;                // Next record to be produced by run.
+} SortRun;
+
 typedef struct {
     OpBase op;
     const AST *ast;
     AR_ExpNode **expressions;   // Expression to sort by.
     heap_t *heap;               // Holds top n records.
     Record *buffer;             // Holds all records.
+    SortKeyBuffer keys;         // Sort keys of buffered records.
+    uint64_t *key_offsets;      // Offset of each buffered record's key within keys.
+    size_t buffered_bytes;      // Memory occupied by buffered records.
+    SortRun *runs;              // Runs spilled to disk.
+    heap_t *merge;              // Merges runs, top is next record to produce.
     unsigned int offset;        // Offset into projected order expressions within a record.
     unsigned int limit;         // Total number of records to produce, 0 no limit.
     int direction;              // Ascending / desending.
@@ -40,7 +40,9 @@ OpResult UnwindInit(OpBase *opBase) {
     for(uint i = 0; i < expCount; i++) {
         AST_ArithmeticExpressionNode *exp;
         Vector_Get(op->unwindClause->expressions, i, &exp);
-        op->expressions = array_append(op->expressions, AR_EXP_BuildFromAST(ast, exp));
+        AR_ExpNode *ar_exp = AR_EXP_BuildFromAST(ast, exp);
+        AR_EXP_Compile(ar_exp);
+        op->expressions = array_append(op->expressions, ar_exp);
     }
     op->unwindRecIdx = AST_GetAliasID(ast, op->unwindClause->alias);
     return OP_OK;
@@ -22,6 +22,7 @@ static void _BuildUpdateEvalCtx(OpUpdate* op, AST *ast) {
         /* Track all required informantion to perform an update. */
         op->update_expressions[i].attribute = element->entity->property;
         op->update_expressions[i].exp = AR_EXP_BuildFromAST(ast, element->exp);
+        AR_EXP_Compile(op->update_expressions[i].exp);
         op->update_expressions[i].entityRecIdx = AST_GetAliasID(op->ast, element->entity->alias);
     }
 }
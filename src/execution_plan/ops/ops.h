@@ -20,6 +20,8 @@
 #include "op_cartesian_product.h"
 #include "op_merge.h"
 #include "op_cond_var_len_traverse.h"
+#include "op_cond_var_len_reach.h"
+#include "op_shortest_path.h"
 #include "op_unwind.h"
 #include "op_sort.h"
 #include "op_results.h"
@@ -30,3 +32,4 @@
 #include "op_expand_into.h"
 #include "op_node_by_id_seek.h"
 #include "op_procedure_call.h"
+#include "op_gather.h"
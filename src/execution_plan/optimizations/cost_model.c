@@ -0,0 +1,332 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Redis Labs Source Available License Agreement
+*/
+
+#include "./cost_model.h"
+#include "../../util/vector.h"
+#include "../../parser/grammar.h"
+#include "../../graph/graphcontext.h"
+#include "../../util/arr.h"
+#include <math.h>
+#include <assert.h>
+#include <strings.h>
+
+// Selectivities assumed when statistics can't tell better.
+#define SELECTIVITY_EQUALITY 0.1    // n.v = x
+#define SELECTIVITY_RANGE 0.33      // n.v > x
+#define SELECTIVITY_DEFAULT 0.5     // Any other predicate.
+
+/* Number of hops beyond the minimum accounted for
+ * when estimating variable length traversals. */
+#define VAR_LEN_ESTIMATED_HOPS 2
+
+/* Frontier of a traversal, the set of nodes reached so far
+ * and the way they were reached, used to estimate the next hop. */
+typedef struct {
+    double rows;        // Estimated number of records.
+    int label;          // Label of frontier nodes, GRAPH_NO_LABEL if unknown.
+    int relation;       // Relation frontier was reached through, GRAPH_NO_RELATION if none.
+    bool transposed;    // Was relation traversed from destination to source.
+} Frontier;
+
+static inline double _Ratio(double part, double total) {
+    return (total > 0) ? part / total : 0;
+}
+
+static inline double _GraphNodeCount(const Graph *g) {
+    return Graph_NodeCount(g);
+}
+
+// Returns label of alias, NULL if unknown.
+static const char *_AliasLabel(const char *alias, const Node *n, const QueryGraph *qg) {
+    if(n && n->alias && strcmp(n->alias, alias) == 0) return n->label;
+    if(!qg) return NULL;
+    Node *qn = QueryGraph_GetNodeByAlias(qg, alias);
+    return (qn) ? qn->label : NULL;
+}
+
+// Estimated fraction of label's nodes whose attribute equals a value of type.
+static double _IndexEqualitySelectivity(const Index *idx, SIType type, double label_count) {
+    double entries;
+    double distinct;
+    if(type == T_NULL) {
+        // Value unknown (query parameter), consider all indexed values.
+        entries = Index_EntryCount(idx, T_STRING) + Index_EntryCount(idx, T_DOUBLE);
+        distinct = Index_DistinctCount(idx, T_STRING) + Index_DistinctCount(idx, T_DOUBLE);
+    } else {
+        entries = Index_EntryCount(idx, type);
+        distinct = Index_DistinctCount(idx, type);
+    }
+    return _Ratio(_Ratio(entries, distinct), label_count);
+}
+
+/* Estimates selectivity of predicates of the form:
+ * alias.attribute [op] constant and id(alias) [op] constant. */
+static double _PredicateSelectivity(const FT_PredicateNode *pred, const Node *n, const QueryGraph *qg) {
+    GraphContext *gc = GraphContext_GetFromTLS();
+    int op = pred->op;
+    AR_ExpNode *entity = pred->lhs;
+    AR_ExpNode *value = pred->rhs;
+    int value_type = AR_EXP_GetOperandType(value);
+    if(value_type != AR_EXP_CONSTANT && value_type != AR_EXP_PARAM) {
+        entity = pred->rhs;
+        value = pred->lhs;
+        value_type = AR_EXP_GetOperandType(value);
+        if(value_type != AR_EXP_CONSTANT && value_type != AR_EXP_PARAM) return SELECTIVITY_DEFAULT;
+    }
+
+    // id(alias) = constant, expecting a single node.
+    if(entity->type == AR_EXP_OP) {
+        if(strcasecmp(entity->op.func_name, "id") != 0) return SELECTIVITY_DEFAULT;
+        if(op == EQ) return _Ratio(1, _GraphNodeCount(gc->g));
+        return (op == NE) ? 1 : SELECTIVITY_RANGE;
+    }
+
+    if(AR_EXP_GetOperandType(entity) != AR_EXP_VARIADIC) return SELECTIVITY_DEFAULT;
+    const char *attribute = entity->operand.variadic.entity_prop;
+    if(!attribute) return SELECTIVITY_DEFAULT;
+
+    double eq_selectivity = SELECTIVITY_EQUALITY;
+    const char *label = _AliasLabel(entity->operand.variadic.entity_alias, n, qg);
+    Index *idx = (label) ? GraphContext_GetIndex(gc, label, attribute) : NULL;
+    if(idx) {
+        SIType type = (value_type == AR_EXP_CONSTANT) ? SI_TYPE(value->operand.constant) : T_NULL;
+        eq_selectivity = _IndexEqualitySelectivity(idx, type, CostModel_LabelCardinality(label));
+    }
+
+    switch(op) {
+        case EQ:
+            return eq_selectivity;
+        case NE:
+            return 1 - eq_selectivity;
+        case LT:
+        case LE:
+        case GT:
+        case GE:
+            return SELECTIVITY_RANGE;
+        default:
+            return SELECTIVITY_DEFAULT;
+    }
+}
+
+static double _Selectivity(const FT_FilterNode *tree, const Node *n, const QueryGraph *qg) {
+    if(IsNodePredicate(tree)) return _PredicateSelectivity(&tree->pred, n, qg);
+
+    double left = _Selectivity(tree->cond.left, n, qg);
+    double right = _Selectivity(tree->cond.right, n, qg);
+    if(tree->cond.op == AND) return left * right;
+    return left + right - left * right;
+}
+
+// Returns true if alias is the only alias tree refers to.
+static bool _SoleAlias(const FT_FilterNode *tree, const char *alias) {
+    Vector *aliases = FilterTree_CollectAliases(tree);
+    size_t alias_count = Vector_Size(aliases);
+    bool sole = (alias_count == 1);
+
+    for(int i = 0; i < alias_count; i++) {
+        char *a;
+        Vector_Get(aliases, i, &a);
+        if(sole) sole = (strcmp(a, alias) == 0);
+        free(a);
+    }
+    Vector_Free(aliases);
+    return sole;
+}
+
+double CostModel_NodeSelectivity(const Node *n, const FT_FilterNode *tree) {
+    if(!tree || !n->alias) return 1;
+
+    // Break down conjunctions, each component might refer to different aliases.
+    if(!IsNodePredicate(tree) && tree->cond.op == AND) {
+        return CostModel_NodeSelectivity(n, tree->cond.left) *
+               CostModel_NodeSelectivity(n, tree->cond.right);
+    }
+
+    if(!_SoleAlias(tree, n->alias)) return 1;
+    return _Selectivity(tree, n, NULL);
+}
+
+double CostModel_FilterSelectivity(const FT_FilterNode *tree, const QueryGraph *qg) {
+    if(!tree) return 1;
+    return _Selectivity(tree, NULL, qg);
+}
+
+double CostModel_LabelCardinality(const char *label) {
+    GraphContext *gc = GraphContext_GetFromTLS();
+    if(!label) return _GraphNodeCount(gc->g);
+
+    Schema *s = GraphContext_GetSchema(gc, label, SCHEMA_NODE);
+    if(!s) return 0;
+    return Graph_LabeledNodeCount(gc->g, s->id);
+}
+
+double CostModel_NodeCardinality(const Node *n, const FT_FilterNode *tree) {
+    return CostModel_LabelCardinality(n->label) * CostModel_NodeSelectivity(n, tree);
+}
+
+// Returns label ID represented by matrix, GRAPH_NO_LABEL if m isn't a label matrix.
+static int _MatrixLabel(const Graph *g, GrB_Matrix m) {
+    int label_count = Graph_LabelTypeCount(g);
+    for(int i = 0; i < label_count; i++) {
+        if(Graph_GetLabelMatrix(g, i) == m) return i;
+    }
+    return GRAPH_NO_LABEL;
+}
+
+// Returns relation ID represented by matrix, GRAPH_NO_RELATION if m isn't a relation matrix.
+static int _MatrixRelation(const Graph *g, GrB_Matrix m) {
+    int relation_count = Graph_RelationTypeCount(g);
+    for(int i = 0; i < relation_count; i++) {
+        if(Graph_GetRelationMatrix(g, i) == m) return i;
+    }
+    return GRAPH_NO_RELATION;
+}
+
+static inline uint64_t _LabelPairs(const uint64_t *label_pairs, int label) {
+    return (label < array_len((uint64_t*)label_pairs)) ? label_pairs[label] : 0;
+}
+
+// Advances frontier through relation.
+static void _Frontier_Relation(Frontier *f, Graph *g, int relation, bool transposed) {
+    RelationStatistics stats;
+    GraphStatistics_GetRelationStatistics(g, relation, false, &stats);
+
+    // Pairs leaving frontier nodes.
+    double pairs = stats.pairs;
+    double nodes = _GraphNodeCount(g);
+    if(f->label != GRAPH_NO_LABEL) {
+        const uint64_t *label_pairs = (transposed) ? stats.dest_label_pairs : stats.src_label_pairs;
+        pairs = _LabelPairs(label_pairs, f->label);
+        nodes = Graph_LabeledNodeCount(g, f->label);
+    }
+
+    f->rows *= _Ratio(pairs, nodes);
+    f->label = GRAPH_NO_LABEL;
+    f->relation = relation;
+    f->transposed = transposed;
+    RelationStatistics_Free(&stats);
+}
+
+// Restricts frontier to nodes of label.
+static void _Frontier_Label(Frontier *f, Graph *g, int label) {
+    double label_count = Graph_LabeledNodeCount(g, label);
+    if(f->relation == GRAPH_NO_RELATION) {
+        f->rows *= _Ratio(label_count, _GraphNodeCount(g));
+    } else {
+        // Fraction of the relation's pairs reaching nodes of label.
+        RelationStatistics stats;
+        GraphStatistics_GetRelationStatistics(g, f->relation, false, &stats);
+        const uint64_t *label_pairs = (f->transposed) ? stats.src_label_pairs : stats.dest_label_pairs;
+        f->rows *= _Ratio(_LabelPairs(label_pairs, label), stats.pairs);
+        RelationStatistics_Free(&stats);
+    }
+    f->label = label;
+}
+
+// Advances frontier through a matrix which isn't a label nor a relation matrix.
+static void _Frontier_Matrix(Frontier *f, Graph *g, GrB_Matrix m) {
+    GrB_Index nvals;
+    GrB_Matrix_nvals(&nvals, m);
+    f->rows *= _Ratio(nvals, _GraphNodeCount(g));
+    f->label = GRAPH_NO_LABEL;
+    f->relation = GRAPH_NO_RELATION;
+}
+
+// Advances frontier through a single expression operand.
+static void _Frontier_Operand(Frontier *f, Graph *g, const AlgebraicExpressionOperand *operand,
+                              bool reversed) {
+    GrB_Matrix m = operand->operand;
+    bool transposed = (operand->transpose != reversed);
+
+    int label = _MatrixLabel(g, m);
+    if(label != GRAPH_NO_LABEL) {
+        // Label of the frontier nodes is already accounted for.
+        if(f->label != label) _Frontier_Label(f, g, label);
+        return;
+    }
+
+    int relation = _MatrixRelation(g, m);
+    if(relation != GRAPH_NO_RELATION) _Frontier_Relation(f, g, relation, transposed);
+    else _Frontier_Matrix(f, g, m);
+}
+
+// Advances frontier through expression's operands.
+static void _Frontier_Operands(Frontier *f, Graph *g, const AlgebraicExpression *exp, bool reversed) {
+    size_t operand_count = exp->operand_count;
+    for(size_t i = 0; i < operand_count; i++) {
+        size_t idx = (reversed) ? operand_count - 1 - i : i;
+        _Frontier_Operand(f, g, exp->operands + idx, reversed);
+    }
+}
+
+/* Advances frontier through expression, from its source to its destination
+ * or from its destination to its source if reversed. */
+static void _Frontier_Expression(Frontier *f, Graph *g, const AlgebraicExpression *exp,
+                                 bool reversed, const FT_FilterNode *tree) {
+    double rows = f->rows;
+    _Frontier_Operands(f, g, exp, reversed);
+
+    /* Variable length expressions are made of a single relation,
+     * sum up the number of nodes reached by each number of hops,
+     * hops following the first one leave nodes of any label. */
+    if(exp->edgeLength && rows > 0) {
+        double first_fanout = f->rows / rows;
+        Frontier any = {.rows = 1, .label = GRAPH_NO_LABEL, .relation = GRAPH_NO_RELATION};
+        _Frontier_Operands(&any, g, exp, reversed);
+        double fanout = any.rows;
+
+        unsigned int min_hops = exp->edgeLength->minHops;
+        unsigned int max_hops = exp->edgeLength->maxHops;
+        if(max_hops - min_hops > VAR_LEN_ESTIMATED_HOPS) max_hops = min_hops + VAR_LEN_ESTIMATED_HOPS;
+
+        double reached = 0;
+        for(unsigned int hops = min_hops; hops <= max_hops; hops++) {
+            reached += (hops == 0) ? 1 : first_fanout * pow(fanout, hops - 1);
+        }
+        f->rows = rows * reached;
+    }
+
+    const Node *n = (reversed) ? exp->src_node : exp->dest_node;
+    f->rows *= CostModel_NodeSelectivity(n, tree);
+}
+
+// Frontier made of the nodes matching n.
+static void _Frontier_Init(Frontier *f, const Node *n, const FT_FilterNode *tree) {
+    f->rows = CostModel_NodeCardinality(n, tree);
+    f->label = (n->label && n->labelID >= 0) ? n->labelID : GRAPH_NO_LABEL;
+    f->relation = GRAPH_NO_RELATION;
+    f->transposed = false;
+}
+
+double CostModel_TraversalCost(AlgebraicExpression **exps, size_t expCount, size_t entry,
+                               const FT_FilterNode *tree) {
+    assert(entry <= expCount);
+    GraphContext *gc = GraphContext_GetFromTLS();
+    Graph *g = gc->g;
+
+    Frontier f;
+    const Node *n = (entry < expCount) ? exps[entry]->src_node : exps[expCount - 1]->dest_node;
+    _Frontier_Init(&f, n, tree);
+    double scanned = f.rows;
+    double cost = scanned;
+
+    // Expressions to the left of entry, traversed from destination to source.
+    for(int i = (int)entry - 1; i >= 0; i--) {
+        _Frontier_Expression(&f, g, exps[i], true, tree);
+        cost += f.rows;
+    }
+
+    /* Expressions to the right of entry continue from entry,
+     * each record produced so far is expanded. */
+    double expansion = _Ratio(f.rows, scanned);
+    _Frontier_Init(&f, n, tree);
+    for(size_t i = entry; i < expCount; i++) {
+        _Frontier_Expression(&f, g, exps[i], false, tree);
+        cost += f.rows * expansion;
+    }
+
+    return cost;
+}
@@ -0,0 +1,41 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Redis Labs Source Available License Agreement
+*/
+
+#ifndef __COST_MODEL_H__
+#define __COST_MODEL_H__
+
+#include "../../graph/query_graph.h"
+#include "../../filter_tree/filter_tree.h"
+#include "../../arithmetic/algebraic_expression.h"
+
+/* Cost model used by the optimizer to compare alternative plans,
+ * estimations are based on the graph statistics: label and relation
+ * cardinalities, relation degrees and index distinct value counts.
+ * Costs are measured in the estimated number of records produced. */
+
+/* Estimated fraction of records passing filter tree,
+ * query graph is used to resolve filtered aliases' labels, it may be NULL. */
+double CostModel_FilterSelectivity(const FT_FilterNode *tree, const QueryGraph *qg);
+
+/* Estimated fraction of n's nodes passing the filters in tree applied solely to n. */
+double CostModel_NodeSelectivity(const Node *n, const FT_FilterNode *tree);
+
+/* Estimated number of nodes carrying label. */
+double CostModel_LabelCardinality(const char *label);
+
+/* Estimated number of nodes matching n, considering n's label
+ * and the filters in tree applied solely to n. */
+double CostModel_NodeCardinality(const Node *n, const FT_FilterNode *tree);
+
+/* Estimated cost of resolving the linear pattern described by exps,
+ * beginning at the node at position entry, where position i < expCount
+ * refers to exps[i]->src_node and position expCount to the last destination node.
+ * Expressions to the left of entry are traversed first, from right to left,
+ * followed by the expressions to the right of entry. */
+double CostModel_TraversalCost(AlgebraicExpression **exps, size_t expCount, size_t entry,
+                               const FT_FilterNode *tree);
+
+#endif
@@ -0,0 +1,68 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Redis Labs Source Available License Agreement
+*/
+
+#include "./fuse_scan_filters.h"
+#include "../ops/op_filter.h"
+#include "../ops/op_all_node_scan.h"
+#include "../ops/op_node_by_label_scan.h"
+#include "../../util/arr.h"
+
+// Locates filters applied directly to the output of a scan which filters can be fused into.
+static void _collectScanFilters(OpBase *root, OpBase ***filters) {
+    if(root == NULL) return;
+
+    if(root->type == OPType_FILTER) {
+        OpBase *child = root->children[0];
+        if((child->type == OPType_ALL_NODE_SCAN || child->type == OPType_NODE_BY_LABEL_SCAN) &&
+           child->childCount == 0) {
+            *filters = array_append(*filters, root);
+        }
+    }
+
+    for(int i = 0; i < root->childCount; i++) {
+        _collectScanFilters(root->children[i], filters);
+    }
+}
+
+static void _fuseScanFilter(ExecutionPlan *plan, OpBase *filter) {
+    OpBase *scan = filter->children[0];
+    FT_FilterNode *tree = ((Filter*)filter)->filterTree;
+
+    // Scan already applies filters.
+    if((scan->type == OPType_ALL_NODE_SCAN && ((AllNodeScan*)scan)->filterTree) ||
+       (scan->type == OPType_NODE_BY_LABEL_SCAN && ((NodeByLabelScan*)scan)->filterTree)) return;
+
+    if(scan->type == OPType_ALL_NODE_SCAN) AllNodeScanSetFilter(scan, tree);
+    else NodeByLabelScanSetFilter(scan, tree);
+
+    /* Scan replaces filter at the same position within filter's parent,
+     * retaining the order of the parent's children. */
+    OpBase *parent = filter->parent;
+    scan->parent = parent;
+    if(parent == NULL) {
+        plan->root = scan;
+    } else {
+        for(int i = 0; i < parent->childCount; i++) {
+            if(parent->children[i] == filter) parent->children[i] = scan;
+        }
+    }
+
+    // Filter tree is now owned by scan.
+    ((Filter*)filter)->filterTree = NULL;
+    OpBase_Free(filter);
+}
+
+void fuseScanFilters(ExecutionPlan *plan) {
+    OpBase **filters = array_new(OpBase*, 0);
+    _collectScanFilters(plan->root, &filters);
+
+    uint filter_count = array_len(filters);
+    for(uint i = 0; i < filter_count; i++) {
+        _fuseScanFilter(plan, filters[i]);
+    }
+
+    array_free(filters);
+}
@@ -0,0 +1,20 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Redis Labs Source Available License Agreement
+*/
+
+#ifndef __FUSE_SCAN_FILTERS_H__
+#define __FUSE_SCAN_FILTERS_H__
+
+#include "../execution_plan.h"
+
+/* The fuse scan filters optimizer merges FILTER operations applied directly
+ * to the output of a node scan into the scan itself, such that nodes are
+ * filtered prior to building records, records are only produced for
+ * nodes passing the filters.
+ * Other optimizations expect filters to be standalone operations,
+ * as such this optimization should be applied last. */
+void fuseScanFilters(ExecutionPlan *plan);
+
+#endif
@@ -10,11 +10,11 @@
 #include "./reduce_filters.h"
 #include "./traverse_order.h"
 #include "./utilize_indices.h"
-#include "./select_entry_point.h"
 #include "./reduce_scans.h"
 #include "./relocate_op.h"
 #include "./reduce_count.h"
 #include "./reduce_distinct.h"
 #include "./seek_by_id.h"
+#include "./fuse_scan_filters.h"
 
 #endif
@@ -63,6 +63,11 @@ static int _identifyPattern(OpBase *root, OpResult **opResult, OpAggregate **opA
     return 1;
 }
 
+// Counts are folded into the plan, which is only valid for the current data.
+static OpResult _reduceCount_Rebind(OpBase *op) {
+    return OP_ERR;
+}
+
 void reduceCount(ExecutionPlan *plan, AST *ast) {
     /* We'll only modify execution plan if it is structured as follows:
      * "Scan -> Aggregate -> Results" */
@@ -105,6 +110,7 @@ void reduceCount(ExecutionPlan *plan, AST *ast) {
     exps = array_append(exps, exp);
 
     OpBase *opProject = NewProjectOp(ast, exps, aliases);
+    opProject->rebind = _reduceCount_Rebind;
 
     // New execution plan: "Project -> Results"    
     ExecutionPlan_RemoveOp(plan, (OpBase*)opScan);    
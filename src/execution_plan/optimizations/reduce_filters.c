@@ -5,36 +5,71 @@
 */
 
 #include "reduce_filters.h"
+#include "cost_model.h"
 #include "../ops/op_filter.h"
 #include "../../filter_tree/filter_tree.h"
 #include "../../parser/grammar.h"
+#include "../../util/arr.h"
 
-void _reduceFilter(OpBase *op) {
+/* Merged filter trees, along with their estimated selectivity. */
+typedef struct {
+    FT_FilterNode *tree;
+    double selectivity;
+} _FilterTree;
+
+/* Sort trees by ascending selectivity, retaining the original order of
+ * equally selective trees, as AND evaluates its left side first and
+ * short-circuits, the most selective filters are placed on the left. */
+void _sortFilterTrees(_FilterTree *trees, uint count) {
+    for(uint i = 1; i < count; i++) {
+        _FilterTree current = trees[i];
+        int j = i - 1;
+        while(j >= 0 && trees[j].selectivity > current.selectivity) {
+            trees[j + 1] = trees[j];
+            j--;
+        }
+        trees[j + 1] = current;
+    }
+}
+
+void _reduceFilter(OpBase *op, const QueryGraph *qg) {
     OpBase *parent = op;
     Filter *filter = (Filter*)parent;
-    FT_FilterNode *tree = filter->filterTree;
     OpBase *child = NULL;
 
+    _FilterTree *trees = array_new(_FilterTree, 2);
+    _FilterTree t = {.tree = filter->filterTree,
+                     .selectivity = CostModel_FilterSelectivity(filter->filterTree, qg)};
+    trees = array_append(trees, t);
+
     /* Filter operation is promised to have only one child. */
     while(parent->childCount == 1) {
         child = parent->children[0];
         if(child->type != OPType_FILTER) break;
 
         Filter *childFilter = (Filter*)child;
-
-        /* Create a new root for the tree, merge trees using an AND. */
-        FT_FilterNode *root = CreateCondFilterNode(AND);
-        AppendLeftChild(root, tree);
-        AppendRightChild(root, childFilter->filterTree);
-        tree = root;
+        t.tree = childFilter->filterTree;
+        t.selectivity = CostModel_FilterSelectivity(childFilter->filterTree, qg);
+        trees = array_append(trees, t);
 
         // Proceed.
         parent = child;
     }
 
     // Did we performed a reduction?
-    if(filter->filterTree != tree) {
+    uint tree_count = array_len(trees);
+    if(tree_count > 1) {
+        /* Merge trees using ANDs, most selective tree is evaluated first. */
+        _sortFilterTrees(trees, tree_count);
+        FT_FilterNode *tree = trees[0].tree;
+        for(uint i = 1; i < tree_count; i++) {
+            FT_FilterNode *root = CreateCondFilterNode(AND);
+            AppendLeftChild(root, tree);
+            AppendRightChild(root, trees[i].tree);
+            tree = root;
+        }
         filter->filterTree = tree;
+
         // Remove intermidate filter ops.
         OpBase *intermidateChild = child->parent;
         while(intermidateChild != op) {
@@ -51,20 +86,22 @@ void _reduceFilter(OpBase *op) {
         child->parent = op;
         op->children[0] = child;
     }
+
+    array_free(trees);
 }
 
-void _reduceFilters(OpBase *op) {
+void _reduceFilters(OpBase *op, const QueryGraph *qg) {
     if(op == NULL) return;
     
     if(op->type == OPType_FILTER) {
-        _reduceFilter(op);
+        _reduceFilter(op, qg);
     }
 
     for(int i = 0; i < op->childCount; i++) {
-        _reduceFilters(op->children[i]);
+        _reduceFilters(op->children[i], qg);
     }
 }
 
 void reduceFilters(ExecutionPlan *plan) {
-    return _reduceFilters(plan->root);
+    return _reduceFilters(plan->root, plan->query_graph);
 }
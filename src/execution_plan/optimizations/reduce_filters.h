@@ -13,7 +13,8 @@
  * consecutive filter operations, these can be reduced down into
  * a single filter operation by ANDing their filter trees
  * Reducing the overall number of operations is expected to produce
- * faster execution time. */
+ * faster execution time. Trees are ordered by their estimated selectivity
+ * such that the most selective filters are evaluated first. */
 void reduceFilters(ExecutionPlan *plan);
 
 #endif
@@ -11,17 +11,14 @@
 #include "../../filter_tree/filter_tree.h"
 #include "../../arithmetic/algebraic_expression.h"
 
-typedef enum {
-    TRAVERSE_ORDER_FIRST,
-    TRAVERSE_ORDER_LAST,
-} TRAVERSE_ORDER;
-
-/* Traverse order tries to determine which of the linear expressions should 
- * be used as the first traverse operation, we will prefer using an expression
- * which has a filter applied to it, as we wish to filter as early as we can,
- * that way we expect the number of entities inspected to be reduced at an early stage. */
-TRAVERSE_ORDER determineTraverseOrder(const FT_FilterNode *filterTree,
-                                      AlgebraicExpression **exps,
-                                      size_t expCount);
+/* Traverse order determines which node along the linear expressions should
+ * be scanned first, traversal then expands from it in both directions.
+ * We will prefer the node estimated by the cost model to inspect the least number
+ * of entities, accounting for label cardinalities, relation fanouts and filters selectivity.
+ * Returns entry position, where position i < expCount refers to exps[i]->src_node
+ * and position expCount to the destination node of the last expression. */
+size_t determineTraverseOrder(const FT_FilterNode *filterTree,
+                              AlgebraicExpression **exps,
+                              size_t expCount);
 
 #endif
@@ -1,23 +1,12 @@
 #include "utilize_indices.h"
 #include "../ops/op_index_scan.h"
+#include "./cost_model.h"
 #include "../../util/arr.h"
 
-/* Reverse an inequality symbol so that indices can support
- * inequalities with right-hand variables. */
-int _reverseOp(int op) {
-    switch(op) {
-        case LT:
-            return GT;
-        case LE:
-            return GE;
-        case GT:
-            return LT;
-        case GE:
-            return LE;
-        default:
-            return op;
-    }
-}
+/* Index scans are only preferred over label scans when they're expected
+ * to produce at most this fraction of the scanned label's nodes, as each
+ * entry retrieved by an index scan is costlier than a label scan step. */
+#define INDEX_SCAN_MAX_SELECTIVITY 0.5
 
 void _locateScanFilters(NodeByLabelScan *scanOp, OpBase ***filterOps) {
   /* We begin with a LabelScan, and want to find predicate filters that modify
@@ -54,6 +43,71 @@ void _locateScanOp(OpBase *root, NodeByLabelScan ***scanOps) {
   }
 }
 
+/* We'll only employ indices when we have filters of the form:
+ * node.property [rel] constant or
+ * constant [rel] node.property
+ * where the constant might also be a query parameter.
+ * If we are not comparing against a constant, then we cannot pre-define useful bounds
+ * for the index iterator, which diminishes their utility.
+ * Returns false if filter isn't of this form. */
+bool _filterBound(const FT_FilterNode *ft, char **filterProp, AR_ExpNode **boundExp, int *op) {
+  int lhsType = AR_EXP_GetOperandType(ft->pred.lhs);
+  int rhsType = AR_EXP_GetOperandType(ft->pred.rhs);
+  if (lhsType == AR_EXP_VARIADIC && (rhsType == AR_EXP_CONSTANT || rhsType == AR_EXP_PARAM)) {
+    *filterProp = ft->pred.lhs->operand.variadic.entity_prop;
+    *boundExp = ft->pred.rhs;
+    *op = ft->pred.op;
+  } else if ((lhsType == AR_EXP_CONSTANT || lhsType == AR_EXP_PARAM) && rhsType == AR_EXP_VARIADIC) {
+    *boundExp = ft->pred.lhs;
+    *filterProp = ft->pred.rhs->operand.variadic.entity_prop;
+    // When the constant is on the left, reverse the relation in the inequality
+    // to properly set the bounds.
+    *op = FilterTree_ReverseOp(ft->pred.op);
+  } else {
+    return false;
+  }
+  return (*filterProp != NULL);
+}
+
+/* Selects the index expected to yield the fewest nodes, given the filters
+ * applied to the scanned node, the selectivity of all filters on an indexed
+ * property is accounted for as they're all folded into the index scan.
+ * Returns NULL if no index is worth using. */
+Index *_selectIndex(NodeByLabelScan *scanOp, OpBase **filterOps) {
+  GraphContext *gc = GraphContext_GetFromTLS();
+  const char *label = scanOp->node->label;
+  Index *selected = NULL;
+  double minSelectivity = INDEX_SCAN_MAX_SELECTIVITY;
+
+  int filterOpsCount = array_len(filterOps);
+  for (int i = 0; i < filterOpsCount; i++) {
+    char *filterProp;
+    AR_ExpNode *boundExp;
+    int op;
+    FT_FilterNode *ft = ((Filter *)filterOps[i])->filterTree;
+    if (!_filterBound(ft, &filterProp, &boundExp, &op)) continue;
+
+    Index *idx = GraphContext_GetIndex(gc, label, filterProp);
+    // Skip missing and already considered indices.
+    if (!idx || idx == selected) continue;
+
+    double selectivity = 1;
+    for (int j = i; j < filterOpsCount; j++) {
+      char *prop;
+      FT_FilterNode *other = ((Filter *)filterOps[j])->filterTree;
+      if (!_filterBound(other, &prop, &boundExp, &op) || strcmp(prop, filterProp)) continue;
+      selectivity *= CostModel_NodeSelectivity(scanOp->node, other);
+    }
+
+    if (selectivity <= minSelectivity) {
+      minSelectivity = selectivity;
+      selected = idx;
+    }
+  }
+
+  return selected;
+}
+
 void utilizeIndices(ExecutionPlan *plan, AST *ast) {
   GraphContext *gc = GraphContext_GetFromTLS();
 
@@ -68,81 +122,76 @@ void utilizeIndices(ExecutionPlan *plan, AST *ast) {
   NodeByLabelScan *scanOp;
   OpBase **filterOps = array_new(OpBase*, 0);
   FT_FilterNode *ft;
-  char *label;
 
   // Variables to be used when comparing filters against available indices
   char *filterProp = NULL;
+  AR_ExpNode *boundExp;
   SIValue constVal;
-  int lhsType, rhsType;
   int op = 0;
 
   int scanOpCount = array_len(scanOps);
   for(int i = 0; i < scanOpCount; i++) {
-  // while (Vector_Pop(scanOps, &scanOp)) {
     scanOp = scanOps[i];
     IndexIter *iter = NULL;
-    Index *idx = NULL;
+    bool parameterized = false;
 
-    /* Get the label string for the scan target.
-     * The label will be used to retrieve the index. */
-    label = scanOp->node->label;
     array_clear(filterOps);
     _locateScanFilters(scanOp, &filterOps);
 
-    // No filters.
-    if(array_len(filterOps) == 0) continue;
-
     /* At this point we have all the filter ops (and thus, filter trees) associated
      * with the scanned entity. If there are valid indices on any filter and no
      * equal or higher precedence OR filters, we can switch to an index scan.
      *
-     * We'll currently use the first matching index, but apply all the filters on
-     * that property. A later optimization would be to find the index with the
-     * most filters, or use some heuristic for trying to select the minimal range. */
+     * We'll use the index estimated to be the most selective, and apply all the
+     * filters on that property, sticking to the label scan if none is selective enough. */
+    Index *idx = _selectIndex(scanOp, filterOps);
+    if (!idx) continue;
+
+    // Bounds are tracked in case some depend on query parameters.
+    IndexBound *bounds = array_new(IndexBound, 0);
 
     int filterOpsCount = array_len(filterOps);
     for (int i = 0; i < filterOpsCount; i ++) {
       OpBase *opFilter = filterOps[i];
       ft = ((Filter *)opFilter)->filterTree;
-      /* We'll only employ indices when we have filters of the form:
-       * node.property [rel] constant or
-       * constant [rel] node.property
-       * If we are not comparing against a constant, then we cannot pre-define useful bounds
-       * for the index iterator, which diminishes their utility. */
-      lhsType = AR_EXP_GetOperandType(ft->pred.lhs);
-      rhsType = AR_EXP_GetOperandType(ft->pred.rhs);
-      if (lhsType == AR_EXP_VARIADIC && rhsType == AR_EXP_CONSTANT) {
-        filterProp = ft->pred.lhs->operand.variadic.entity_prop;
-        constVal = ft->pred.rhs->operand.constant;
-        op = ft->pred.op;
-      } else if (lhsType == AR_EXP_CONSTANT && rhsType == AR_EXP_VARIADIC) {
-        constVal = ft->pred.lhs->operand.constant;
-        filterProp = ft->pred.rhs->operand.variadic.entity_prop;
-        // When the constant is on the left, reverse the relation in the inequality
-        // to properly set the bounds.
-        op = _reverseOp(ft->pred.op);
-      } else {
+      if (!_filterBound(ft, &filterProp, &boundExp, &op)) continue;
+
+      // Only filters on the selected index's property are folded into the scan.
+      if (strcmp(idx->attribute, filterProp)) continue;
+
+      /* Parameters are bound to values prior to each execution, their bounds are
+       * applied by the index scan and their filters are retained, as a parameter
+       * may be bound to a value of a type the iterator doesn't traverse. */
+      if (AR_EXP_GetOperandType(boundExp) == AR_EXP_PARAM) {
+        if (op == NE) continue;
+        bounds = array_append(bounds, ((IndexBound){.exp = AR_EXP_Clone(boundExp), .op = op}));
+        parameterized = true;
         continue;
       }
 
-      // If we've already selected an index on a different property, continue
-      if (idx && strcmp(idx->attribute, filterProp)) continue;
-
-      // Try to retrieve an index if one has not been selected yet
-      if (!idx) {
-        idx = GraphContext_GetIndex(gc, label, filterProp);
-        if (!idx) continue;
-        iter = IndexIter_Create(idx, SI_TYPE(constVal));
-      }
+      constVal = boundExp->operand.constant;
+      if (!iter) iter = IndexIter_Create(idx, SI_TYPE(constVal));
 
       // Tighten the iterator range if possible
       if (IndexIter_ApplyBound(iter, &constVal, op)) {
+        bounds = array_append(bounds, ((IndexBound){.exp = AR_EXP_Clone(boundExp), .op = op}));
         // Remove filter operations that have been folded into the index scan iterator
         ExecutionPlan_RemoveOp(plan, opFilter);
         OpBase_Free(opFilter);
       }
     }
 
+    if (parameterized) {
+      if (!iter) iter = IndexIter_Create(idx, T_NULL);
+      OpBase *indexOp = NewIndexScanOp(scanOp->g, scanOp->node, iter, ast);
+      IndexScanSetBounds(indexOp, idx, bounds);
+      ExecutionPlan_ReplaceOp(plan, (OpBase*)scanOp, indexOp);
+      continue;
+    }
+
+    for (uint j = 0; j < array_len(bounds); j++) AR_EXP_Free(bounds[j].exp);
+    array_free(bounds);
+
     if (iter != NULL) {
       OpBase *indexOp = NewIndexScanOp(scanOp->g, scanOp->node, iter, ast);
       ExecutionPlan_ReplaceOp(plan, (OpBase*)scanOp, indexOp);
@@ -153,4 +202,3 @@ void utilizeIndices(ExecutionPlan *plan, AST *ast) {
   array_free(filterOps);
   array_free(scanOps);
 }
-
@@ -14,7 +14,8 @@
 /* The utilizeIndices optimization finds Label Scan operations with Filter parents and, if
  * any constant predicate filter matches a viable index, replaces the Label Scan and Filter
  * with an Index Scan. This allows for the consideration of fewer candidate nodes and
- * significantly increases the speed of the operation. */
+ * significantly increases the speed of the operation. When several indices match, the one
+ * estimated to be the most selective is used, non-selective filters keep the Label Scan. */
 void utilizeIndices(ExecutionPlan *plan, AST *ast);
 
 #endif
\ No newline at end of file
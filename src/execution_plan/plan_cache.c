@@ -0,0 +1,121 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Redis Labs Source Available License Agreement
+*/
+
+#include "plan_cache.h"
+#include "../util/rmalloc.h"
+#include "xxhash/xxhash.h"
+#include <assert.h>
+#include <string.h>
+
+static inline uint64_t _PlanCache_Hash(const char *query, long long parallelism) {
+    return XXH64(query, strlen(query), (unsigned long long)parallelism);
+}
+
+// Detach entry from cache's LRU list.
+static void _PlanCache_Unlink(PlanCache *cache, PlanCacheEntry *entry) {
+    if(entry->prev) entry->prev->next = entry->next;
+    else cache->head = entry->next;
+    if(entry->next) entry->next->prev = entry->prev;
+    else cache->tail = entry->prev;
+
+    entry->prev = NULL;
+    entry->next = NULL;
+    cache->count--;
+}
+
+// Locate entry for query, NULL if missing.
+static PlanCacheEntry *_PlanCache_Find(const PlanCache *cache, const char *query,
+                                       long long parallelism, uint64_t hash) {
+    for(PlanCacheEntry *entry = cache->head; entry; entry = entry->next) {
+        if(entry->hash == hash &&
+           entry->parallelism == parallelism &&
+           strcmp(entry->query, query) == 0) return entry;
+    }
+    return NULL;
+}
+
+PlanCache *PlanCache_New(uint cap) {
+    assert(cap > 0);
+    PlanCache *cache = rm_malloc(sizeof(PlanCache));
+    cache->head = NULL;
+    cache->tail = NULL;
+    cache->count = 0;
+    cache->cap = cap;
+    assert(pthread_mutex_init(&cache->lock, NULL) == 0);
+    return cache;
+}
+
+PlanCacheEntry *PlanCache_Checkout(PlanCache *cache, const char *query, long long parallelism) {
+    uint64_t hash = _PlanCache_Hash(query, parallelism);
+
+    pthread_mutex_lock(&cache->lock);
+    PlanCacheEntry *entry = _PlanCache_Find(cache, query, parallelism, hash);
+    if(entry) _PlanCache_Unlink(cache, entry);
+    pthread_mutex_unlock(&cache->lock);
+
+    return entry;
+}
+
+void PlanCache_Return(PlanCache *cache, PlanCacheEntry *entry) {
+    PlanCacheEntry *evicted = NULL;
+
+    pthread_mutex_lock(&cache->lock);
+    /* The same query might have been cached while entry was checked out,
+     * keep the most recent of the two. */
+    PlanCacheEntry *existing = _PlanCache_Find(cache, entry->query, entry->parallelism, entry->hash);
+    if(existing) {
+        _PlanCache_Unlink(cache, existing);
+        evicted = existing;
+    } else if(cache->count == cache->cap) {
+        evicted = cache->tail;
+        _PlanCache_Unlink(cache, evicted);
+    }
+
+    entry->prev = NULL;
+    entry->next = cache->head;
+    if(cache->head) cache->head->prev = entry;
+    else cache->tail = entry;
+    cache->head = entry;
+    cache->count++;
+    pthread_mutex_unlock(&cache->lock);
+
+    // Free outside of the critical section.
+    if(evicted) PlanCacheEntry_Free(evicted);
+}
+
+PlanCacheEntry *PlanCacheEntry_New(const char *query, long long parallelism, AST **ast,
+                                   ExecutionPlan *plan, uint64_t version) {
+    PlanCacheEntry *entry = rm_malloc(sizeof(PlanCacheEntry));
+    entry->query = rm_strdup(query);
+    entry->hash = _PlanCache_Hash(query, parallelism);
+    entry->parallelism = parallelism;
+    entry->version = version;
+    entry->ast = ast;
+    entry->plan = plan;
+    entry->prev = NULL;
+    entry->next = NULL;
+    return entry;
+}
+
+void PlanCacheEntry_Free(PlanCacheEntry *entry) {
+    if(!entry) return;
+    if(entry->plan) ExecutionPlanFree(entry->plan);
+    if(entry->ast) AST_Free(entry->ast);
+    rm_free(entry->query);
+    rm_free(entry);
+}
+
+void PlanCache_Free(PlanCache *cache) {
+    if(!cache) return;
+    PlanCacheEntry *entry = cache->head;
+    while(entry) {
+        PlanCacheEntry *next = entry->next;
+        PlanCacheEntry_Free(entry);
+        entry = next;
+    }
+    pthread_mutex_destroy(&cache->lock);
+    rm_free(cache);
+}
@@ -0,0 +1,57 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Redis Labs Source Available License Agreement
+*/
+
+#ifndef __PLAN_CACHE_H__
+#define __PLAN_CACHE_H__
+
+#include <pthread.h>
+#include "execution_plan.h"
+
+/* Cached plan, along with the AST it was built from. */
+typedef struct PlanCacheEntry {
+    char *query;                    // Query text.
+    uint64_t hash;                  // Hash of query text and parallelism.
+    long long parallelism;          // Number of threads plan was built for.
+    uint64_t version;               // Graph schema version plan was built against.
+    AST **ast;                      // Validated and modified AST.
+    ExecutionPlan *plan;            // Initialized plan, NULL if not built yet.
+    struct PlanCacheEntry *prev;    // More recently used entry.
+    struct PlanCacheEntry *next;    // Less recently used entry.
+} PlanCacheEntry;
+
+/* LRU cache of execution plans for read-only queries, keyed by query text.
+ * Entries are checked out of the cache while in use,
+ * such that each plan is executed by a single query at a time. */
+typedef struct PlanCache {
+    PlanCacheEntry *head;   // Most recently used entry.
+    PlanCacheEntry *tail;   // Least recently used entry.
+    uint count;             // Number of cached entries.
+    uint cap;               // Maximum number of cached entries.
+    pthread_mutex_t lock;   // Guards cache, accessed by multiple threads.
+} PlanCache;
+
+/* Creates a cache holding up to cap plans. */
+PlanCache *PlanCache_New(uint cap);
+
+/* Removes and returns the entry cached for query, NULL if missing. */
+PlanCacheEntry *PlanCache_Checkout(PlanCache *cache, const char *query, long long parallelism);
+
+/* Adds entry to cache as its most recently used entry,
+ * replacing an entry for the same query and evicting
+ * the least recently used entry if cache is full. */
+void PlanCache_Return(PlanCache *cache, PlanCacheEntry *entry);
+
+/* Creates an entry for query, taking ownership over ast and plan. */
+PlanCacheEntry *PlanCacheEntry_New(const char *query, long long parallelism, AST **ast,
+                                   ExecutionPlan *plan, uint64_t version);
+
+/* Frees entry, along with its AST and plan. */
+void PlanCacheEntry_Free(PlanCacheEntry *entry);
+
+/* Frees cache and all cached entries. */
+void PlanCache_Free(PlanCache *cache);
+
+#endif
@@ -226,6 +226,138 @@ unsigned long long Record_Hash64(const Record r) {
     return hash;
 }
 
+size_t Record_MemoryUsage(const Record r) {
+    uint rec_len = Record_length(r);
+    size_t size = sizeof(Entry) * (rec_len + 1);
+    for(uint i = 0; i < rec_len; i++) {
+        if(r[i].type != REC_TYPE_SCALAR) continue;
+        SIValue v = r[i].value.s;
+        if(v.type == T_STRING && v.allocation == M_SELF) size += strlen(v.stringval) + 1;
+    }
+    return size;
+}
+
+static inline bool _Record_Write(FILE *stream, const void *data, size_t len) {
+    return fwrite(data, len, 1, stream) == 1;
+}
+
+static inline bool _Record_Read(FILE *stream, void *data, size_t len) {
+    return fread(data, len, 1, stream) == 1;
+}
+
+// Size of the graph entity an SIValue points to.
+static inline size_t _Record_EntitySize(SIType t) {
+    return (t == T_NODE) ? sizeof(Node) : sizeof(Edge);
+}
+
+/* Serialized record layout:
+ * record length (uint32)
+ * per entry: entry type (uint8) followed by
+ *   node / edge: entity struct
+ *   scalar: SIType (uint32) followed by
+ *     string: length (uint32) and characters
+ *     node / edge: entity struct
+ *     other: 8 bytes value */
+bool Record_Serialize(const Record r, FILE *stream) {
+    uint32_t rec_len = Record_length(r);
+    if(!_Record_Write(stream, &rec_len, sizeof(rec_len))) return false;
+
+    for(uint32_t i = 0; i < rec_len; i++) {
+        uint8_t type = r[i].type;
+        if(!_Record_Write(stream, &type, sizeof(type))) return false;
+
+        bool ok = true;
+        switch(r[i].type) {
+            case REC_TYPE_NODE:
+                ok = _Record_Write(stream, &r[i].value.n, sizeof(Node));
+                break;
+            case REC_TYPE_EDGE:
+                ok = _Record_Write(stream, &r[i].value.e, sizeof(Edge));
+                break;
+            case REC_TYPE_SCALAR: {
+                SIValue v = r[i].value.s;
+                uint32_t t = v.type;
+                if(!_Record_Write(stream, &t, sizeof(t))) return false;
+                if(v.type == T_STRING || v.type == T_CONSTSTRING) {
+                    uint32_t len = strlen(v.stringval);
+                    ok = _Record_Write(stream, &len, sizeof(len)) &&
+                         (len == 0 || _Record_Write(stream, v.stringval, len));
+                } else if(v.type == T_NODE || v.type == T_EDGE) {
+                    ok = _Record_Write(stream, v.ptrval, _Record_EntitySize(v.type));
+                } else {
+                    ok = _Record_Write(stream, &v.longval, sizeof(v.longval));
+                }
+                break;
+            }
+            default:
+                break;
+        }
+        if(!ok) return false;
+    }
+    return true;
+}
+
+Record Record_Deserialize(FILE *stream) {
+    uint32_t rec_len;
+    if(!_Record_Read(stream, &rec_len, sizeof(rec_len))) return NULL;
+
+    Record r = Record_New(rec_len);
+    for(uint32_t i = 0; i < rec_len; i++) {
+        uint8_t type;
+        if(!_Record_Read(stream, &type, sizeof(type))) goto error;
+
+        switch(type) {
+            case REC_TYPE_NODE:
+                if(!_Record_Read(stream, &r[i].value.n, sizeof(Node))) goto error;
+                r[i].type = REC_TYPE_NODE;
+                break;
+            case REC_TYPE_EDGE:
+                if(!_Record_Read(stream, &r[i].value.e, sizeof(Edge))) goto error;
+                r[i].type = REC_TYPE_EDGE;
+                break;
+            case REC_TYPE_SCALAR: {
+                uint32_t t;
+                SIValue v = SI_NullVal();
+                if(!_Record_Read(stream, &t, sizeof(t))) goto error;
+                if(t == T_STRING || t == T_CONSTSTRING) {
+                    uint32_t len;
+                    if(!_Record_Read(stream, &len, sizeof(len))) goto error;
+                    char *str = rm_malloc(len + 1);
+                    if(len > 0 && !_Record_Read(stream, str, len)) {
+                        rm_free(str);
+                        goto error;
+                    }
+                    str[len] = '\0';
+                    v = SI_TransferStringVal(str);
+                } else if(t == T_NODE || t == T_EDGE) {
+                    size_t size = _Record_EntitySize(t);
+                    void *entity = rm_malloc(size);
+                    if(!_Record_Read(stream, entity, size)) {
+                        rm_free(entity);
+                        goto error;
+                    }
+                    v.type = t;
+                    v.ptrval = entity;
+                    v.allocation = M_SELF;
+                } else {
+                    if(!_Record_Read(stream, &v.longval, sizeof(v.longval))) goto error;
+                    v.type = t;
+                    v.allocation = M_NONE;
+                }
+                Record_AddScalar(r, i, v);
+                break;
+            }
+            default:
+                break;
+        }
+    }
+    return r;
+
+error:
+    Record_Free(r);
+    return NULL;
+}
+
 void Record_Free(Record r) {
     int length = Record_length(r);
     for(int i = 0; i < length; i++) {
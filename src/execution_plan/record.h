@@ -7,6 +7,8 @@
 #ifndef __RECORD_H_
 #define __RECORD_H_
 
+#include <stdio.h>
+#include <stdbool.h>
 #include "../value.h"
 #include "../graph/entities/node.h"
 #include "../graph/entities/edge.h"
@@ -78,6 +80,18 @@ size_t Record_ToString(const Record r, char **buf, size_t *buf_cap);
 // 64-bit hash of record
 unsigned long long Record_Hash64(const Record r);
 
+// Approximated number of bytes occupied by record.
+size_t Record_MemoryUsage(const Record r);
+
+// Writes record to stream, returns false on failure.
+// Graph entities are written as is, serialized records are only
+// meaningful to the process which wrote them while the graph is locked.
+bool Record_Serialize(const Record r, FILE *stream);
+
+// Reads a record written by Record_Serialize,
+// returns NULL once stream is depleted or on failure.
+Record Record_Deserialize(FILE *stream);
+
 // Free record.
 void Record_Free(Record r);
 
@@ -0,0 +1,133 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Redis Labs Source Available License Agreement
+*/
+
+#include "./record_set.h"
+#include "../util/arr.h"
+#include "../util/rmalloc.h"
+
+// Marks record entry idx as holding an entity of the given kind.
+static inline void _RecordSet_Tag(SIValue *key, uint idx, uint64_t tag) {
+    key[idx / RECORD_SET_TAGS_PER_VALUE].longval |=
+        (int64_t)(tag << ((idx % RECORD_SET_TAGS_PER_VALUE) * RECORD_SET_TAG_BITS));
+}
+
+/* Builds record's key, strings are duplicated as records
+ * are handed to other operations which might free them.
+ * Entities are represented by their ID, the leading tag values
+ * tell nodes and edges apart from each other and from integers. */
+static void _RecordSet_BuildKey(const Record r, uint tag_len, uint key_len, SIValue *key) {
+    for(uint i = 0; i < tag_len; i++) key[i] = SI_LongVal(0);
+
+    SIValue *entries = key + tag_len;
+    for(uint i = 0; i < key_len - tag_len; i++) {
+        SIValue v;
+        switch(Record_GetType(r, i)) {
+            case REC_TYPE_NODE:
+                entries[i] = SI_LongVal(ENTITY_GET_ID(Record_GetGraphEntity(r, i)));
+                _RecordSet_Tag(key, i, RECORD_SET_TAG_NODE);
+                break;
+            case REC_TYPE_EDGE:
+                entries[i] = SI_LongVal(ENTITY_GET_ID(Record_GetGraphEntity(r, i)));
+                _RecordSet_Tag(key, i, RECORD_SET_TAG_EDGE);
+                break;
+            case REC_TYPE_SCALAR:
+                v = Record_GetScalar(r, i);
+                if(v.type == T_STRING || v.type == T_CONSTSTRING) {
+                    entries[i] = SI_DuplicateStringVal(v.stringval);
+                } else if(v.type == T_NODE || v.type == T_EDGE) {
+                    entries[i] = SI_LongVal(ENTITY_GET_ID((GraphEntity*)v.ptrval));
+                    _RecordSet_Tag(key, i, (v.type == T_NODE) ? RECORD_SET_TAG_NODE : RECORD_SET_TAG_EDGE);
+                } else {
+                    entries[i] = v;
+                    entries[i].allocation = M_NONE;
+                }
+                break;
+            default:
+                entries[i] = SI_NullVal();
+                break;
+        }
+    }
+}
+
+static void _RecordSet_FreeKey(SIValue *key, uint key_len) {
+    for(uint i = 0; i < key_len; i++) SIValue_Free(&key[i]);
+}
+
+// Returns storage for a new key.
+static SIValue *_RecordSet_NextKey(RecordSet *set) {
+    uint block_count = array_len(set->key_blocks);
+    if(block_count == 0 || set->key_count == RECORD_SET_KEY_BLOCK) {
+        SIValue *block = rm_malloc(sizeof(SIValue) * set->key_len * RECORD_SET_KEY_BLOCK);
+        set->key_blocks = array_append(set->key_blocks, block);
+        set->key_count = 0;
+        block_count++;
+    }
+    return set->key_blocks[block_count - 1] + (set->key_count * set->key_len);
+}
+
+RecordSet *RecordSet_New(uint64_t expected) {
+    RecordSet *set = rm_malloc(sizeof(RecordSet));
+    set->table = NULL;
+    set->expected = expected;
+    set->key_len = 0;
+    set->tag_len = 0;
+    set->key_blocks = array_new(SIValue*, 1);
+    set->key_count = 0;
+    return set;
+}
+
+bool RecordSet_Add(RecordSet *set, const Record r) {
+    // Key length is determined by the first record.
+    if(!set->table) {
+        uint len = Record_length(r);
+        set->tag_len = (len + RECORD_SET_TAGS_PER_VALUE - 1) / RECORD_SET_TAGS_PER_VALUE;
+        set->key_len = set->tag_len + len;
+        set->table = ValueTable_New(set->key_len, set->expected);
+    }
+
+    SIValue *key = _RecordSet_NextKey(set);
+    _RecordSet_BuildKey(r, set->tag_len, set->key_len, key);
+
+    uint64_t hash = ValueTable_HashKey(key, set->key_len);
+    if(ValueTable_Find(set->table, key, hash)) {
+        // Duplicate, key storage will be reused by the next record.
+        _RecordSet_FreeKey(key, set->key_len);
+        return false;
+    }
+
+    ValueTable_Insert(set->table, key, hash, NULL);
+    set->key_count++;
+    return true;
+}
+
+uint64_t RecordSet_Count(const RecordSet *set) {
+    if(!set->table) return 0;
+    return ValueTable_Count(set->table);
+}
+
+void RecordSet_Clear(RecordSet *set) {
+    if(!set->table) return;
+
+    uint block_count = array_len(set->key_blocks);
+    for(uint i = 0; i < block_count; i++) {
+        // Last block might be partially populated.
+        uint keys = (i == block_count - 1) ? set->key_count : RECORD_SET_KEY_BLOCK;
+        for(uint j = 0; j < keys; j++) {
+            _RecordSet_FreeKey(set->key_blocks[i] + (j * set->key_len), set->key_len);
+        }
+        rm_free(set->key_blocks[i]);
+    }
+    array_clear(set->key_blocks);
+    set->key_count = 0;
+    ValueTable_Clear(set->table, NULL);
+}
+
+void RecordSet_Free(RecordSet *set) {
+    RecordSet_Clear(set);
+    ValueTable_Free(set->table, NULL);
+    array_free(set->key_blocks);
+    rm_free(set);
+}
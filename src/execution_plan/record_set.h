@@ -0,0 +1,49 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Redis Labs Source Available License Agreement
+*/
+
+#ifndef __RECORD_SET_H_
+#define __RECORD_SET_H_
+
+#include <stdbool.h>
+#include "./record.h"
+#include "../util/value_table.h"
+
+#define RECORD_SET_KEY_BLOCK 1024   // Number of keys allocated at once.
+
+// Kind of entity occupying a record entry, scalars are tagged 0.
+#define RECORD_SET_TAG_NODE 1
+#define RECORD_SET_TAG_EDGE 2
+#define RECORD_SET_TAG_BITS 2
+#define RECORD_SET_TAGS_PER_VALUE (64 / RECORD_SET_TAG_BITS)
+
+/* Exact set of records, used to drop duplicates.
+ * Each distinct record is represented by a compact key, a tuple holding
+ * a copy of each scalar and the ID of each graph entity within the record,
+ * prefixed by integers tagging which entries hold nodes or edges. */
+typedef struct {
+    ValueTable *table;      // Maps record keys to nothing.
+    uint64_t expected;      // Expected number of distinct records.
+    uint key_len;           // Number of values in a key, determined by the first record.
+    uint tag_len;           // Number of leading tag values in a key.
+    SIValue **key_blocks;   // Key storage, blocks are never relocated.
+    uint key_count;         // Number of keys within the last block.
+} RecordSet;
+
+// Create a new record set expecting about expected distinct records.
+RecordSet *RecordSet_New(uint64_t expected);
+
+// Adds record's key to set, returns false if an equal record was already added.
+bool RecordSet_Add(RecordSet *set, const Record r);
+
+// Number of distinct records in set.
+uint64_t RecordSet_Count(const RecordSet *set);
+
+// Removes all records from set.
+void RecordSet_Clear(RecordSet *set);
+
+void RecordSet_Free(RecordSet *set);
+
+#endif
@@ -5,6 +5,7 @@
 */
 
 #include <assert.h>
+#include <string.h>
 #include "../value.h"
 #include "filter_tree.h"
 #include "../parser/grammar.h"
@@ -25,12 +26,17 @@ FT_FilterNode* CreateCondFilterNode(int op) {
     return filterNode;
 }
 
+void _FT_SpecializePredicate(FT_PredicateNode *pred);
+
 FT_FilterNode* _CreatePredicateFilterNode(const AST *ast, const AST_PredicateNode *pn) {
     FT_FilterNode *filterNode = malloc(sizeof(FT_FilterNode));
     filterNode->t= FT_N_PRED;
     filterNode->pred.op = pn->op;
     filterNode->pred.lhs = AR_EXP_BuildFromAST(ast, pn->lhs);
     filterNode->pred.rhs = AR_EXP_BuildFromAST(ast, pn->rhs);
+    AR_EXP_Compile(filterNode->pred.lhs);
+    AR_EXP_Compile(filterNode->pred.rhs);
+    _FT_SpecializePredicate(&filterNode->pred);
     return filterNode;
 }
 
@@ -131,20 +137,174 @@ int _applyFilter(SIValue* aVal, SIValue* bVal, int op) {
     return 0;
 }
 
-int _applyPredicateFilters(const FT_FilterNode* root, const Record r) {
+int _applyPredicateFilters(const FT_PredicateNode *pred, const Record r) {
     /* A op B
      * Evaluate the left and right sides of the predicate to obtain
      * comparable SIValues. */
-    SIValue lhs = AR_EXP_Evaluate(root->pred.lhs, r);
-    SIValue rhs = AR_EXP_Evaluate(root->pred.rhs, r);
+    SIValue lhs = AR_EXP_Evaluate(pred->lhs, r);
+    SIValue rhs = AR_EXP_Evaluate(pred->rhs, r);
+
+    return _applyFilter(&lhs, &rhs, pred->op);
+}
+
+/* Predicates comparing an expression to a value (constant or parameter)
+ * are evaluated by routines specialized to the predicate's operation
+ * and to the value's type, avoiding the generic comparison of SIValues.
+ * Whenever the expression evaluates to a type the routine doesn't handle
+ * evaluation falls back to _applyFilter, preserving comparison semantics. */
+
+static inline int _applyFilterToValue(SIValue v, const FT_PredicateNode *pred) {
+    SIValue value = *pred->value;
+    return _applyFilter(&v, &value, pred->op);
+}
+
+/* Defines the specialized predicates of the operation named op,
+ * where cmp is the C operator implementing op. */
+#define FT_VALUE_PREDICATES(op, cmp)                                                        \
+/* Integer value. */                                                                        \
+static int _applyInt64Predicate##op(const FT_PredicateNode *pred, const Record r) {         \
+    SIValue v = AR_EXP_Evaluate(pred->lhs, r);                                              \
+    if(SI_TYPE(v) != T_INT64) return _applyFilterToValue(v, pred);                          \
+    return v.longval cmp pred->value->longval;                                              \
+}                                                                                           \
+/* Floating point value. */                                                                 \
+static int _applyDoublePredicate##op(const FT_PredicateNode *pred, const Record r) {        \
+    SIValue v = AR_EXP_Evaluate(pred->lhs, r);                                              \
+    if(!(SI_TYPE(v) & SI_NUMERIC)) return _applyFilterToValue(v, pred);                     \
+    return SI_GET_NUMERIC(v) cmp pred->value->doubleval;                                    \
+}                                                                                           \
+/* String value. */                                                                         \
+static int _applyStringPredicate##op(const FT_PredicateNode *pred, const Record r) {        \
+    SIValue v = AR_EXP_Evaluate(pred->lhs, r);                                              \
+    if(SI_TYPE(v) != T_STRING) return _applyFilterToValue(v, pred);                         \
+    return strcmp(v.stringval, pred->value->stringval) cmp 0;                               \
+}                                                                                           \
+/* Parameter, its type is only known once bound. */                                         \
+static int _applyParamPredicate##op(const FT_PredicateNode *pred, const Record r) {         \
+    SIValue v = AR_EXP_Evaluate(pred->lhs, r);                                              \
+    const SIValue *value = pred->value;                                                     \
+    if(SI_TYPE(v) == T_INT64 && SI_TYPE(*value) == T_INT64) {                               \
+        return v.longval cmp value->longval;                                                \
+    }                                                                                       \
+    if((SI_TYPE(v) & SI_NUMERIC) && (SI_TYPE(*value) & SI_NUMERIC)) {                       \
+        return SI_GET_NUMERIC(v) cmp SI_GET_NUMERIC(*value);                                \
+    }                                                                                       \
+    if(SI_TYPE(v) == T_STRING && SI_TYPE(*value) == T_STRING) {                             \
+        return strcmp(v.stringval, value->stringval) cmp 0;                                 \
+    }                                                                                       \
+    return _applyFilterToValue(v, pred);                                                    \
+}
+
+FT_VALUE_PREDICATES(EQ, ==)
+FT_VALUE_PREDICATES(NE, !=)
+FT_VALUE_PREDICATES(LT, <)
+FT_VALUE_PREDICATES(LE, <=)
+FT_VALUE_PREDICATES(GT, >)
+FT_VALUE_PREDICATES(GE, >=)
+
+typedef struct {
+    FT_PredicateFunc int64;
+    FT_PredicateFunc dbl;
+    FT_PredicateFunc string;
+    FT_PredicateFunc param;
+} FT_ValuePredicates;
+
+#define FT_VALUE_PREDICATES_ENTRY(op) {                     \
+    _applyInt64Predicate##op, _applyDoublePredicate##op,    \
+    _applyStringPredicate##op, _applyParamPredicate##op     \
+}
+
+static const FT_ValuePredicates *_valuePredicates(int op) {
+    static const FT_ValuePredicates eq = FT_VALUE_PREDICATES_ENTRY(EQ);
+    static const FT_ValuePredicates ne = FT_VALUE_PREDICATES_ENTRY(NE);
+    static const FT_ValuePredicates lt = FT_VALUE_PREDICATES_ENTRY(LT);
+    static const FT_ValuePredicates le = FT_VALUE_PREDICATES_ENTRY(LE);
+    static const FT_ValuePredicates gt = FT_VALUE_PREDICATES_ENTRY(GT);
+    static const FT_ValuePredicates ge = FT_VALUE_PREDICATES_ENTRY(GE);
+
+    switch(op) {
+        case EQ:
+            return &eq;
+        case NE:
+            return &ne;
+        case LT:
+            return &lt;
+        case LE:
+            return &le;
+        case GT:
+            return &gt;
+        case GE:
+            return &ge;
+        default:
+            return NULL;
+    }
+}
 
-    return _applyFilter(&lhs, &rhs, root->pred.op);
+static inline bool _isValueExp(AR_ExpNode *exp) {
+    int type = AR_EXP_GetOperandType(exp);
+    return (type == AR_EXP_CONSTANT || type == AR_EXP_PARAM);
+}
+
+/* Selects predicate's evaluation routine, predicates comparing a value to
+ * an expression are rewritten such that the value is on the right-hand side. */
+void _FT_SpecializePredicate(FT_PredicateNode *pred) {
+    pred->eval = _applyPredicateFilters;
+    pred->value = NULL;
+
+    if(_isValueExp(pred->lhs) && !_isValueExp(pred->rhs)) {
+        AR_ExpNode *exp = pred->lhs;
+        pred->lhs = pred->rhs;
+        pred->rhs = exp;
+        pred->op = FilterTree_ReverseOp(pred->op);
+    }
+
+    const FT_ValuePredicates *predicates = _valuePredicates(pred->op);
+    if(!predicates || !_isValueExp(pred->rhs)) return;
+
+    if(AR_EXP_GetOperandType(pred->rhs) == AR_EXP_PARAM) {
+        // Parameter's value might change between executions.
+        pred->value = &pred->rhs->operand.param->value;
+        pred->eval = predicates->param;
+        return;
+    }
+
+    pred->value = &pred->rhs->operand.constant;
+    switch(SI_TYPE(*pred->value)) {
+        case T_INT64:
+            pred->eval = predicates->int64;
+            break;
+        case T_DOUBLE:
+            pred->eval = predicates->dbl;
+            break;
+        case T_STRING:
+            pred->eval = predicates->string;
+            break;
+        default:
+            // Compared using the generic routine.
+            pred->value = NULL;
+            break;
+    }
+}
+
+int FilterTree_ReverseOp(int op) {
+    switch(op) {
+        case LT:
+            return GT;
+        case LE:
+            return GE;
+        case GT:
+            return LT;
+        case GE:
+            return LE;
+        default:
+            return op;
+    }
 }
 
 int FilterTree_applyFilters(const FT_FilterNode* root, const Record r) {
     /* Handle predicate node. */
     if(IsNodePredicate(root)) {
-        return _applyPredicateFilters(root, r);
+        return root->pred.eval(&root->pred, r);
     }
 
     /* root->t == FT_N_COND, visit left subtree. */
@@ -163,6 +323,44 @@ int FilterTree_applyFilters(const FT_FilterNode* root, const Record r) {
     return pass;
 }
 
+static void _applyPredicateBatch(const FT_PredicateNode *pred, const Record *records, uint count,
+                                 uint64_t *selection) {
+    uint words = FILTER_SELECTION_WORDS(count);
+    for(uint i = 0; i < words; i++) {
+        // Visit selected records only.
+        uint64_t word = selection[i];
+        while(word) {
+            int bit = __builtin_ctzll(word);
+            word &= word - 1;
+            if(!pred->eval(pred, records[i * 64 + bit])) selection[i] &= ~(1ULL << bit);
+        }
+    }
+}
+
+void FilterTree_applyFiltersBatch(const FT_FilterNode *root, const Record *records, uint count,
+                                  uint64_t *selection) {
+    if(IsNodePredicate(root)) {
+        _applyPredicateBatch(&root->pred, records, count, selection);
+        return;
+    }
+
+    if(root->cond.op == AND) {
+        // Right subtree only visits records passing the left subtree.
+        FilterTree_applyFiltersBatch(LeftChild(root), records, count, selection);
+        FilterTree_applyFiltersBatch(RightChild(root), records, count, selection);
+        return;
+    }
+
+    // OR, right subtree only visits records failing the left subtree.
+    uint words = FILTER_SELECTION_WORDS(count);
+    uint64_t rest[words];
+    memcpy(rest, selection, sizeof(uint64_t) * words);
+    FilterTree_applyFiltersBatch(LeftChild(root), records, count, selection);
+    for(uint i = 0; i < words; i++) rest[i] &= ~selection[i];
+    FilterTree_applyFiltersBatch(RightChild(root), records, count, rest);
+    for(uint i = 0; i < words; i++) selection[i] |= rest[i];
+}
+
 void _FilterTree_CollectAliases(const FT_FilterNode *root, TrieMap *aliases) {
     if(root == NULL) return;
 
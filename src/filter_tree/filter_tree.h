@@ -22,11 +22,17 @@ typedef enum {
 } FT_FilterNodeType;
 
 struct FT_FilterNode;
+struct FT_PredicateNode;
 
-typedef struct {
+/* Predicate evaluation routine, returns FILTER_PASS or FILTER_FAIL. */
+typedef int (*FT_PredicateFunc)(const struct FT_PredicateNode *pred, const Record r);
+
+typedef struct FT_PredicateNode {
 	AR_ExpNode *lhs;
 	AR_ExpNode *rhs;
 	int op;					/* Operation (<, <=, =, =>, >, !). */
+	FT_PredicateFunc eval;	/* Evaluation routine, specialized to operands' types. */
+	const SIValue *value;	/* rhs value, when rhs is a constant or a parameter. */
 } FT_PredicateNode;
 
 typedef struct {
@@ -60,6 +66,20 @@ FT_FilterNode *AppendRightChild(FT_FilterNode *root, FT_FilterNode *child);
 /* Runs val through the filter tree. */
 int FilterTree_applyFilters(const FT_FilterNode* root, const Record r);
 
+/* Number of 64 bit words in a selection bitmap of n records. */
+#define FILTER_SELECTION_WORDS(n) (((n) + 63) / 64)
+
+/* Number of scanned records filtered together, a single selection word. */
+#define FILTER_BATCH_SIZE 64
+
+/* Runs count records through the filter tree, record i is represented by
+ * bit i % 64 of selection[i / 64], on entry selection marks the records
+ * to filter, on return it marks the records passing the filter. */
+void FilterTree_applyFiltersBatch(const FT_FilterNode *root, const Record *records, uint count, uint64_t *selection);
+
+/* Reverse an inequality symbol, such that a op b equals b reversed op a. */
+int FilterTree_ReverseOp(int op);
+
 /* Extract every alias mentioned in the tree
  * without duplications. */
 Vector *FilterTree_CollectAliases(const FT_FilterNode *root);
@@ -13,6 +13,8 @@
 #include "../util/rmalloc.h"
 
 static GrB_BinaryOp _graph_edge_accum = NULL;
+static GrB_UnaryOp _graph_edge_count = NULL;
+static uint64_t _graph_version = 0;    // Last version handed out to a graph.
 
 GrB_Matrix _Graph_GetRelationMap(const Graph *g, int relation_idx);
 
@@ -43,6 +45,14 @@ void _edge_accum(void *_z, const void *_x, const void *_y) {
     }
 }
 
+// Number of edges held by a relation map entry.
+void _edge_count(void *_z, const void *_x) {
+    uint64_t *z = (uint64_t*)_z;
+    const EdgeID *x = (const EdgeID*)_x;
+    if(SINGLE_EDGE(*x)) *z = 1;
+    else *z = array_len((EdgeID*)(*x));
+}
+
 bool _select_op_free_edge(GrB_Index i, GrB_Index j, GrB_Index nrows, GrB_Index ncols, const void *x, const void *k) {
     const Graph *g = (const Graph*)k;
     const EdgeID *id = (const EdgeID*)x;
@@ -81,14 +91,34 @@ void Graph_AcquireReadLock(Graph *g) {
 void Graph_AcquireWriteLock(Graph *g) {
     pthread_rwlock_wrlock(&g->_rwlock);
     g->_writelocked = true;
+    // Writers hold the lock while modifying graph.
+    Graph_UpdateVersion(g);
 }
 
 /* Release the held lock */
 void Graph_ReleaseLock(Graph *g) {
+    // Entity counts drifted, plans might pick a different strategy.
+    if(g->_writelocked && GraphStatistics_Drifted(&g->stats)) Graph_UpdateSchemaVersion(g);
     g->_writelocked = false;
     pthread_rwlock_unlock(&g->_rwlock);
 }
 
+void Graph_UpdateVersion(Graph *g) {
+    g->version = __atomic_add_fetch(&_graph_version, 1, __ATOMIC_RELAXED);
+}
+
+uint64_t Graph_GetVersion(const Graph *g) {
+    return g->version;
+}
+
+void Graph_UpdateSchemaVersion(Graph *g) {
+    g->schema_version = __atomic_add_fetch(&_graph_version, 1, __ATOMIC_RELAXED);
+}
+
+uint64_t Graph_GetSchemaVersion(const Graph *g) {
+    return g->schema_version;
+}
+
 /* Writer request access to graph. */
 void Graph_WriterEnter(Graph *g) {
     pthread_mutex_lock(&g->_writers_mutex);
@@ -115,6 +145,14 @@ static GrB_Matrix _Graph_Get_Transposed_AdjacencyMatrix(const Graph *g) {
     return m;
 }
 
+// Get the transposed relation matrix, NULL if it wasn't created.
+static GrB_Matrix _Graph_Get_Transposed_RelationMatrix(const Graph *g, int relation_idx) {
+    assert(g && relation_idx >= 0 && relation_idx < array_len(g->_t_relations));
+    GrB_Matrix m = __atomic_load_n(g->_t_relations + relation_idx, __ATOMIC_ACQUIRE);
+    if(m) g->SynchronizeMatrix(g, m);
+    return m;
+}
+
 // Return number of nodes graph can contain.
 size_t _Graph_NodeCap(const Graph *g) {
     return g->nodes->itemCap;
@@ -278,6 +316,11 @@ void Graph_ApplyAllPending(Graph *g) {
       M = g->_relations_map[i];
       g->SynchronizeMatrix(g, M);
     }
+
+    for(int i = 0; i < array_len(g->_t_relations); i ++) {
+      M = g->_t_relations[i];
+      if(M) g->SynchronizeMatrix(g, M);
+    }
 }
 
 /* ================================ Graph API ================================ */
@@ -290,6 +333,7 @@ Graph *Graph_New(size_t node_cap, size_t edge_cap) {
     g->edges = DataBlock_New(edge_cap, sizeof(Entity), (fpDestructor)FreeEntity);
     g->labels = array_new(GrB_Matrix, GRAPH_DEFAULT_LABEL_CAP);
     g->relations = array_new(GrB_Matrix, GRAPH_DEFAULT_RELATION_TYPE_CAP);
+    g->_t_relations = array_new(GrB_Matrix, GRAPH_DEFAULT_RELATION_TYPE_CAP);
     g->_relations_map = array_new(GrB_Matrix, GRAPH_DEFAULT_RELATION_TYPE_CAP);
     GrB_Matrix_new(&g->adjacency_matrix, GrB_BOOL, node_cap, node_cap);
     GrB_Matrix_new(&g->_t_adjacency_matrix, GrB_BOOL, node_cap, node_cap);
@@ -298,6 +342,9 @@ Graph *Graph_New(size_t node_cap, size_t edge_cap) {
     // Initialize a read-write lock scoped to the individual graph
     assert(pthread_rwlock_init(&g->_rwlock, NULL) == 0);
     g->_writelocked = false;
+    Graph_UpdateVersion(g);
+    Graph_UpdateSchemaVersion(g);
+    GraphStatistics_Init(&g->stats);
 
     // Force GraphBLAS updates and resize matrices to node count by default
     Graph_SetMatrixPolicy(g, SYNC_AND_MINIMIZE_SPACE);
@@ -315,6 +362,13 @@ Graph *Graph_New(size_t node_cap, size_t edge_cap) {
         assert(info == GrB_SUCCESS);
     }
 
+    // Create edge count unary function
+    if(!_graph_edge_count) {
+        GrB_Info info;
+        info = GrB_UnaryOp_new(&_graph_edge_count, _edge_count, GrB_UINT64, GrB_UINT64);
+        assert(info == GrB_SUCCESS);
+    }
+
     return g;
 }
 
@@ -332,10 +386,8 @@ size_t Graph_NodeCount(const Graph *g) {
 }
 
 size_t Graph_LabeledNodeCount(const Graph *g, int label) {
-    GrB_Index nvals = 0;
-    GrB_Matrix m = Graph_GetLabelMatrix(g, label);
-    if(m) GrB_Matrix_nvals(&nvals, m);
-    return nvals;
+    assert(g);
+    return GraphStatistics_NodeCount(&g->stats, label);
 }
 
 size_t Graph_EdgeCount(const Graph *g) {
@@ -466,6 +518,7 @@ void Graph_CreateNode(Graph* g, int label, Node *n) {
             _MatrixResizeToCapacity(g, m);
             assert(GrB_Matrix_setElement_BOOL(m, true, id, id) == GrB_SUCCESS);
         }
+        GraphStatistics_IncNodeCount(&g->stats, label, 1);
     }
 }
 
@@ -492,11 +545,13 @@ int Graph_ConnectNodes(Graph *g, NodeID src, NodeID dest, int r, Edge *e) {
     GrB_Matrix relationMat = Graph_GetRelationMatrix(g, r);
     GrB_Matrix relationMapMat = _Graph_GetRelationMap(g, r);
     GrB_Matrix tadj = _Graph_Get_Transposed_AdjacencyMatrix(g);
+    GrB_Matrix trelationMat = _Graph_Get_Transposed_RelationMatrix(g, r);
 
     // Rows represent source nodes, columns represent destination nodes.
     GrB_Matrix_setElement_BOOL(adj, true, src, dest);
     GrB_Matrix_setElement_BOOL(tadj, true, dest, src);
     GrB_Matrix_setElement_BOOL(relationMat, true, src, dest);
+    if(trelationMat) GrB_Matrix_setElement_BOOL(trelationMat, true, dest, src);
     GrB_Index I = src;
     GrB_Index J = dest;
     id = SET_MSB(id);
@@ -513,6 +568,7 @@ int Graph_ConnectNodes(Graph *g, NodeID src, NodeID dest, int r, Edge *e) {
         GrB_NULL            // descriptor for C(I,J) and Mask
     );
     assert(info == GrB_SUCCESS);
+    GraphStatistics_IncEdgeCount(&g->stats, r, 1);
 
     return 1;
 }
@@ -546,26 +602,11 @@ void Graph_GetNodeEdges(const Graph *g, const Node *n, GRAPH_EDGE_DIR dir, int e
 
     // Incoming.
     if(dir == GRAPH_EDGE_DIR_INCOMING || dir == GRAPH_EDGE_DIR_BOTH) {
+        // Row i of the transposed matrix lists the sources of edges reaching node i.
         destNodeID = ENTITY_GET_ID(n);
-        GrB_Vector incoming = GrB_NULL;
-        GrB_Descriptor desc = GrB_NULL;
-
-        if(edgeType == GRAPH_NO_RELATION) {
-            // Relation wasn't specified, use transposed adjacency matrix.
-            M = _Graph_Get_Transposed_AdjacencyMatrix(g);
-            GxB_MatrixTupleIter_new(&tupleIter, M);
-            GxB_MatrixTupleIter_iterate_row(tupleIter, destNodeID);
-        } else {
-            // TODO: Callers wishing to get Incoming edges to a number of nodes
-            // should pass a transposed matrix, as the operations below are costly
-            // and we'll perform them forevery node.
-            size_t nRows = Graph_RequiredMatrixDim(g);
-            GrB_Vector_new(&incoming, GrB_BOOL, nRows);
-            GrB_Descriptor_new(&desc);
-            GrB_Descriptor_set(desc, GrB_INP0, GrB_TRAN);
-            GrB_Col_extract(incoming, NULL, NULL, M, GrB_ALL, nRows, destNodeID, desc);
-            GxB_MatrixTupleIter_new(&tupleIter, (GrB_Matrix)incoming);
-        }
+        M = Graph_GetTransposedRelationMatrix(g, edgeType);
+        GxB_MatrixTupleIter_new(&tupleIter, M);
+        GxB_MatrixTupleIter_iterate_row(tupleIter, destNodeID);
 
         while(true) {
             bool depleted = false;
@@ -573,11 +614,7 @@ void Graph_GetNodeEdges(const Graph *g, const Node *n, GRAPH_EDGE_DIR dir, int e
             if(depleted) break;
             Graph_GetEdgesConnectingNodes(g, srcNodeID, destNodeID, edgeType, edges);
         }
-
-        // Clean up
         GxB_MatrixTupleIter_free(tupleIter);
-        if(desc != GrB_NULL) GrB_Descriptor_free(&desc);
-        if(incoming != GrB_NULL) GrB_Vector_free(&incoming);
     }
 }
 
@@ -606,6 +643,9 @@ int Graph_DeleteEdge(Graph *g, Edge *e) {
          * delete entry from both M and R. */
         assert(GxB_Matrix_Delete(M, src_id, dest_id) == GrB_SUCCESS);        
         assert(GxB_Matrix_Delete(R, src_id, dest_id )== GrB_SUCCESS);
+
+        M = _Graph_Get_Transposed_RelationMatrix(g, r);
+        if(M) assert(GxB_Matrix_Delete(M, dest_id, src_id) == GrB_SUCCESS);
     
         // See if source is connected to destination with additional edges.
         bool connected = false;
@@ -660,6 +700,7 @@ int Graph_DeleteEdge(Graph *g, Edge *e) {
 
     // Free and remove edges from datablock.
     DataBlock_DeleteItem(g->edges, ENTITY_GET_ID(e));
+    GraphStatistics_DecEdgeCount(&g->stats, r, 1);
     return 1;
 }
 
@@ -668,7 +709,10 @@ void Graph_DeleteNode(Graph *g, Node *n) {
      * there are no incoming nor outgoing edges
      * leading to / from node. */
     assert(g && n);
-    
+
+    int label = Graph_GetNodeLabel(g, ENTITY_GET_ID(n));
+    GraphStatistics_DecNodeCount(&g->stats, label, 1);
+
     // Clear label matrix at position node ID.
     uint32_t label_count = array_len(g->labels);
     for(int i = 0; i < label_count; i++) {
@@ -689,6 +733,7 @@ void _BulkDeleteNodes(Graph *g, Node *nodes, uint node_count,
     GrB_Matrix A;                       // A = R(M) masked relation matrix.
     GrB_Index nvals;                    // Number of elements in mask.
     GrB_Matrix Mask;                    // Mask noteing all implicitly deleted edges.
+    GrB_Matrix TMask = NULL;            // Transposed mask, used to update transposed relation matrices.
     GrB_Matrix Nodes;                   // Mask noteing each node marked for deletion.
     GrB_Matrix adj;                     // Adjacency matrix.
     GrB_Matrix tadj;                    // Transposed adjacency matrix.
@@ -759,7 +804,9 @@ void _BulkDeleteNodes(Graph *g, Node *nodes, uint node_count,
         
         /* Free each multi edge array entry in A
          * Call _select_op_free_edge on each entry of A. */
+        uint64_t edge_count = g->edges->itemCount;
         GxB_select(A, GrB_NULL, GrB_NULL, selectop, A, g, GrB_NULL);
+        GraphStatistics_DecEdgeCount(&g->stats, i, edge_count - g->edges->itemCount);
 
         // Clear both relation matrix and its coresponding relation mapping matrix.
         GrB_Descriptor_set(desc, GrB_MASK, GrB_SCMP);
@@ -770,6 +817,16 @@ void _BulkDeleteNodes(Graph *g, Node *nodes, uint node_count,
         R = Graph_GetRelationMatrix(g, i);
         // Remove every entry of R marked by Mask.
         GrB_Matrix_apply(R, Mask, NULL, GrB_IDENTITY_UINT64, R, desc);
+
+        R = _Graph_Get_Transposed_RelationMatrix(g, i);
+        if(R) {
+            if(!TMask) {
+                GrB_Matrix_new(&TMask, GrB_BOOL, Graph_RequiredMatrixDim(g), Graph_RequiredMatrixDim(g));
+                GrB_transpose(TMask, GrB_NULL, GrB_NULL, Mask, GrB_NULL);
+            }
+            // Remove every entry of transposed R marked by transposed Mask.
+            GrB_Matrix_apply(R, TMask, NULL, GrB_IDENTITY_UINT64, R, desc);
+        }
     }
 
     /* Descriptor:
@@ -786,7 +843,11 @@ void _BulkDeleteNodes(Graph *g, Node *nodes, uint node_count,
     int node_type_count = Graph_LabelTypeCount(g);
     for(int i = 0; i < node_type_count; i++) {
         GrB_Matrix L = Graph_GetLabelMatrix(g, i);
+        GrB_Matrix_nvals(&nvals, L);
+        GraphStatistics_DecNodeCount(&g->stats, i, nvals);
         GrB_Matrix_apply(L, Nodes, NULL, GrB_IDENTITY_BOOL, L, desc);
+        GrB_Matrix_nvals(&nvals, L);
+        GraphStatistics_IncNodeCount(&g->stats, i, nvals);
     }
 
     for(uint i = 0; i < node_count; i++) {
@@ -798,6 +859,7 @@ void _BulkDeleteNodes(Graph *g, Node *nodes, uint node_count,
     GrB_free(&A);
     GrB_free(&desc);
     GrB_free(&Mask);
+    if(TMask) GrB_free(&TMask);
     GrB_free(&Nodes);
     GrB_free(&selectop);
     GxB_MatrixTupleIter_free(adj_iter);
@@ -843,6 +905,10 @@ void _BulkDeleteEdges(Graph *g, Edge *edges, size_t edge_count) {
 
             deletion.M = M;
             deletions = array_append(deletions, deletion);
+
+            // Transposed relation matrix isn't read, delete entry right away.
+            GrB_Matrix T = _Graph_Get_Transposed_RelationMatrix(g, r);
+            if(T) assert(GxB_Matrix_Delete(T, dest_id, src_id) == GrB_SUCCESS);
         } else {
             /* Multiple edges connecting src to dest
              * locate specific edge and remove it
@@ -877,6 +943,7 @@ void _BulkDeleteEdges(Graph *g, Edge *edges, size_t edge_count) {
 
         // Free and remove edges from datablock.
         DataBlock_DeleteItem(g->edges, ENTITY_GET_ID(e));
+        GraphStatistics_DecEdgeCount(&g->stats, r, 1);
     }
 
     // Delete entries.
@@ -975,6 +1042,11 @@ DataBlockIterator *Graph_ScanNodes(const Graph *g) {
     return DataBlock_Scan(g->nodes);
 }
 
+DataBlockIterator *Graph_ScanNodeRange(const Graph *g, NodeID start, NodeID end) {
+    assert(g);
+    return DataBlock_ScanRange(g->nodes, start, end);
+}
+
 DataBlockIterator *Graph_ScanEdges(const Graph *g) {
     assert(g);
     return DataBlock_Scan(g->edges);
@@ -985,7 +1057,10 @@ int Graph_AddLabel(Graph *g) {
 
     GrB_Matrix m;
     GrB_Matrix_new(&m, GrB_BOOL, Graph_RequiredMatrixDim(g), Graph_RequiredMatrixDim(g));
-    array_append(g->labels, m);
+    g->labels = array_append(g->labels, m);
+    GraphStatistics_AddLabel(&g->stats);
+    Graph_UpdateVersion(g);
+    Graph_UpdateSchemaVersion(g);
     return array_len(g->labels)-1;
 }
 
@@ -996,7 +1071,14 @@ int Graph_AddRelationType(Graph *g) {
     GrB_Matrix_new(&m, GrB_BOOL, Graph_RequiredMatrixDim(g), Graph_RequiredMatrixDim(g));
     g->relations = array_append(g->relations, m);
 
+    // Transposed relation matrix is created on first access.
+    GrB_Matrix t = NULL;
+    g->_t_relations = array_append(g->_t_relations, t);
+
     _Graph_AddRelationMap(g);
+    GraphStatistics_AddRelation(&g->stats);
+    Graph_UpdateVersion(g);
+    Graph_UpdateSchemaVersion(g);
 
     // Edge mapping for relation K is at _relations_map[K].
     assert(array_len(g->_relations_map) == Graph_RelationTypeCount(g));
@@ -1004,6 +1086,11 @@ int Graph_AddRelationType(Graph *g) {
     return relationID;
 }
 
+void Graph_SynchronizeMatrix(const Graph *g, GrB_Matrix m) {
+    assert(g && m);
+    g->SynchronizeMatrix(g, m);
+}
+
 GrB_Matrix Graph_GetAdjacencyMatrix(const Graph *g) {
     assert(g);
     GrB_Matrix m = g->adjacency_matrix;
@@ -1031,6 +1118,45 @@ GrB_Matrix Graph_GetRelationMatrix(const Graph *g, int relation_idx) {
     return m;
 }
 
+GrB_Matrix Graph_GetTransposedRelationMatrix(const Graph *g, int relation_idx) {
+    assert(g && (relation_idx == GRAPH_NO_RELATION || relation_idx < Graph_RelationTypeCount(g)));
+    if(relation_idx == GRAPH_NO_RELATION) return _Graph_Get_Transposed_AdjacencyMatrix(g);
+
+    GrB_Matrix t = _Graph_Get_Transposed_RelationMatrix(g, relation_idx);
+    if(t) return t;
+
+    // Multiple readers might try to create the transposed matrix.
+    GrB_Matrix m = Graph_GetRelationMatrix(g, relation_idx);
+    _Graph_EnterCriticalSection((Graph *)g);
+    t = g->_t_relations[relation_idx];
+    if(!t) {
+        GrB_Index n;
+        GrB_Matrix_nrows(&n, m);
+        GrB_Matrix_new(&t, GrB_BOOL, n, n);
+        GrB_transpose(t, GrB_NULL, GrB_NULL, m, GrB_NULL);
+        _Graph_ApplyPending(t);
+        __atomic_store_n(g->_t_relations + relation_idx, t, __ATOMIC_RELEASE);
+    }
+    _Graph_LeaveCriticalSection((Graph *)g);
+
+    g->SynchronizeMatrix(g, t);
+    return t;
+}
+
+void Graph_CountRelationEdges(const Graph *g, int relation_idx, GrB_Matrix C) {
+    assert(g && (relation_idx == GRAPH_NO_RELATION || relation_idx < Graph_RelationTypeCount(g)));
+    if(relation_idx != GRAPH_NO_RELATION) {
+        GrB_apply(C, GrB_NULL, GrB_NULL, _graph_edge_count, _Graph_GetRelationMap(g, relation_idx), GrB_NULL);
+        return;
+    }
+
+    // Sum up edges of every relation.
+    int relationCount = Graph_RelationTypeCount(g);
+    for(int i = 0; i < relationCount; i++) {
+        GrB_apply(C, GrB_NULL, GrB_PLUS_UINT64, _graph_edge_count, _Graph_GetRelationMap(g, i), GrB_NULL);
+    }
+}
+
 GrB_Matrix Graph_GetZeroMatrix(const Graph *g) {
     GrB_Index nvals;
     GrB_Matrix z = g->_zero_matrix;
@@ -1060,8 +1186,11 @@ void Graph_Free(Graph *g) {
         GrB_Matrix_free(&m);
         m = g->_relations_map[i];
         GrB_Matrix_free(&m);
+        m = g->_t_relations[i];
+        if(m) GrB_Matrix_free(&m);
     }
     array_free(g->relations);
+    array_free(g->_t_relations);
     array_free(g->_relations_map);
 
     uint32_t labelCount = array_len(g->labels);
@@ -1070,6 +1199,7 @@ void Graph_Free(Graph *g) {
         GrB_Matrix_free(&m);
     }
     array_free(g->labels);
+    GraphStatistics_Free(&g->stats);
 
     it = Graph_ScanNodes(g);
     while ((en = (Entity*)DataBlockIterator_Next(it)) != NULL)
@@ -1091,7 +1221,11 @@ void Graph_Free(Graph *g) {
     assert(pthread_mutex_destroy(&g->_mutex) == 0);
     assert(pthread_mutex_destroy(&g->_writers_mutex) == 0);
 
-    if(g->_writelocked) Graph_ReleaseLock(g);
+    // Statistics are gone, release lock without inspecting them.
+    if(g->_writelocked) {
+        g->_writelocked = false;
+        pthread_rwlock_unlock(&g->_rwlock);
+    }
     assert(pthread_rwlock_destroy(&g->_rwlock) == 0);
 
     rm_free(g);
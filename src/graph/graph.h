@@ -11,6 +11,7 @@
 
 #include "entities/node.h"
 #include "entities/edge.h"
+#include "graph_statistics.h"
 #include "../redismodule.h"
 #include "../util/triemap/triemap.h"
 #include "../util/datablock/datablock.h"
@@ -63,12 +64,16 @@ struct Graph {
     GrB_Matrix _t_adjacency_matrix;     // Transposed Adjacency matrix.
     GrB_Matrix *labels;                 // Label matrices.
     GrB_Matrix *relations;              // Relation matrices.
+    GrB_Matrix *_t_relations;           // Transposed relation matrices, NULL until first accessed.
     GrB_Matrix *_relations_map;         // Maps from (relation, row, col) to edge id.
     GrB_Matrix _zero_matrix;            // Zero matrix.
     pthread_mutex_t _writers_mutex;     // Mutex restrict single writer.
     pthread_mutex_t _mutex;             // Mutex for accessing critical sections.
     pthread_rwlock_t _rwlock;           // Read-write lock scoped to this specific graph
     bool _writelocked;                  // true if the read-write lock was acquired by a writer
+    uint64_t version;                   // Changes whenever graph's data or schema might have changed.
+    uint64_t schema_version;            // Changes whenever graph's schema or statistics changed.
+    GraphStatistics stats;              // Entity counts and relation statistics.
     SyncMatrixFunc SynchronizeMatrix;   // Function pointer to matrix synchronization routine.
 };
 
@@ -90,6 +95,26 @@ void Graph_WriterLeave(Graph *g);
 /* Release the held lock */
 void Graph_ReleaseLock(Graph *g);
 
+/* Marks graph as modified, assigning it a new version.
+ * Versions are unique across all graphs. */
+void Graph_UpdateVersion(Graph *g);
+
+/* Returns graph's version. */
+uint64_t Graph_GetVersion(const Graph *g);
+
+/* Marks graph's schema as modified, assigning it a new schema version.
+ * Schema versions change when labels, relation types or indices are
+ * introduced or removed and when entity counts drift, plans built
+ * against an older schema version might no longer be valid or efficient. */
+void Graph_UpdateSchemaVersion(Graph *g);
+
+/* Returns graph's schema version. */
+uint64_t Graph_GetSchemaVersion(const Graph *g);
+
+/* Synchronize m, one of the graph's matrices,
+ * according to the current matrix synchronization policy. */
+void Graph_SynchronizeMatrix(const Graph *g, GrB_Matrix m);
+
 /* Choose the current matrix synchronization policy. */
 void Graph_SetMatrixPolicy(Graph *g, MATRIX_POLICY policy);
 
@@ -177,6 +202,14 @@ DataBlockIterator *Graph_ScanNodes (
     const Graph *g
 );
 
+// Retrieves a node iterator which can be used to access
+// nodes with IDs in the range [start, end).
+DataBlockIterator *Graph_ScanNodeRange (
+    const Graph *g,
+    NodeID start,
+    NodeID end
+);
+
 // Retrieves an edge iterator which can be used to access
 // every edge in the graph.
 DataBlockIterator *Graph_ScanEdges (
@@ -279,6 +312,25 @@ GrB_Matrix Graph_GetRelationMatrix (
     int relation        // Relation described by matrix.
 );
 
+// Retrieves a transposed typed adjacency matrix,
+// GRAPH_NO_RELATION retrieves the transposed adjacency matrix.
+// Matrix is created on first access and maintained by later updates,
+// caller mustn't modify it in any way.
+GrB_Matrix Graph_GetTransposedRelationMatrix (
+    const Graph *g,     // Graph from which to get adjacency matrix.
+    int relation        // Relation described by matrix.
+);
+
+// Counts the edges of a relation connecting each pair of nodes,
+// C[src, dest] is the number of edges connecting src to dest,
+// GRAPH_NO_RELATION counts edges of every relation.
+// C is expected to be an empty UINT64 matrix of graph's dimensions.
+void Graph_CountRelationEdges (
+    const Graph *g,     // Graph from which to count edges.
+    int relation,       // Relation to count.
+    GrB_Matrix C        // Output edge counts.
+);
+
 // Retrieves the zero matrix.
 // The function will resize it to match all other
 // internal matrices, caller mustn't modify it in any way.
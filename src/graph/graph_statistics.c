@@ -0,0 +1,219 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Redis Labs Source Available License Agreement
+*/
+
+#include "graph_statistics.h"
+#include "graph.h"
+#include "../util/arr.h"
+#include <assert.h>
+#include <string.h>
+
+/* Relation statistics computed at an older graph version are considered
+ * accurate enough for estimations as long as the relation's edge count
+ * changed by less than this fraction, same goes for plans built against
+ * older entity counts. */
+#define RELATION_STATISTICS_TOLERANCE 0.1
+
+void GraphStatistics_Init(GraphStatistics *stats) {
+    assert(stats);
+    stats->node_count = array_new(uint64_t, GRAPH_DEFAULT_LABEL_CAP);
+    stats->edge_count = array_new(uint64_t, GRAPH_DEFAULT_RELATION_TYPE_CAP);
+    stats->baseline_node_count = array_new(uint64_t, GRAPH_DEFAULT_LABEL_CAP);
+    stats->baseline_edge_count = array_new(uint64_t, GRAPH_DEFAULT_RELATION_TYPE_CAP);
+    stats->relations = array_new(RelationStatistics, GRAPH_DEFAULT_RELATION_TYPE_CAP);
+    assert(pthread_mutex_init(&stats->lock, NULL) == 0);
+}
+
+void GraphStatistics_AddLabel(GraphStatistics *stats) {
+    stats->node_count = array_append(stats->node_count, 0);
+    stats->baseline_node_count = array_append(stats->baseline_node_count, 0);
+}
+
+void GraphStatistics_AddRelation(GraphStatistics *stats) {
+    stats->edge_count = array_append(stats->edge_count, 0);
+    stats->baseline_edge_count = array_append(stats->baseline_edge_count, 0);
+
+    RelationStatistics relation;
+    // Graph versions are never 0, statistics are computed on first access.
+    memset(&relation, 0, sizeof(RelationStatistics));
+    relation.src_label_pairs = array_new(uint64_t, 0);
+    relation.dest_label_pairs = array_new(uint64_t, 0);
+    stats->relations = array_append(stats->relations, relation);
+}
+
+void GraphStatistics_IncNodeCount(GraphStatistics *stats, int label, uint64_t n) {
+    if(label == GRAPH_NO_LABEL) return;
+    assert(label < array_len(stats->node_count));
+    stats->node_count[label] += n;
+}
+
+void GraphStatistics_DecNodeCount(GraphStatistics *stats, int label, uint64_t n) {
+    if(label == GRAPH_NO_LABEL) return;
+    assert(label < array_len(stats->node_count) && stats->node_count[label] >= n);
+    stats->node_count[label] -= n;
+}
+
+void GraphStatistics_IncEdgeCount(GraphStatistics *stats, int relation, uint64_t n) {
+    assert(relation >= 0 && relation < array_len(stats->edge_count));
+    stats->edge_count[relation] += n;
+}
+
+void GraphStatistics_DecEdgeCount(GraphStatistics *stats, int relation, uint64_t n) {
+    assert(relation >= 0 && relation < array_len(stats->edge_count));
+    assert(stats->edge_count[relation] >= n);
+    stats->edge_count[relation] -= n;
+}
+
+static inline bool _CountDrifted(uint64_t count, uint64_t baseline) {
+    uint64_t drift = (count > baseline) ? count - baseline : baseline - count;
+    return drift > baseline * RELATION_STATISTICS_TOLERANCE;
+}
+
+static bool _CountsDrifted(const uint64_t *counts, const uint64_t *baseline) {
+    uint32_t len = array_len((uint64_t*)counts);
+    for(uint32_t i = 0; i < len; i++) {
+        if(_CountDrifted(counts[i], baseline[i])) return true;
+    }
+    return false;
+}
+
+bool GraphStatistics_Drifted(GraphStatistics *stats) {
+    if(!_CountsDrifted(stats->node_count, stats->baseline_node_count) &&
+       !_CountsDrifted(stats->edge_count, stats->baseline_edge_count)) return false;
+
+    memcpy(stats->baseline_node_count, stats->node_count, sizeof(uint64_t) * array_len(stats->node_count));
+    memcpy(stats->baseline_edge_count, stats->edge_count, sizeof(uint64_t) * array_len(stats->edge_count));
+    return true;
+}
+
+uint64_t GraphStatistics_NodeCount(const GraphStatistics *stats, int label) {
+    if(label < 0 || label >= array_len(stats->node_count)) return 0;
+    return stats->node_count[label];
+}
+
+uint64_t GraphStatistics_EdgeCount(const GraphStatistics *stats, int relation) {
+    if(relation < 0 || relation >= array_len(stats->edge_count)) return 0;
+    return stats->edge_count[relation];
+}
+
+static uint64_t _VectorSum(GrB_Vector v) {
+    uint64_t sum = 0;
+    GrB_Vector_reduce_UINT64(&sum, NULL, GxB_PLUS_UINT64_MONOID, v, NULL);
+    return sum;
+}
+
+static uint64_t _VectorMax(GrB_Vector v) {
+    uint64_t max = 0;
+    GrB_Vector_reduce_UINT64(&max, NULL, GxB_MAX_UINT64_MONOID, v, NULL);
+    return max;
+}
+
+/* Computes the number of distinct neighbours of each node, sets count to the
+ * number of nodes with neighbours and max to the largest number of neighbours,
+ * label_pairs[l] is set to the number of pairs involving nodes of label l. */
+static void _ComputeDegrees(const Graph *g, GrB_Matrix R, GrB_Descriptor desc, GrB_Vector degree,
+                            GrB_Vector labeled, uint64_t *count, uint64_t *max,
+                            uint64_t **label_pairs) {
+    GrB_Index nvals;
+    GrB_Vector_clear(degree);
+    GrB_Matrix_reduce_Monoid(degree, NULL, NULL, GxB_PLUS_UINT64_MONOID, R, desc);
+    GrB_Vector_nvals(&nvals, degree);
+    *count = nvals;
+    *max = _VectorMax(degree);
+
+    // Label matrices are diagonal, L * degree retains degrees of labeled nodes.
+    int label_count = Graph_LabelTypeCount(g);
+    array_clear(*label_pairs);
+    for(int i = 0; i < label_count; i++) {
+        GrB_Matrix L = Graph_GetLabelMatrix(g, i);
+        GrB_Vector_clear(labeled);
+        GrB_mxv(labeled, NULL, NULL, GxB_PLUS_TIMES_UINT64, L, degree, NULL);
+        *label_pairs = array_append(*label_pairs, _VectorSum(labeled));
+    }
+}
+
+static void _ComputeRelationStatistics(const Graph *g, int relation, RelationStatistics *stats) {
+    GrB_Index n = Graph_RequiredMatrixDim(g);
+    GrB_Matrix R = Graph_GetRelationMatrix(g, relation);
+
+    GrB_Vector degree;
+    GrB_Vector labeled;
+    GrB_Descriptor desc;
+    GrB_Vector_new(&degree, GrB_UINT64, n);
+    GrB_Vector_new(&labeled, GrB_UINT64, n);
+    GrB_Descriptor_new(&desc);
+    GrB_Descriptor_set(desc, GrB_INP0, GrB_TRAN);
+
+    GrB_Index pairs;
+    GrB_Matrix_nvals(&pairs, R);
+    stats->pairs = pairs;
+    stats->edges = GraphStatistics_EdgeCount(&g->stats, relation);
+
+    // Out degree, reduce each row of R.
+    _ComputeDegrees(g, R, NULL, degree, labeled, &stats->sources,
+                    &stats->max_out_degree, &stats->src_label_pairs);
+
+    // In degree, reduce each row of R's transpose.
+    _ComputeDegrees(g, R, desc, degree, labeled, &stats->destinations,
+                    &stats->max_in_degree, &stats->dest_label_pairs);
+
+    stats->version = Graph_GetVersion(g);
+
+    GrB_free(&desc);
+    GrB_free(&degree);
+    GrB_free(&labeled);
+}
+
+// Returns true if relation statistics should be recomputed.
+static bool _RelationStatisticsStale(const Graph *g, int relation, const RelationStatistics *stats,
+                                     bool exact) {
+    if(stats->version == Graph_GetVersion(g)) return false;
+    // Never computed.
+    if(stats->version == 0 || exact) return true;
+
+    uint64_t edges = GraphStatistics_EdgeCount(&g->stats, relation);
+    uint64_t drift = (edges > stats->edges) ? edges - stats->edges : stats->edges - edges;
+    return drift > stats->edges * RELATION_STATISTICS_TOLERANCE;
+}
+
+static uint64_t *_CloneCounts(const uint64_t *counts) {
+    uint32_t len = array_len((uint64_t*)counts);
+    uint64_t *clone = array_newlen(uint64_t, len);
+    memcpy(clone, counts, sizeof(uint64_t) * len);
+    return clone;
+}
+
+void GraphStatistics_GetRelationStatistics(Graph *g, int relation, bool exact, RelationStatistics *out) {
+    assert(g && out && relation >= 0 && relation < Graph_RelationTypeCount(g));
+
+    GraphStatistics *stats = &g->stats;
+    pthread_mutex_lock(&stats->lock);
+    RelationStatistics *relation_stats = stats->relations + relation;
+    if(_RelationStatisticsStale(g, relation, relation_stats, exact)) {
+        _ComputeRelationStatistics(g, relation, relation_stats);
+    }
+    *out = *relation_stats;
+    // Label pair counts are replaced whenever statistics are recomputed.
+    out->src_label_pairs = _CloneCounts(relation_stats->src_label_pairs);
+    out->dest_label_pairs = _CloneCounts(relation_stats->dest_label_pairs);
+    pthread_mutex_unlock(&stats->lock);
+}
+
+void RelationStatistics_Free(RelationStatistics *stats) {
+    array_free(stats->src_label_pairs);
+    array_free(stats->dest_label_pairs);
+}
+
+void GraphStatistics_Free(GraphStatistics *stats) {
+    assert(stats);
+    uint relation_count = array_len(stats->relations);
+    for(uint i = 0; i < relation_count; i++) RelationStatistics_Free(stats->relations + i);
+    array_free(stats->relations);
+    array_free(stats->node_count);
+    array_free(stats->edge_count);
+    array_free(stats->baseline_node_count);
+    array_free(stats->baseline_edge_count);
+    pthread_mutex_destroy(&stats->lock);
+}
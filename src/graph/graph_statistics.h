@@ -0,0 +1,74 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Redis Labs Source Available License Agreement
+*/
+
+#ifndef GRAPH_STATISTICS_H
+#define GRAPH_STATISTICS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+struct Graph;
+
+/* Statistics describing a single relation type,
+ * degrees count distinct neighbours, disregarding multi-edges. */
+typedef struct {
+    uint64_t version;           // Graph version statistics were computed at.
+    uint64_t edges;             // Number of edges when statistics were computed.
+    uint64_t pairs;             // Number of connected (source, destination) pairs.
+    uint64_t sources;           // Number of nodes with outgoing edges.
+    uint64_t destinations;      // Number of nodes with incoming edges.
+    uint64_t max_out_degree;    // Maximum number of destinations a single node reaches.
+    uint64_t max_in_degree;     // Maximum number of sources reaching a single node.
+    uint64_t *src_label_pairs;  // Number of pairs leaving nodes of each label.
+    uint64_t *dest_label_pairs; // Number of pairs entering nodes of each label.
+} RelationStatistics;
+
+/* Per graph statistics, used for cardinality estimation.
+ * Entity counts are maintained as entities are created and deleted,
+ * relation statistics are computed on demand and kept until the graph changes. */
+typedef struct {
+    uint64_t *node_count;               // Number of nodes per label.
+    uint64_t *edge_count;               // Number of edges per relation.
+    uint64_t *baseline_node_count;      // Number of nodes per label when counts last drifted.
+    uint64_t *baseline_edge_count;      // Number of edges per relation when counts last drifted.
+    RelationStatistics *relations;      // Computed relation statistics.
+    pthread_mutex_t lock;               // Guards relation statistics, computed by readers.
+} GraphStatistics;
+
+void GraphStatistics_Init(GraphStatistics *stats);
+
+/* Introduce a new label/relation, counts start at 0. */
+void GraphStatistics_AddLabel(GraphStatistics *stats);
+void GraphStatistics_AddRelation(GraphStatistics *stats);
+
+/* Update entity counts. */
+void GraphStatistics_IncNodeCount(GraphStatistics *stats, int label, uint64_t n);
+void GraphStatistics_DecNodeCount(GraphStatistics *stats, int label, uint64_t n);
+void GraphStatistics_IncEdgeCount(GraphStatistics *stats, int relation, uint64_t n);
+void GraphStatistics_DecEdgeCount(GraphStatistics *stats, int relation, uint64_t n);
+
+/* Returns true if any entity count drifted from its baseline by more than
+ * the tolerated fraction, in which case counts become the new baseline. */
+bool GraphStatistics_Drifted(GraphStatistics *stats);
+
+/* Returns number of nodes with label. */
+uint64_t GraphStatistics_NodeCount(const GraphStatistics *stats, int label);
+
+/* Returns number of edges of relation type. */
+uint64_t GraphStatistics_EdgeCount(const GraphStatistics *stats, int relation);
+
+/* Retrieves statistics of relation type, caller should hold graph's lock.
+ * Statistics are recomputed if the graph changed since they were last computed,
+ * unless exact is false and the relation's edge count hardly changed since.
+ * Caller should free out using RelationStatistics_Free. */
+void GraphStatistics_GetRelationStatistics(struct Graph *g, int relation, bool exact, RelationStatistics *out);
+
+void RelationStatistics_Free(RelationStatistics *stats);
+
+void GraphStatistics_Free(GraphStatistics *stats);
+
+#endif
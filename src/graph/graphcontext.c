@@ -9,6 +9,7 @@
 #include "serializers/graphcontext_type.h"
 #include "../util/arr.h"
 #include "../util/rmalloc.h"
+#include "../execution_plan/plan_cache.h"
 #include "../redismodule.h"
 
 extern pthread_key_t _tlsGCKey;    // Thread local storage graph context key.
@@ -32,6 +33,7 @@ GraphContext* GraphContext_New(RedisModuleCtx *ctx, const char *graphname,
 
   // No indicies.
   gc->index_count = 0;
+  gc->plan_cache = NULL;
 
   // Initialize the graph's matrices and datablock storage
   gc->g = Graph_New(node_cap, edge_cap);
@@ -206,6 +208,7 @@ int GraphContext_AddIndex(GraphContext *gc, const char *label, const char *attri
   // Associate the new index with the attribute in the schema.
   if (Schema_AddIndex(s, attr_id) == INDEX_OK) {
       gc->index_count++;
+      Graph_UpdateSchemaVersion(gc->g);
       return INDEX_OK;
   }
 
@@ -222,6 +225,7 @@ int GraphContext_DeleteIndex(GraphContext *gc, const char *label, const char *at
   // Remove the index association from the label schema
   if (Schema_RemoveIndex(schema, attr_id) == INDEX_OK) {
       gc->index_count--;
+      Graph_UpdateSchemaVersion(gc->g);
       return INDEX_OK;
   }
 
@@ -278,6 +282,8 @@ void GraphContext_DeleteNodeFromIndices(GraphContext *gc, Node *n) {
 
 // Free all data associated with graph
 void GraphContext_Free(GraphContext *gc) {
+  // Cached plans reference the graph.
+  PlanCache_Free(gc->plan_cache);
   Graph_Free(gc->g);
   rm_free(gc->graph_name);
 
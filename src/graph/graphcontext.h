@@ -24,6 +24,7 @@ typedef struct {
   Schema **node_schemas;            // Array of schemas for each node label 
 
   unsigned short index_count;       // Number of indicies.
+  struct PlanCache *plan_cache;     // Cached plans of read-only queries, NULL if not created yet.
 } GraphContext;
 
 /* GraphContext API */
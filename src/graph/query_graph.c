@@ -191,6 +191,8 @@ void BuildQueryGraph(const GraphContext *gc, QueryGraph *qg, Vector *entities) {
         AST_GraphEntity *entity;
         Vector_Get(entities, i, &entity);
         if(entity->t != N_LINK) continue;
+        // Shortest paths are searched for, their relationships aren't matched.
+        if(((AST_LinkEntity*)entity)->shortestPath != N_SHORTEST_PATH_NONE) continue;
         AST_GraphEntity *l_entity;
         AST_GraphEntity *r_entity;
         Vector_Get(entities, i-1, &l_entity);
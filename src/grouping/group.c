@@ -7,33 +7,22 @@
 #include <stdio.h>
 #include "group.h"
 #include "../redismodule.h"
-#include "../util/arr.h"
+#include "../arithmetic/aggregate.h"
 #include "../util/rmalloc.h"
 
 // Creates a new group
 // arguments specify group's key.
-Group* NewGroup(int key_count, SIValue* keys, AR_ExpNode** funcs, Record r) {
+Group* NewGroup(int key_count, SIValue* keys, int func_count, AggCtx** funcs, Record r) {
     Group* g = rm_malloc(sizeof(Group));
     g->keys = keys;
     g->key_count = key_count;
+    g->func_count = func_count;
     g->aggregationFunctions = funcs;
     if(r) g->r = Record_Clone(r);
     else g->r = NULL;
     return g;
 }
 
-void Group_KeyStr(const Group *g, char **group_key) {
-    if(g->key_count == 0) {
-        *group_key = rm_strdup("SINGLE_GROUP");
-        return;
-    }
-
-    // Determine required size for group key string representation.
-    size_t group_len_key = SIValue_StringConcatLen(g->keys, g->key_count);
-    *group_key = rm_malloc(sizeof(char) * group_len_key);
-    SIValue_StringConcat(g->keys, g->key_count, *group_key, group_len_key);
-}
-
 void FreeGroup(Group* g) {
     if(g == NULL) return;
     if(g->r) Record_Free(g->r);
@@ -44,11 +33,10 @@ void FreeGroup(Group* g) {
         rm_free(g->keys);
     }
     if(g->aggregationFunctions) {
-        for(uint32_t i = 0; i < array_len(g->aggregationFunctions); i++) {
-            AR_ExpNode *exp = g->aggregationFunctions[i];
-            AR_EXP_Free(exp);
+        for(int i = 0; i < g->func_count; i++) {
+            AggCtx_Free(g->aggregationFunctions[i]);
         }
-        array_free(g->aggregationFunctions);
+        rm_free(g->aggregationFunctions);
     }
     rm_free(g);
 }
@@ -8,21 +8,19 @@
 #define GROUP_H_
 
 #include "../value.h"
-#include "../arithmetic/arithmetic_expression.h"
+#include "../arithmetic/agg_ctx.h"
+#include "../execution_plan/record.h"
 
 typedef struct {
     int key_count;
     SIValue* keys;
-    AR_ExpNode** aggregationFunctions;   /* Array of AR_ExpNode*, where the root is an aggregation function. */
+    int func_count;
+    AggCtx** aggregationFunctions;  /* Aggregation state, one per aggregated expression. */
     Record r;   /* Representative record for all aggregated records in group. */
 } Group;
 
 /* Creates a new group */
-Group* NewGroup(int key_count, SIValue* keys, AR_ExpNode** funcs, Record r);
-
-/* Compute group key string representation, it is the callers 
- * responsibility to free returned string. */
-void Group_KeyStr(const Group *g, char **group_key);
+Group* NewGroup(int key_count, SIValue* keys, int func_count, AggCtx** funcs, Record r);
 
 void FreeGroup(Group* group);
 
@@ -5,42 +5,54 @@
 */
 
 #include "group_cache.h"
+#include "../util/rmalloc.h"
 
-CacheGroup* CacheGroupNew() {
-    return NewTrieMap();
+CacheGroup* CacheGroupNew(uint key_count) {
+    return ValueTable_New(key_count, GROUP_CACHE_DEFAULT_CAP);
 }
 
-void CacheGroupAdd(CacheGroup *groups, char *key, Group *group) {
-    TrieMap_Add(groups, key, strlen(key), group, NULL);
+uint64_t CacheGroupHash(const CacheGroup *groups, const SIValue *keys) {
+    return ValueTable_HashKey(keys, groups->key_len);
+}
+
+void CacheGroupAdd(CacheGroup *groups, uint64_t hash, Group *group) {
+    ValueTable_Insert(groups, group->keys, hash, group);
 }
 
 // Retrives a group,
-// Sets group to NULL if key is missing.
-Group* CacheGroupGet(CacheGroup *groups, char *key) {
-    Group *g = TrieMap_Find(groups, key, strlen(key));
-    if (g == TRIEMAP_NOTFOUND) return NULL;
-    return g;
+// Returns NULL if key is missing.
+Group* CacheGroupGet(CacheGroup *groups, const SIValue *keys, uint64_t hash) {
+    ValueTableEntry *entry = ValueTable_Find(groups, keys, hash);
+    if(!entry) return NULL;
+    return entry->value;
+}
+
+uint64_t CacheGroupCount(const CacheGroup *groups) {
+    return ValueTable_Count(groups);
 }
 
 void FreeGroupCache(CacheGroup *groups) {
-    TrieMap_Free(groups, (void (*)(void *))FreeGroup);
+    ValueTable_Free(groups, (ValueTableFreeFunc)FreeGroup);
 }
 
 // Returns an iterator to scan entire group cache
 CacheGroupIterator* CacheGroupIter(CacheGroup *groups) {
-    return TrieMap_Iterate(groups, "", 0);
+    CacheGroupIterator *iter = rm_malloc(sizeof(CacheGroupIterator));
+    iter->groups = groups;
+    iter->idx = 0;
+    return iter;
 }
 
-// Advance iterator and returns key & value in current position.
-int CacheGroupIterNext(CacheGroupIterator *iter, char **key, Group **group) {
-    tm_len_t len = 0;
-    int res = TrieMapIterator_Next(iter, key, &len, (void**)group);
-    if(res == 0) {
+// Advance iterator and returns group in current position.
+int CacheGroupIterNext(CacheGroupIterator *iter, Group **group) {
+    if(iter->idx >= ValueTable_Count(iter->groups)) {
         *group = NULL;
+        return 0;
     }
-    return res;
+    *group = ValueTable_EntryAt(iter->groups, iter->idx++)->value;
+    return 1;
 }
 
 void CacheGroupIterator_Free(CacheGroupIterator* iter) {
-    if(iter) TrieMapIterator_Free(iter);
+    if(iter) rm_free(iter);
 }
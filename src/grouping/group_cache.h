@@ -8,27 +8,41 @@
 #define GROUP_CACHE_H_
 
 #include "group.h"
-#include "../util/triemap/triemap.h"
+#include "../util/value_table.h"
 
-typedef TrieMapIterator CacheGroupIterator;
-typedef TrieMap CacheGroup;
+#define GROUP_CACHE_DEFAULT_CAP 64
 
-CacheGroup* CacheGroupNew();
+/* Groups are keyed by the tuple of their key values,
+ * group's own key array is referenced by the cache. */
+typedef ValueTable CacheGroup;
 
-void CacheGroupAdd(CacheGroup *groups, char *key, Group *group);
+typedef struct {
+    CacheGroup *groups;
+    uint64_t idx;
+} CacheGroupIterator;
+
+CacheGroup* CacheGroupNew(uint key_count);
+
+// Hash group key values.
+uint64_t CacheGroupHash(const CacheGroup *groups, const SIValue *keys);
+
+void CacheGroupAdd(CacheGroup *groups, uint64_t hash, Group *group);
 
 // Retrives a group,
-// Sets group to NULL if key is missing.
-Group* CacheGroupGet(CacheGroup *groups, char *key);
+// Returns NULL if key is missing.
+Group* CacheGroupGet(CacheGroup *groups, const SIValue *keys, uint64_t hash);
+
+// Number of groups in cache.
+uint64_t CacheGroupCount(const CacheGroup *groups);
 
 void FreeGroupCache(CacheGroup *groups);
 
-// Returns an iterator to scan hashtable
+// Returns an iterator to scan groups in insertion order.
 CacheGroupIterator* CacheGroupIter(CacheGroup *groups);
 
-// Advance iterator and returns key & value in current position.
-int CacheGroupIterNext(CacheGroupIterator *iter, char **key, Group **group);
+// Advance iterator and returns group in current position.
+int CacheGroupIterNext(CacheGroupIterator *iter, Group **group);
 
 void CacheGroupIterator_Free(CacheGroupIterator* iter);
 
-#endif
\ No newline at end of file
+#endif
@@ -17,6 +17,11 @@ static inline skiplist* _select_skiplist(const Index *idx, const SIType t) {
   return NULL;
 }
 
+// Given a value type, return the matching entry counter of an index.
+static inline uint64_t* _select_entry_count(Index *idx, const SIType t) {
+  return (t == T_STRING) ? &idx->string_entries : &idx->numeric_entries;
+}
+
 //------------------------------------------------------------------------------
 // Function pointers for skiplist routines
 //------------------------------------------------------------------------------
@@ -69,6 +74,8 @@ Index* Index_Create(Graph *g, const char *label, int label_id, const char *attr_
   index->label = rm_strdup(label);
   index->attribute = rm_strdup(attr_str);
   index->attr_id = attr_id;
+  index->string_entries = 0;
+  index->numeric_entries = 0;
 
   initializeSkiplists(index);
 
@@ -112,6 +119,7 @@ Index* Index_Create(Graph *g, const char *label, int label_id, const char *attr_
     sl = _select_skiplist(index, key->type);
     if (!sl) continue; // Value was of a type not supported by indices.
     skiplistInsert(sl, key, node_id);
+    (*_select_entry_count(index, key->type))++;
   }
 
   GxB_MatrixTupleIter_free(it);
@@ -126,12 +134,28 @@ Index* Index_Create(Graph *g, const char *label, int label_id, const char *attr_
 void Index_DeleteNode(Index *idx, NodeID node, SIValue *val) {
   skiplist *sl = _select_skiplist(idx, val->type);
   if (!sl) return; // Value was of a type not supported by indices.
-  skiplistDelete(sl, val, &node);
+  if (skiplistDelete(sl, val, &node)) (*_select_entry_count(idx, val->type))--;
 }
  void Index_InsertNode(Index *idx, NodeID node, SIValue *val) {
   skiplist *sl = _select_skiplist(idx, val->type);
   if (!sl) return; // Value was of a type not supported by indices.
   skiplistInsert(sl, val, node);
+  (*_select_entry_count(idx, val->type))++;
+}
+
+//------------------------------------------------------------------------------
+// Index statistics
+//------------------------------------------------------------------------------
+
+uint64_t Index_EntryCount(const Index *idx, SIType type) {
+  if (type == T_STRING) return idx->string_entries;
+  if (type & SI_NUMERIC) return idx->numeric_entries;
+  return 0;
+}
+
+uint64_t Index_DistinctCount(const Index *idx, SIType type) {
+  skiplist *sl = _select_skiplist(idx, type);
+  return (sl) ? sl->length : 0;
 }
 
 //------------------------------------------------------------------------------
@@ -144,6 +168,11 @@ IndexIter* IndexIter_Create(Index *idx, SIType type) {
   return skiplistIterateAll(sl);
 }
 
+void IndexIter_ClearBounds(IndexIter *iter, Index *idx, SIType type) {
+  skiplist *sl = (type == T_STRING) ? idx->string_sl : idx->numeric_sl;
+  skiplistIterate_ClearRange(iter, sl);
+}
+
 /* Apply a filter to an iterator, modifying the appropriate bound if
  * it narrows the iterator range.
  * Returns 1 if the filter was a comparison type that can be translated into a bound
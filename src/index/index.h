@@ -30,6 +30,8 @@ typedef struct {
   Attribute_ID attr_id;
   skiplist *string_sl;
   skiplist *numeric_sl;
+  uint64_t string_entries;  // Number of indexed string values.
+  uint64_t numeric_entries; // Number of indexed numeric values.
 } Index;
 
 /* Index_Create builds an index for a label-property pair so that queries reliant
@@ -42,6 +44,12 @@ void Index_DeleteNode(Index *idx, NodeID node, SIValue *val);
 /* Insert a single entity into an index. */
 void Index_InsertNode(Index *idx, NodeID node, SIValue *val);
 
+/* Returns the number of indexed values of the specified type. */
+uint64_t Index_EntryCount(const Index *idx, SIType type);
+
+/* Returns the number of distinct indexed values of the specified type. */
+uint64_t Index_DistinctCount(const Index *idx, SIType type);
+
 /* Build a new iterator to traverse all indexed values of the specified type. */
 IndexIter* IndexIter_Create(Index *idx, SIType type);
 
@@ -49,6 +57,10 @@ IndexIter* IndexIter_Create(Index *idx, SIType type);
  * (if that filter represents a narrower bound than the current one). */
 bool IndexIter_ApplyBound(IndexIter *iter, SIValue *bound, int op);
 
+/* Drops the bounds of an iterator, repositioning it at the
+ * beginning of the indexed values of the specified type. */
+void IndexIter_ClearBounds(IndexIter *iter, Index *idx, SIType type);
+
 /* Returns a pointer to the next Node ID in the index, or NULL if the iterator has been depleted. */
 GrB_Index* IndexIter_Next(IndexIter *iter);
 
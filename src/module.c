@@ -19,7 +19,12 @@
 
 /* Thread pool. */
 threadpool _thpool = NULL;
+long long _thread_count = 1;        // Number of threads in thread pool.
 pthread_key_t _tlsGCKey;    // Thread local storage graph context key.
+long long _query_parallelism = 1;   // Default number of threads a single query may use.
+long long _sort_spill_threshold = 0; // Bytes buffered by sort before spilling to disk, 0 never spills.
+long long _plan_cache_size = 0;     // Number of plans cached per graph, 0 disables caching.
+long long _extract_literals = 0;    // Replace query literals with parameters, sharing cached plans.
 
 // Define the C symbols for RediSearch.
 REDISEARCH_API_INIT_SYMBOLS();
@@ -55,6 +60,7 @@ int RedisModule_OnLoad(RedisModuleCtx *ctx, RedisModuleString **argv, int argc)
     assert(GrB_init(GrB_NONBLOCKING) == GrB_SUCCESS);
     GxB_set(GxB_FORMAT, GxB_BY_ROW); // all matrices in CSR format
     GxB_set(GxB_HYPER, GxB_NEVER_HYPER); // matrices are never hypersparse
+    GxB_set(GxB_NTHREADS, 1); // queries are parallelized by the thread pool and gather workers
 
     if (RedisModule_Init(ctx, "graph", REDISGRAPH_MODULE_VERSION, REDISMODULE_APIVER_1) == REDISMODULE_ERR) {
         return REDISMODULE_ERR;
@@ -79,6 +85,21 @@ int RedisModule_OnLoad(RedisModuleCtx *ctx, RedisModuleString **argv, int argc)
     if (!_Setup_ThreadPOOL(threadCount)) return REDISMODULE_ERR;
     RedisModule_Log(ctx, "notice", "Thread pool created, using %d threads.", threadCount);
 
+    _thread_count = threadCount;
+
+    // Query workers run on the thread pool, a query can't use more threads than the pool holds.
+    _query_parallelism = Config_GetQueryParallelism(ctx, argv, argc);
+    if(_query_parallelism > _thread_count) {
+        RedisModule_Log(ctx, "warning", "Query parallelism: %lld exceeds thread count, using %lld threads.",
+                        _query_parallelism, _thread_count);
+        _query_parallelism = _thread_count;
+    }
+    RedisModule_Log(ctx, "notice", "Queries may use up to %lld threads.", _query_parallelism);
+
+    _sort_spill_threshold = Config_GetSortSpillThreshold(ctx, argv, argc);
+    _plan_cache_size = Config_GetPlanCacheSize(ctx, argv, argc);
+    _extract_literals = Config_GetExtractLiterals(ctx, argv, argc);
+
     if (_RegisterDataTypes(ctx) != REDISMODULE_OK) return REDISMODULE_ERR;
 
     if(RedisModule_CreateCommand(ctx, "graph.QUERY", MGraph_Query, "write deny-oom", 1, 1, 1) == REDISMODULE_ERR) {
@@ -8,6 +8,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
 #include "../util/arr.h"
 #include "../util/rmalloc.h"
 #include "../procedures/procedure.h"
@@ -112,10 +113,37 @@ static AST_Validation _Validate_CREATE_Clause(const AST *ast, char **reason) {
     Vector_Get(createNode->graphEntities, i, &entity);
     
     if(entity->t == N_ENTITY) continue;
+    if(((AST_LinkEntity*)entity)->shortestPath != N_SHORTEST_PATH_NONE) {
+      asprintf(reason, "Shortest path patterns are only supported by MATCH");
+      return AST_INVALID;
+    }
     if (!entity->label) {
       asprintf(reason, "Exactly one relationship type must be specified for CREATE");
       return AST_INVALID;
     }
+    if(((AST_LinkEntity*)entity)->direction == N_DIR_UNKNOWN) {
+      asprintf(reason, "Only directed relationships are supported in CREATE");
+      return AST_INVALID;
+    }
+  }
+
+  return AST_VALID;
+}
+
+static AST_Validation _Validate_MERGE_Clause(const AST *ast, char **reason) {
+  if(!ast->mergeNode) return AST_VALID;
+  AST_MergeNode *mergeNode = ast->mergeNode;
+
+  int entityCount = Vector_Size(mergeNode->graphEntities);
+  for(int i = 0; i < entityCount; i++) {
+    AST_GraphEntity *entity;
+    Vector_Get(mergeNode->graphEntities, i, &entity);
+
+    if(entity->t == N_ENTITY) continue;
+    if(((AST_LinkEntity*)entity)->direction == N_DIR_UNKNOWN) {
+      asprintf(reason, "Only directed relationships are supported in MERGE");
+      return AST_INVALID;
+    }
   }
 
   return AST_VALID;
@@ -134,6 +162,53 @@ static AST_Validation _Validate_DELETE_Clause(const AST *ast, char **reason) {
   return AST_VALID;
 }
 
+/* Shortest paths are searched between nodes matched by other patterns,
+ * searching from both ends at once. */
+static AST_Validation _Validate_ShortestPaths(const AST_MatchNode *matchNode, char **reason) {
+  TrieMap *defined = NewTrieMap();
+  int patternCount = Vector_Size(matchNode->patterns);
+  for(int i = 0; i < patternCount; i++) {
+    Vector *pattern;
+    Vector_Get(matchNode->patterns, i, &pattern);
+    if(MatchClause_ShortestPathLink(pattern)) continue;
+    for(int j = 0; j < Vector_Size(pattern); j++) {
+      AST_GraphEntity *entity;
+      Vector_Get(pattern, j, &entity);
+      if(entity->t != N_ENTITY || !entity->alias) continue;
+      TrieMap_Add(defined, entity->alias, strlen(entity->alias), NULL, TrieMap_DONT_CARE_REPLACE);
+    }
+  }
+
+  AST_Validation res = AST_VALID;
+  for(int i = 0; i < patternCount && res == AST_VALID; i++) {
+    Vector *pattern;
+    Vector_Get(matchNode->patterns, i, &pattern);
+    AST_LinkEntity *link = MatchClause_ShortestPathLink(pattern);
+    if(!link) continue;
+
+    if(link->length && link->length->minHops > 1) {
+      asprintf(reason, "Shortest path doesn't support a minimal length greater than 1.");
+      res = AST_INVALID;
+      break;
+    }
+
+    for(int j = 0; j < Vector_Size(pattern); j++) {
+      AST_GraphEntity *entity;
+      Vector_Get(pattern, j, &entity);
+      if(entity->t != N_ENTITY) continue;
+      if(entity->label || !entity->alias ||
+         TrieMap_Find(defined, entity->alias, strlen(entity->alias)) == TRIEMAP_NOTFOUND) {
+        asprintf(reason, "Shortest path end nodes must be matched by other patterns, without a label.");
+        res = AST_INVALID;
+        break;
+      }
+    }
+  }
+
+  TrieMap_Free(defined, TrieMap_NOP_CB);
+  return res;
+}
+
 static AST_Validation _Validate_MATCH_Clause(const AST *ast, char **reason) {
   if(!ast->matchNode) return AST_VALID;
   
@@ -150,6 +225,12 @@ static AST_Validation _Validate_MATCH_Clause(const AST *ast, char **reason) {
     if(entity->t != N_LINK) continue;
 
     AST_LinkEntity *edge = (AST_LinkEntity*) entity;
+    if(edge->direction == N_DIR_UNKNOWN && edge->shortestPath == N_SHORTEST_PATH_NONE) {
+      asprintf(reason, "Undirected relationships are only supported by shortest path patterns.");
+      res = AST_INVALID;
+      break;
+    }
+
     if(edge->length) {
       if(edge->length->minHops > edge->length->maxHops) {
         asprintf(reason, "Variable length path, maximum number of hops must be greater or equal to minimum number of hops.");
@@ -172,8 +253,13 @@ static AST_Validation _Validate_MATCH_Clause(const AST *ast, char **reason) {
   }
 
   TrieMap_Free(edgeAliases, TrieMap_NOP_CB);
+  if(res != AST_VALID) return res;
 
-  /* Verify that no alias appears in multiple independent patterns.
+  res = _Validate_ShortestPaths(ast->matchNode, reason);
+  if(res != AST_VALID) return res;
+
+  /* Verify that no alias appears in multiple independent patterns,
+   * shortest path patterns are expected to refer to other patterns' nodes.
    * TODO We should introduce support for this when possible. */
   int patternCount = Vector_Size(ast->matchNode->patterns);
   if (Vector_Size(ast->matchNode->patterns) > 1) {
@@ -185,6 +271,7 @@ static AST_Validation _Validate_MATCH_Clause(const AST *ast, char **reason) {
     for (int i = 0; i < patternCount; i ++) {
       pattern_ids[i] = i;
       Vector_Get(ast->matchNode->patterns, i, &pattern);
+      if (MatchClause_ShortestPathLink(pattern)) continue;
       for (int j = 0; j < Vector_Size(pattern); j ++) {
         Vector_Get(pattern, j, &elem);
         char *alias = elem->alias;
@@ -365,6 +452,7 @@ AST *AST_New(AST_MatchNode *matchNode, AST_WhereNode *whereNode,
   ast->callNode = callNode;
   ast->withNode = NULL;
   ast->_aliasIDMapping = NULL;
+  ast->params = NULL;
   return ast;
 }
 
@@ -385,6 +473,11 @@ AST_Validation AST_Validate(const AST *ast, char **reason) {
     return AST_INVALID;
   }
 
+  // MERGE patterns are also matched, validate them as such first.
+  if (_Validate_MERGE_Clause(ast, reason) != AST_VALID) {
+    return AST_INVALID;
+  }
+
   if (_Validate_MATCH_Clause(ast, reason) != AST_VALID) {
     return AST_INVALID;
   }
@@ -538,7 +631,39 @@ bool AST_ReadOnly(AST **ast) {
   return true;
 }
 
+// Retrieves a SKIP/LIMIT count from its parameter.
+static bool _AST_BindCount(const AST_Param *param, const char *clause, long long *count, char **err) {
+  if(param->value.type != T_INT64 || param->value.longval < 0) {
+    asprintf(err, "%s parameter '%s' must be a non-negative integer", clause, param->name);
+    return false;
+  }
+  *count = param->value.longval;
+  return true;
+}
+
+bool AST_BindParams(AST **ast, const AST_Params *values, char **err) {
+  if(!AST_Params_Bind(ast[0]->params, values, err)) return false;
+
+  long long count;
+  for (uint i = 0; i < array_len(ast); i++) {
+    AST_SkipNode *skipNode = ast[i]->skipNode;
+    if(skipNode && skipNode->param) {
+      if(!_AST_BindCount(skipNode->param, "SKIP", &count, err)) return false;
+      skipNode->skip = count;
+    }
+    AST_LimitNode *limitNode = ast[i]->limitNode;
+    if(limitNode && limitNode->param) {
+      if(!_AST_BindCount(limitNode->param, "LIMIT", &count, err)) return false;
+      limitNode->limit = (count > INT_MAX) ? INT_MAX : count;
+    }
+  }
+  return true;
+}
+
 void AST_Free(AST **ast) {
+  // Parameters are shared by all segments.
+  if(array_len(ast) > 0) AST_Params_Free(ast[0]->params);
+
   for (uint i = 0; i < array_len(ast); i++) {
     Free_AST_MatchNode(ast[i]->matchNode);
     Free_AST_CreateNode(ast[i]->createNode);
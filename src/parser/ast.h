@@ -10,6 +10,7 @@
 #include <stdbool.h>
 #include "../value.h"
 #include "./ast_common.h"
+#include "./ast_params.h"
 #include "../redismodule.h"
 #include "../util/vector.h"
 #include "./clauses/clauses.h"
@@ -35,6 +36,7 @@ typedef struct {
 	AST_WithNode *withNode;
 	AST_ProcedureCallNode *callNode;
 	TrieMap *_aliasIDMapping;	// Mapping between aliases and IDs.
+	AST_Params *params;			// Query parameters, shared by all AST segments.
 } AST;
 
 AST* AST_New(AST_MatchNode *matchNode, AST_WhereNode *whereNode,
@@ -74,6 +76,11 @@ bool AST_Empty(const AST *ast);
 // Checks if AST represent a read only query.
 bool AST_ReadOnly(AST **ast);
 
+/* Binds query parameters to values, see AST_Params_Bind,
+ * returns false and sets err if a parameter is missing
+ * or specifies an invalid SKIP/LIMIT. */
+bool AST_BindParams(AST **ast, const AST_Params *values, char **err);
+
 void AST_Free(AST **ast);
 
 #endif
@@ -31,6 +31,14 @@ AST_ArithmeticExpressionNode* New_AST_AR_EXP_ConstOperandNode(SIValue constant)
 	return node;
 }
 
+AST_ArithmeticExpressionNode* New_AST_AR_EXP_ParamOperandNode(AST_Param *param) {
+	AST_ArithmeticExpressionNode *node = rm_malloc(sizeof(AST_ArithmeticExpressionNode));
+	node->type = AST_AR_EXP_OPERAND;
+	node->operand.type = AST_AR_EXP_PARAM;
+	node->operand.param = param;
+	return node;
+}
+
 AST_ArithmeticExpressionNode* New_AST_AR_EXP_OpNode(char *func, Vector *args) {
 	AST_ArithmeticExpressionNode *node = rm_malloc(sizeof(AST_ArithmeticExpressionNode));
 	node->type = AST_AR_EXP_OP;
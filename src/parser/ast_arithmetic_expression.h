@@ -10,6 +10,7 @@
 #include "../util/vector.h"
 #include "../util/triemap/triemap.h"
 #include "../value.h"
+#include "./ast_params.h"
 
 /* If an AST_ArithmeticExpression_Node is a variadic with an entity alias and no
  * property, it may refer to a full graph entity (or an aliased constant,
@@ -28,6 +29,7 @@ typedef enum {
 typedef enum {
     AST_AR_EXP_CONSTANT,
     AST_AR_EXP_VARIADIC,
+    AST_AR_EXP_PARAM,
 } AST_ArithmeticExpression_OperandNodeType;
 
 typedef struct {
@@ -36,7 +38,7 @@ typedef struct {
 } AST_ArithmeticExpressionOP;
 
 /* OperandNode represents either a constant numeric value, 
- * or a graph entity property. */
+ * a graph entity property or a query parameter. */
 typedef struct {
     union {
         SIValue constant;
@@ -44,6 +46,7 @@ typedef struct {
 			char *alias;
 			char *property;
 		} variadic;
+        AST_Param *param;
     };
     AST_ArithmeticExpression_OperandNodeType type;
 } AST_ArithmeticExpressionOperand;
@@ -58,6 +61,7 @@ typedef struct {
 
 AST_ArithmeticExpressionNode* New_AST_AR_EXP_VariableOperandNode(char* alias, char *property);
 AST_ArithmeticExpressionNode* New_AST_AR_EXP_ConstOperandNode(SIValue constant);
+AST_ArithmeticExpressionNode* New_AST_AR_EXP_ParamOperandNode(AST_Param *param);
 AST_ArithmeticExpressionNode* New_AST_AR_EXP_OpNode(char *func, Vector *args);
 
 /* Find all the aliases in expression */
@@ -40,6 +40,7 @@ static AST_LinkEntity* _AST_Clone_LinkEntity(const AST_LinkEntity *src) {
 	_AST_Clone_BaseEntity((AST_GraphEntity*)clone, (const AST_GraphEntity*)src);
 
 	clone->direction = src->direction;
+	clone->shortestPath = src->shortestPath;
 	
 	clone->length = NULL;
 	if(src->length) {
@@ -81,6 +82,7 @@ AST_LinkEntity* New_AST_LinkEntity(char *alias, char **labels, Vector *propertie
 	le->ge.t = N_LINK;
 	le->ge.properties = properties;
 	le->labels = NULL;
+	le->shortestPath = N_SHORTEST_PATH_NONE;
 
 	if(labels) {
 		le->ge.label = labels[0];
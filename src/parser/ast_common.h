@@ -22,6 +22,12 @@ typedef enum {
 	N_DIR_UNKNOWN,
 } AST_LinkDirection;
 
+typedef enum {
+	N_SHORTEST_PATH_NONE,
+	N_SHORTEST_PATH_SINGLE,	// shortestPath((a)-[*]->(b))
+	N_SHORTEST_PATH_ALL,	// allShortestPaths((a)-[*]->(b))
+} AST_ShortestPathType;
+
 typedef struct {
 	char *alias;			// Alias given to entity.
 	char *label;			// Label of entity.
@@ -47,6 +53,7 @@ typedef struct {
 	AST_LinkDirection direction;
 	AST_LinkLength *length;			// NULL If edge is of length 1.
 	char **labels;
+	AST_ShortestPathType shortestPath;	// Link is matched by shortest paths only.
 } AST_LinkEntity;
 
 AST_NodeEntity* New_AST_NodeEntity(char *alias, char *label, Vector *properties);
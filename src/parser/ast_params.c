@@ -0,0 +1,218 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Redis Labs Source Available License Agreement
+*/
+
+#include "ast_params.h"
+#include "../util/arr.h"
+#include "../util/rmalloc.h"
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+
+#define PARAMS_PREFIX "CYPHER"
+
+AST_Params *AST_Params_New(void) {
+    AST_Params *params = rm_malloc(sizeof(AST_Params));
+    params->params = array_new(AST_Param*, 0);
+    params->map_values = array_new(SIValue*, 0);
+    params->map_params = array_new(AST_Param*, 0);
+    return params;
+}
+
+AST_Param *AST_Params_Find(const AST_Params *params, const char *name) {
+    uint count = array_len(params->params);
+    for(uint i = 0; i < count; i++) {
+        if(strcmp(params->params[i]->name, name) == 0) return params->params[i];
+    }
+    return NULL;
+}
+
+AST_Param *AST_Params_Get(AST_Params *params, const char *name) {
+    AST_Param *param = AST_Params_Find(params, name);
+    if(param) return param;
+
+    // Parameters are referred to by address, allocate each separately.
+    param = rm_malloc(sizeof(AST_Param));
+    param->name = rm_strdup(name);
+    param->value = SI_NullVal();
+    params->params = array_append(params->params, param);
+    return param;
+}
+
+void AST_Params_AddMapValue(AST_Params *params, SIValue *value, const char *name) {
+    AST_Param *param = AST_Params_Get(params, name);
+    params->map_values = array_append(params->map_values, value);
+    params->map_params = array_append(params->map_params, param);
+}
+
+AST_Param *AST_Params_MapValueParam(const AST_Params *params, const SIValue *value) {
+    uint count = array_len(params->map_values);
+    for(uint i = 0; i < count; i++) {
+        if(params->map_values[i] == value) return params->map_params[i];
+    }
+    return NULL;
+}
+
+uint AST_Params_Count(const AST_Params *params) {
+    return array_len(params->params);
+}
+
+static inline const char *_skip_whitespace(const char *s) {
+    while(isspace(*s)) s++;
+    return s;
+}
+
+static inline bool _identifier_char(char c) {
+    return isalnum(c) || c == '_';
+}
+
+// Returns true if s starts with keyword, ignoring case.
+static bool _match_keyword(const char *s, const char *keyword) {
+    size_t len = strlen(keyword);
+    return strncasecmp(s, keyword, len) == 0 && !_identifier_char(s[len]);
+}
+
+/* Parses a quoted string starting at s, sets end to the first
+ * character following the closing quote, returns false if unterminated. */
+static bool _parse_string(const char *s, const char **end, SIValue *v) {
+    char quote = *s++;
+    char *str = rm_malloc(strlen(s) + 1);
+    size_t len = 0;
+
+    while(*s && *s != quote) {
+        // Backslash escapes the following character.
+        if(*s == '\\' && s[1]) s++;
+        str[len++] = *s++;
+    }
+
+    if(*s != quote) {
+        rm_free(str);
+        return false;
+    }
+
+    str[len] = '\0';
+    *v = SI_TransferStringVal(str);
+    *end = s + 1;
+    return true;
+}
+
+// Parses an integer or floating point number starting at s.
+static bool _parse_number(const char *s, const char **end, SIValue *v) {
+    char *num_end;
+    double d = strtod(s, &num_end);
+    if(num_end == s) return false;
+
+    // Numbers without a fraction or an exponent are integers.
+    const char *c = (*s == '-' || *s == '+') ? s + 1 : s;
+    while(isdigit(*c)) c++;
+    if(c == num_end) *v = SI_LongVal(strtoll(s, NULL, 10));
+    else *v = SI_DoubleVal(d);
+
+    *end = num_end;
+    return true;
+}
+
+static bool _parse_value(const char *s, const char **end, SIValue *v) {
+    if(*s == '"' || *s == '\'') return _parse_string(s, end, v);
+
+    if(_match_keyword(s, "true")) {
+        *v = SI_BoolVal(1);
+        *end = s + 4;
+    } else if(_match_keyword(s, "false")) {
+        *v = SI_BoolVal(0);
+        *end = s + 5;
+    } else if(_match_keyword(s, "null")) {
+        *v = SI_NullVal();
+        *end = s + 4;
+    } else {
+        return _parse_number(s, end, v);
+    }
+    return true;
+}
+
+const char *AST_Params_ParsePrefix(const char *query, AST_Params **values, char **err) {
+    *values = NULL;
+    *err = NULL;
+
+    const char *s = _skip_whitespace(query);
+    if(!_match_keyword(s, PARAMS_PREFIX)) return query;
+    s += strlen(PARAMS_PREFIX);
+
+    AST_Params *params = AST_Params_New();
+    while(true) {
+        s = _skip_whitespace(s);
+
+        // name=value, anything else marks the beginning of the query.
+        const char *name = s;
+        if(!isalpha(*s) && *s != '_') break;
+        while(_identifier_char(*s)) s++;
+        size_t name_len = s - name;
+        s = _skip_whitespace(s);
+        if(*s != '=') {
+            s = name;
+            break;
+        }
+        s = _skip_whitespace(s + 1);
+
+        char param_name[name_len + 1];
+        memcpy(param_name, name, name_len);
+        param_name[name_len] = '\0';
+
+        SIValue v;
+        const char *value_end;
+        if(!_parse_value(s, &value_end, &v) ||
+           (*value_end && !isspace(*value_end))) {
+            asprintf(err, "Invalid value for parameter '%s'", param_name);
+            AST_Params_Free(params);
+            return NULL;
+        }
+        s = value_end;
+
+        // Later definitions override earlier ones.
+        AST_Param *param = AST_Params_Get(params, param_name);
+        SIValue_Free(&param->value);
+        param->value = v;
+    }
+
+    *values = params;
+    return s;
+}
+
+bool AST_Params_Bind(AST_Params *params, const AST_Params *values, char **err) {
+    uint count = array_len(params->params);
+    for(uint i = 0; i < count; i++) {
+        AST_Param *param = params->params[i];
+        AST_Param *value = (values) ? AST_Params_Find(values, param->name) : NULL;
+        if(!value) {
+            asprintf(err, "Missing parameter '%s'", param->name);
+            return false;
+        }
+        SIValue_Free(&param->value);
+        param->value = SI_Clone(value->value);
+    }
+
+    // Inline property maps hold a view of their parameter's value.
+    count = array_len(params->map_values);
+    for(uint i = 0; i < count; i++) {
+        *params->map_values[i] = SI_ShallowCopy(params->map_params[i]->value);
+    }
+    return true;
+}
+
+void AST_Params_Free(AST_Params *params) {
+    if(!params) return;
+    uint count = array_len(params->params);
+    for(uint i = 0; i < count; i++) {
+        AST_Param *param = params->params[i];
+        SIValue_Free(&param->value);
+        rm_free(param->name);
+        rm_free(param);
+    }
+    array_free(params->params);
+    array_free(params->map_values);
+    array_free(params->map_params);
+    rm_free(params);
+}
@@ -0,0 +1,61 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Redis Labs Source Available License Agreement
+*/
+
+#ifndef _AST_PARAMS_H
+#define _AST_PARAMS_H
+
+#include <stdbool.h>
+#include "../value.h"
+
+/* Prefix of parameters replacing literals, see Query_ExtractLiterals.
+ * Parameters specified by clients can't contain '-'. */
+#define LITERAL_PARAM_PREFIX "_lit-"
+
+/* Query parameter, referred to within a query as $name. */
+typedef struct {
+    char *name;     // Parameter name.
+    SIValue value;  // Bound value, owned by parameter.
+} AST_Param;
+
+/* Parameters referred to by a query, shared by all of the query's AST segments.
+ * Parameters are bound to values prior to each execution,
+ * allowing a single execution plan to serve different values. */
+typedef struct AST_Params {
+    AST_Param **params;         // Referred parameters.
+    SIValue **map_values;       // Inline property map values specified by a parameter.
+    AST_Param **map_params;     // Parameter specifying each of map_values.
+} AST_Params;
+
+AST_Params *AST_Params_New(void);
+
+/* Returns parameter name, introducing it if missing. */
+AST_Param *AST_Params_Get(AST_Params *params, const char *name);
+
+/* Returns parameter name, NULL if missing. */
+AST_Param *AST_Params_Find(const AST_Params *params, const char *name);
+
+/* Marks inline property map value as specified by parameter name. */
+void AST_Params_AddMapValue(AST_Params *params, SIValue *value, const char *name);
+
+/* Returns parameter specifying inline property map value, NULL if value is a literal. */
+AST_Param *AST_Params_MapValueParam(const AST_Params *params, const SIValue *value);
+
+/* Returns number of parameters. */
+uint AST_Params_Count(const AST_Params *params);
+
+/* Parses the parameters prefixing query: CYPHER name=value name=value ...
+ * returns a pointer to the query following the prefix and sets values
+ * to the specified parameters, NULL if query isn't prefixed.
+ * On failure NULL is returned and err is set. */
+const char *AST_Params_ParsePrefix(const char *query, AST_Params **values, char **err);
+
+/* Binds each parameter in params to its value in values,
+ * returns false and sets err if a parameter is missing a value. */
+bool AST_Params_Bind(AST_Params *params, const AST_Params *values, char **err);
+
+void AST_Params_Free(AST_Params *params);
+
+#endif
@@ -9,6 +9,14 @@
 AST_LimitNode* New_AST_LimitNode(int limit) {
 	AST_LimitNode* limitNode = (AST_LimitNode*)malloc(sizeof(AST_LimitNode));
 	limitNode->limit = limit;
+	limitNode->param = NULL;
+	return limitNode;
+}
+
+// Limit is set once param is bound.
+AST_LimitNode* New_AST_LimitParamNode(AST_Param *param) {
+	AST_LimitNode* limitNode = New_AST_LimitNode(0);
+	limitNode->param = param;
 	return limitNode;
 }
 
@@ -8,12 +8,15 @@
 #define _CLAUSE_LIMIT_H
 
 #include "../../util/vector.h"
+#include "../ast_params.h"
 
 typedef struct {
 	int limit;
+	AST_Param *param;	// Parameter specifying limit, NULL if limit is a literal.
 } AST_LimitNode;
 
 AST_LimitNode* New_AST_LimitNode(int limit);
+AST_LimitNode* New_AST_LimitParamNode(AST_Param *param);
 void Free_AST_LimitNode(AST_LimitNode *limitNode);
 
 #endif
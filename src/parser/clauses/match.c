@@ -38,6 +38,37 @@ void MatchClause_DefinedEntities(const AST_MatchNode *matchNode, TrieMap *define
 	}
 }
 
+void MatchClause_ReferredEntities(const AST_MatchNode *matchNode, TrieMap *referred_entities) {
+	if(!matchNode) return;
+
+	int patternCount = Vector_Size(matchNode->patterns);
+	for(int i = 0; i < patternCount; i++) {
+		Vector *pattern;
+		Vector_Get(matchNode->patterns, i, &pattern);
+		if(!MatchClause_ShortestPathLink(pattern)) continue;
+
+		int entityCount = Vector_Size(pattern);
+		for(int j = 0; j < entityCount; j++) {
+			AST_GraphEntity *entity;
+			Vector_Get(pattern, j, &entity);
+			if(entity->t != N_ENTITY || !entity->alias) continue;
+			TrieMap_Add(referred_entities, entity->alias, strlen(entity->alias), NULL, TrieMap_DONT_CARE_REPLACE);
+		}
+	}
+}
+
+AST_LinkEntity* MatchClause_ShortestPathLink(const Vector *pattern) {
+	int entityCount = Vector_Size(pattern);
+	for(int i = 0; i < entityCount; i++) {
+		AST_GraphEntity *entity;
+		Vector_Get(pattern, i, &entity);
+		if(entity->t != N_LINK) continue;
+		AST_LinkEntity *link = (AST_LinkEntity*)entity;
+		if(link->shortestPath != N_SHORTEST_PATH_NONE) return link;
+	}
+	return NULL;
+}
+
 AST_GraphEntity* MatchClause_GetEntity(const AST_MatchNode *matchNode, const char* alias) {
 	if(!matchNode) return NULL;
 
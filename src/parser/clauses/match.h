@@ -22,6 +22,13 @@ AST_MatchNode* New_AST_MatchNode(Vector *patterns);
 /* Lists entities defined by this clause. */
 void MatchClause_DefinedEntities(const AST_MatchNode *matchNode, TrieMap *referred_entities);
 
+/* Lists entities referred by shortest path patterns,
+ * these are defined by the clause's other patterns. */
+void MatchClause_ReferredEntities(const AST_MatchNode *matchNode, TrieMap *referred_entities);
+
+/* Returns the shortest path link of pattern, NULL if pattern isn't a shortest path. */
+AST_LinkEntity* MatchClause_ShortestPathLink(const Vector *pattern);
+
 /* Get an AST_GraphEntity* aliased as given alias. */
 AST_GraphEntity* MatchClause_GetEntity(const AST_MatchNode *matchNode, const char* alias);
 
@@ -9,6 +9,14 @@
 AST_SkipNode* New_AST_SkipNode(size_t n) {
     AST_SkipNode* skipNode = malloc(sizeof(AST_SkipNode));
     skipNode->skip = n;
+    skipNode->param = NULL;
+    return skipNode;
+}
+
+// Skip is set once param is bound.
+AST_SkipNode* New_AST_SkipParamNode(AST_Param *param) {
+    AST_SkipNode* skipNode = New_AST_SkipNode(0);
+    skipNode->param = param;
     return skipNode;
 }
 
@@ -8,12 +8,15 @@
 #define _SKIP_H_
 
 #include <stdlib.h>
+#include "../ast_params.h"
 
 typedef struct {
 	size_t skip; // Number of records to skip.
+	AST_Param *param; // Parameter specifying skip, NULL if skip is a literal.
 } AST_SkipNode;
 
 AST_SkipNode* New_AST_SkipNode(size_t n);
+AST_SkipNode* New_AST_SkipParamNode(AST_Param *param);
 void Free_AST_SkipNode(AST_SkipNode *skipNode);
 
 #endif
@@ -31,6 +31,7 @@
 	#include <stdint.h>
 	#include <assert.h>
 	#include <limits.h>
+	#include <string.h>
 	#include "token.h"	
 	#include "grammar.h"
 	#include "ast.h"
@@ -38,6 +39,7 @@
 	#include "parse.h"
 	#include "../value.h"
 	#include "../util/arr.h"
+	#include "../util/rmalloc.h"
 
 	void yyerror(char *s);
 
@@ -47,7 +49,7 @@
 	*/
 	// Increase depth from 100 to 1000 to handel deep recursion.
 	#define YYSTACKDEPTH 1000
-#line 51 "grammar.c"
+#line 53 "grammar.c"
 /**************** End of %include directives **********************************/
 /* These constants specify the various numeric values for terminal symbols
 ** in a format understandable to "makeheaders".  This section is blank unless
@@ -109,45 +111,46 @@
 #endif
 /************* Begin control #defines *****************************************/
 #define YYCODETYPE unsigned char
-#define YYNOCODE 109
+#define YYNOCODE 112
 #define YYACTIONTYPE unsigned short int
 #define ParseTOKENTYPE Token
 typedef union {
   int yyinit;
   ParseTOKENTYPE yy0;
-  AST_WhereNode* yy3;
-  AST_CreateNode* yy4;
-  char** yy5;
-  int yy6;
-  AST_FilterNode* yy10;
-  AST* yy31;
-  AST_LimitNode* yy39;
-  AST_SetNode* yy44;
-  AST_DeleteNode * yy47;
-  AST_LinkEntity* yy69;
+  SIValue yy12;
+  AST_MatchNode* yy17;
+  AST_NodeEntity* yy21;
+  AST_FilterNode* yy28;
+  AST_WithElementNode** yy29;
+  SIValue* yy36;
+  AST_ReturnElementNode** yy37;
+  AST_IndexNode* yy42;
+  char** yy57;
+  AST** yy61;
+  AST_IndexOpType yy63;
+  AST_ReturnNode* yy72;
+  int yy82;
+  AST_WithElementNode* yy86;
   AST_UnwindNode* yy97;
-  AST_WithElementNode* yy98;
-  AST_WithElementNode** yy112;
-  AST_NodeEntity* yy117;
-  AST_ReturnNode* yy120;
-  AST** yy121;
-  AST_ReturnElementNode** yy122;
-  char* yy129;
-  AST_LinkLength* yy138;
-  AST_ReturnElementNode* yy139;
-  AST_SkipNode* yy147;
-  SIValue yy150;
-  AST_ArithmeticExpressionNode* yy154;
-  AST_Variable* yy156;
-  AST_ProcedureCallNode* yy157;
-  AST_MergeNode* yy164;
-  AST_WithNode* yy168;
-  AST_IndexNode* yy169;
-  AST_SetElement* yy170;
-  AST_MatchNode* yy173;
-  AST_IndexOpType yy177;
-  AST_OrderNode* yy196;
-  Vector* yy210;
+  AST_SkipNode* yy105;
+  Vector* yy114;
+  AST_LinkEntity* yy117;
+  AST* yy127;
+  AST_WithNode* yy138;
+  AST_Variable* yy150;
+  AST_OrderNode* yy160;
+  AST_ReturnElementNode* yy174;
+  AST_CreateNode* yy178;
+  AST_DeleteNode * yy179;
+  AST_ProcedureCallNode* yy187;
+  AST_ArithmeticExpressionNode* yy190;
+  AST_LinkLength* yy192;
+  AST_SetNode* yy206;
+  AST_WhereNode* yy207;
+  AST_MergeNode* yy212;
+  AST_LimitNode* yy213;
+  char* yy214;
+  AST_SetElement* yy216;
 } YYMINORTYPE;
 #ifndef YYSTACKDEPTH
 #define YYSTACKDEPTH 100
@@ -156,17 +159,17 @@ typedef union {
 #define ParseARG_PDECL , parseCtx *ctx 
 #define ParseARG_FETCH  parseCtx *ctx  = yypParser->ctx 
 #define ParseARG_STORE yypParser->ctx  = ctx 
-#define YYNSTATE             164
-#define YYNRULE              138
-#define YYNTOKEN             55
-#define YY_MAX_SHIFT         163
-#define YY_MIN_SHIFTREDUCE   258
-#define YY_MAX_SHIFTREDUCE   395
-#define YY_ERROR_ACTION      396
-#define YY_ACCEPT_ACTION     397
-#define YY_NO_ACTION         398
-#define YY_MIN_REDUCE        399
-#define YY_MAX_REDUCE        536
+#define YYNSTATE             171
+#define YYNRULE              148
+#define YYNTOKEN             56
+#define YY_MAX_SHIFT         170
+#define YY_MIN_SHIFTREDUCE   274
+#define YY_MAX_SHIFTREDUCE   421
+#define YY_ERROR_ACTION      422
+#define YY_ACCEPT_ACTION     423
+#define YY_NO_ACTION         424
+#define YY_MIN_REDUCE        425
+#define YY_MAX_REDUCE        572
 /************* End control #defines *******************************************/
 
 /* Define the yytestcase() macro to be a no-op if is not already defined
@@ -232,161 +235,168 @@ typedef union {
 **  yy_default[]       Default action for each state.
 **
 *********** Begin parsing tables **********************************************/
-#define YY_ACTTAB_COUNT (441)
+#define YY_ACTTAB_COUNT (463)
 static const YYACTIONTYPE yy_action[] = {
- /*     0 */   402,   17,  401,   32,   95,   42,   91,   98,   96,   88,
- /*    10 */   146,  415,   16,  417,   66,   15,   41,   43,  509,   99,
- /*    20 */    56,  436,  454,   79,  441,  125,  397,   51,  400,  508,
- /*    30 */   156,  451,  155,  420,  117,  499,  129,   88,   44,  415,
- /*    40 */    16,  417,   66,   15,   73,   29,   34,   71,   56,  436,
- /*    50 */    76,   79,  441,  125,   29,   28,  111,  351,  305,   27,
- /*    60 */    33,  514,  514,   11,  484,   24,  154,  134,  390,  113,
- /*    70 */    69,    8,   10,    2,  509,   99,  290,  163,   76,  509,
- /*    80 */   100,  157,  158,  120,  346,  508,  388,  111,  352,    2,
- /*    90 */   508,  500,    3,  161,  495,   30,   24,  126,  158,  390,
- /*   100 */   113,   31,   89,  391,  393,  394,  395,   23,   22,   21,
- /*   110 */    20,  382,  383,  386,  384,  385,  142,  388,  361,   23,
- /*   120 */    22,   21,   20,  382,  383,  386,  384,  385,  407,  111,
- /*   130 */   408,  409,  509,  100,  391,  393,  394,  395,   24,  111,
- /*   140 */   128,  390,  113,  508,  292,  293,  159,  495,    9,   68,
- /*   150 */    78,  390,  113,  111,  387,  416,   83,  412,   93,  388,
- /*   160 */    87,   23,   22,   21,   20,  390,  387,   79,  441,  388,
- /*   170 */   509,  100,   79,  441,   30,   50,  391,  393,  394,  395,
- /*   180 */   454,  508,   34,  388,  127,  494,  391,  393,  394,  395,
- /*   190 */    29,   28,    2,   70,  305,  135,   33,  509,  105,  116,
- /*   200 */   391,  393,  394,  395,   23,   22,   21,   20,  508,    2,
- /*   210 */    23,   22,   21,   20,  145,  108,  509,   38,  399,  120,
- /*   220 */   134,  361,  509,   37,    1,  509,   38,  508,  131,  509,
- /*   230 */    38,   76,  123,  508,  106,  110,  508,  488,   61,   65,
- /*   240 */   508,  109,  160,  509,  105,  444,  509,  105,  121,   56,
- /*   250 */   436,  509,  102,   45,  508,  452,  155,  508,  509,  103,
- /*   260 */     4,  112,  508,   71,  107,   23,   22,   21,   20,  508,
- /*   270 */   150,  509,  104,  509,  506,  509,  505,  509,  114,  509,
- /*   280 */   115,   76,  508,   40,  508,  366,  508,   19,  508,   19,
- /*   290 */   508,  509,  101,   72,   31,   89,   47,  472,   19,   13,
- /*   300 */   136,  119,  508,   48,  472,  162,    2,  151,  130,   49,
- /*   310 */   389,  163,  288,   46,   46,  514,  514,  144,  454,  454,
- /*   320 */    52,  292,  293,    8,   10,  375,  376,  392,   76,  139,
- /*   330 */   137,   21,   20,   29,  437,  158,  424,  157,   57,   58,
- /*   340 */   163,    2,   59,   11,  423,   62,   60,   63,   64,   25,
- /*   350 */    31,  421,   67,  419,  132,   76,  134,  133,  473,  110,
- /*   360 */   140,  141,  147,   30,  143,   81,  414,   80,    5,   84,
- /*   370 */    82,  483,  148,  410,   85,  149,  442,   86,  318,   26,
- /*   380 */   404,   90,  360,  406,  455,   92,    6,  381,   94,  118,
- /*   390 */    97,  153,  405,  403,    7,  306,  307,  122,   53,  124,
- /*   400 */   289,   54,  291,   55,   10,   35,  328,  325,  330,  323,
- /*   410 */   336,  329,  321,  327,   74,  322,   77,  334,   75,   39,
- /*   420 */   320,  326,  324,  138,  319,   18,  152,  356,  162,  340,
- /*   430 */    36,   12,  372,  398,  398,  398,  398,  398,  378,  380,
- /*   440 */    14,
+ /*     0 */   428,   20,  427,   34,   97,   44,   93,  152,  514,   90,
+ /*    10 */   131,  441,   18,  443,   68,   15,  542,  107,  542,  102,
+ /*    20 */    58,  462,  160,   81,  467,  130,  423,   53,  426,  540,
+ /*    30 */   134,  540,   46,  446,  167,  527,  110,   90,   19,  441,
+ /*    40 */    18,  443,   68,   15,   32,   91,   36,   17,   58,  462,
+ /*    50 */     2,   81,  467,  130,   17,   16,  116,  373,  321,  115,
+ /*    60 */    35,  548,  548,  542,   40,   27,   11,  516,  416,  118,
+ /*    70 */   140,   43,  542,  102,    2,  137,  540,  136,  170,  116,
+ /*    80 */   374,   78,  114,  115,  125,  540,  414,   43,   27,  526,
+ /*    90 */   169,  416,  118,    3,  306,   26,   25,   24,   23,  408,
+ /*   100 */   409,  412,  410,  411,  417,  419,  420,  421,   80,  414,
+ /*   110 */   116,  542,  104,  169,   26,   25,   24,   23,  433,   27,
+ /*   120 */   434,  435,  416,  118,  540,  383,   19,  417,  419,  420,
+ /*   130 */   421,   26,   25,   24,   23,  408,  409,  412,  410,  411,
+ /*   140 */   414,  116,  383,  413,  169,    2,   26,   25,   24,   23,
+ /*   150 */     9,   85,  438,  416,  118,   89,  542,   39,  417,  419,
+ /*   160 */   420,  421,  100,   98,  116,  478,  161,   81,  467,  540,
+ /*   170 */   108,  414,   22,   36,   74,  169,  416,   49,  502,  413,
+ /*   180 */   147,   17,   16,  542,  102,  321,  124,   35,   52,  417,
+ /*   190 */   419,  420,  421,  480,  414,  485,  540,  157,  151,  165,
+ /*   200 */   527,    2,  170,   48,  542,  101,  548,  548,  480,   95,
+ /*   210 */   484,  125,  417,  419,  420,  421,  425,  540,   26,   25,
+ /*   220 */    24,   23,  122,  531,   26,   25,   24,   23,  542,  101,
+ /*   230 */   542,   40,  542,   40,   75,  542,  107,   45,  542,  105,
+ /*   240 */   132,  540,  480,  540,  520,  540,  111,  532,  540,  542,
+ /*   250 */   107,  540,   70,   63,   67,  117,  112,  121,  442,    4,
+ /*   260 */    71,  135,  540,  166,   58,  462,   72,   48,   22,  109,
+ /*   270 */    81,  467,  480,  141,  484,  142,  542,  106,   50,  502,
+ /*   280 */   542,  538,  542,  537,   73,  542,  119,  542,  120,  540,
+ /*   290 */   542,  103,  150,  540,   30,  540,  399,  400,  540,    1,
+ /*   300 */   540,  128,  140,  540,   51,   32,   91,  162,  477,  161,
+ /*   310 */   133,   75,  149,   78,  308,  309,    8,   10,    2,   42,
+ /*   320 */   156,  335,   73,   78,  480,   78,  308,  309,  345,  368,
+ /*   330 */   470,   78,  415,    8,   10,  145,  143,   71,  402,  405,
+ /*   340 */   388,   13,  163,  164,   22,   24,   23,  168,  126,   54,
+ /*   350 */   418,   47,  304,  343,   17,   41,  463,  450,  115,  114,
+ /*   360 */   170,   59,   60,  138,   61,    2,   11,   78,   65,  449,
+ /*   370 */    32,   62,   64,   28,  140,  503,   66,  447,  139,  445,
+ /*   380 */    69,  112,  146,  113,  153,   19,  148,   83,  337,  155,
+ /*   390 */     5,   82,  513,  154,   84,  382,  440,    6,  436,   86,
+ /*   400 */   407,   92,  468,   87,  123,   88,    7,   29,  432,  481,
+ /*   410 */    94,  430,  431,  322,   96,  159,  429,   99,  323,  127,
+ /*   420 */    55,  129,  305,   56,  307,   57,   10,   31,   37,  344,
+ /*   430 */   348,  350,  349,  347,  342,  340,   76,  356,   33,  354,
+ /*   440 */   341,   77,  339,  346,  364,  144,   79,  338,   21,  158,
+ /*   450 */   403,  168,   38,  360,  406,  424,   12,  378,  424,  396,
+ /*   460 */   390,  424,   14,
 };
 static const YYCODETYPE yy_lookahead[] = {
- /*     0 */    58,  102,   60,   61,   62,   63,   64,   62,   63,   67,
- /*    10 */   100,   69,   70,   71,   72,   73,   13,   86,   89,   90,
- /*    20 */    78,   79,   91,   81,   82,   83,   56,   57,   58,  100,
- /*    30 */    87,   88,   89,   63,  105,  106,   74,   67,   76,   69,
- /*    40 */    70,   71,   72,   73,    4,   20,   12,   33,   78,   79,
- /*    50 */    36,   81,   82,   83,   20,   21,    4,    5,   24,   17,
- /*    60 */    26,   27,   28,   38,   39,   13,   17,   25,   16,   17,
- /*    70 */    30,    1,    2,   39,   89,   90,   17,   43,   36,   89,
- /*    80 */    90,   47,   48,   49,   14,  100,   34,    4,    5,   39,
- /*    90 */   100,  106,   40,  103,  104,   21,   13,   77,   48,   16,
- /*   100 */    17,   27,   28,   51,   52,   53,   54,    3,    4,    5,
- /*   110 */     6,    7,    8,    9,   10,   11,   94,   34,   14,    3,
- /*   120 */     4,    5,    6,    7,    8,    9,   10,   11,   63,    4,
- /*   130 */    65,   66,   89,   90,   51,   52,   53,   54,   13,    4,
- /*   140 */    14,   16,   17,  100,   18,   19,  103,  104,   13,   63,
- /*   150 */    92,   16,   17,    4,   50,   69,   65,   66,   64,   34,
- /*   160 */    69,    3,    4,    5,    6,   16,   50,   81,   82,   34,
- /*   170 */    89,   90,   81,   82,   21,   86,   51,   52,   53,   54,
- /*   180 */    91,  100,   12,   34,   77,  104,   51,   52,   53,   54,
- /*   190 */    20,   21,   39,   96,   24,   94,   26,   89,   90,   41,
- /*   200 */    51,   52,   53,   54,    3,    4,    5,    6,  100,   39,
- /*   210 */     3,    4,    5,    6,   94,  107,   89,   90,    0,   49,
- /*   220 */    25,   14,   89,   90,   59,   89,   90,  100,  101,   89,
- /*   230 */    90,   36,   13,  100,  101,    5,  100,  101,   67,   68,
- /*   240 */   100,  101,   41,   89,   90,   85,   89,   90,   25,   78,
- /*   250 */    79,   89,   90,   76,  100,   88,   89,  100,   89,   90,
- /*   260 */    42,  107,  100,   33,  107,    3,    4,    5,    6,  100,
- /*   270 */    25,   89,   90,   89,   90,   89,   90,   89,   90,   89,
- /*   280 */    90,   36,  100,   75,  100,   14,  100,   18,  100,   18,
- /*   290 */   100,   89,   90,   94,   27,   28,   97,   98,   18,   13,
- /*   300 */    94,   32,  100,   97,   98,   19,   39,   80,   80,   17,
- /*   310 */    34,   43,   16,   86,   86,   47,   48,   25,   91,   91,
- /*   320 */    84,   18,   19,    1,    2,   45,   46,   51,   36,   34,
- /*   330 */    35,    5,    6,   20,   79,   48,   62,   47,   61,   64,
- /*   340 */    43,   39,   63,   38,   62,   61,   68,   64,   63,   31,
- /*   350 */    27,   62,   61,   65,   95,   36,   25,   94,   98,    5,
- /*   360 */    96,   95,   17,   21,   94,   64,   62,   61,   68,   61,
- /*   370 */    63,   99,   99,   62,   64,   94,   82,   63,   17,   62,
- /*   380 */    64,   61,   17,   62,   91,   61,   18,   17,   63,   41,
- /*   390 */    63,   93,   64,   64,   31,   17,   14,   17,   23,   22,
- /*   400 */    16,   15,   17,   13,    2,   18,   32,    4,   17,   14,
- /*   410 */    34,   32,   14,   32,   17,   14,   17,   34,   18,   25,
- /*   420 */    14,   32,   29,   35,   17,    7,   18,   17,   19,   37,
- /*   430 */    18,   18,   17,  108,  108,  108,  108,  108,   34,   34,
- /*   440 */    44,  108,  108,  108,  108,  108,  108,  108,  108,  108,
- /*   450 */   108,  108,  108,  108,  108,  108,  108,  108,  108,  108,
- /*   460 */   108,  108,  108,  108,  108,  108,  108,  108,  108,  108,
- /*   470 */   108,  108,  108,  108,  108,  108,  108,  108,  108,  108,
- /*   480 */   108,  108,  108,  108,  108,  108,  108,  108,  108,  108,
- /*   490 */   108,  108,  108,  108,  108,  108,
+ /*     0 */    59,  105,   61,   62,   63,   64,   65,  102,  103,   68,
+ /*    10 */    78,   70,   71,   72,   73,   74,   90,   91,   90,   91,
+ /*    20 */    79,   80,   17,   82,   83,   84,   57,   58,   59,  103,
+ /*    30 */    75,  103,   77,   64,  106,  107,  110,   68,   21,   70,
+ /*    40 */    71,   72,   73,   74,   27,   28,   12,   20,   79,   80,
+ /*    50 */    40,   82,   83,   84,   20,   21,    4,    5,   24,   49,
+ /*    60 */    26,   27,   28,   90,   91,   13,   39,   40,   16,   17,
+ /*    70 */    25,   13,   90,   91,   40,   17,  103,  104,   44,    4,
+ /*    80 */     5,   36,   48,   49,   50,  103,   34,   13,   13,  107,
+ /*    90 */    38,   16,   17,   41,   17,    3,    4,    5,    6,    7,
+ /*   100 */     8,    9,   10,   11,   52,   53,   54,   55,   93,   34,
+ /*   110 */     4,   90,   91,   38,    3,    4,    5,    6,   64,   13,
+ /*   120 */    66,   67,   16,   17,  103,   14,   21,   52,   53,   54,
+ /*   130 */    55,    3,    4,    5,    6,    7,    8,    9,   10,   11,
+ /*   140 */    34,    4,   14,   51,   38,   40,    3,    4,    5,    6,
+ /*   150 */    13,   66,   67,   16,   17,   70,   90,   91,   52,   53,
+ /*   160 */    54,   55,   63,   64,    4,   89,   90,   82,   83,  103,
+ /*   170 */   104,   34,   18,   12,   96,   38,   16,   99,  100,   51,
+ /*   180 */    96,   20,   21,   90,   91,   24,   32,   26,   87,   52,
+ /*   190 */    53,   54,   55,   92,   34,   94,  103,   81,   38,  106,
+ /*   200 */   107,   40,   44,   87,   90,   91,   48,   49,   92,   65,
+ /*   210 */    94,   50,   52,   53,   54,   55,    0,  103,    3,    4,
+ /*   220 */     5,    6,  108,  109,    3,    4,    5,    6,   90,   91,
+ /*   230 */    90,   91,   90,   91,    4,   90,   91,   87,   90,   91,
+ /*   240 */    78,  103,   92,  103,  104,  103,  104,  109,  103,   90,
+ /*   250 */    91,  103,   64,   68,   69,  110,    5,   42,   70,   43,
+ /*   260 */    30,   81,  103,   42,   79,   80,   98,   87,   18,  110,
+ /*   270 */    82,   83,   92,   96,   94,   96,   90,   91,   99,  100,
+ /*   280 */    90,   91,   90,   91,   33,   90,   91,   90,   91,  103,
+ /*   290 */    90,   91,   96,  103,   17,  103,   46,   47,  103,   60,
+ /*   300 */   103,   13,   25,  103,   17,   27,   28,   88,   89,   90,
+ /*   310 */    14,    4,   25,   36,   18,   19,    1,    2,   40,   87,
+ /*   320 */    25,   14,   33,   36,   92,   36,   18,   19,    4,   14,
+ /*   330 */    86,   36,   34,    1,    2,   34,   35,   30,   34,   34,
+ /*   340 */    14,   13,   38,   38,   18,    5,    6,   19,   25,   85,
+ /*   350 */    52,   77,   16,   29,   20,   76,   80,   63,   49,   48,
+ /*   360 */    44,   62,   65,   97,   64,   40,   39,   36,   65,   63,
+ /*   370 */    27,   69,   62,   31,   25,  100,   64,   63,   96,   66,
+ /*   380 */    62,    5,   98,   97,   17,   21,   96,   65,   17,   96,
+ /*   390 */    69,   62,  101,  101,   64,   17,   63,   18,   63,   62,
+ /*   400 */    17,   62,   83,   65,   42,   64,   31,   63,   63,   92,
+ /*   410 */    62,   65,   65,   17,   64,   95,   65,   64,   14,   17,
+ /*   420 */    23,   22,   16,   15,   17,   13,    2,   18,   13,    4,
+ /*   430 */    32,   17,   32,   32,   14,   14,   17,   34,   25,   34,
+ /*   440 */    14,   18,   14,   32,   17,   35,   17,   17,    7,   18,
+ /*   450 */    17,   19,   18,   37,   17,  111,   18,   17,  111,   17,
+ /*   460 */    17,  111,   45,  111,  111,  111,  111,  111,  111,  111,
+ /*   470 */   111,  111,  111,  111,  111,  111,  111,  111,  111,  111,
+ /*   480 */   111,  111,  111,  111,  111,  111,  111,  111,  111,  111,
+ /*   490 */   111,  111,  111,  111,  111,  111,  111,  111,  111,  111,
+ /*   500 */   111,  111,  111,  111,  111,  111,  111,  111,  111,  111,
+ /*   510 */   111,  111,  111,  111,  111,  111,  111,  111,  111,
 };
-#define YY_SHIFT_COUNT    (163)
+#define YY_SHIFT_COUNT    (170)
 #define YY_SHIFT_MIN      (0)
-#define YY_SHIFT_MAX      (418)
+#define YY_SHIFT_MAX      (443)
 static const unsigned short int yy_shift_ofst[] = {
- /*     0 */   170,   34,   52,   83,  125,   74,  125,  125,  135,  135,
- /*    10 */   135,  135,  125,  125,  125,   25,  153,  125,  125,  125,
- /*    20 */   125,  125,  125,  125,  125,   42,  267,  195,    3,    3,
- /*    30 */     3,   49,   50,    3,   59,    3,   49,  104,  116,  149,
- /*    40 */   126,  292,  268,   40,  303,  303,   40,  230,   14,  245,
- /*    50 */    40,  218,  219,  223,   59,  296,  313,  287,  290,  297,
- /*    60 */   302,  305,  287,  290,  297,  302,  323,  287,  290,  318,
- /*    70 */   319,  331,  354,  318,  319,  345,  345,  319,    3,  342,
- /*    80 */   287,  290,  297,  302,  287,  290,  297,  302,  305,  361,
- /*    90 */   287,  290,  287,  290,  297,  302,  297,  297,  302,  158,
- /*   100 */   201,  207,  262,  262,  262,  262,   70,  280,  269,  322,
- /*   110 */   295,  276,  271,  286,  326,  326,  365,  368,  370,  348,
- /*   120 */   363,  378,  382,  380,  375,  377,  384,  385,  386,  390,
- /*   130 */   387,  402,  403,  374,  391,  379,  381,  376,  383,  388,
- /*   140 */   389,  393,  395,  398,  397,  401,  400,  394,  392,  406,
- /*   150 */   399,  387,  407,  408,  409,  418,  412,  404,  405,  413,
- /*   160 */   410,  413,  415,  396,
+ /*     0 */   161,   34,   52,   75,  106,   17,  106,  106,  137,  137,
+ /*    10 */   137,  137,  106,  106,  106,   27,   58,   58,  105,   58,
+ /*    20 */   106,  106,  106,  106,  106,  106,  106,  106,  277,  278,
+ /*    30 */    45,   58,    5,  160,   10,   74,   77,   74,    5,  128,
+ /*    40 */    92,  296,  307,  287,  158,  230,  308,  308,  230,  251,
+ /*    50 */   289,  295,  230,  216,  288,  323,   77,  336,  334,  309,
+ /*    60 */   311,  316,  325,  327,  309,  311,  316,  325,  343,  309,
+ /*    70 */   311,  342,  331,  349,  376,  342,  331,  367,  367,  331,
+ /*    80 */    74,  364,  309,  311,  316,  325,  309,  311,  316,  325,
+ /*    90 */   327,  371,  309,  311,  309,  311,  316,  325,  316,  316,
+ /*   100 */   325,  215,  221,  111,  143,  143,  143,  143,  315,  250,
+ /*   110 */   154,  332,  301,  324,  304,  305,  298,  326,  328,  340,
+ /*   120 */   340,  378,  379,  383,  362,  375,  396,  404,  402,  397,
+ /*   130 */   399,  406,  407,  408,  412,  409,  424,  415,  425,  398,
+ /*   140 */   414,  400,  401,  403,  405,  410,  411,  420,  421,  419,
+ /*   150 */   426,  427,  423,  413,  416,  428,  429,  409,  430,  431,
+ /*   160 */   432,  441,  434,  433,  437,  438,  440,  438,  442,  443,
+ /*   170 */   417,
 };
-#define YY_REDUCE_COUNT (98)
-#define YY_REDUCE_MIN   (-101)
-#define YY_REDUCE_MAX   (329)
+#define YY_REDUCE_COUNT (100)
+#define YY_REDUCE_MIN   (-104)
+#define YY_REDUCE_MAX   (353)
 static const short yy_reduce_ofst[] = {
- /*     0 */   -30,  -58,  -10,   43,  -71,   91,  -15,  108,  127,  133,
- /*    10 */   136,  140,   81,  154,  157,  171,   86,  162,  169,  182,
- /*    20 */   184,  186,  188,  190,  202,  199,   65,  206,  227,  228,
- /*    30 */   227,  -57,  -55,  -69,  -38,   89,  167, -101, -101,  -90,
- /*    40 */    20,   22,   94,   58,  107,  107,   58,   97,  101,  120,
- /*    50 */    58,  165,  160,  236,  177,  208,  255,  274,  277,  275,
- /*    60 */   279,  278,  282,  284,  283,  285,  288,  289,  291,  259,
- /*    70 */   263,  260,  264,  266,  270,  272,  273,  281,  293,  294,
- /*    80 */   304,  306,  301,  307,  311,  308,  310,  314,  300,  298,
- /*    90 */   317,  320,  321,  324,  316,  325,  328,  329,  327,
+ /*     0 */   -31,  -59,  -72,   93,  114,   85,  138,  -74,  -27,   66,
+ /*    10 */   140,  142,  -18,  145,  159,  185,  116,  180,  188,  116,
+ /*    20 */    21,  148,  186,  190,  192,  195,  197,  200,   78,   54,
+ /*    30 */   179,  101,  219,  -95,   99,  150,  -45,  232,   76, -104,
+ /*    40 */  -104,  -68,   15,   84,  144,   15,  162,  162,   15,  168,
+ /*    50 */   177,  196,   15,  239,  244,  264,  274,  279,  276,  294,
+ /*    60 */   299,  297,  300,  302,  306,  310,  303,  312,  313,  314,
+ /*    70 */   318,  266,  282,  275,  284,  286,  290,  291,  292,  293,
+ /*    80 */   317,  319,  333,  329,  322,  330,  335,  337,  338,  341,
+ /*    90 */   321,  320,  344,  339,  345,  348,  346,  350,  347,  351,
+ /*   100 */   353,
 };
 static const YYACTIONTYPE yy_default[] = {
- /*     0 */   439,  439,  396,  396,  396,  439,  396,  396,  396,  396,
- /*    10 */   396,  396,  396,  396,  396,  422,  439,  396,  396,  396,
- /*    20 */   396,  396,  396,  396,  396,  480,  396,  480,  445,  396,
- /*    30 */   396,  396,  396,  396,  396,  396,  396,  396,  396,  396,
- /*    40 */   396,  480,  420,  449,  427,  425,  456,  474,  480,  480,
- /*    50 */   457,  396,  396,  396,  396,  428,  435,  520,  518,  514,
- /*    60 */   396,  484,  520,  518,  514,  396,  418,  520,  518,  396,
- /*    70 */   480,  396,  474,  396,  480,  396,  396,  480,  396,  440,
- /*    80 */   520,  518,  514,  413,  520,  518,  514,  411,  484,  396,
- /*    90 */   520,  518,  520,  518,  514,  396,  514,  514,  396,  396,
- /*   100 */   496,  396,  486,  453,  510,  511,  396,  515,  396,  485,
- /*   110 */   479,  396,  396,  512,  504,  503,  396,  498,  396,  396,
- /*   120 */   396,  396,  396,  396,  396,  396,  396,  396,  426,  396,
- /*   130 */   438,  489,  396,  396,  396,  396,  396,  396,  476,  478,
- /*   140 */   396,  396,  396,  396,  396,  396,  482,  396,  396,  396,
- /*   150 */   396,  443,  396,  458,  512,  396,  450,  396,  396,  491,
- /*   160 */   396,  490,  396,  396,
+ /*     0 */   465,  465,  422,  422,  422,  465,  422,  543,  422,  422,
+ /*    10 */   422,  422,  422,  543,  543,  448,  471,  422,  465,  422,
+ /*    20 */   422,  422,  422,  422,  422,  422,  422,  422,  510,  422,
+ /*    30 */   510,  422,  422,  422,  422,  422,  422,  422,  422,  422,
+ /*    40 */   422,  422,  422,  510,  446,  475,  453,  451,  482,  504,
+ /*    50 */   510,  510,  483,  422,  422,  422,  422,  454,  461,  555,
+ /*    60 */   552,  548,  422,  516,  555,  552,  548,  422,  444,  555,
+ /*    70 */   552,  422,  510,  422,  504,  422,  510,  422,  422,  510,
+ /*    80 */   422,  466,  555,  552,  548,  439,  555,  552,  548,  437,
+ /*    90 */   516,  422,  555,  552,  555,  552,  548,  422,  548,  548,
+ /*   100 */   422,  422,  528,  422,  518,  479,  544,  545,  422,  549,
+ /*   110 */   422,  517,  509,  422,  422,  422,  422,  422,  546,  536,
+ /*   120 */   535,  422,  530,  422,  422,  422,  422,  422,  422,  422,
+ /*   130 */   422,  422,  422,  452,  422,  464,  521,  422,  422,  422,
+ /*   140 */   422,  422,  422,  422,  506,  508,  422,  422,  422,  422,
+ /*   150 */   422,  422,  512,  422,  422,  422,  422,  469,  422,  487,
+ /*   160 */   546,  422,  476,  422,  422,  523,  422,  522,  422,  422,
+ /*   170 */   422,
 };
 /********** End of lemon-generated parsing tables *****************************/
 
@@ -530,76 +540,79 @@ static const char *const yyTokenName[] = {
   /*   35 */ "DOTDOT",
   /*   36 */ "LEFT_CURLY_BRACKET",
   /*   37 */ "RIGHT_CURLY_BRACKET",
-  /*   38 */ "WHERE",
-  /*   39 */ "RETURN",
-  /*   40 */ "DISTINCT",
-  /*   41 */ "AS",
-  /*   42 */ "WITH",
-  /*   43 */ "ORDER",
-  /*   44 */ "BY",
-  /*   45 */ "ASC",
-  /*   46 */ "DESC",
-  /*   47 */ "SKIP",
-  /*   48 */ "LIMIT",
-  /*   49 */ "UNWIND",
-  /*   50 */ "NE",
-  /*   51 */ "FLOAT",
-  /*   52 */ "TRUE",
-  /*   53 */ "FALSE",
-  /*   54 */ "NULLVAL",
-  /*   55 */ "error",
-  /*   56 */ "query",
-  /*   57 */ "expressions",
-  /*   58 */ "expr",
-  /*   59 */ "withClause",
-  /*   60 */ "singlePartQuery",
-  /*   61 */ "skipClause",
-  /*   62 */ "limitClause",
-  /*   63 */ "returnClause",
-  /*   64 */ "orderClause",
-  /*   65 */ "setClause",
-  /*   66 */ "deleteClause",
-  /*   67 */ "multipleMatchClause",
-  /*   68 */ "whereClause",
-  /*   69 */ "multipleCreateClause",
-  /*   70 */ "unwindClause",
-  /*   71 */ "indexClause",
-  /*   72 */ "mergeClause",
-  /*   73 */ "procedureCallClause",
-  /*   74 */ "procedureName",
-  /*   75 */ "stringList",
-  /*   76 */ "unquotedStringList",
-  /*   77 */ "delimiter",
-  /*   78 */ "matchClauses",
-  /*   79 */ "matchClause",
-  /*   80 */ "chains",
-  /*   81 */ "createClauses",
-  /*   82 */ "createClause",
-  /*   83 */ "indexOpToken",
-  /*   84 */ "indexLabel",
-  /*   85 */ "indexProp",
-  /*   86 */ "chain",
-  /*   87 */ "setList",
-  /*   88 */ "setElement",
-  /*   89 */ "variable",
-  /*   90 */ "arithmetic_expression",
-  /*   91 */ "node",
-  /*   92 */ "link",
-  /*   93 */ "deleteExpression",
-  /*   94 */ "properties",
-  /*   95 */ "edge",
-  /*   96 */ "edgeLength",
-  /*   97 */ "edgeLabels",
-  /*   98 */ "edgeLabel",
-  /*   99 */ "mapLiteral",
-  /*  100 */ "value",
-  /*  101 */ "cond",
-  /*  102 */ "relation",
-  /*  103 */ "returnElements",
-  /*  104 */ "returnElement",
-  /*  105 */ "withElements",
-  /*  106 */ "withElement",
-  /*  107 */ "arithmetic_expression_list",
+  /*   38 */ "DOLLAR",
+  /*   39 */ "WHERE",
+  /*   40 */ "RETURN",
+  /*   41 */ "DISTINCT",
+  /*   42 */ "AS",
+  /*   43 */ "WITH",
+  /*   44 */ "ORDER",
+  /*   45 */ "BY",
+  /*   46 */ "ASC",
+  /*   47 */ "DESC",
+  /*   48 */ "SKIP",
+  /*   49 */ "LIMIT",
+  /*   50 */ "UNWIND",
+  /*   51 */ "NE",
+  /*   52 */ "FLOAT",
+  /*   53 */ "TRUE",
+  /*   54 */ "FALSE",
+  /*   55 */ "NULLVAL",
+  /*   56 */ "error",
+  /*   57 */ "query",
+  /*   58 */ "expressions",
+  /*   59 */ "expr",
+  /*   60 */ "withClause",
+  /*   61 */ "singlePartQuery",
+  /*   62 */ "skipClause",
+  /*   63 */ "limitClause",
+  /*   64 */ "returnClause",
+  /*   65 */ "orderClause",
+  /*   66 */ "setClause",
+  /*   67 */ "deleteClause",
+  /*   68 */ "multipleMatchClause",
+  /*   69 */ "whereClause",
+  /*   70 */ "multipleCreateClause",
+  /*   71 */ "unwindClause",
+  /*   72 */ "indexClause",
+  /*   73 */ "mergeClause",
+  /*   74 */ "procedureCallClause",
+  /*   75 */ "procedureName",
+  /*   76 */ "stringList",
+  /*   77 */ "unquotedStringList",
+  /*   78 */ "delimiter",
+  /*   79 */ "matchClauses",
+  /*   80 */ "matchClause",
+  /*   81 */ "chains",
+  /*   82 */ "createClauses",
+  /*   83 */ "createClause",
+  /*   84 */ "indexOpToken",
+  /*   85 */ "indexLabel",
+  /*   86 */ "indexProp",
+  /*   87 */ "chain",
+  /*   88 */ "setList",
+  /*   89 */ "setElement",
+  /*   90 */ "variable",
+  /*   91 */ "arithmetic_expression",
+  /*   92 */ "node",
+  /*   93 */ "link",
+  /*   94 */ "shortestPath",
+  /*   95 */ "deleteExpression",
+  /*   96 */ "properties",
+  /*   97 */ "edge",
+  /*   98 */ "edgeLength",
+  /*   99 */ "edgeLabels",
+  /*  100 */ "edgeLabel",
+  /*  101 */ "mapLiteral",
+  /*  102 */ "mapValue",
+  /*  103 */ "value",
+  /*  104 */ "cond",
+  /*  105 */ "relation",
+  /*  106 */ "returnElements",
+  /*  107 */ "returnElement",
+  /*  108 */ "withElements",
+  /*  109 */ "withElement",
+  /*  110 */ "arithmetic_expression_list",
 };
 #endif /* defined(YYCOVERAGE) || !defined(NDEBUG) */
 
@@ -666,85 +679,95 @@ static const char *const yyRuleName[] = {
  /*  56 */ "chain ::= chain link node",
  /*  57 */ "chains ::= chain",
  /*  58 */ "chains ::= chains COMMA chain",
- /*  59 */ "deleteClause ::= DELETE deleteExpression",
- /*  60 */ "deleteExpression ::= UQSTRING",
- /*  61 */ "deleteExpression ::= deleteExpression COMMA UQSTRING",
- /*  62 */ "node ::= LEFT_PARENTHESIS UQSTRING COLON UQSTRING properties RIGHT_PARENTHESIS",
- /*  63 */ "node ::= LEFT_PARENTHESIS COLON UQSTRING properties RIGHT_PARENTHESIS",
- /*  64 */ "node ::= LEFT_PARENTHESIS UQSTRING properties RIGHT_PARENTHESIS",
- /*  65 */ "node ::= LEFT_PARENTHESIS properties RIGHT_PARENTHESIS",
- /*  66 */ "link ::= DASH edge RIGHT_ARROW",
- /*  67 */ "link ::= LEFT_ARROW edge DASH",
- /*  68 */ "edge ::= LEFT_BRACKET properties edgeLength RIGHT_BRACKET",
- /*  69 */ "edge ::= LEFT_BRACKET UQSTRING properties RIGHT_BRACKET",
- /*  70 */ "edge ::= LEFT_BRACKET edgeLabels edgeLength properties RIGHT_BRACKET",
- /*  71 */ "edge ::= LEFT_BRACKET UQSTRING edgeLabels properties RIGHT_BRACKET",
- /*  72 */ "edgeLabel ::= COLON UQSTRING",
- /*  73 */ "edgeLabels ::= edgeLabel",
- /*  74 */ "edgeLabels ::= edgeLabels PIPE edgeLabel",
- /*  75 */ "edgeLength ::=",
- /*  76 */ "edgeLength ::= MUL INTEGER DOTDOT INTEGER",
- /*  77 */ "edgeLength ::= MUL INTEGER DOTDOT",
- /*  78 */ "edgeLength ::= MUL DOTDOT INTEGER",
- /*  79 */ "edgeLength ::= MUL INTEGER",
- /*  80 */ "edgeLength ::= MUL",
- /*  81 */ "properties ::=",
- /*  82 */ "properties ::= LEFT_CURLY_BRACKET mapLiteral RIGHT_CURLY_BRACKET",
- /*  83 */ "mapLiteral ::= UQSTRING COLON value",
- /*  84 */ "mapLiteral ::= UQSTRING COLON value COMMA mapLiteral",
- /*  85 */ "whereClause ::=",
- /*  86 */ "whereClause ::= WHERE cond",
- /*  87 */ "cond ::= arithmetic_expression relation arithmetic_expression",
- /*  88 */ "cond ::= LEFT_PARENTHESIS cond RIGHT_PARENTHESIS",
- /*  89 */ "cond ::= cond AND cond",
- /*  90 */ "cond ::= cond OR cond",
- /*  91 */ "returnClause ::= RETURN returnElements",
- /*  92 */ "returnClause ::= RETURN DISTINCT returnElements",
- /*  93 */ "returnClause ::= RETURN MUL",
- /*  94 */ "returnClause ::= RETURN DISTINCT MUL",
- /*  95 */ "returnElements ::= returnElements COMMA returnElement",
- /*  96 */ "returnElements ::= returnElement",
- /*  97 */ "returnElement ::= arithmetic_expression",
- /*  98 */ "returnElement ::= arithmetic_expression AS UQSTRING",
- /*  99 */ "withClause ::= WITH withElements",
- /* 100 */ "withElements ::= withElement",
- /* 101 */ "withElements ::= withElements COMMA withElement",
- /* 102 */ "withElement ::= arithmetic_expression AS UQSTRING",
- /* 103 */ "arithmetic_expression ::= LEFT_PARENTHESIS arithmetic_expression RIGHT_PARENTHESIS",
- /* 104 */ "arithmetic_expression ::= arithmetic_expression ADD arithmetic_expression",
- /* 105 */ "arithmetic_expression ::= arithmetic_expression DASH arithmetic_expression",
- /* 106 */ "arithmetic_expression ::= arithmetic_expression MUL arithmetic_expression",
- /* 107 */ "arithmetic_expression ::= arithmetic_expression DIV arithmetic_expression",
- /* 108 */ "arithmetic_expression ::= UQSTRING LEFT_PARENTHESIS arithmetic_expression_list RIGHT_PARENTHESIS",
- /* 109 */ "arithmetic_expression ::= value",
- /* 110 */ "arithmetic_expression ::= variable",
- /* 111 */ "arithmetic_expression_list ::= arithmetic_expression_list COMMA arithmetic_expression",
- /* 112 */ "arithmetic_expression_list ::= arithmetic_expression",
- /* 113 */ "variable ::= UQSTRING",
- /* 114 */ "variable ::= UQSTRING DOT UQSTRING",
- /* 115 */ "orderClause ::=",
- /* 116 */ "orderClause ::= ORDER BY arithmetic_expression_list",
- /* 117 */ "orderClause ::= ORDER BY arithmetic_expression_list ASC",
- /* 118 */ "orderClause ::= ORDER BY arithmetic_expression_list DESC",
- /* 119 */ "skipClause ::=",
- /* 120 */ "skipClause ::= SKIP INTEGER",
- /* 121 */ "limitClause ::=",
- /* 122 */ "limitClause ::= LIMIT INTEGER",
- /* 123 */ "unwindClause ::= UNWIND LEFT_BRACKET arithmetic_expression_list RIGHT_BRACKET AS UQSTRING",
- /* 124 */ "relation ::= EQ",
- /* 125 */ "relation ::= GT",
- /* 126 */ "relation ::= LT",
- /* 127 */ "relation ::= LE",
- /* 128 */ "relation ::= GE",
- /* 129 */ "relation ::= NE",
- /* 130 */ "value ::= INTEGER",
- /* 131 */ "value ::= DASH INTEGER",
- /* 132 */ "value ::= STRING",
- /* 133 */ "value ::= FLOAT",
- /* 134 */ "value ::= DASH FLOAT",
- /* 135 */ "value ::= TRUE",
- /* 136 */ "value ::= FALSE",
- /* 137 */ "value ::= NULLVAL",
+ /*  59 */ "chains ::= shortestPath",
+ /*  60 */ "chains ::= chains COMMA shortestPath",
+ /*  61 */ "shortestPath ::= UQSTRING LEFT_PARENTHESIS chain RIGHT_PARENTHESIS",
+ /*  62 */ "deleteClause ::= DELETE deleteExpression",
+ /*  63 */ "deleteExpression ::= UQSTRING",
+ /*  64 */ "deleteExpression ::= deleteExpression COMMA UQSTRING",
+ /*  65 */ "node ::= LEFT_PARENTHESIS UQSTRING COLON UQSTRING properties RIGHT_PARENTHESIS",
+ /*  66 */ "node ::= LEFT_PARENTHESIS COLON UQSTRING properties RIGHT_PARENTHESIS",
+ /*  67 */ "node ::= LEFT_PARENTHESIS UQSTRING properties RIGHT_PARENTHESIS",
+ /*  68 */ "node ::= LEFT_PARENTHESIS properties RIGHT_PARENTHESIS",
+ /*  69 */ "link ::= DASH edge RIGHT_ARROW",
+ /*  70 */ "link ::= LEFT_ARROW edge DASH",
+ /*  71 */ "link ::= DASH edge DASH",
+ /*  72 */ "edge ::= LEFT_BRACKET properties edgeLength RIGHT_BRACKET",
+ /*  73 */ "edge ::= LEFT_BRACKET UQSTRING properties RIGHT_BRACKET",
+ /*  74 */ "edge ::= LEFT_BRACKET edgeLabels edgeLength properties RIGHT_BRACKET",
+ /*  75 */ "edge ::= LEFT_BRACKET UQSTRING edgeLabels properties RIGHT_BRACKET",
+ /*  76 */ "edgeLabel ::= COLON UQSTRING",
+ /*  77 */ "edgeLabels ::= edgeLabel",
+ /*  78 */ "edgeLabels ::= edgeLabels PIPE edgeLabel",
+ /*  79 */ "edgeLength ::=",
+ /*  80 */ "edgeLength ::= MUL INTEGER DOTDOT INTEGER",
+ /*  81 */ "edgeLength ::= MUL INTEGER DOTDOT",
+ /*  82 */ "edgeLength ::= MUL DOTDOT INTEGER",
+ /*  83 */ "edgeLength ::= MUL INTEGER",
+ /*  84 */ "edgeLength ::= MUL",
+ /*  85 */ "properties ::=",
+ /*  86 */ "properties ::= LEFT_CURLY_BRACKET mapLiteral RIGHT_CURLY_BRACKET",
+ /*  87 */ "mapLiteral ::= UQSTRING COLON mapValue",
+ /*  88 */ "mapLiteral ::= UQSTRING COLON mapValue COMMA mapLiteral",
+ /*  89 */ "mapValue ::= value",
+ /*  90 */ "mapValue ::= DOLLAR UQSTRING",
+ /*  91 */ "whereClause ::=",
+ /*  92 */ "whereClause ::= WHERE cond",
+ /*  93 */ "cond ::= arithmetic_expression relation arithmetic_expression",
+ /*  94 */ "cond ::= LEFT_PARENTHESIS cond RIGHT_PARENTHESIS",
+ /*  95 */ "cond ::= cond AND cond",
+ /*  96 */ "cond ::= cond OR cond",
+ /*  97 */ "returnClause ::= RETURN returnElements",
+ /*  98 */ "returnClause ::= RETURN DISTINCT returnElements",
+ /*  99 */ "returnClause ::= RETURN MUL",
+ /* 100 */ "returnClause ::= RETURN DISTINCT MUL",
+ /* 101 */ "returnElements ::= returnElements COMMA returnElement",
+ /* 102 */ "returnElements ::= returnElement",
+ /* 103 */ "returnElement ::= arithmetic_expression",
+ /* 104 */ "returnElement ::= arithmetic_expression AS UQSTRING",
+ /* 105 */ "withClause ::= WITH withElements",
+ /* 106 */ "withElements ::= withElement",
+ /* 107 */ "withElements ::= withElements COMMA withElement",
+ /* 108 */ "withElement ::= arithmetic_expression AS UQSTRING",
+ /* 109 */ "arithmetic_expression ::= LEFT_PARENTHESIS arithmetic_expression RIGHT_PARENTHESIS",
+ /* 110 */ "arithmetic_expression ::= arithmetic_expression ADD arithmetic_expression",
+ /* 111 */ "arithmetic_expression ::= arithmetic_expression DASH arithmetic_expression",
+ /* 112 */ "arithmetic_expression ::= arithmetic_expression MUL arithmetic_expression",
+ /* 113 */ "arithmetic_expression ::= arithmetic_expression DIV arithmetic_expression",
+ /* 114 */ "arithmetic_expression ::= UQSTRING LEFT_PARENTHESIS arithmetic_expression_list RIGHT_PARENTHESIS",
+ /* 115 */ "arithmetic_expression ::= value",
+ /* 116 */ "arithmetic_expression ::= DOLLAR UQSTRING",
+ /* 117 */ "arithmetic_expression ::= variable",
+ /* 118 */ "arithmetic_expression_list ::=",
+ /* 119 */ "arithmetic_expression_list ::= arithmetic_expression_list COMMA arithmetic_expression",
+ /* 120 */ "arithmetic_expression_list ::= arithmetic_expression",
+ /* 121 */ "variable ::= UQSTRING",
+ /* 122 */ "variable ::= UQSTRING DOT UQSTRING",
+ /* 123 */ "orderClause ::=",
+ /* 124 */ "orderClause ::= ORDER BY arithmetic_expression_list",
+ /* 125 */ "orderClause ::= ORDER BY arithmetic_expression_list ASC",
+ /* 126 */ "orderClause ::= ORDER BY arithmetic_expression_list DESC",
+ /* 127 */ "skipClause ::=",
+ /* 128 */ "skipClause ::= SKIP INTEGER",
+ /* 129 */ "skipClause ::= SKIP DOLLAR UQSTRING",
+ /* 130 */ "limitClause ::=",
+ /* 131 */ "limitClause ::= LIMIT INTEGER",
+ /* 132 */ "limitClause ::= LIMIT DOLLAR UQSTRING",
+ /* 133 */ "unwindClause ::= UNWIND LEFT_BRACKET arithmetic_expression_list RIGHT_BRACKET AS UQSTRING",
+ /* 134 */ "relation ::= EQ",
+ /* 135 */ "relation ::= GT",
+ /* 136 */ "relation ::= LT",
+ /* 137 */ "relation ::= LE",
+ /* 138 */ "relation ::= GE",
+ /* 139 */ "relation ::= NE",
+ /* 140 */ "value ::= INTEGER",
+ /* 141 */ "value ::= DASH INTEGER",
+ /* 142 */ "value ::= STRING",
+ /* 143 */ "value ::= FLOAT",
+ /* 144 */ "value ::= DASH FLOAT",
+ /* 145 */ "value ::= TRUE",
+ /* 146 */ "value ::= FALSE",
+ /* 147 */ "value ::= NULLVAL",
 };
 #endif /* NDEBUG */
 
@@ -865,11 +888,11 @@ static void yy_destructor(
     ** inside the C code.
     */
 /********* Begin destructor definitions ***************************************/
-    case 101: /* cond */
+    case 104: /* cond */
 {
-#line 519 "grammar.y"
- Free_AST_FilterNode((yypminor->yy10)); 
-#line 873 "grammar.c"
+#line 575 "grammar.y"
+ Free_AST_FilterNode((yypminor->yy28)); 
+#line 896 "grammar.c"
 }
       break;
 /********* End destructor definitions *****************************************/
@@ -1164,144 +1187,154 @@ static const struct {
   YYCODETYPE lhs;       /* Symbol on the left-hand side of the rule */
   signed char nrhs;     /* Negative of the number of RHS symbols in the rule */
 } yyRuleInfo[] = {
-  {   56,   -1 }, /* (0) query ::= expressions */
-  {   57,   -1 }, /* (1) expressions ::= expr */
-  {   57,   -3 }, /* (2) expressions ::= expressions withClause singlePartQuery */
-  {   60,   -1 }, /* (3) singlePartQuery ::= expr */
-  {   60,   -4 }, /* (4) singlePartQuery ::= skipClause limitClause returnClause orderClause */
-  {   60,   -3 }, /* (5) singlePartQuery ::= limitClause returnClause orderClause */
-  {   60,   -3 }, /* (6) singlePartQuery ::= skipClause returnClause orderClause */
-  {   60,   -4 }, /* (7) singlePartQuery ::= returnClause orderClause skipClause limitClause */
-  {   60,   -4 }, /* (8) singlePartQuery ::= orderClause skipClause limitClause returnClause */
-  {   60,   -4 }, /* (9) singlePartQuery ::= orderClause skipClause limitClause setClause */
-  {   60,   -4 }, /* (10) singlePartQuery ::= orderClause skipClause limitClause deleteClause */
-  {   58,   -7 }, /* (11) expr ::= multipleMatchClause whereClause multipleCreateClause returnClause orderClause skipClause limitClause */
-  {   58,   -3 }, /* (12) expr ::= multipleMatchClause whereClause multipleCreateClause */
-  {   58,   -3 }, /* (13) expr ::= multipleMatchClause whereClause deleteClause */
-  {   58,   -3 }, /* (14) expr ::= multipleMatchClause whereClause setClause */
-  {   58,   -7 }, /* (15) expr ::= multipleMatchClause whereClause setClause returnClause orderClause skipClause limitClause */
-  {   58,   -1 }, /* (16) expr ::= multipleCreateClause */
-  {   58,   -2 }, /* (17) expr ::= unwindClause multipleCreateClause */
-  {   58,   -1 }, /* (18) expr ::= indexClause */
-  {   58,   -1 }, /* (19) expr ::= mergeClause */
-  {   58,   -2 }, /* (20) expr ::= mergeClause setClause */
-  {   58,   -1 }, /* (21) expr ::= returnClause */
-  {   58,   -4 }, /* (22) expr ::= unwindClause returnClause skipClause limitClause */
-  {   58,   -1 }, /* (23) expr ::= procedureCallClause */
-  {   58,   -6 }, /* (24) expr ::= procedureCallClause whereClause returnClause orderClause skipClause limitClause */
-  {   58,   -7 }, /* (25) expr ::= procedureCallClause multipleMatchClause whereClause returnClause orderClause skipClause limitClause */
-  {   73,   -7 }, /* (26) procedureCallClause ::= CALL procedureName LEFT_PARENTHESIS stringList RIGHT_PARENTHESIS YIELD unquotedStringList */
-  {   73,   -5 }, /* (27) procedureCallClause ::= CALL procedureName LEFT_PARENTHESIS stringList RIGHT_PARENTHESIS */
-  {   74,   -1 }, /* (28) procedureName ::= unquotedStringList */
-  {   75,    0 }, /* (29) stringList ::= */
-  {   75,   -1 }, /* (30) stringList ::= STRING */
-  {   75,   -3 }, /* (31) stringList ::= stringList delimiter STRING */
-  {   76,   -1 }, /* (32) unquotedStringList ::= UQSTRING */
-  {   76,   -3 }, /* (33) unquotedStringList ::= unquotedStringList delimiter UQSTRING */
-  {   77,   -1 }, /* (34) delimiter ::= COMMA */
-  {   77,   -1 }, /* (35) delimiter ::= DOT */
-  {   67,   -1 }, /* (36) multipleMatchClause ::= matchClauses */
-  {   78,   -1 }, /* (37) matchClauses ::= matchClause */
-  {   78,   -2 }, /* (38) matchClauses ::= matchClauses matchClause */
-  {   79,   -2 }, /* (39) matchClause ::= MATCH chains */
-  {   69,    0 }, /* (40) multipleCreateClause ::= */
-  {   69,   -1 }, /* (41) multipleCreateClause ::= createClauses */
-  {   81,   -1 }, /* (42) createClauses ::= createClause */
-  {   81,   -2 }, /* (43) createClauses ::= createClauses createClause */
-  {   82,   -2 }, /* (44) createClause ::= CREATE chains */
-  {   71,   -5 }, /* (45) indexClause ::= indexOpToken INDEX ON indexLabel indexProp */
-  {   83,   -1 }, /* (46) indexOpToken ::= CREATE */
-  {   83,   -1 }, /* (47) indexOpToken ::= DROP */
-  {   84,   -2 }, /* (48) indexLabel ::= COLON UQSTRING */
-  {   85,   -3 }, /* (49) indexProp ::= LEFT_PARENTHESIS UQSTRING RIGHT_PARENTHESIS */
-  {   72,   -2 }, /* (50) mergeClause ::= MERGE chain */
-  {   65,   -2 }, /* (51) setClause ::= SET setList */
-  {   87,   -1 }, /* (52) setList ::= setElement */
-  {   87,   -3 }, /* (53) setList ::= setList COMMA setElement */
-  {   88,   -3 }, /* (54) setElement ::= variable EQ arithmetic_expression */
-  {   86,   -1 }, /* (55) chain ::= node */
-  {   86,   -3 }, /* (56) chain ::= chain link node */
-  {   80,   -1 }, /* (57) chains ::= chain */
-  {   80,   -3 }, /* (58) chains ::= chains COMMA chain */
-  {   66,   -2 }, /* (59) deleteClause ::= DELETE deleteExpression */
-  {   93,   -1 }, /* (60) deleteExpression ::= UQSTRING */
-  {   93,   -3 }, /* (61) deleteExpression ::= deleteExpression COMMA UQSTRING */
-  {   91,   -6 }, /* (62) node ::= LEFT_PARENTHESIS UQSTRING COLON UQSTRING properties RIGHT_PARENTHESIS */
-  {   91,   -5 }, /* (63) node ::= LEFT_PARENTHESIS COLON UQSTRING properties RIGHT_PARENTHESIS */
-  {   91,   -4 }, /* (64) node ::= LEFT_PARENTHESIS UQSTRING properties RIGHT_PARENTHESIS */
-  {   91,   -3 }, /* (65) node ::= LEFT_PARENTHESIS properties RIGHT_PARENTHESIS */
-  {   92,   -3 }, /* (66) link ::= DASH edge RIGHT_ARROW */
-  {   92,   -3 }, /* (67) link ::= LEFT_ARROW edge DASH */
-  {   95,   -4 }, /* (68) edge ::= LEFT_BRACKET properties edgeLength RIGHT_BRACKET */
-  {   95,   -4 }, /* (69) edge ::= LEFT_BRACKET UQSTRING properties RIGHT_BRACKET */
-  {   95,   -5 }, /* (70) edge ::= LEFT_BRACKET edgeLabels edgeLength properties RIGHT_BRACKET */
-  {   95,   -5 }, /* (71) edge ::= LEFT_BRACKET UQSTRING edgeLabels properties RIGHT_BRACKET */
-  {   98,   -2 }, /* (72) edgeLabel ::= COLON UQSTRING */
-  {   97,   -1 }, /* (73) edgeLabels ::= edgeLabel */
-  {   97,   -3 }, /* (74) edgeLabels ::= edgeLabels PIPE edgeLabel */
-  {   96,    0 }, /* (75) edgeLength ::= */
-  {   96,   -4 }, /* (76) edgeLength ::= MUL INTEGER DOTDOT INTEGER */
-  {   96,   -3 }, /* (77) edgeLength ::= MUL INTEGER DOTDOT */
-  {   96,   -3 }, /* (78) edgeLength ::= MUL DOTDOT INTEGER */
-  {   96,   -2 }, /* (79) edgeLength ::= MUL INTEGER */
-  {   96,   -1 }, /* (80) edgeLength ::= MUL */
-  {   94,    0 }, /* (81) properties ::= */
-  {   94,   -3 }, /* (82) properties ::= LEFT_CURLY_BRACKET mapLiteral RIGHT_CURLY_BRACKET */
-  {   99,   -3 }, /* (83) mapLiteral ::= UQSTRING COLON value */
-  {   99,   -5 }, /* (84) mapLiteral ::= UQSTRING COLON value COMMA mapLiteral */
-  {   68,    0 }, /* (85) whereClause ::= */
-  {   68,   -2 }, /* (86) whereClause ::= WHERE cond */
-  {  101,   -3 }, /* (87) cond ::= arithmetic_expression relation arithmetic_expression */
-  {  101,   -3 }, /* (88) cond ::= LEFT_PARENTHESIS cond RIGHT_PARENTHESIS */
-  {  101,   -3 }, /* (89) cond ::= cond AND cond */
-  {  101,   -3 }, /* (90) cond ::= cond OR cond */
-  {   63,   -2 }, /* (91) returnClause ::= RETURN returnElements */
-  {   63,   -3 }, /* (92) returnClause ::= RETURN DISTINCT returnElements */
-  {   63,   -2 }, /* (93) returnClause ::= RETURN MUL */
-  {   63,   -3 }, /* (94) returnClause ::= RETURN DISTINCT MUL */
-  {  103,   -3 }, /* (95) returnElements ::= returnElements COMMA returnElement */
-  {  103,   -1 }, /* (96) returnElements ::= returnElement */
-  {  104,   -1 }, /* (97) returnElement ::= arithmetic_expression */
-  {  104,   -3 }, /* (98) returnElement ::= arithmetic_expression AS UQSTRING */
-  {   59,   -2 }, /* (99) withClause ::= WITH withElements */
-  {  105,   -1 }, /* (100) withElements ::= withElement */
-  {  105,   -3 }, /* (101) withElements ::= withElements COMMA withElement */
-  {  106,   -3 }, /* (102) withElement ::= arithmetic_expression AS UQSTRING */
-  {   90,   -3 }, /* (103) arithmetic_expression ::= LEFT_PARENTHESIS arithmetic_expression RIGHT_PARENTHESIS */
-  {   90,   -3 }, /* (104) arithmetic_expression ::= arithmetic_expression ADD arithmetic_expression */
-  {   90,   -3 }, /* (105) arithmetic_expression ::= arithmetic_expression DASH arithmetic_expression */
-  {   90,   -3 }, /* (106) arithmetic_expression ::= arithmetic_expression MUL arithmetic_expression */
-  {   90,   -3 }, /* (107) arithmetic_expression ::= arithmetic_expression DIV arithmetic_expression */
-  {   90,   -4 }, /* (108) arithmetic_expression ::= UQSTRING LEFT_PARENTHESIS arithmetic_expression_list RIGHT_PARENTHESIS */
-  {   90,   -1 }, /* (109) arithmetic_expression ::= value */
-  {   90,   -1 }, /* (110) arithmetic_expression ::= variable */
-  {  107,   -3 }, /* (111) arithmetic_expression_list ::= arithmetic_expression_list COMMA arithmetic_expression */
-  {  107,   -1 }, /* (112) arithmetic_expression_list ::= arithmetic_expression */
-  {   89,   -1 }, /* (113) variable ::= UQSTRING */
-  {   89,   -3 }, /* (114) variable ::= UQSTRING DOT UQSTRING */
-  {   64,    0 }, /* (115) orderClause ::= */
-  {   64,   -3 }, /* (116) orderClause ::= ORDER BY arithmetic_expression_list */
-  {   64,   -4 }, /* (117) orderClause ::= ORDER BY arithmetic_expression_list ASC */
-  {   64,   -4 }, /* (118) orderClause ::= ORDER BY arithmetic_expression_list DESC */
-  {   61,    0 }, /* (119) skipClause ::= */
-  {   61,   -2 }, /* (120) skipClause ::= SKIP INTEGER */
-  {   62,    0 }, /* (121) limitClause ::= */
-  {   62,   -2 }, /* (122) limitClause ::= LIMIT INTEGER */
-  {   70,   -6 }, /* (123) unwindClause ::= UNWIND LEFT_BRACKET arithmetic_expression_list RIGHT_BRACKET AS UQSTRING */
-  {  102,   -1 }, /* (124) relation ::= EQ */
-  {  102,   -1 }, /* (125) relation ::= GT */
-  {  102,   -1 }, /* (126) relation ::= LT */
-  {  102,   -1 }, /* (127) relation ::= LE */
-  {  102,   -1 }, /* (128) relation ::= GE */
-  {  102,   -1 }, /* (129) relation ::= NE */
-  {  100,   -1 }, /* (130) value ::= INTEGER */
-  {  100,   -2 }, /* (131) value ::= DASH INTEGER */
-  {  100,   -1 }, /* (132) value ::= STRING */
-  {  100,   -1 }, /* (133) value ::= FLOAT */
-  {  100,   -2 }, /* (134) value ::= DASH FLOAT */
-  {  100,   -1 }, /* (135) value ::= TRUE */
-  {  100,   -1 }, /* (136) value ::= FALSE */
-  {  100,   -1 }, /* (137) value ::= NULLVAL */
+  {   57,   -1 }, /* (0) query ::= expressions */
+  {   58,   -1 }, /* (1) expressions ::= expr */
+  {   58,   -3 }, /* (2) expressions ::= expressions withClause singlePartQuery */
+  {   61,   -1 }, /* (3) singlePartQuery ::= expr */
+  {   61,   -4 }, /* (4) singlePartQuery ::= skipClause limitClause returnClause orderClause */
+  {   61,   -3 }, /* (5) singlePartQuery ::= limitClause returnClause orderClause */
+  {   61,   -3 }, /* (6) singlePartQuery ::= skipClause returnClause orderClause */
+  {   61,   -4 }, /* (7) singlePartQuery ::= returnClause orderClause skipClause limitClause */
+  {   61,   -4 }, /* (8) singlePartQuery ::= orderClause skipClause limitClause returnClause */
+  {   61,   -4 }, /* (9) singlePartQuery ::= orderClause skipClause limitClause setClause */
+  {   61,   -4 }, /* (10) singlePartQuery ::= orderClause skipClause limitClause deleteClause */
+  {   59,   -7 }, /* (11) expr ::= multipleMatchClause whereClause multipleCreateClause returnClause orderClause skipClause limitClause */
+  {   59,   -3 }, /* (12) expr ::= multipleMatchClause whereClause multipleCreateClause */
+  {   59,   -3 }, /* (13) expr ::= multipleMatchClause whereClause deleteClause */
+  {   59,   -3 }, /* (14) expr ::= multipleMatchClause whereClause setClause */
+  {   59,   -7 }, /* (15) expr ::= multipleMatchClause whereClause setClause returnClause orderClause skipClause limitClause */
+  {   59,   -1 }, /* (16) expr ::= multipleCreateClause */
+  {   59,   -2 }, /* (17) expr ::= unwindClause multipleCreateClause */
+  {   59,   -1 }, /* (18) expr ::= indexClause */
+  {   59,   -1 }, /* (19) expr ::= mergeClause */
+  {   59,   -2 }, /* (20) expr ::= mergeClause setClause */
+  {   59,   -1 }, /* (21) expr ::= returnClause */
+  {   59,   -4 }, /* (22) expr ::= unwindClause returnClause skipClause limitClause */
+  {   59,   -1 }, /* (23) expr ::= procedureCallClause */
+  {   59,   -6 }, /* (24) expr ::= procedureCallClause whereClause returnClause orderClause skipClause limitClause */
+  {   59,   -7 }, /* (25) expr ::= procedureCallClause multipleMatchClause whereClause returnClause orderClause skipClause limitClause */
+  {   74,   -7 }, /* (26) procedureCallClause ::= CALL procedureName LEFT_PARENTHESIS stringList RIGHT_PARENTHESIS YIELD unquotedStringList */
+  {   74,   -5 }, /* (27) procedureCallClause ::= CALL procedureName LEFT_PARENTHESIS stringList RIGHT_PARENTHESIS */
+  {   75,   -1 }, /* (28) procedureName ::= unquotedStringList */
+  {   76,    0 }, /* (29) stringList ::= */
+  {   76,   -1 }, /* (30) stringList ::= STRING */
+  {   76,   -3 }, /* (31) stringList ::= stringList delimiter STRING */
+  {   77,   -1 }, /* (32) unquotedStringList ::= UQSTRING */
+  {   77,   -3 }, /* (33) unquotedStringList ::= unquotedStringList delimiter UQSTRING */
+  {   78,   -1 }, /* (34) delimiter ::= COMMA */
+  {   78,   -1 }, /* (35) delimiter ::= DOT */
+  {   68,   -1 }, /* (36) multipleMatchClause ::= matchClauses */
+  {   79,   -1 }, /* (37) matchClauses ::= matchClause */
+  {   79,   -2 }, /* (38) matchClauses ::= matchClauses matchClause */
+  {   80,   -2 }, /* (39) matchClause ::= MATCH chains */
+  {   70,    0 }, /* (40) multipleCreateClause ::= */
+  {   70,   -1 }, /* (41) multipleCreateClause ::= createClauses */
+  {   82,   -1 }, /* (42) createClauses ::= createClause */
+  {   82,   -2 }, /* (43) createClauses ::= createClauses createClause */
+  {   83,   -2 }, /* (44) createClause ::= CREATE chains */
+  {   72,   -5 }, /* (45) indexClause ::= indexOpToken INDEX ON indexLabel indexProp */
+  {   84,   -1 }, /* (46) indexOpToken ::= CREATE */
+  {   84,   -1 }, /* (47) indexOpToken ::= DROP */
+  {   85,   -2 }, /* (48) indexLabel ::= COLON UQSTRING */
+  {   86,   -3 }, /* (49) indexProp ::= LEFT_PARENTHESIS UQSTRING RIGHT_PARENTHESIS */
+  {   73,   -2 }, /* (50) mergeClause ::= MERGE chain */
+  {   66,   -2 }, /* (51) setClause ::= SET setList */
+  {   88,   -1 }, /* (52) setList ::= setElement */
+  {   88,   -3 }, /* (53) setList ::= setList COMMA setElement */
+  {   89,   -3 }, /* (54) setElement ::= variable EQ arithmetic_expression */
+  {   87,   -1 }, /* (55) chain ::= node */
+  {   87,   -3 }, /* (56) chain ::= chain link node */
+  {   81,   -1 }, /* (57) chains ::= chain */
+  {   81,   -3 }, /* (58) chains ::= chains COMMA chain */
+  {   81,   -1 }, /* (59) chains ::= shortestPath */
+  {   81,   -3 }, /* (60) chains ::= chains COMMA shortestPath */
+  {   94,   -4 }, /* (61) shortestPath ::= UQSTRING LEFT_PARENTHESIS chain RIGHT_PARENTHESIS */
+  {   67,   -2 }, /* (62) deleteClause ::= DELETE deleteExpression */
+  {   95,   -1 }, /* (63) deleteExpression ::= UQSTRING */
+  {   95,   -3 }, /* (64) deleteExpression ::= deleteExpression COMMA UQSTRING */
+  {   92,   -6 }, /* (65) node ::= LEFT_PARENTHESIS UQSTRING COLON UQSTRING properties RIGHT_PARENTHESIS */
+  {   92,   -5 }, /* (66) node ::= LEFT_PARENTHESIS COLON UQSTRING properties RIGHT_PARENTHESIS */
+  {   92,   -4 }, /* (67) node ::= LEFT_PARENTHESIS UQSTRING properties RIGHT_PARENTHESIS */
+  {   92,   -3 }, /* (68) node ::= LEFT_PARENTHESIS properties RIGHT_PARENTHESIS */
+  {   93,   -3 }, /* (69) link ::= DASH edge RIGHT_ARROW */
+  {   93,   -3 }, /* (70) link ::= LEFT_ARROW edge DASH */
+  {   93,   -3 }, /* (71) link ::= DASH edge DASH */
+  {   97,   -4 }, /* (72) edge ::= LEFT_BRACKET properties edgeLength RIGHT_BRACKET */
+  {   97,   -4 }, /* (73) edge ::= LEFT_BRACKET UQSTRING properties RIGHT_BRACKET */
+  {   97,   -5 }, /* (74) edge ::= LEFT_BRACKET edgeLabels edgeLength properties RIGHT_BRACKET */
+  {   97,   -5 }, /* (75) edge ::= LEFT_BRACKET UQSTRING edgeLabels properties RIGHT_BRACKET */
+  {  100,   -2 }, /* (76) edgeLabel ::= COLON UQSTRING */
+  {   99,   -1 }, /* (77) edgeLabels ::= edgeLabel */
+  {   99,   -3 }, /* (78) edgeLabels ::= edgeLabels PIPE edgeLabel */
+  {   98,    0 }, /* (79) edgeLength ::= */
+  {   98,   -4 }, /* (80) edgeLength ::= MUL INTEGER DOTDOT INTEGER */
+  {   98,   -3 }, /* (81) edgeLength ::= MUL INTEGER DOTDOT */
+  {   98,   -3 }, /* (82) edgeLength ::= MUL DOTDOT INTEGER */
+  {   98,   -2 }, /* (83) edgeLength ::= MUL INTEGER */
+  {   98,   -1 }, /* (84) edgeLength ::= MUL */
+  {   96,    0 }, /* (85) properties ::= */
+  {   96,   -3 }, /* (86) properties ::= LEFT_CURLY_BRACKET mapLiteral RIGHT_CURLY_BRACKET */
+  {  101,   -3 }, /* (87) mapLiteral ::= UQSTRING COLON mapValue */
+  {  101,   -5 }, /* (88) mapLiteral ::= UQSTRING COLON mapValue COMMA mapLiteral */
+  {  102,   -1 }, /* (89) mapValue ::= value */
+  {  102,   -2 }, /* (90) mapValue ::= DOLLAR UQSTRING */
+  {   69,    0 }, /* (91) whereClause ::= */
+  {   69,   -2 }, /* (92) whereClause ::= WHERE cond */
+  {  104,   -3 }, /* (93) cond ::= arithmetic_expression relation arithmetic_expression */
+  {  104,   -3 }, /* (94) cond ::= LEFT_PARENTHESIS cond RIGHT_PARENTHESIS */
+  {  104,   -3 }, /* (95) cond ::= cond AND cond */
+  {  104,   -3 }, /* (96) cond ::= cond OR cond */
+  {   64,   -2 }, /* (97) returnClause ::= RETURN returnElements */
+  {   64,   -3 }, /* (98) returnClause ::= RETURN DISTINCT returnElements */
+  {   64,   -2 }, /* (99) returnClause ::= RETURN MUL */
+  {   64,   -3 }, /* (100) returnClause ::= RETURN DISTINCT MUL */
+  {  106,   -3 }, /* (101) returnElements ::= returnElements COMMA returnElement */
+  {  106,   -1 }, /* (102) returnElements ::= returnElement */
+  {  107,   -1 }, /* (103) returnElement ::= arithmetic_expression */
+  {  107,   -3 }, /* (104) returnElement ::= arithmetic_expression AS UQSTRING */
+  {   60,   -2 }, /* (105) withClause ::= WITH withElements */
+  {  108,   -1 }, /* (106) withElements ::= withElement */
+  {  108,   -3 }, /* (107) withElements ::= withElements COMMA withElement */
+  {  109,   -3 }, /* (108) withElement ::= arithmetic_expression AS UQSTRING */
+  {   91,   -3 }, /* (109) arithmetic_expression ::= LEFT_PARENTHESIS arithmetic_expression RIGHT_PARENTHESIS */
+  {   91,   -3 }, /* (110) arithmetic_expression ::= arithmetic_expression ADD arithmetic_expression */
+  {   91,   -3 }, /* (111) arithmetic_expression ::= arithmetic_expression DASH arithmetic_expression */
+  {   91,   -3 }, /* (112) arithmetic_expression ::= arithmetic_expression MUL arithmetic_expression */
+  {   91,   -3 }, /* (113) arithmetic_expression ::= arithmetic_expression DIV arithmetic_expression */
+  {   91,   -4 }, /* (114) arithmetic_expression ::= UQSTRING LEFT_PARENTHESIS arithmetic_expression_list RIGHT_PARENTHESIS */
+  {   91,   -1 }, /* (115) arithmetic_expression ::= value */
+  {   91,   -2 }, /* (116) arithmetic_expression ::= DOLLAR UQSTRING */
+  {   91,   -1 }, /* (117) arithmetic_expression ::= variable */
+  {  110,    0 }, /* (118) arithmetic_expression_list ::= */
+  {  110,   -3 }, /* (119) arithmetic_expression_list ::= arithmetic_expression_list COMMA arithmetic_expression */
+  {  110,   -1 }, /* (120) arithmetic_expression_list ::= arithmetic_expression */
+  {   90,   -1 }, /* (121) variable ::= UQSTRING */
+  {   90,   -3 }, /* (122) variable ::= UQSTRING DOT UQSTRING */
+  {   65,    0 }, /* (123) orderClause ::= */
+  {   65,   -3 }, /* (124) orderClause ::= ORDER BY arithmetic_expression_list */
+  {   65,   -4 }, /* (125) orderClause ::= ORDER BY arithmetic_expression_list ASC */
+  {   65,   -4 }, /* (126) orderClause ::= ORDER BY arithmetic_expression_list DESC */
+  {   62,    0 }, /* (127) skipClause ::= */
+  {   62,   -2 }, /* (128) skipClause ::= SKIP INTEGER */
+  {   62,   -3 }, /* (129) skipClause ::= SKIP DOLLAR UQSTRING */
+  {   63,    0 }, /* (130) limitClause ::= */
+  {   63,   -2 }, /* (131) limitClause ::= LIMIT INTEGER */
+  {   63,   -3 }, /* (132) limitClause ::= LIMIT DOLLAR UQSTRING */
+  {   71,   -6 }, /* (133) unwindClause ::= UNWIND LEFT_BRACKET arithmetic_expression_list RIGHT_BRACKET AS UQSTRING */
+  {  105,   -1 }, /* (134) relation ::= EQ */
+  {  105,   -1 }, /* (135) relation ::= GT */
+  {  105,   -1 }, /* (136) relation ::= LT */
+  {  105,   -1 }, /* (137) relation ::= LE */
+  {  105,   -1 }, /* (138) relation ::= GE */
+  {  105,   -1 }, /* (139) relation ::= NE */
+  {  103,   -1 }, /* (140) value ::= INTEGER */
+  {  103,   -2 }, /* (141) value ::= DASH INTEGER */
+  {  103,   -1 }, /* (142) value ::= STRING */
+  {  103,   -1 }, /* (143) value ::= FLOAT */
+  {  103,   -2 }, /* (144) value ::= DASH FLOAT */
+  {  103,   -1 }, /* (145) value ::= TRUE */
+  {  103,   -1 }, /* (146) value ::= FALSE */
+  {  103,   -1 }, /* (147) value ::= NULLVAL */
 };
 
 static void yy_accept(yyParser*);  /* Forward Declaration */
@@ -1382,243 +1415,243 @@ static void yy_reduce(
 /********** Begin reduce actions **********************************************/
         YYMINORTYPE yylhsminor;
       case 0: /* query ::= expressions */
-#line 43 "grammar.y"
-{ ctx->root = yymsp[0].minor.yy121; }
-#line 1388 "grammar.c"
+#line 45 "grammar.y"
+{ ctx->root = yymsp[0].minor.yy61; }
+#line 1421 "grammar.c"
         break;
       case 1: /* expressions ::= expr */
-#line 47 "grammar.y"
+#line 49 "grammar.y"
 {
-	yylhsminor.yy121 = array_new(AST*, 1);
-	yylhsminor.yy121 = array_append(yylhsminor.yy121, yymsp[0].minor.yy31);
+	yylhsminor.yy61 = array_new(AST*, 1);
+	yylhsminor.yy61 = array_append(yylhsminor.yy61, yymsp[0].minor.yy127);
 }
-#line 1396 "grammar.c"
-  yymsp[0].minor.yy121 = yylhsminor.yy121;
+#line 1429 "grammar.c"
+  yymsp[0].minor.yy61 = yylhsminor.yy61;
         break;
       case 2: /* expressions ::= expressions withClause singlePartQuery */
-#line 52 "grammar.y"
+#line 54 "grammar.y"
 {
-	AST *ast = yymsp[-2].minor.yy121[array_len(yymsp[-2].minor.yy121)-1];
-	ast->withNode = yymsp[-1].minor.yy168;
-	yylhsminor.yy121 = array_append(yymsp[-2].minor.yy121, yymsp[0].minor.yy31);
-	yylhsminor.yy121=yymsp[-2].minor.yy121;
+	AST *ast = yymsp[-2].minor.yy61[array_len(yymsp[-2].minor.yy61)-1];
+	ast->withNode = yymsp[-1].minor.yy138;
+	yylhsminor.yy61 = array_append(yymsp[-2].minor.yy61, yymsp[0].minor.yy127);
+	yylhsminor.yy61=yymsp[-2].minor.yy61;
 }
-#line 1407 "grammar.c"
-  yymsp[-2].minor.yy121 = yylhsminor.yy121;
+#line 1440 "grammar.c"
+  yymsp[-2].minor.yy61 = yylhsminor.yy61;
         break;
       case 3: /* singlePartQuery ::= expr */
-#line 60 "grammar.y"
+#line 62 "grammar.y"
 {
-	yylhsminor.yy31 = yymsp[0].minor.yy31;
+	yylhsminor.yy127 = yymsp[0].minor.yy127;
 }
-#line 1415 "grammar.c"
-  yymsp[0].minor.yy31 = yylhsminor.yy31;
+#line 1448 "grammar.c"
+  yymsp[0].minor.yy127 = yylhsminor.yy127;
         break;
       case 4: /* singlePartQuery ::= skipClause limitClause returnClause orderClause */
-#line 64 "grammar.y"
+#line 66 "grammar.y"
 {
-	yylhsminor.yy31 = AST_New(NULL, NULL, NULL, NULL, NULL, NULL, yymsp[-1].minor.yy120, yymsp[0].minor.yy196, yymsp[-3].minor.yy147, yymsp[-2].minor.yy39, NULL, NULL, NULL);
+	yylhsminor.yy127 = AST_New(NULL, NULL, NULL, NULL, NULL, NULL, yymsp[-1].minor.yy72, yymsp[0].minor.yy160, yymsp[-3].minor.yy105, yymsp[-2].minor.yy213, NULL, NULL, NULL);
 }
-#line 1423 "grammar.c"
-  yymsp[-3].minor.yy31 = yylhsminor.yy31;
+#line 1456 "grammar.c"
+  yymsp[-3].minor.yy127 = yylhsminor.yy127;
         break;
       case 5: /* singlePartQuery ::= limitClause returnClause orderClause */
-#line 68 "grammar.y"
+#line 70 "grammar.y"
 {
-	yylhsminor.yy31 = AST_New(NULL, NULL, NULL, NULL, NULL, NULL, yymsp[-1].minor.yy120, yymsp[0].minor.yy196, NULL, yymsp[-2].minor.yy39, NULL, NULL, NULL);
+	yylhsminor.yy127 = AST_New(NULL, NULL, NULL, NULL, NULL, NULL, yymsp[-1].minor.yy72, yymsp[0].minor.yy160, NULL, yymsp[-2].minor.yy213, NULL, NULL, NULL);
 }
-#line 1431 "grammar.c"
-  yymsp[-2].minor.yy31 = yylhsminor.yy31;
+#line 1464 "grammar.c"
+  yymsp[-2].minor.yy127 = yylhsminor.yy127;
         break;
       case 6: /* singlePartQuery ::= skipClause returnClause orderClause */
-#line 72 "grammar.y"
+#line 74 "grammar.y"
 {
-	yylhsminor.yy31 = AST_New(NULL, NULL, NULL, NULL, NULL, NULL, yymsp[-1].minor.yy120, yymsp[0].minor.yy196, yymsp[-2].minor.yy147, NULL, NULL, NULL, NULL);
+	yylhsminor.yy127 = AST_New(NULL, NULL, NULL, NULL, NULL, NULL, yymsp[-1].minor.yy72, yymsp[0].minor.yy160, yymsp[-2].minor.yy105, NULL, NULL, NULL, NULL);
 }
-#line 1439 "grammar.c"
-  yymsp[-2].minor.yy31 = yylhsminor.yy31;
+#line 1472 "grammar.c"
+  yymsp[-2].minor.yy127 = yylhsminor.yy127;
         break;
       case 7: /* singlePartQuery ::= returnClause orderClause skipClause limitClause */
-#line 76 "grammar.y"
+#line 78 "grammar.y"
 {
-	yylhsminor.yy31 = AST_New(NULL, NULL, NULL, NULL, NULL, NULL, yymsp[-3].minor.yy120, yymsp[-2].minor.yy196, yymsp[-1].minor.yy147, yymsp[0].minor.yy39, NULL, NULL, NULL);
+	yylhsminor.yy127 = AST_New(NULL, NULL, NULL, NULL, NULL, NULL, yymsp[-3].minor.yy72, yymsp[-2].minor.yy160, yymsp[-1].minor.yy105, yymsp[0].minor.yy213, NULL, NULL, NULL);
 }
-#line 1447 "grammar.c"
-  yymsp[-3].minor.yy31 = yylhsminor.yy31;
+#line 1480 "grammar.c"
+  yymsp[-3].minor.yy127 = yylhsminor.yy127;
         break;
       case 8: /* singlePartQuery ::= orderClause skipClause limitClause returnClause */
-#line 80 "grammar.y"
+#line 82 "grammar.y"
 {
-	yylhsminor.yy31 = AST_New(NULL, NULL, NULL, NULL, NULL, NULL, yymsp[0].minor.yy120, yymsp[-3].minor.yy196, yymsp[-2].minor.yy147, yymsp[-1].minor.yy39, NULL, NULL, NULL);
+	yylhsminor.yy127 = AST_New(NULL, NULL, NULL, NULL, NULL, NULL, yymsp[0].minor.yy72, yymsp[-3].minor.yy160, yymsp[-2].minor.yy105, yymsp[-1].minor.yy213, NULL, NULL, NULL);
 }
-#line 1455 "grammar.c"
-  yymsp[-3].minor.yy31 = yylhsminor.yy31;
+#line 1488 "grammar.c"
+  yymsp[-3].minor.yy127 = yylhsminor.yy127;
         break;
       case 9: /* singlePartQuery ::= orderClause skipClause limitClause setClause */
-#line 84 "grammar.y"
+#line 86 "grammar.y"
 {
-	yylhsminor.yy31 = AST_New(NULL, NULL, NULL, NULL, yymsp[0].minor.yy44, NULL, NULL, yymsp[-3].minor.yy196, yymsp[-2].minor.yy147, yymsp[-1].minor.yy39, NULL, NULL, NULL);
+	yylhsminor.yy127 = AST_New(NULL, NULL, NULL, NULL, yymsp[0].minor.yy206, NULL, NULL, yymsp[-3].minor.yy160, yymsp[-2].minor.yy105, yymsp[-1].minor.yy213, NULL, NULL, NULL);
 }
-#line 1463 "grammar.c"
-  yymsp[-3].minor.yy31 = yylhsminor.yy31;
+#line 1496 "grammar.c"
+  yymsp[-3].minor.yy127 = yylhsminor.yy127;
         break;
       case 10: /* singlePartQuery ::= orderClause skipClause limitClause deleteClause */
-#line 88 "grammar.y"
+#line 90 "grammar.y"
 {
-	yylhsminor.yy31 = AST_New(NULL, NULL, NULL, NULL, NULL, yymsp[0].minor.yy47, NULL, yymsp[-3].minor.yy196, yymsp[-2].minor.yy147, yymsp[-1].minor.yy39, NULL, NULL, NULL);
+	yylhsminor.yy127 = AST_New(NULL, NULL, NULL, NULL, NULL, yymsp[0].minor.yy179, NULL, yymsp[-3].minor.yy160, yymsp[-2].minor.yy105, yymsp[-1].minor.yy213, NULL, NULL, NULL);
 }
-#line 1471 "grammar.c"
-  yymsp[-3].minor.yy31 = yylhsminor.yy31;
+#line 1504 "grammar.c"
+  yymsp[-3].minor.yy127 = yylhsminor.yy127;
         break;
       case 11: /* expr ::= multipleMatchClause whereClause multipleCreateClause returnClause orderClause skipClause limitClause */
-#line 93 "grammar.y"
+#line 95 "grammar.y"
 {
-	yylhsminor.yy31 = AST_New(yymsp[-6].minor.yy173, yymsp[-5].minor.yy3, yymsp[-4].minor.yy4, NULL, NULL, NULL, yymsp[-3].minor.yy120, yymsp[-2].minor.yy196, yymsp[-1].minor.yy147, yymsp[0].minor.yy39, NULL, NULL, NULL);
+	yylhsminor.yy127 = AST_New(yymsp[-6].minor.yy17, yymsp[-5].minor.yy207, yymsp[-4].minor.yy178, NULL, NULL, NULL, yymsp[-3].minor.yy72, yymsp[-2].minor.yy160, yymsp[-1].minor.yy105, yymsp[0].minor.yy213, NULL, NULL, NULL);
 }
-#line 1479 "grammar.c"
-  yymsp[-6].minor.yy31 = yylhsminor.yy31;
+#line 1512 "grammar.c"
+  yymsp[-6].minor.yy127 = yylhsminor.yy127;
         break;
       case 12: /* expr ::= multipleMatchClause whereClause multipleCreateClause */
-#line 97 "grammar.y"
+#line 99 "grammar.y"
 {
-	yylhsminor.yy31 = AST_New(yymsp[-2].minor.yy173, yymsp[-1].minor.yy3, yymsp[0].minor.yy4, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+	yylhsminor.yy127 = AST_New(yymsp[-2].minor.yy17, yymsp[-1].minor.yy207, yymsp[0].minor.yy178, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
 }
-#line 1487 "grammar.c"
-  yymsp[-2].minor.yy31 = yylhsminor.yy31;
+#line 1520 "grammar.c"
+  yymsp[-2].minor.yy127 = yylhsminor.yy127;
         break;
       case 13: /* expr ::= multipleMatchClause whereClause deleteClause */
-#line 101 "grammar.y"
+#line 103 "grammar.y"
 {
-	yylhsminor.yy31 = AST_New(yymsp[-2].minor.yy173, yymsp[-1].minor.yy3, NULL, NULL, NULL, yymsp[0].minor.yy47, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+	yylhsminor.yy127 = AST_New(yymsp[-2].minor.yy17, yymsp[-1].minor.yy207, NULL, NULL, NULL, yymsp[0].minor.yy179, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
 }
-#line 1495 "grammar.c"
-  yymsp[-2].minor.yy31 = yylhsminor.yy31;
+#line 1528 "grammar.c"
+  yymsp[-2].minor.yy127 = yylhsminor.yy127;
         break;
       case 14: /* expr ::= multipleMatchClause whereClause setClause */
-#line 105 "grammar.y"
+#line 107 "grammar.y"
 {
-	yylhsminor.yy31 = AST_New(yymsp[-2].minor.yy173, yymsp[-1].minor.yy3, NULL, NULL, yymsp[0].minor.yy44, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+	yylhsminor.yy127 = AST_New(yymsp[-2].minor.yy17, yymsp[-1].minor.yy207, NULL, NULL, yymsp[0].minor.yy206, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
 }
-#line 1503 "grammar.c"
-  yymsp[-2].minor.yy31 = yylhsminor.yy31;
+#line 1536 "grammar.c"
+  yymsp[-2].minor.yy127 = yylhsminor.yy127;
         break;
       case 15: /* expr ::= multipleMatchClause whereClause setClause returnClause orderClause skipClause limitClause */
-#line 109 "grammar.y"
+#line 111 "grammar.y"
 {
-	yylhsminor.yy31 = AST_New(yymsp[-6].minor.yy173, yymsp[-5].minor.yy3, NULL, NULL, yymsp[-4].minor.yy44, NULL, yymsp[-3].minor.yy120, yymsp[-2].minor.yy196, yymsp[-1].minor.yy147, yymsp[0].minor.yy39, NULL, NULL, NULL);
+	yylhsminor.yy127 = AST_New(yymsp[-6].minor.yy17, yymsp[-5].minor.yy207, NULL, NULL, yymsp[-4].minor.yy206, NULL, yymsp[-3].minor.yy72, yymsp[-2].minor.yy160, yymsp[-1].minor.yy105, yymsp[0].minor.yy213, NULL, NULL, NULL);
 }
-#line 1511 "grammar.c"
-  yymsp[-6].minor.yy31 = yylhsminor.yy31;
+#line 1544 "grammar.c"
+  yymsp[-6].minor.yy127 = yylhsminor.yy127;
         break;
       case 16: /* expr ::= multipleCreateClause */
-#line 113 "grammar.y"
+#line 115 "grammar.y"
 {
-	yylhsminor.yy31 = AST_New(NULL, NULL, yymsp[0].minor.yy4, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+	yylhsminor.yy127 = AST_New(NULL, NULL, yymsp[0].minor.yy178, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
 }
-#line 1519 "grammar.c"
-  yymsp[0].minor.yy31 = yylhsminor.yy31;
+#line 1552 "grammar.c"
+  yymsp[0].minor.yy127 = yylhsminor.yy127;
         break;
       case 17: /* expr ::= unwindClause multipleCreateClause */
-#line 117 "grammar.y"
+#line 119 "grammar.y"
 {
-	yylhsminor.yy31 = AST_New(NULL, NULL, yymsp[0].minor.yy4, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, yymsp[-1].minor.yy97, NULL);
+	yylhsminor.yy127 = AST_New(NULL, NULL, yymsp[0].minor.yy178, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, yymsp[-1].minor.yy97, NULL);
 }
-#line 1527 "grammar.c"
-  yymsp[-1].minor.yy31 = yylhsminor.yy31;
+#line 1560 "grammar.c"
+  yymsp[-1].minor.yy127 = yylhsminor.yy127;
         break;
       case 18: /* expr ::= indexClause */
-#line 121 "grammar.y"
+#line 123 "grammar.y"
 {
-	yylhsminor.yy31 = AST_New(NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, yymsp[0].minor.yy169, NULL, NULL);
+	yylhsminor.yy127 = AST_New(NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, yymsp[0].minor.yy42, NULL, NULL);
 }
-#line 1535 "grammar.c"
-  yymsp[0].minor.yy31 = yylhsminor.yy31;
+#line 1568 "grammar.c"
+  yymsp[0].minor.yy127 = yylhsminor.yy127;
         break;
       case 19: /* expr ::= mergeClause */
-#line 125 "grammar.y"
+#line 127 "grammar.y"
 {
-	yylhsminor.yy31 = AST_New(NULL, NULL, NULL, yymsp[0].minor.yy164, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+	yylhsminor.yy127 = AST_New(NULL, NULL, NULL, yymsp[0].minor.yy212, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
 }
-#line 1543 "grammar.c"
-  yymsp[0].minor.yy31 = yylhsminor.yy31;
+#line 1576 "grammar.c"
+  yymsp[0].minor.yy127 = yylhsminor.yy127;
         break;
       case 20: /* expr ::= mergeClause setClause */
-#line 129 "grammar.y"
+#line 131 "grammar.y"
 {
-	yylhsminor.yy31 = AST_New(NULL, NULL, NULL, yymsp[-1].minor.yy164, yymsp[0].minor.yy44, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+	yylhsminor.yy127 = AST_New(NULL, NULL, NULL, yymsp[-1].minor.yy212, yymsp[0].minor.yy206, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
 }
-#line 1551 "grammar.c"
-  yymsp[-1].minor.yy31 = yylhsminor.yy31;
+#line 1584 "grammar.c"
+  yymsp[-1].minor.yy127 = yylhsminor.yy127;
         break;
       case 21: /* expr ::= returnClause */
-#line 133 "grammar.y"
+#line 135 "grammar.y"
 {
-	yylhsminor.yy31 = AST_New(NULL, NULL, NULL, NULL, NULL, NULL, yymsp[0].minor.yy120, NULL, NULL, NULL, NULL, NULL, NULL);
+	yylhsminor.yy127 = AST_New(NULL, NULL, NULL, NULL, NULL, NULL, yymsp[0].minor.yy72, NULL, NULL, NULL, NULL, NULL, NULL);
 }
-#line 1559 "grammar.c"
-  yymsp[0].minor.yy31 = yylhsminor.yy31;
+#line 1592 "grammar.c"
+  yymsp[0].minor.yy127 = yylhsminor.yy127;
         break;
       case 22: /* expr ::= unwindClause returnClause skipClause limitClause */
-#line 137 "grammar.y"
+#line 139 "grammar.y"
 {
-	yylhsminor.yy31 = AST_New(NULL, NULL, NULL, NULL, NULL, NULL, yymsp[-2].minor.yy120, NULL, yymsp[-1].minor.yy147, yymsp[0].minor.yy39, NULL, yymsp[-3].minor.yy97, NULL);
+	yylhsminor.yy127 = AST_New(NULL, NULL, NULL, NULL, NULL, NULL, yymsp[-2].minor.yy72, NULL, yymsp[-1].minor.yy105, yymsp[0].minor.yy213, NULL, yymsp[-3].minor.yy97, NULL);
 }
-#line 1567 "grammar.c"
-  yymsp[-3].minor.yy31 = yylhsminor.yy31;
+#line 1600 "grammar.c"
+  yymsp[-3].minor.yy127 = yylhsminor.yy127;
         break;
       case 23: /* expr ::= procedureCallClause */
-#line 143 "grammar.y"
+#line 145 "grammar.y"
 {
-	yylhsminor.yy31 = AST_New(NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, yymsp[0].minor.yy157);
+	yylhsminor.yy127 = AST_New(NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, yymsp[0].minor.yy187);
 }
-#line 1575 "grammar.c"
-  yymsp[0].minor.yy31 = yylhsminor.yy31;
+#line 1608 "grammar.c"
+  yymsp[0].minor.yy127 = yylhsminor.yy127;
         break;
       case 24: /* expr ::= procedureCallClause whereClause returnClause orderClause skipClause limitClause */
-#line 147 "grammar.y"
+#line 149 "grammar.y"
 {
-	yylhsminor.yy31 = AST_New(NULL, yymsp[-4].minor.yy3, NULL, NULL, NULL, NULL, yymsp[-3].minor.yy120, yymsp[-2].minor.yy196, yymsp[-1].minor.yy147, yymsp[0].minor.yy39, NULL, NULL, yymsp[-5].minor.yy157);
+	yylhsminor.yy127 = AST_New(NULL, yymsp[-4].minor.yy207, NULL, NULL, NULL, NULL, yymsp[-3].minor.yy72, yymsp[-2].minor.yy160, yymsp[-1].minor.yy105, yymsp[0].minor.yy213, NULL, NULL, yymsp[-5].minor.yy187);
 }
-#line 1583 "grammar.c"
-  yymsp[-5].minor.yy31 = yylhsminor.yy31;
+#line 1616 "grammar.c"
+  yymsp[-5].minor.yy127 = yylhsminor.yy127;
         break;
       case 25: /* expr ::= procedureCallClause multipleMatchClause whereClause returnClause orderClause skipClause limitClause */
-#line 151 "grammar.y"
+#line 153 "grammar.y"
 {
-	yylhsminor.yy31 = AST_New(yymsp[-5].minor.yy173, yymsp[-4].minor.yy3, NULL, NULL, NULL, NULL, yymsp[-3].minor.yy120, yymsp[-2].minor.yy196, yymsp[-1].minor.yy147, yymsp[0].minor.yy39, NULL, NULL, yymsp[-6].minor.yy157);
+	yylhsminor.yy127 = AST_New(yymsp[-5].minor.yy17, yymsp[-4].minor.yy207, NULL, NULL, NULL, NULL, yymsp[-3].minor.yy72, yymsp[-2].minor.yy160, yymsp[-1].minor.yy105, yymsp[0].minor.yy213, NULL, NULL, yymsp[-6].minor.yy187);
 }
-#line 1591 "grammar.c"
-  yymsp[-6].minor.yy31 = yylhsminor.yy31;
+#line 1624 "grammar.c"
+  yymsp[-6].minor.yy127 = yylhsminor.yy127;
         break;
       case 26: /* procedureCallClause ::= CALL procedureName LEFT_PARENTHESIS stringList RIGHT_PARENTHESIS YIELD unquotedStringList */
-#line 156 "grammar.y"
+#line 158 "grammar.y"
 {
-	yymsp[-6].minor.yy157 = New_AST_ProcedureCallNode(yymsp[-5].minor.yy129, yymsp[-3].minor.yy5, yymsp[0].minor.yy5);
+	yymsp[-6].minor.yy187 = New_AST_ProcedureCallNode(yymsp[-5].minor.yy214, yymsp[-3].minor.yy57, yymsp[0].minor.yy57);
 }
-#line 1599 "grammar.c"
+#line 1632 "grammar.c"
         break;
       case 27: /* procedureCallClause ::= CALL procedureName LEFT_PARENTHESIS stringList RIGHT_PARENTHESIS */
-#line 160 "grammar.y"
+#line 162 "grammar.y"
 {	
-	yymsp[-4].minor.yy157 = New_AST_ProcedureCallNode(yymsp[-3].minor.yy129, yymsp[-1].minor.yy5, NULL);
+	yymsp[-4].minor.yy187 = New_AST_ProcedureCallNode(yymsp[-3].minor.yy214, yymsp[-1].minor.yy57, NULL);
 }
-#line 1606 "grammar.c"
+#line 1639 "grammar.c"
         break;
       case 28: /* procedureName ::= unquotedStringList */
-#line 165 "grammar.y"
+#line 167 "grammar.y"
 {
 	// Concatenate strings with dots.
 	// Determine required string length.
 	int buffLen = 0;
-	for(int i = 0; i < array_len(yymsp[0].minor.yy5); i++) {
-		buffLen += strlen(yymsp[0].minor.yy5[i]) + 1;
+	for(int i = 0; i < array_len(yymsp[0].minor.yy57); i++) {
+		buffLen += strlen(yymsp[0].minor.yy57[i]) + 1;
 	}
 
 	int offset = 0;
 	char *procedure_name = malloc(buffLen);
-	for(int i = 0; i < array_len(yymsp[0].minor.yy5); i++) {
-		int n = strlen(yymsp[0].minor.yy5[i]);
-		memcpy(procedure_name + offset, yymsp[0].minor.yy5[i], n);
+	for(int i = 0; i < array_len(yymsp[0].minor.yy57); i++) {
+		int n = strlen(yymsp[0].minor.yy57[i]);
+		memcpy(procedure_name + offset, yymsp[0].minor.yy57[i], n);
 		offset += n;
 		procedure_name[offset] = '.';
 		offset++;
@@ -1627,795 +1660,882 @@ static void yy_reduce(
 	// Discard last dot and trerminate string.
 	offset--;
 	procedure_name[offset] = '\0';
-	yylhsminor.yy129 = procedure_name;
+	yylhsminor.yy214 = procedure_name;
 }
-#line 1633 "grammar.c"
-  yymsp[0].minor.yy129 = yylhsminor.yy129;
+#line 1666 "grammar.c"
+  yymsp[0].minor.yy214 = yylhsminor.yy214;
         break;
       case 29: /* stringList ::= */
-#line 190 "grammar.y"
+#line 192 "grammar.y"
 {
-	yymsp[1].minor.yy5 = array_new(char*, 0);
+	yymsp[1].minor.yy57 = array_new(char*, 0);
 }
-#line 1641 "grammar.c"
+#line 1674 "grammar.c"
         break;
       case 30: /* stringList ::= STRING */
       case 32: /* unquotedStringList ::= UQSTRING */ yytestcase(yyruleno==32);
-#line 194 "grammar.y"
+#line 196 "grammar.y"
 {
-	yylhsminor.yy5 = array_new(char*, 1);
-	yylhsminor.yy5 = array_append(yylhsminor.yy5, yymsp[0].minor.yy0.strval);
+	yylhsminor.yy57 = array_new(char*, 1);
+	yylhsminor.yy57 = array_append(yylhsminor.yy57, yymsp[0].minor.yy0.strval);
 }
-#line 1650 "grammar.c"
-  yymsp[0].minor.yy5 = yylhsminor.yy5;
+#line 1683 "grammar.c"
+  yymsp[0].minor.yy57 = yylhsminor.yy57;
         break;
       case 31: /* stringList ::= stringList delimiter STRING */
       case 33: /* unquotedStringList ::= unquotedStringList delimiter UQSTRING */ yytestcase(yyruleno==33);
-#line 200 "grammar.y"
+#line 202 "grammar.y"
 {
-	yymsp[-2].minor.yy5 = array_append(yymsp[-2].minor.yy5, yymsp[0].minor.yy0.strval);
-	yylhsminor.yy5 = yymsp[-2].minor.yy5;
+	yymsp[-2].minor.yy57 = array_append(yymsp[-2].minor.yy57, yymsp[0].minor.yy0.strval);
+	yylhsminor.yy57 = yymsp[-2].minor.yy57;
 }
-#line 1660 "grammar.c"
-  yymsp[-2].minor.yy5 = yylhsminor.yy5;
+#line 1693 "grammar.c"
+  yymsp[-2].minor.yy57 = yylhsminor.yy57;
         break;
       case 34: /* delimiter ::= COMMA */
-#line 218 "grammar.y"
-{ yymsp[0].minor.yy6 = COMMA; }
-#line 1666 "grammar.c"
+#line 220 "grammar.y"
+{ yymsp[0].minor.yy82 = COMMA; }
+#line 1699 "grammar.c"
         break;
       case 35: /* delimiter ::= DOT */
-#line 219 "grammar.y"
-{ yymsp[0].minor.yy6 = DOT; }
-#line 1671 "grammar.c"
+#line 221 "grammar.y"
+{ yymsp[0].minor.yy82 = DOT; }
+#line 1704 "grammar.c"
         break;
       case 36: /* multipleMatchClause ::= matchClauses */
-#line 222 "grammar.y"
+#line 224 "grammar.y"
 {
-	yylhsminor.yy173 = New_AST_MatchNode(yymsp[0].minor.yy210);
+	yylhsminor.yy17 = New_AST_MatchNode(yymsp[0].minor.yy114);
 }
-#line 1678 "grammar.c"
-  yymsp[0].minor.yy173 = yylhsminor.yy173;
+#line 1711 "grammar.c"
+  yymsp[0].minor.yy17 = yylhsminor.yy17;
         break;
       case 37: /* matchClauses ::= matchClause */
       case 42: /* createClauses ::= createClause */ yytestcase(yyruleno==42);
-#line 228 "grammar.y"
+#line 230 "grammar.y"
 {
-	yylhsminor.yy210 = yymsp[0].minor.yy210;
+	yylhsminor.yy114 = yymsp[0].minor.yy114;
 }
-#line 1687 "grammar.c"
-  yymsp[0].minor.yy210 = yylhsminor.yy210;
+#line 1720 "grammar.c"
+  yymsp[0].minor.yy114 = yylhsminor.yy114;
         break;
       case 38: /* matchClauses ::= matchClauses matchClause */
       case 43: /* createClauses ::= createClauses createClause */ yytestcase(yyruleno==43);
-#line 232 "grammar.y"
+#line 234 "grammar.y"
 {
 	Vector *v;
-	while(Vector_Pop(yymsp[0].minor.yy210, &v)) Vector_Push(yymsp[-1].minor.yy210, v);
-	Vector_Free(yymsp[0].minor.yy210);
-	yylhsminor.yy210 = yymsp[-1].minor.yy210;
+	while(Vector_Pop(yymsp[0].minor.yy114, &v)) Vector_Push(yymsp[-1].minor.yy114, v);
+	Vector_Free(yymsp[0].minor.yy114);
+	yylhsminor.yy114 = yymsp[-1].minor.yy114;
 }
-#line 1699 "grammar.c"
-  yymsp[-1].minor.yy210 = yylhsminor.yy210;
+#line 1732 "grammar.c"
+  yymsp[-1].minor.yy114 = yylhsminor.yy114;
         break;
       case 39: /* matchClause ::= MATCH chains */
       case 44: /* createClause ::= CREATE chains */ yytestcase(yyruleno==44);
-#line 241 "grammar.y"
+#line 243 "grammar.y"
 {
-	yymsp[-1].minor.yy210 = yymsp[0].minor.yy210;
+	yymsp[-1].minor.yy114 = yymsp[0].minor.yy114;
 }
-#line 1708 "grammar.c"
+#line 1741 "grammar.c"
         break;
       case 40: /* multipleCreateClause ::= */
-#line 246 "grammar.y"
+#line 248 "grammar.y"
 {
-	yymsp[1].minor.yy4 = NULL;
+	yymsp[1].minor.yy178 = NULL;
 }
-#line 1715 "grammar.c"
+#line 1748 "grammar.c"
         break;
       case 41: /* multipleCreateClause ::= createClauses */
-#line 250 "grammar.y"
+#line 252 "grammar.y"
 {
-	yylhsminor.yy4 = New_AST_CreateNode(yymsp[0].minor.yy210);
+	yylhsminor.yy178 = New_AST_CreateNode(yymsp[0].minor.yy114);
 }
-#line 1722 "grammar.c"
-  yymsp[0].minor.yy4 = yylhsminor.yy4;
+#line 1755 "grammar.c"
+  yymsp[0].minor.yy178 = yylhsminor.yy178;
         break;
       case 45: /* indexClause ::= indexOpToken INDEX ON indexLabel indexProp */
-#line 276 "grammar.y"
+#line 278 "grammar.y"
 {
-  yylhsminor.yy169 = New_AST_IndexNode(yymsp[-1].minor.yy0.strval, yymsp[0].minor.yy0.strval, yymsp[-4].minor.yy177);
+  yylhsminor.yy42 = New_AST_IndexNode(yymsp[-1].minor.yy0.strval, yymsp[0].minor.yy0.strval, yymsp[-4].minor.yy63);
 }
-#line 1730 "grammar.c"
-  yymsp[-4].minor.yy169 = yylhsminor.yy169;
+#line 1763 "grammar.c"
+  yymsp[-4].minor.yy42 = yylhsminor.yy42;
         break;
       case 46: /* indexOpToken ::= CREATE */
-#line 282 "grammar.y"
-{ yymsp[0].minor.yy177 = CREATE_INDEX; }
-#line 1736 "grammar.c"
+#line 284 "grammar.y"
+{ yymsp[0].minor.yy63 = CREATE_INDEX; }
+#line 1769 "grammar.c"
         break;
       case 47: /* indexOpToken ::= DROP */
-#line 283 "grammar.y"
-{ yymsp[0].minor.yy177 = DROP_INDEX; }
-#line 1741 "grammar.c"
+#line 285 "grammar.y"
+{ yymsp[0].minor.yy63 = DROP_INDEX; }
+#line 1774 "grammar.c"
         break;
       case 48: /* indexLabel ::= COLON UQSTRING */
-#line 285 "grammar.y"
+#line 287 "grammar.y"
 {
   yymsp[-1].minor.yy0 = yymsp[0].minor.yy0;
 }
-#line 1748 "grammar.c"
+#line 1781 "grammar.c"
         break;
       case 49: /* indexProp ::= LEFT_PARENTHESIS UQSTRING RIGHT_PARENTHESIS */
-#line 289 "grammar.y"
+#line 291 "grammar.y"
 {
   yymsp[-2].minor.yy0 = yymsp[-1].minor.yy0;
 }
-#line 1755 "grammar.c"
+#line 1788 "grammar.c"
         break;
       case 50: /* mergeClause ::= MERGE chain */
-#line 295 "grammar.y"
+#line 297 "grammar.y"
 {
-	yymsp[-1].minor.yy164 = New_AST_MergeNode(yymsp[0].minor.yy210);
+	yymsp[-1].minor.yy212 = New_AST_MergeNode(yymsp[0].minor.yy114);
 }
-#line 1762 "grammar.c"
+#line 1795 "grammar.c"
         break;
       case 51: /* setClause ::= SET setList */
-#line 300 "grammar.y"
+#line 302 "grammar.y"
 {
-	yymsp[-1].minor.yy44 = New_AST_SetNode(yymsp[0].minor.yy210);
+	yymsp[-1].minor.yy206 = New_AST_SetNode(yymsp[0].minor.yy114);
 }
-#line 1769 "grammar.c"
+#line 1802 "grammar.c"
         break;
       case 52: /* setList ::= setElement */
-#line 305 "grammar.y"
+#line 307 "grammar.y"
 {
-	yylhsminor.yy210 = NewVector(AST_SetElement*, 1);
-	Vector_Push(yylhsminor.yy210, yymsp[0].minor.yy170);
+	yylhsminor.yy114 = NewVector(AST_SetElement*, 1);
+	Vector_Push(yylhsminor.yy114, yymsp[0].minor.yy216);
 }
-#line 1777 "grammar.c"
-  yymsp[0].minor.yy210 = yylhsminor.yy210;
+#line 1810 "grammar.c"
+  yymsp[0].minor.yy114 = yylhsminor.yy114;
         break;
       case 53: /* setList ::= setList COMMA setElement */
-#line 309 "grammar.y"
+#line 311 "grammar.y"
 {
-	Vector_Push(yymsp[-2].minor.yy210, yymsp[0].minor.yy170);
-	yylhsminor.yy210 = yymsp[-2].minor.yy210;
+	Vector_Push(yymsp[-2].minor.yy114, yymsp[0].minor.yy216);
+	yylhsminor.yy114 = yymsp[-2].minor.yy114;
 }
-#line 1786 "grammar.c"
-  yymsp[-2].minor.yy210 = yylhsminor.yy210;
+#line 1819 "grammar.c"
+  yymsp[-2].minor.yy114 = yylhsminor.yy114;
         break;
       case 54: /* setElement ::= variable EQ arithmetic_expression */
-#line 315 "grammar.y"
+#line 317 "grammar.y"
 {
-	yylhsminor.yy170 = New_AST_SetElement(yymsp[-2].minor.yy156, yymsp[0].minor.yy154);
+	yylhsminor.yy216 = New_AST_SetElement(yymsp[-2].minor.yy150, yymsp[0].minor.yy190);
 }
-#line 1794 "grammar.c"
-  yymsp[-2].minor.yy170 = yylhsminor.yy170;
+#line 1827 "grammar.c"
+  yymsp[-2].minor.yy216 = yylhsminor.yy216;
         break;
       case 55: /* chain ::= node */
-#line 321 "grammar.y"
+#line 323 "grammar.y"
 {
-	yylhsminor.yy210 = NewVector(AST_GraphEntity*, 1);
-	Vector_Push(yylhsminor.yy210, yymsp[0].minor.yy117);
+	yylhsminor.yy114 = NewVector(AST_GraphEntity*, 1);
+	Vector_Push(yylhsminor.yy114, yymsp[0].minor.yy21);
 }
-#line 1803 "grammar.c"
-  yymsp[0].minor.yy210 = yylhsminor.yy210;
+#line 1836 "grammar.c"
+  yymsp[0].minor.yy114 = yylhsminor.yy114;
         break;
       case 56: /* chain ::= chain link node */
-#line 326 "grammar.y"
+#line 328 "grammar.y"
 {
-	Vector_Push(yymsp[-2].minor.yy210, yymsp[-1].minor.yy69);
-	Vector_Push(yymsp[-2].minor.yy210, yymsp[0].minor.yy117);
-	yylhsminor.yy210 = yymsp[-2].minor.yy210;
+	Vector_Push(yymsp[-2].minor.yy114, yymsp[-1].minor.yy117);
+	Vector_Push(yymsp[-2].minor.yy114, yymsp[0].minor.yy21);
+	yylhsminor.yy114 = yymsp[-2].minor.yy114;
 }
-#line 1813 "grammar.c"
-  yymsp[-2].minor.yy210 = yylhsminor.yy210;
+#line 1846 "grammar.c"
+  yymsp[-2].minor.yy114 = yylhsminor.yy114;
         break;
       case 57: /* chains ::= chain */
-#line 334 "grammar.y"
+      case 59: /* chains ::= shortestPath */ yytestcase(yyruleno==59);
+#line 336 "grammar.y"
 {
-	yylhsminor.yy210 = NewVector(Vector*, 1);
-	Vector_Push(yylhsminor.yy210, yymsp[0].minor.yy210);
+	yylhsminor.yy114 = NewVector(Vector*, 1);
+	Vector_Push(yylhsminor.yy114, yymsp[0].minor.yy114);
 }
-#line 1822 "grammar.c"
-  yymsp[0].minor.yy210 = yylhsminor.yy210;
+#line 1856 "grammar.c"
+  yymsp[0].minor.yy114 = yylhsminor.yy114;
         break;
       case 58: /* chains ::= chains COMMA chain */
-#line 339 "grammar.y"
+      case 60: /* chains ::= chains COMMA shortestPath */ yytestcase(yyruleno==60);
+#line 341 "grammar.y"
+{
+	Vector_Push(yymsp[-2].minor.yy114, yymsp[0].minor.yy114);
+	yylhsminor.yy114 = yymsp[-2].minor.yy114;
+}
+#line 1866 "grammar.c"
+  yymsp[-2].minor.yy114 = yylhsminor.yy114;
+        break;
+      case 61: /* shortestPath ::= UQSTRING LEFT_PARENTHESIS chain RIGHT_PARENTHESIS */
+#line 359 "grammar.y"
 {
-	Vector_Push(yymsp[-2].minor.yy210, yymsp[0].minor.yy210);
-	yylhsminor.yy210 = yymsp[-2].minor.yy210;
+	AST_ShortestPathType type = N_SHORTEST_PATH_NONE;
+	if(strcasecmp(yymsp[-3].minor.yy0.strval, "shortestPath") == 0) type = N_SHORTEST_PATH_SINGLE;
+	else if(strcasecmp(yymsp[-3].minor.yy0.strval, "allShortestPaths") == 0) type = N_SHORTEST_PATH_ALL;
+
+	char buf[256];
+	buf[0] = '\0';
+	if(type == N_SHORTEST_PATH_NONE) {
+		snprintf(buf, 256, "Unknown pattern function '%s' at offset %d", yymsp[-3].minor.yy0.strval, yymsp[-3].minor.yy0.pos);
+	} else if(Vector_Size(yymsp[-1].minor.yy114) != 3) {
+		snprintf(buf, 256, "%s requires a pattern with a single relationship", yymsp[-3].minor.yy0.strval);
+	} else {
+		AST_LinkEntity *link;
+		Vector_Get(yymsp[-1].minor.yy114, 1, &link);
+		link->shortestPath = type;
+	}
+
+	if(buf[0] != '\0' && ctx->ok) {
+		ctx->ok = 0;
+		ctx->errorMsg = strdup(buf);
+	}
+	free(yymsp[-3].minor.yy0.strval);
+	yylhsminor.yy114 = yymsp[-1].minor.yy114;
 }
-#line 1831 "grammar.c"
-  yymsp[-2].minor.yy210 = yylhsminor.yy210;
+#line 1895 "grammar.c"
+  yymsp[-3].minor.yy114 = yylhsminor.yy114;
         break;
-      case 59: /* deleteClause ::= DELETE deleteExpression */
-#line 347 "grammar.y"
+      case 62: /* deleteClause ::= DELETE deleteExpression */
+#line 387 "grammar.y"
 {
-	yymsp[-1].minor.yy47 = New_AST_DeleteNode(yymsp[0].minor.yy210);
+	yymsp[-1].minor.yy179 = New_AST_DeleteNode(yymsp[0].minor.yy114);
 }
-#line 1839 "grammar.c"
+#line 1903 "grammar.c"
         break;
-      case 60: /* deleteExpression ::= UQSTRING */
-#line 353 "grammar.y"
+      case 63: /* deleteExpression ::= UQSTRING */
+#line 393 "grammar.y"
 {
-	yylhsminor.yy210 = NewVector(char*, 1);
-	Vector_Push(yylhsminor.yy210, yymsp[0].minor.yy0.strval);
+	yylhsminor.yy114 = NewVector(char*, 1);
+	Vector_Push(yylhsminor.yy114, yymsp[0].minor.yy0.strval);
 }
-#line 1847 "grammar.c"
-  yymsp[0].minor.yy210 = yylhsminor.yy210;
+#line 1911 "grammar.c"
+  yymsp[0].minor.yy114 = yylhsminor.yy114;
         break;
-      case 61: /* deleteExpression ::= deleteExpression COMMA UQSTRING */
-#line 358 "grammar.y"
+      case 64: /* deleteExpression ::= deleteExpression COMMA UQSTRING */
+#line 398 "grammar.y"
 {
-	Vector_Push(yymsp[-2].minor.yy210, yymsp[0].minor.yy0.strval);
-	yylhsminor.yy210 = yymsp[-2].minor.yy210;
+	Vector_Push(yymsp[-2].minor.yy114, yymsp[0].minor.yy0.strval);
+	yylhsminor.yy114 = yymsp[-2].minor.yy114;
 }
-#line 1856 "grammar.c"
-  yymsp[-2].minor.yy210 = yylhsminor.yy210;
+#line 1920 "grammar.c"
+  yymsp[-2].minor.yy114 = yylhsminor.yy114;
+        break;
+      case 65: /* node ::= LEFT_PARENTHESIS UQSTRING COLON UQSTRING properties RIGHT_PARENTHESIS */
+#line 406 "grammar.y"
+{
+	yymsp[-5].minor.yy21 = New_AST_NodeEntity(yymsp[-4].minor.yy0.strval, yymsp[-2].minor.yy0.strval, yymsp[-1].minor.yy114);
+}
+#line 1928 "grammar.c"
         break;
-      case 62: /* node ::= LEFT_PARENTHESIS UQSTRING COLON UQSTRING properties RIGHT_PARENTHESIS */
-#line 366 "grammar.y"
+      case 66: /* node ::= LEFT_PARENTHESIS COLON UQSTRING properties RIGHT_PARENTHESIS */
+#line 411 "grammar.y"
 {
-	yymsp[-5].minor.yy117 = New_AST_NodeEntity(yymsp[-4].minor.yy0.strval, yymsp[-2].minor.yy0.strval, yymsp[-1].minor.yy210);
+	yymsp[-4].minor.yy21 = New_AST_NodeEntity(NULL, yymsp[-2].minor.yy0.strval, yymsp[-1].minor.yy114);
 }
-#line 1864 "grammar.c"
+#line 1935 "grammar.c"
         break;
-      case 63: /* node ::= LEFT_PARENTHESIS COLON UQSTRING properties RIGHT_PARENTHESIS */
-#line 371 "grammar.y"
+      case 67: /* node ::= LEFT_PARENTHESIS UQSTRING properties RIGHT_PARENTHESIS */
+#line 416 "grammar.y"
 {
-	yymsp[-4].minor.yy117 = New_AST_NodeEntity(NULL, yymsp[-2].minor.yy0.strval, yymsp[-1].minor.yy210);
+	yymsp[-3].minor.yy21 = New_AST_NodeEntity(yymsp[-2].minor.yy0.strval, NULL, yymsp[-1].minor.yy114);
 }
-#line 1871 "grammar.c"
+#line 1942 "grammar.c"
         break;
-      case 64: /* node ::= LEFT_PARENTHESIS UQSTRING properties RIGHT_PARENTHESIS */
-#line 376 "grammar.y"
+      case 68: /* node ::= LEFT_PARENTHESIS properties RIGHT_PARENTHESIS */
+#line 421 "grammar.y"
 {
-	yymsp[-3].minor.yy117 = New_AST_NodeEntity(yymsp[-2].minor.yy0.strval, NULL, yymsp[-1].minor.yy210);
+	yymsp[-2].minor.yy21 = New_AST_NodeEntity(NULL, NULL, yymsp[-1].minor.yy114);
 }
-#line 1878 "grammar.c"
+#line 1949 "grammar.c"
         break;
-      case 65: /* node ::= LEFT_PARENTHESIS properties RIGHT_PARENTHESIS */
-#line 381 "grammar.y"
+      case 69: /* link ::= DASH edge RIGHT_ARROW */
+#line 428 "grammar.y"
 {
-	yymsp[-2].minor.yy117 = New_AST_NodeEntity(NULL, NULL, yymsp[-1].minor.yy210);
+	yymsp[-2].minor.yy117 = yymsp[-1].minor.yy117;
+	yymsp[-2].minor.yy117->direction = N_LEFT_TO_RIGHT;
 }
-#line 1885 "grammar.c"
+#line 1957 "grammar.c"
         break;
-      case 66: /* link ::= DASH edge RIGHT_ARROW */
-#line 388 "grammar.y"
+      case 70: /* link ::= LEFT_ARROW edge DASH */
+#line 434 "grammar.y"
 {
-	yymsp[-2].minor.yy69 = yymsp[-1].minor.yy69;
-	yymsp[-2].minor.yy69->direction = N_LEFT_TO_RIGHT;
+	yymsp[-2].minor.yy117 = yymsp[-1].minor.yy117;
+	yymsp[-2].minor.yy117->direction = N_RIGHT_TO_LEFT;
 }
-#line 1893 "grammar.c"
+#line 1965 "grammar.c"
         break;
-      case 67: /* link ::= LEFT_ARROW edge DASH */
-#line 394 "grammar.y"
+      case 71: /* link ::= DASH edge DASH */
+#line 440 "grammar.y"
 {
-	yymsp[-2].minor.yy69 = yymsp[-1].minor.yy69;
-	yymsp[-2].minor.yy69->direction = N_RIGHT_TO_LEFT;
+	yymsp[-2].minor.yy117 = yymsp[-1].minor.yy117;
+	yymsp[-2].minor.yy117->direction = N_DIR_UNKNOWN;
 }
-#line 1901 "grammar.c"
+#line 1973 "grammar.c"
         break;
-      case 68: /* edge ::= LEFT_BRACKET properties edgeLength RIGHT_BRACKET */
-#line 401 "grammar.y"
+      case 72: /* edge ::= LEFT_BRACKET properties edgeLength RIGHT_BRACKET */
+#line 447 "grammar.y"
 { 
-	yymsp[-3].minor.yy69 = New_AST_LinkEntity(NULL, NULL, yymsp[-2].minor.yy210, N_DIR_UNKNOWN, yymsp[-1].minor.yy138);
+	yymsp[-3].minor.yy117 = New_AST_LinkEntity(NULL, NULL, yymsp[-2].minor.yy114, N_DIR_UNKNOWN, yymsp[-1].minor.yy192);
 }
-#line 1908 "grammar.c"
+#line 1980 "grammar.c"
         break;
-      case 69: /* edge ::= LEFT_BRACKET UQSTRING properties RIGHT_BRACKET */
-#line 406 "grammar.y"
+      case 73: /* edge ::= LEFT_BRACKET UQSTRING properties RIGHT_BRACKET */
+#line 452 "grammar.y"
 { 
-	yymsp[-3].minor.yy69 = New_AST_LinkEntity(yymsp[-2].minor.yy0.strval, NULL, yymsp[-1].minor.yy210, N_DIR_UNKNOWN, NULL);
+	yymsp[-3].minor.yy117 = New_AST_LinkEntity(yymsp[-2].minor.yy0.strval, NULL, yymsp[-1].minor.yy114, N_DIR_UNKNOWN, NULL);
 }
-#line 1915 "grammar.c"
+#line 1987 "grammar.c"
         break;
-      case 70: /* edge ::= LEFT_BRACKET edgeLabels edgeLength properties RIGHT_BRACKET */
-#line 411 "grammar.y"
+      case 74: /* edge ::= LEFT_BRACKET edgeLabels edgeLength properties RIGHT_BRACKET */
+#line 457 "grammar.y"
 { 
-	yymsp[-4].minor.yy69 = New_AST_LinkEntity(NULL, yymsp[-3].minor.yy5, yymsp[-1].minor.yy210, N_DIR_UNKNOWN, yymsp[-2].minor.yy138);
+	yymsp[-4].minor.yy117 = New_AST_LinkEntity(NULL, yymsp[-3].minor.yy57, yymsp[-1].minor.yy114, N_DIR_UNKNOWN, yymsp[-2].minor.yy192);
 }
-#line 1922 "grammar.c"
+#line 1994 "grammar.c"
         break;
-      case 71: /* edge ::= LEFT_BRACKET UQSTRING edgeLabels properties RIGHT_BRACKET */
-#line 416 "grammar.y"
+      case 75: /* edge ::= LEFT_BRACKET UQSTRING edgeLabels properties RIGHT_BRACKET */
+#line 462 "grammar.y"
 { 
-	yymsp[-4].minor.yy69 = New_AST_LinkEntity(yymsp[-3].minor.yy0.strval, yymsp[-2].minor.yy5, yymsp[-1].minor.yy210, N_DIR_UNKNOWN, NULL);
+	yymsp[-4].minor.yy117 = New_AST_LinkEntity(yymsp[-3].minor.yy0.strval, yymsp[-2].minor.yy57, yymsp[-1].minor.yy114, N_DIR_UNKNOWN, NULL);
 }
-#line 1929 "grammar.c"
+#line 2001 "grammar.c"
         break;
-      case 72: /* edgeLabel ::= COLON UQSTRING */
-#line 423 "grammar.y"
+      case 76: /* edgeLabel ::= COLON UQSTRING */
+#line 469 "grammar.y"
 {
-	yymsp[-1].minor.yy129 = yymsp[0].minor.yy0.strval;
+	yymsp[-1].minor.yy214 = yymsp[0].minor.yy0.strval;
 }
-#line 1936 "grammar.c"
+#line 2008 "grammar.c"
         break;
-      case 73: /* edgeLabels ::= edgeLabel */
-#line 428 "grammar.y"
+      case 77: /* edgeLabels ::= edgeLabel */
+#line 474 "grammar.y"
 {
-	yylhsminor.yy5 = array_new(char*, 1);
-	yylhsminor.yy5 = array_append(yylhsminor.yy5, yymsp[0].minor.yy129);
+	yylhsminor.yy57 = array_new(char*, 1);
+	yylhsminor.yy57 = array_append(yylhsminor.yy57, yymsp[0].minor.yy214);
 }
-#line 1944 "grammar.c"
-  yymsp[0].minor.yy5 = yylhsminor.yy5;
+#line 2016 "grammar.c"
+  yymsp[0].minor.yy57 = yylhsminor.yy57;
         break;
-      case 74: /* edgeLabels ::= edgeLabels PIPE edgeLabel */
-#line 434 "grammar.y"
+      case 78: /* edgeLabels ::= edgeLabels PIPE edgeLabel */
+#line 480 "grammar.y"
 {
-	char *label = yymsp[0].minor.yy129;
-	yymsp[-2].minor.yy5 = array_append(yymsp[-2].minor.yy5, label);
-	yylhsminor.yy5 = yymsp[-2].minor.yy5;
+	char *label = yymsp[0].minor.yy214;
+	yymsp[-2].minor.yy57 = array_append(yymsp[-2].minor.yy57, label);
+	yylhsminor.yy57 = yymsp[-2].minor.yy57;
 }
-#line 1954 "grammar.c"
-  yymsp[-2].minor.yy5 = yylhsminor.yy5;
+#line 2026 "grammar.c"
+  yymsp[-2].minor.yy57 = yylhsminor.yy57;
         break;
-      case 75: /* edgeLength ::= */
-#line 443 "grammar.y"
+      case 79: /* edgeLength ::= */
+#line 489 "grammar.y"
 {
-	yymsp[1].minor.yy138 = NULL;
+	yymsp[1].minor.yy192 = NULL;
 }
-#line 1962 "grammar.c"
+#line 2034 "grammar.c"
         break;
-      case 76: /* edgeLength ::= MUL INTEGER DOTDOT INTEGER */
-#line 448 "grammar.y"
+      case 80: /* edgeLength ::= MUL INTEGER DOTDOT INTEGER */
+#line 494 "grammar.y"
 {
-	yymsp[-3].minor.yy138 = New_AST_LinkLength(yymsp[-2].minor.yy0.longval, yymsp[0].minor.yy0.longval);
+	yymsp[-3].minor.yy192 = New_AST_LinkLength(yymsp[-2].minor.yy0.longval, yymsp[0].minor.yy0.longval);
 }
-#line 1969 "grammar.c"
+#line 2041 "grammar.c"
         break;
-      case 77: /* edgeLength ::= MUL INTEGER DOTDOT */
-#line 453 "grammar.y"
+      case 81: /* edgeLength ::= MUL INTEGER DOTDOT */
+#line 499 "grammar.y"
 {
-	yymsp[-2].minor.yy138 = New_AST_LinkLength(yymsp[-1].minor.yy0.longval, UINT_MAX-2);
+	yymsp[-2].minor.yy192 = New_AST_LinkLength(yymsp[-1].minor.yy0.longval, UINT_MAX-2);
 }
-#line 1976 "grammar.c"
+#line 2048 "grammar.c"
         break;
-      case 78: /* edgeLength ::= MUL DOTDOT INTEGER */
-#line 458 "grammar.y"
+      case 82: /* edgeLength ::= MUL DOTDOT INTEGER */
+#line 504 "grammar.y"
 {
-	yymsp[-2].minor.yy138 = New_AST_LinkLength(1, yymsp[0].minor.yy0.longval);
+	yymsp[-2].minor.yy192 = New_AST_LinkLength(1, yymsp[0].minor.yy0.longval);
 }
-#line 1983 "grammar.c"
+#line 2055 "grammar.c"
         break;
-      case 79: /* edgeLength ::= MUL INTEGER */
-#line 463 "grammar.y"
+      case 83: /* edgeLength ::= MUL INTEGER */
+#line 509 "grammar.y"
 {
-	yymsp[-1].minor.yy138 = New_AST_LinkLength(yymsp[0].minor.yy0.longval, yymsp[0].minor.yy0.longval);
+	yymsp[-1].minor.yy192 = New_AST_LinkLength(yymsp[0].minor.yy0.longval, yymsp[0].minor.yy0.longval);
 }
-#line 1990 "grammar.c"
+#line 2062 "grammar.c"
         break;
-      case 80: /* edgeLength ::= MUL */
-#line 468 "grammar.y"
+      case 84: /* edgeLength ::= MUL */
+#line 514 "grammar.y"
 {
-	yymsp[0].minor.yy138 = New_AST_LinkLength(1, UINT_MAX-2);
+	yymsp[0].minor.yy192 = New_AST_LinkLength(1, UINT_MAX-2);
 }
-#line 1997 "grammar.c"
+#line 2069 "grammar.c"
         break;
-      case 81: /* properties ::= */
-#line 474 "grammar.y"
+      case 85: /* properties ::= */
+#line 520 "grammar.y"
 {
-	yymsp[1].minor.yy210 = NULL;
+	yymsp[1].minor.yy114 = NULL;
 }
-#line 2004 "grammar.c"
+#line 2076 "grammar.c"
         break;
-      case 82: /* properties ::= LEFT_CURLY_BRACKET mapLiteral RIGHT_CURLY_BRACKET */
-#line 478 "grammar.y"
+      case 86: /* properties ::= LEFT_CURLY_BRACKET mapLiteral RIGHT_CURLY_BRACKET */
+#line 524 "grammar.y"
 {
-	yymsp[-2].minor.yy210 = yymsp[-1].minor.yy210;
+	yymsp[-2].minor.yy114 = yymsp[-1].minor.yy114;
 }
-#line 2011 "grammar.c"
+#line 2083 "grammar.c"
         break;
-      case 83: /* mapLiteral ::= UQSTRING COLON value */
-#line 484 "grammar.y"
+      case 87: /* mapLiteral ::= UQSTRING COLON mapValue */
+#line 530 "grammar.y"
 {
-	yylhsminor.yy210 = NewVector(SIValue*, 2);
+	yylhsminor.yy114 = NewVector(SIValue*, 2);
 
 	SIValue *key = malloc(sizeof(SIValue));
 	*key = SI_ConstStringVal(yymsp[-2].minor.yy0.strval);
-	Vector_Push(yylhsminor.yy210, key);
+	Vector_Push(yylhsminor.yy114, key);
 
-	SIValue *val = malloc(sizeof(SIValue));
-	*val = yymsp[0].minor.yy150;
-	Vector_Push(yylhsminor.yy210, val);
+	Vector_Push(yylhsminor.yy114, yymsp[0].minor.yy36);
 }
-#line 2026 "grammar.c"
-  yymsp[-2].minor.yy210 = yylhsminor.yy210;
+#line 2096 "grammar.c"
+  yymsp[-2].minor.yy114 = yylhsminor.yy114;
         break;
-      case 84: /* mapLiteral ::= UQSTRING COLON value COMMA mapLiteral */
-#line 496 "grammar.y"
+      case 88: /* mapLiteral ::= UQSTRING COLON mapValue COMMA mapLiteral */
+#line 540 "grammar.y"
 {
 	SIValue *key = malloc(sizeof(SIValue));
 	*key = SI_ConstStringVal(yymsp[-4].minor.yy0.strval);
-	Vector_Push(yymsp[0].minor.yy210, key);
+	Vector_Push(yymsp[0].minor.yy114, key);
 
-	SIValue *val = malloc(sizeof(SIValue));
-	*val = yymsp[-2].minor.yy150;
-	Vector_Push(yymsp[0].minor.yy210, val);
+	Vector_Push(yymsp[0].minor.yy114, yymsp[-2].minor.yy36);
 	
-	yylhsminor.yy210 = yymsp[0].minor.yy210;
+	yylhsminor.yy114 = yymsp[0].minor.yy114;
 }
-#line 2042 "grammar.c"
-  yymsp[-4].minor.yy210 = yylhsminor.yy210;
+#line 2110 "grammar.c"
+  yymsp[-4].minor.yy114 = yylhsminor.yy114;
         break;
-      case 85: /* whereClause ::= */
-#line 510 "grammar.y"
+      case 89: /* mapValue ::= value */
+#line 551 "grammar.y"
+{
+	yylhsminor.yy36 = malloc(sizeof(SIValue));
+	*yylhsminor.yy36 = yymsp[0].minor.yy12;
+}
+#line 2119 "grammar.c"
+  yymsp[0].minor.yy36 = yylhsminor.yy36;
+        break;
+      case 90: /* mapValue ::= DOLLAR UQSTRING */
+#line 557 "grammar.y"
+{
+	yymsp[-1].minor.yy36 = malloc(sizeof(SIValue));
+	*yymsp[-1].minor.yy36 = SI_NullVal();
+	AST_Params_AddMapValue(ctx->params, yymsp[-1].minor.yy36, yymsp[0].minor.yy0.strval);
+	free(yymsp[0].minor.yy0.strval);
+}
+#line 2130 "grammar.c"
+        break;
+      case 91: /* whereClause ::= */
+#line 566 "grammar.y"
 { 
-	yymsp[1].minor.yy3 = NULL;
+	yymsp[1].minor.yy207 = NULL;
 }
-#line 2050 "grammar.c"
+#line 2137 "grammar.c"
         break;
-      case 86: /* whereClause ::= WHERE cond */
-#line 513 "grammar.y"
+      case 92: /* whereClause ::= WHERE cond */
+#line 569 "grammar.y"
 {
-	yymsp[-1].minor.yy3 = New_AST_WhereNode(yymsp[0].minor.yy10);
+	yymsp[-1].minor.yy207 = New_AST_WhereNode(yymsp[0].minor.yy28);
 }
-#line 2057 "grammar.c"
+#line 2144 "grammar.c"
         break;
-      case 87: /* cond ::= arithmetic_expression relation arithmetic_expression */
-#line 522 "grammar.y"
-{ yylhsminor.yy10 = New_AST_PredicateNode(yymsp[-2].minor.yy154, yymsp[-1].minor.yy6, yymsp[0].minor.yy154); }
-#line 2062 "grammar.c"
-  yymsp[-2].minor.yy10 = yylhsminor.yy10;
+      case 93: /* cond ::= arithmetic_expression relation arithmetic_expression */
+#line 578 "grammar.y"
+{ yylhsminor.yy28 = New_AST_PredicateNode(yymsp[-2].minor.yy190, yymsp[-1].minor.yy82, yymsp[0].minor.yy190); }
+#line 2149 "grammar.c"
+  yymsp[-2].minor.yy28 = yylhsminor.yy28;
         break;
-      case 88: /* cond ::= LEFT_PARENTHESIS cond RIGHT_PARENTHESIS */
-#line 524 "grammar.y"
-{ yymsp[-2].minor.yy10 = yymsp[-1].minor.yy10; }
-#line 2068 "grammar.c"
-        break;
-      case 89: /* cond ::= cond AND cond */
-#line 525 "grammar.y"
-{ yylhsminor.yy10 = New_AST_ConditionNode(yymsp[-2].minor.yy10, AND, yymsp[0].minor.yy10); }
-#line 2073 "grammar.c"
-  yymsp[-2].minor.yy10 = yylhsminor.yy10;
-        break;
-      case 90: /* cond ::= cond OR cond */
-#line 526 "grammar.y"
-{ yylhsminor.yy10 = New_AST_ConditionNode(yymsp[-2].minor.yy10, OR, yymsp[0].minor.yy10); }
-#line 2079 "grammar.c"
-  yymsp[-2].minor.yy10 = yylhsminor.yy10;
-        break;
-      case 91: /* returnClause ::= RETURN returnElements */
-#line 530 "grammar.y"
+      case 94: /* cond ::= LEFT_PARENTHESIS cond RIGHT_PARENTHESIS */
+#line 580 "grammar.y"
+{ yymsp[-2].minor.yy28 = yymsp[-1].minor.yy28; }
+#line 2155 "grammar.c"
+        break;
+      case 95: /* cond ::= cond AND cond */
+#line 581 "grammar.y"
+{ yylhsminor.yy28 = New_AST_ConditionNode(yymsp[-2].minor.yy28, AND, yymsp[0].minor.yy28); }
+#line 2160 "grammar.c"
+  yymsp[-2].minor.yy28 = yylhsminor.yy28;
+        break;
+      case 96: /* cond ::= cond OR cond */
+#line 582 "grammar.y"
+{ yylhsminor.yy28 = New_AST_ConditionNode(yymsp[-2].minor.yy28, OR, yymsp[0].minor.yy28); }
+#line 2166 "grammar.c"
+  yymsp[-2].minor.yy28 = yylhsminor.yy28;
+        break;
+      case 97: /* returnClause ::= RETURN returnElements */
+#line 586 "grammar.y"
 {
-	yymsp[-1].minor.yy120 = New_AST_ReturnNode(yymsp[0].minor.yy122, 0);
+	yymsp[-1].minor.yy72 = New_AST_ReturnNode(yymsp[0].minor.yy37, 0);
 }
-#line 2087 "grammar.c"
+#line 2174 "grammar.c"
         break;
-      case 92: /* returnClause ::= RETURN DISTINCT returnElements */
-#line 533 "grammar.y"
+      case 98: /* returnClause ::= RETURN DISTINCT returnElements */
+#line 589 "grammar.y"
 {
-	yymsp[-2].minor.yy120 = New_AST_ReturnNode(yymsp[0].minor.yy122, 1);
+	yymsp[-2].minor.yy72 = New_AST_ReturnNode(yymsp[0].minor.yy37, 1);
 }
-#line 2094 "grammar.c"
+#line 2181 "grammar.c"
         break;
-      case 93: /* returnClause ::= RETURN MUL */
-#line 537 "grammar.y"
+      case 99: /* returnClause ::= RETURN MUL */
+#line 593 "grammar.y"
 {
-	yymsp[-1].minor.yy120 = New_AST_ReturnNode(NULL, 0);
+	yymsp[-1].minor.yy72 = New_AST_ReturnNode(NULL, 0);
 }
-#line 2101 "grammar.c"
+#line 2188 "grammar.c"
         break;
-      case 94: /* returnClause ::= RETURN DISTINCT MUL */
-#line 540 "grammar.y"
+      case 100: /* returnClause ::= RETURN DISTINCT MUL */
+#line 596 "grammar.y"
 {
-	yymsp[-2].minor.yy120 = New_AST_ReturnNode(NULL, 1);
+	yymsp[-2].minor.yy72 = New_AST_ReturnNode(NULL, 1);
 }
-#line 2108 "grammar.c"
+#line 2195 "grammar.c"
         break;
-      case 95: /* returnElements ::= returnElements COMMA returnElement */
-#line 546 "grammar.y"
+      case 101: /* returnElements ::= returnElements COMMA returnElement */
+#line 602 "grammar.y"
 {
-	yylhsminor.yy122 = array_append(yymsp[-2].minor.yy122, yymsp[0].minor.yy139);
+	yylhsminor.yy37 = array_append(yymsp[-2].minor.yy37, yymsp[0].minor.yy174);
 }
-#line 2115 "grammar.c"
-  yymsp[-2].minor.yy122 = yylhsminor.yy122;
+#line 2202 "grammar.c"
+  yymsp[-2].minor.yy37 = yylhsminor.yy37;
         break;
-      case 96: /* returnElements ::= returnElement */
-#line 550 "grammar.y"
+      case 102: /* returnElements ::= returnElement */
+#line 606 "grammar.y"
 {
-	yylhsminor.yy122 = array_new(AST_ReturnElementNode*, 1);
-	array_append(yylhsminor.yy122, yymsp[0].minor.yy139);
+	yylhsminor.yy37 = array_new(AST_ReturnElementNode*, 1);
+	array_append(yylhsminor.yy37, yymsp[0].minor.yy174);
 }
-#line 2124 "grammar.c"
-  yymsp[0].minor.yy122 = yylhsminor.yy122;
+#line 2211 "grammar.c"
+  yymsp[0].minor.yy37 = yylhsminor.yy37;
         break;
-      case 97: /* returnElement ::= arithmetic_expression */
-#line 557 "grammar.y"
+      case 103: /* returnElement ::= arithmetic_expression */
+#line 613 "grammar.y"
 {
-	yylhsminor.yy139 = New_AST_ReturnElementNode(yymsp[0].minor.yy154, NULL);
+	yylhsminor.yy174 = New_AST_ReturnElementNode(yymsp[0].minor.yy190, NULL);
 }
-#line 2132 "grammar.c"
-  yymsp[0].minor.yy139 = yylhsminor.yy139;
+#line 2219 "grammar.c"
+  yymsp[0].minor.yy174 = yylhsminor.yy174;
         break;
-      case 98: /* returnElement ::= arithmetic_expression AS UQSTRING */
-#line 561 "grammar.y"
+      case 104: /* returnElement ::= arithmetic_expression AS UQSTRING */
+#line 617 "grammar.y"
 {
-	yylhsminor.yy139 = New_AST_ReturnElementNode(yymsp[-2].minor.yy154, yymsp[0].minor.yy0.strval);
+	yylhsminor.yy174 = New_AST_ReturnElementNode(yymsp[-2].minor.yy190, yymsp[0].minor.yy0.strval);
 }
-#line 2140 "grammar.c"
-  yymsp[-2].minor.yy139 = yylhsminor.yy139;
+#line 2227 "grammar.c"
+  yymsp[-2].minor.yy174 = yylhsminor.yy174;
         break;
-      case 99: /* withClause ::= WITH withElements */
-#line 566 "grammar.y"
+      case 105: /* withClause ::= WITH withElements */
+#line 622 "grammar.y"
 {
-	yymsp[-1].minor.yy168 = New_AST_WithNode(yymsp[0].minor.yy112);
+	yymsp[-1].minor.yy138 = New_AST_WithNode(yymsp[0].minor.yy29);
 }
-#line 2148 "grammar.c"
+#line 2235 "grammar.c"
         break;
-      case 100: /* withElements ::= withElement */
-#line 571 "grammar.y"
+      case 106: /* withElements ::= withElement */
+#line 627 "grammar.y"
 {
-	yylhsminor.yy112 = array_new(AST_WithElementNode*, 1);
-	array_append(yylhsminor.yy112, yymsp[0].minor.yy98);
+	yylhsminor.yy29 = array_new(AST_WithElementNode*, 1);
+	array_append(yylhsminor.yy29, yymsp[0].minor.yy86);
 }
-#line 2156 "grammar.c"
-  yymsp[0].minor.yy112 = yylhsminor.yy112;
+#line 2243 "grammar.c"
+  yymsp[0].minor.yy29 = yylhsminor.yy29;
         break;
-      case 101: /* withElements ::= withElements COMMA withElement */
-#line 575 "grammar.y"
+      case 107: /* withElements ::= withElements COMMA withElement */
+#line 631 "grammar.y"
 {
-	yylhsminor.yy112 = array_append(yymsp[-2].minor.yy112, yymsp[0].minor.yy98);
+	yylhsminor.yy29 = array_append(yymsp[-2].minor.yy29, yymsp[0].minor.yy86);
 }
-#line 2164 "grammar.c"
-  yymsp[-2].minor.yy112 = yylhsminor.yy112;
+#line 2251 "grammar.c"
+  yymsp[-2].minor.yy29 = yylhsminor.yy29;
         break;
-      case 102: /* withElement ::= arithmetic_expression AS UQSTRING */
-#line 580 "grammar.y"
+      case 108: /* withElement ::= arithmetic_expression AS UQSTRING */
+#line 636 "grammar.y"
 {
-	yylhsminor.yy98 = New_AST_WithElementNode(yymsp[-2].minor.yy154, yymsp[0].minor.yy0.strval);
+	yylhsminor.yy86 = New_AST_WithElementNode(yymsp[-2].minor.yy190, yymsp[0].minor.yy0.strval);
 }
-#line 2172 "grammar.c"
-  yymsp[-2].minor.yy98 = yylhsminor.yy98;
+#line 2259 "grammar.c"
+  yymsp[-2].minor.yy86 = yylhsminor.yy86;
         break;
-      case 103: /* arithmetic_expression ::= LEFT_PARENTHESIS arithmetic_expression RIGHT_PARENTHESIS */
-#line 587 "grammar.y"
+      case 109: /* arithmetic_expression ::= LEFT_PARENTHESIS arithmetic_expression RIGHT_PARENTHESIS */
+#line 643 "grammar.y"
 {
-	yymsp[-2].minor.yy154 = yymsp[-1].minor.yy154;
+	yymsp[-2].minor.yy190 = yymsp[-1].minor.yy190;
 }
-#line 2180 "grammar.c"
+#line 2267 "grammar.c"
         break;
-      case 104: /* arithmetic_expression ::= arithmetic_expression ADD arithmetic_expression */
-#line 593 "grammar.y"
+      case 110: /* arithmetic_expression ::= arithmetic_expression ADD arithmetic_expression */
+#line 649 "grammar.y"
 {
 	Vector *args = NewVector(AST_ArithmeticExpressionNode*, 2);
-	Vector_Push(args, yymsp[-2].minor.yy154);
-	Vector_Push(args, yymsp[0].minor.yy154);
-	yylhsminor.yy154 = New_AST_AR_EXP_OpNode("ADD", args);
+	Vector_Push(args, yymsp[-2].minor.yy190);
+	Vector_Push(args, yymsp[0].minor.yy190);
+	yylhsminor.yy190 = New_AST_AR_EXP_OpNode("ADD", args);
 }
-#line 2190 "grammar.c"
-  yymsp[-2].minor.yy154 = yylhsminor.yy154;
+#line 2277 "grammar.c"
+  yymsp[-2].minor.yy190 = yylhsminor.yy190;
         break;
-      case 105: /* arithmetic_expression ::= arithmetic_expression DASH arithmetic_expression */
-#line 600 "grammar.y"
+      case 111: /* arithmetic_expression ::= arithmetic_expression DASH arithmetic_expression */
+#line 656 "grammar.y"
 {
 	Vector *args = NewVector(AST_ArithmeticExpressionNode*, 2);
-	Vector_Push(args, yymsp[-2].minor.yy154);
-	Vector_Push(args, yymsp[0].minor.yy154);
-	yylhsminor.yy154 = New_AST_AR_EXP_OpNode("SUB", args);
+	Vector_Push(args, yymsp[-2].minor.yy190);
+	Vector_Push(args, yymsp[0].minor.yy190);
+	yylhsminor.yy190 = New_AST_AR_EXP_OpNode("SUB", args);
 }
-#line 2201 "grammar.c"
-  yymsp[-2].minor.yy154 = yylhsminor.yy154;
+#line 2288 "grammar.c"
+  yymsp[-2].minor.yy190 = yylhsminor.yy190;
         break;
-      case 106: /* arithmetic_expression ::= arithmetic_expression MUL arithmetic_expression */
-#line 607 "grammar.y"
+      case 112: /* arithmetic_expression ::= arithmetic_expression MUL arithmetic_expression */
+#line 663 "grammar.y"
 {
 	Vector *args = NewVector(AST_ArithmeticExpressionNode*, 2);
-	Vector_Push(args, yymsp[-2].minor.yy154);
-	Vector_Push(args, yymsp[0].minor.yy154);
-	yylhsminor.yy154 = New_AST_AR_EXP_OpNode("MUL", args);
+	Vector_Push(args, yymsp[-2].minor.yy190);
+	Vector_Push(args, yymsp[0].minor.yy190);
+	yylhsminor.yy190 = New_AST_AR_EXP_OpNode("MUL", args);
 }
-#line 2212 "grammar.c"
-  yymsp[-2].minor.yy154 = yylhsminor.yy154;
+#line 2299 "grammar.c"
+  yymsp[-2].minor.yy190 = yylhsminor.yy190;
         break;
-      case 107: /* arithmetic_expression ::= arithmetic_expression DIV arithmetic_expression */
-#line 614 "grammar.y"
+      case 113: /* arithmetic_expression ::= arithmetic_expression DIV arithmetic_expression */
+#line 670 "grammar.y"
 {
 	Vector *args = NewVector(AST_ArithmeticExpressionNode*, 2);
-	Vector_Push(args, yymsp[-2].minor.yy154);
-	Vector_Push(args, yymsp[0].minor.yy154);
-	yylhsminor.yy154 = New_AST_AR_EXP_OpNode("DIV", args);
+	Vector_Push(args, yymsp[-2].minor.yy190);
+	Vector_Push(args, yymsp[0].minor.yy190);
+	yylhsminor.yy190 = New_AST_AR_EXP_OpNode("DIV", args);
 }
-#line 2223 "grammar.c"
-  yymsp[-2].minor.yy154 = yylhsminor.yy154;
+#line 2310 "grammar.c"
+  yymsp[-2].minor.yy190 = yylhsminor.yy190;
         break;
-      case 108: /* arithmetic_expression ::= UQSTRING LEFT_PARENTHESIS arithmetic_expression_list RIGHT_PARENTHESIS */
-#line 622 "grammar.y"
+      case 114: /* arithmetic_expression ::= UQSTRING LEFT_PARENTHESIS arithmetic_expression_list RIGHT_PARENTHESIS */
+#line 678 "grammar.y"
 {
-	yylhsminor.yy154 = New_AST_AR_EXP_OpNode(yymsp[-3].minor.yy0.strval, yymsp[-1].minor.yy210);
+	yylhsminor.yy190 = New_AST_AR_EXP_OpNode(yymsp[-3].minor.yy0.strval, yymsp[-1].minor.yy114);
 }
-#line 2231 "grammar.c"
-  yymsp[-3].minor.yy154 = yylhsminor.yy154;
+#line 2318 "grammar.c"
+  yymsp[-3].minor.yy190 = yylhsminor.yy190;
         break;
-      case 109: /* arithmetic_expression ::= value */
-#line 627 "grammar.y"
+      case 115: /* arithmetic_expression ::= value */
+#line 683 "grammar.y"
 {
-	yylhsminor.yy154 = New_AST_AR_EXP_ConstOperandNode(yymsp[0].minor.yy150);
+	yylhsminor.yy190 = New_AST_AR_EXP_ConstOperandNode(yymsp[0].minor.yy12);
 }
-#line 2239 "grammar.c"
-  yymsp[0].minor.yy154 = yylhsminor.yy154;
+#line 2326 "grammar.c"
+  yymsp[0].minor.yy190 = yylhsminor.yy190;
         break;
-      case 110: /* arithmetic_expression ::= variable */
-#line 632 "grammar.y"
+      case 116: /* arithmetic_expression ::= DOLLAR UQSTRING */
+#line 688 "grammar.y"
 {
-	yylhsminor.yy154 = New_AST_AR_EXP_VariableOperandNode(yymsp[0].minor.yy156->alias, yymsp[0].minor.yy156->property);
-	free(yymsp[0].minor.yy156);
+	yymsp[-1].minor.yy190 = New_AST_AR_EXP_ParamOperandNode(AST_Params_Get(ctx->params, yymsp[0].minor.yy0.strval));
+	free(yymsp[0].minor.yy0.strval);
 }
-#line 2248 "grammar.c"
-  yymsp[0].minor.yy154 = yylhsminor.yy154;
+#line 2335 "grammar.c"
         break;
-      case 111: /* arithmetic_expression_list ::= arithmetic_expression_list COMMA arithmetic_expression */
-#line 639 "grammar.y"
+      case 117: /* arithmetic_expression ::= variable */
+#line 694 "grammar.y"
 {
-	Vector_Push(yymsp[-2].minor.yy210, yymsp[0].minor.yy154);
-	yylhsminor.yy210 = yymsp[-2].minor.yy210;
+	yylhsminor.yy190 = New_AST_AR_EXP_VariableOperandNode(yymsp[0].minor.yy150->alias, yymsp[0].minor.yy150->property);
+	free(yymsp[0].minor.yy150->alias);
+	free(yymsp[0].minor.yy150->property);
+	free(yymsp[0].minor.yy150);
 }
-#line 2257 "grammar.c"
-  yymsp[-2].minor.yy210 = yylhsminor.yy210;
+#line 2345 "grammar.c"
+  yymsp[0].minor.yy190 = yylhsminor.yy190;
         break;
-      case 112: /* arithmetic_expression_list ::= arithmetic_expression */
-#line 643 "grammar.y"
+      case 118: /* arithmetic_expression_list ::= */
+#line 703 "grammar.y"
 {
-	yylhsminor.yy210 = NewVector(AST_ArithmeticExpressionNode*, 1);
-	Vector_Push(yylhsminor.yy210, yymsp[0].minor.yy154);
+	yymsp[1].minor.yy114 = NewVector(AST_ArithmeticExpressionNode*, 0);
 }
-#line 2266 "grammar.c"
-  yymsp[0].minor.yy210 = yylhsminor.yy210;
+#line 2353 "grammar.c"
         break;
-      case 113: /* variable ::= UQSTRING */
-#line 650 "grammar.y"
+      case 119: /* arithmetic_expression_list ::= arithmetic_expression_list COMMA arithmetic_expression */
+#line 706 "grammar.y"
 {
-	yylhsminor.yy156 = New_AST_Variable(yymsp[0].minor.yy0.strval, NULL);
+	Vector_Push(yymsp[-2].minor.yy114, yymsp[0].minor.yy190);
+	yylhsminor.yy114 = yymsp[-2].minor.yy114;
 }
-#line 2274 "grammar.c"
-  yymsp[0].minor.yy156 = yylhsminor.yy156;
+#line 2361 "grammar.c"
+  yymsp[-2].minor.yy114 = yylhsminor.yy114;
         break;
-      case 114: /* variable ::= UQSTRING DOT UQSTRING */
-#line 654 "grammar.y"
+      case 120: /* arithmetic_expression_list ::= arithmetic_expression */
+#line 710 "grammar.y"
 {
-	yylhsminor.yy156 = New_AST_Variable(yymsp[-2].minor.yy0.strval, yymsp[0].minor.yy0.strval);
+	yylhsminor.yy114 = NewVector(AST_ArithmeticExpressionNode*, 1);
+	Vector_Push(yylhsminor.yy114, yymsp[0].minor.yy190);
 }
-#line 2282 "grammar.c"
-  yymsp[-2].minor.yy156 = yylhsminor.yy156;
+#line 2370 "grammar.c"
+  yymsp[0].minor.yy114 = yylhsminor.yy114;
         break;
-      case 115: /* orderClause ::= */
-#line 660 "grammar.y"
+      case 121: /* variable ::= UQSTRING */
+#line 717 "grammar.y"
 {
-	yymsp[1].minor.yy196 = NULL;
+	yylhsminor.yy150 = New_AST_Variable(yymsp[0].minor.yy0.strval, NULL);
 }
-#line 2290 "grammar.c"
+#line 2378 "grammar.c"
+  yymsp[0].minor.yy150 = yylhsminor.yy150;
         break;
-      case 116: /* orderClause ::= ORDER BY arithmetic_expression_list */
-#line 663 "grammar.y"
+      case 122: /* variable ::= UQSTRING DOT UQSTRING */
+#line 721 "grammar.y"
 {
-	yymsp[-2].minor.yy196 = New_AST_OrderNode(yymsp[0].minor.yy210, ORDER_DIR_ASC);
+	yylhsminor.yy150 = New_AST_Variable(yymsp[-2].minor.yy0.strval, yymsp[0].minor.yy0.strval);
 }
-#line 2297 "grammar.c"
+#line 2386 "grammar.c"
+  yymsp[-2].minor.yy150 = yylhsminor.yy150;
         break;
-      case 117: /* orderClause ::= ORDER BY arithmetic_expression_list ASC */
-#line 666 "grammar.y"
+      case 123: /* orderClause ::= */
+#line 727 "grammar.y"
 {
-	yymsp[-3].minor.yy196 = New_AST_OrderNode(yymsp[-1].minor.yy210, ORDER_DIR_ASC);
+	yymsp[1].minor.yy160 = NULL;
 }
-#line 2304 "grammar.c"
+#line 2394 "grammar.c"
         break;
-      case 118: /* orderClause ::= ORDER BY arithmetic_expression_list DESC */
-#line 669 "grammar.y"
+      case 124: /* orderClause ::= ORDER BY arithmetic_expression_list */
+#line 730 "grammar.y"
 {
-	yymsp[-3].minor.yy196 = New_AST_OrderNode(yymsp[-1].minor.yy210, ORDER_DIR_DESC);
+	yymsp[-2].minor.yy160 = New_AST_OrderNode(yymsp[0].minor.yy114, ORDER_DIR_ASC);
 }
-#line 2311 "grammar.c"
+#line 2401 "grammar.c"
         break;
-      case 119: /* skipClause ::= */
-#line 675 "grammar.y"
+      case 125: /* orderClause ::= ORDER BY arithmetic_expression_list ASC */
+#line 733 "grammar.y"
 {
-	yymsp[1].minor.yy147 = NULL;
+	yymsp[-3].minor.yy160 = New_AST_OrderNode(yymsp[-1].minor.yy114, ORDER_DIR_ASC);
 }
-#line 2318 "grammar.c"
+#line 2408 "grammar.c"
         break;
-      case 120: /* skipClause ::= SKIP INTEGER */
-#line 678 "grammar.y"
+      case 126: /* orderClause ::= ORDER BY arithmetic_expression_list DESC */
+#line 736 "grammar.y"
 {
-	yymsp[-1].minor.yy147 = New_AST_SkipNode(yymsp[0].minor.yy0.longval);
+	yymsp[-3].minor.yy160 = New_AST_OrderNode(yymsp[-1].minor.yy114, ORDER_DIR_DESC);
 }
-#line 2325 "grammar.c"
+#line 2415 "grammar.c"
         break;
-      case 121: /* limitClause ::= */
-#line 684 "grammar.y"
+      case 127: /* skipClause ::= */
+#line 742 "grammar.y"
 {
-	yymsp[1].minor.yy39 = NULL;
+	yymsp[1].minor.yy105 = NULL;
 }
-#line 2332 "grammar.c"
+#line 2422 "grammar.c"
         break;
-      case 122: /* limitClause ::= LIMIT INTEGER */
-#line 687 "grammar.y"
+      case 128: /* skipClause ::= SKIP INTEGER */
+#line 745 "grammar.y"
 {
-	yymsp[-1].minor.yy39 = New_AST_LimitNode(yymsp[0].minor.yy0.longval);
+	yymsp[-1].minor.yy105 = New_AST_SkipNode(yymsp[0].minor.yy0.longval);
 }
-#line 2339 "grammar.c"
+#line 2429 "grammar.c"
         break;
-      case 123: /* unwindClause ::= UNWIND LEFT_BRACKET arithmetic_expression_list RIGHT_BRACKET AS UQSTRING */
-#line 693 "grammar.y"
+      case 129: /* skipClause ::= SKIP DOLLAR UQSTRING */
+#line 748 "grammar.y"
 {
-	yymsp[-5].minor.yy97 = New_AST_UnwindNode(yymsp[-3].minor.yy210, yymsp[0].minor.yy0.strval);
+	yymsp[-2].minor.yy105 = New_AST_SkipParamNode(AST_Params_Get(ctx->params, yymsp[0].minor.yy0.strval));
+	free(yymsp[0].minor.yy0.strval);
 }
-#line 2346 "grammar.c"
+#line 2437 "grammar.c"
         break;
-      case 124: /* relation ::= EQ */
-#line 698 "grammar.y"
-{ yymsp[0].minor.yy6 = EQ; }
-#line 2351 "grammar.c"
+      case 130: /* limitClause ::= */
+#line 755 "grammar.y"
+{
+	yymsp[1].minor.yy213 = NULL;
+}
+#line 2444 "grammar.c"
         break;
-      case 125: /* relation ::= GT */
-#line 699 "grammar.y"
-{ yymsp[0].minor.yy6 = GT; }
-#line 2356 "grammar.c"
+      case 131: /* limitClause ::= LIMIT INTEGER */
+#line 758 "grammar.y"
+{
+	yymsp[-1].minor.yy213 = New_AST_LimitNode(yymsp[0].minor.yy0.longval);
+}
+#line 2451 "grammar.c"
         break;
-      case 126: /* relation ::= LT */
-#line 700 "grammar.y"
-{ yymsp[0].minor.yy6 = LT; }
-#line 2361 "grammar.c"
+      case 132: /* limitClause ::= LIMIT DOLLAR UQSTRING */
+#line 761 "grammar.y"
+{
+	yymsp[-2].minor.yy213 = New_AST_LimitParamNode(AST_Params_Get(ctx->params, yymsp[0].minor.yy0.strval));
+	free(yymsp[0].minor.yy0.strval);
+}
+#line 2459 "grammar.c"
         break;
-      case 127: /* relation ::= LE */
-#line 701 "grammar.y"
-{ yymsp[0].minor.yy6 = LE; }
-#line 2366 "grammar.c"
+      case 133: /* unwindClause ::= UNWIND LEFT_BRACKET arithmetic_expression_list RIGHT_BRACKET AS UQSTRING */
+#line 768 "grammar.y"
+{
+	yymsp[-5].minor.yy97 = New_AST_UnwindNode(yymsp[-3].minor.yy114, yymsp[0].minor.yy0.strval);
+}
+#line 2466 "grammar.c"
         break;
-      case 128: /* relation ::= GE */
-#line 702 "grammar.y"
-{ yymsp[0].minor.yy6 = GE; }
-#line 2371 "grammar.c"
+      case 134: /* relation ::= EQ */
+#line 773 "grammar.y"
+{ yymsp[0].minor.yy82 = EQ; }
+#line 2471 "grammar.c"
         break;
-      case 129: /* relation ::= NE */
-#line 703 "grammar.y"
-{ yymsp[0].minor.yy6 = NE; }
-#line 2376 "grammar.c"
+      case 135: /* relation ::= GT */
+#line 774 "grammar.y"
+{ yymsp[0].minor.yy82 = GT; }
+#line 2476 "grammar.c"
         break;
-      case 130: /* value ::= INTEGER */
-#line 708 "grammar.y"
-{  yylhsminor.yy150 = SI_LongVal(yymsp[0].minor.yy0.longval); }
-#line 2381 "grammar.c"
-  yymsp[0].minor.yy150 = yylhsminor.yy150;
+      case 136: /* relation ::= LT */
+#line 775 "grammar.y"
+{ yymsp[0].minor.yy82 = LT; }
+#line 2481 "grammar.c"
         break;
-      case 131: /* value ::= DASH INTEGER */
-#line 709 "grammar.y"
-{  yymsp[-1].minor.yy150 = SI_LongVal(-yymsp[0].minor.yy0.longval); }
-#line 2387 "grammar.c"
+      case 137: /* relation ::= LE */
+#line 776 "grammar.y"
+{ yymsp[0].minor.yy82 = LE; }
+#line 2486 "grammar.c"
         break;
-      case 132: /* value ::= STRING */
-#line 710 "grammar.y"
-{  yylhsminor.yy150 = SI_ConstStringVal(yymsp[0].minor.yy0.strval); }
-#line 2392 "grammar.c"
-  yymsp[0].minor.yy150 = yylhsminor.yy150;
+      case 138: /* relation ::= GE */
+#line 777 "grammar.y"
+{ yymsp[0].minor.yy82 = GE; }
+#line 2491 "grammar.c"
         break;
-      case 133: /* value ::= FLOAT */
-#line 711 "grammar.y"
-{  yylhsminor.yy150 = SI_DoubleVal(yymsp[0].minor.yy0.dval); }
-#line 2398 "grammar.c"
-  yymsp[0].minor.yy150 = yylhsminor.yy150;
+      case 139: /* relation ::= NE */
+#line 778 "grammar.y"
+{ yymsp[0].minor.yy82 = NE; }
+#line 2496 "grammar.c"
+        break;
+      case 140: /* value ::= INTEGER */
+#line 783 "grammar.y"
+{  yylhsminor.yy12 = SI_LongVal(yymsp[0].minor.yy0.longval); }
+#line 2501 "grammar.c"
+  yymsp[0].minor.yy12 = yylhsminor.yy12;
+        break;
+      case 141: /* value ::= DASH INTEGER */
+#line 784 "grammar.y"
+{  yymsp[-1].minor.yy12 = SI_LongVal(-yymsp[0].minor.yy0.longval); }
+#line 2507 "grammar.c"
+        break;
+      case 142: /* value ::= STRING */
+#line 785 "grammar.y"
+{  yylhsminor.yy12 = SI_ConstStringVal(yymsp[0].minor.yy0.strval); }
+#line 2512 "grammar.c"
+  yymsp[0].minor.yy12 = yylhsminor.yy12;
         break;
-      case 134: /* value ::= DASH FLOAT */
-#line 712 "grammar.y"
-{  yymsp[-1].minor.yy150 = SI_DoubleVal(-yymsp[0].minor.yy0.dval); }
-#line 2404 "grammar.c"
+      case 143: /* value ::= FLOAT */
+#line 786 "grammar.y"
+{  yylhsminor.yy12 = SI_DoubleVal(yymsp[0].minor.yy0.dval); }
+#line 2518 "grammar.c"
+  yymsp[0].minor.yy12 = yylhsminor.yy12;
         break;
-      case 135: /* value ::= TRUE */
-#line 713 "grammar.y"
-{ yymsp[0].minor.yy150 = SI_BoolVal(1); }
-#line 2409 "grammar.c"
+      case 144: /* value ::= DASH FLOAT */
+#line 787 "grammar.y"
+{  yymsp[-1].minor.yy12 = SI_DoubleVal(-yymsp[0].minor.yy0.dval); }
+#line 2524 "grammar.c"
         break;
-      case 136: /* value ::= FALSE */
-#line 714 "grammar.y"
-{ yymsp[0].minor.yy150 = SI_BoolVal(0); }
-#line 2414 "grammar.c"
+      case 145: /* value ::= TRUE */
+#line 788 "grammar.y"
+{ yymsp[0].minor.yy12 = SI_BoolVal(1); }
+#line 2529 "grammar.c"
         break;
-      case 137: /* value ::= NULLVAL */
-#line 715 "grammar.y"
-{ yymsp[0].minor.yy150 = SI_NullVal(); }
-#line 2419 "grammar.c"
+      case 146: /* value ::= FALSE */
+#line 789 "grammar.y"
+{ yymsp[0].minor.yy12 = SI_BoolVal(0); }
+#line 2534 "grammar.c"
+        break;
+      case 147: /* value ::= NULLVAL */
+#line 790 "grammar.y"
+{ yymsp[0].minor.yy12 = SI_NullVal(); }
+#line 2539 "grammar.c"
         break;
       default:
         break;
@@ -2473,14 +2593,14 @@ static void yy_syntax_error(
   ParseARG_FETCH;
 #define TOKEN yyminor
 /************ Begin %syntax_error code ****************************************/
-#line 33 "grammar.y"
+#line 35 "grammar.y"
 
 	char buf[256];
 	snprintf(buf, 256, "Syntax error at offset %d near '%s'", TOKEN.pos, TOKEN.s);
 
 	ctx->ok = 0;
 	ctx->errorMsg = strdup(buf);
-#line 2484 "grammar.c"
+#line 2604 "grammar.c"
 /************ End %syntax_error code ******************************************/
   ParseARG_STORE; /* Suppress warning about unused %extra_argument variable */
 }
@@ -2694,7 +2814,7 @@ void Parse(
 #endif
   return;
 }
-#line 717 "grammar.y"
+#line 792 "grammar.y"
 
 
 	/* Definitions of flex stuff */
@@ -2713,7 +2833,7 @@ void Parse(
   		void* pParser = ParseAlloc(malloc);
   		int t = 0;
 
-		parseCtx ctx = {.root = NULL, .ok = 1, .errorMsg = NULL};
+		parseCtx ctx = {.root = NULL, .params = AST_Params_New(), .ok = 1, .errorMsg = NULL};
 
 		while( (t = yylex()) != 0) {
 			Parse(pParser, t, tok, &ctx);
@@ -2726,6 +2846,182 @@ void Parse(
 			*err = ctx.errorMsg;
 		}
 		yylex_destroy();
+
+		// Parameters are shared by all AST segments.
+		if(ctx.root) {
+			for(uint i = 0; i < array_len(ctx.root); i++) ctx.root[i]->params = ctx.params;
+		} else {
+			AST_Params_Free(ctx.params);
+		}
 		return ctx.root;
 	}
-#line 2732 "grammar.c"
+
+	/* Token retained by literal extraction. */
+	typedef struct {
+		int type;		// Token type.
+		char *text;		// Token text, quoted if token is a string literal.
+		char *strval;	// String literal value.
+		SIValue value;	// Numeric literal value.
+	} LiteralToken;
+
+	static inline bool _literal_token(int type) {
+		return (type == INTEGER || type == FLOAT || type == STRING);
+	}
+
+	// Returns true if token concludes an operand, e.g. 1 or n.v or (n.v + 1).
+	static inline bool _operand_token(int type) {
+		return (_literal_token(type) || type == UQSTRING ||
+				type == RIGHT_PARENTHESIS || type == RIGHT_BRACKET ||
+				type == TRUE || type == FALSE || type == NULLVAL);
+	}
+
+	// Returns true if token introduces a clause, concluding a WHERE clause.
+	static inline bool _clause_token(int type) {
+		return (type == MATCH || type == RETURN || type == WITH || type == ORDER ||
+				type == SKIP || type == LIMIT || type == UNWIND);
+	}
+
+	// Returns true if token belongs to a query which modifies the graph or calls a procedure.
+	static inline bool _write_token(int type) {
+		return (type == CREATE || type == MERGE || type == DELETE || type == SET ||
+				type == CALL || type == INDEX || type == DROP);
+	}
+
+	static void _free_literal_tokens(LiteralToken *tokens) {
+		for(uint i = 0; i < array_len(tokens); i++) {
+			free(tokens[i].text);
+			free(tokens[i].strval);
+		}
+		array_free(tokens);
+	}
+
+	/* Determine which tokens are extracted, WHERE clauses comparing
+	 * entity IDs are left intact as node by ID seek requires a constant. */
+	static bool *_extracted_literals(LiteralToken *tokens) {
+		uint count = array_len(tokens);
+		bool *extract = calloc(count, sizeof(bool));
+		bool where = false;
+		int map_depth = 0;
+
+		for(uint i = 0; i < count; i++) {
+			int type = tokens[i].type;
+			if(type == WHERE) {
+				where = true;
+				// Look for ID(...) within WHERE clause.
+				for(uint j = i + 1; j + 1 < count && !_clause_token(tokens[j].type); j++) {
+					if(tokens[j].type == UQSTRING && strcasecmp(tokens[j].text, "id") == 0 &&
+					   tokens[j+1].type == LEFT_PARENTHESIS) {
+						where = false;
+						break;
+					}
+				}
+			} else if(_clause_token(type)) {
+				where = false;
+				// SKIP and LIMIT are followed by an integer.
+				if((type == SKIP || type == LIMIT) && i + 1 < count && tokens[i+1].type == INTEGER) {
+					extract[i+1] = true;
+					i++;
+				}
+			} else if(type == LEFT_CURLY_BRACKET) {
+				map_depth++;
+			} else if(type == RIGHT_CURLY_BRACKET) {
+				map_depth--;
+			} else if(_literal_token(type) && (where || map_depth > 0)) {
+				extract[i] = true;
+			}
+		}
+		return extract;
+	}
+
+	char *Query_ExtractLiterals(const char *q, size_t len, AST_Params **values) {
+		yycolumn = 1;
+		yy_scan_bytes(q, len);
+
+		bool eligible = true;
+		size_t text_len = 0;
+		LiteralToken *tokens = array_new(LiteralToken, 32);
+
+		int t = 0;
+		while((t = yylex()) != 0) {
+			LiteralToken token = {.type = t, .text = NULL, .strval = NULL};
+			if(t == UQSTRING) {
+				token.text = tok.strval;
+				// Parameter names might collide with extracted literals.
+				if(array_len(tokens) > 0 && array_tail(tokens).type == DOLLAR &&
+				   strncmp(tok.strval, LITERAL_PARAM_PREFIX, strlen(LITERAL_PARAM_PREFIX)) == 0) {
+					eligible = false;
+				}
+			} else if(t == STRING) {
+				// Strings are written back unescaped, leave quoted text intact.
+				if(strpbrk(tok.strval, "'\"\\")) eligible = false;
+				// Lexer strips string's closing quote.
+				asprintf(&token.text, "%c%s%c", *tok.s, tok.strval, *tok.s);
+				token.strval = tok.strval;
+			} else {
+				token.text = strdup(tok.s);
+				if(t == INTEGER) token.value = SI_LongVal(tok.longval);
+				else if(t == FLOAT) token.value = SI_DoubleVal(tok.dval);
+			}
+			if(_write_token(t)) eligible = false;
+			text_len += strlen(token.text) + 1;
+			tokens = array_append(tokens, token);
+		}
+		yylex_destroy();
+
+		bool *extract = (eligible) ? _extracted_literals(tokens) : NULL;
+		uint count = array_len(tokens);
+		uint extracted = 0;
+		char *normalized = NULL;
+
+		if(extract) {
+			for(uint i = 0; i < count; i++) extracted += extract[i];
+		}
+
+		if(extracted > 0) {
+			// Each literal is replaced by $<prefix><index>.
+			normalized = rm_malloc(text_len + extracted * (strlen(LITERAL_PARAM_PREFIX) + 12) + 1);
+			char *s = normalized;
+			if(!*values) *values = AST_Params_New();
+
+			uint param_idx = 0;
+			for(uint i = 0; i < count; i++) {
+				LiteralToken *token = tokens + i;
+				bool negate = false;
+
+				// Separate tokens by a single space, parameter names follow '$'.
+				if(i > 0 && tokens[i-1].type != DOLLAR) *s++ = ' ';
+
+				// Unary minus is part of the literal, e.g. n.v > -1
+				if(token->type == DASH && i + 1 < count && extract[i+1] &&
+				   tokens[i+1].type != STRING && (i == 0 || !_operand_token(tokens[i-1].type))) {
+					negate = true;
+					token++;
+					i++;
+				}
+
+				if(!extract[i]) {
+					s += sprintf(s, "%s", token->text);
+					continue;
+				}
+
+				char name[strlen(LITERAL_PARAM_PREFIX) + 12];
+				sprintf(name, LITERAL_PARAM_PREFIX "%u", param_idx++);
+				s += sprintf(s, "$%s", name);
+
+				AST_Param *param = AST_Params_Get(*values, name);
+				if(token->type == STRING) {
+					param->value = SI_DuplicateStringVal(token->strval);
+				} else {
+					param->value = token->value;
+					if(negate) param->value = (token->type == INTEGER) ?
+						SI_LongVal(-token->value.longval) : SI_DoubleVal(-token->value.doubleval);
+				}
+			}
+			*s = '\0';
+		}
+
+		free(extract);
+		_free_literal_tokens(tokens);
+		return normalized;
+	}
+#line 3028 "grammar.c"
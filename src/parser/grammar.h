@@ -35,20 +35,21 @@
 #define DOTDOT                          35
 #define LEFT_CURLY_BRACKET              36
 #define RIGHT_CURLY_BRACKET             37
-#define WHERE                           38
-#define RETURN                          39
-#define DISTINCT                        40
-#define AS                              41
-#define WITH                            42
-#define ORDER                           43
-#define BY                              44
-#define ASC                             45
-#define DESC                            46
-#define SKIP                            47
-#define LIMIT                           48
-#define UNWIND                          49
-#define NE                              50
-#define FLOAT                           51
-#define TRUE                            52
-#define FALSE                           53
-#define NULLVAL                         54
+#define DOLLAR                          38
+#define WHERE                           39
+#define RETURN                          40
+#define DISTINCT                        41
+#define AS                              42
+#define WITH                            43
+#define ORDER                           44
+#define BY                              45
+#define ASC                             46
+#define DESC                            47
+#define SKIP                            48
+#define LIMIT                           49
+#define UNWIND                          50
+#define NE                              51
+#define FLOAT                           52
+#define TRUE                            53
+#define FALSE                           54
+#define NULLVAL                         55
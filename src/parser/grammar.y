@@ -12,6 +12,7 @@
 	#include <stdint.h>
 	#include <assert.h>
 	#include <limits.h>
+	#include <string.h>
 	#include "token.h"	
 	#include "grammar.h"
 	#include "ast.h"
@@ -19,6 +20,7 @@
 	#include "parse.h"
 	#include "../value.h"
 	#include "../util/arr.h"
+	#include "../util/rmalloc.h"
 
 	void yyerror(char *s);
 
@@ -341,6 +343,44 @@ chains(A) ::= chains(B) COMMA chain(C). {
 	A = B;
 }
 
+chains(A) ::= shortestPath(B). {
+	A = NewVector(Vector*, 1);
+	Vector_Push(A, B);
+}
+
+chains(A) ::= chains(B) COMMA shortestPath(C). {
+	Vector_Push(B, C);
+	A = B;
+}
+
+%type shortestPath {Vector*}
+
+// shortestPath((a)-[*]->(b)) or allShortestPaths((a)-[*]->(b))
+shortestPath(A) ::= UQSTRING(B) LEFT_PARENTHESIS chain(C) RIGHT_PARENTHESIS. {
+	AST_ShortestPathType type = N_SHORTEST_PATH_NONE;
+	if(strcasecmp(B.strval, "shortestPath") == 0) type = N_SHORTEST_PATH_SINGLE;
+	else if(strcasecmp(B.strval, "allShortestPaths") == 0) type = N_SHORTEST_PATH_ALL;
+
+	char buf[256];
+	buf[0] = '\0';
+	if(type == N_SHORTEST_PATH_NONE) {
+		snprintf(buf, 256, "Unknown pattern function '%s' at offset %d", B.strval, B.pos);
+	} else if(Vector_Size(C) != 3) {
+		snprintf(buf, 256, "%s requires a pattern with a single relationship", B.strval);
+	} else {
+		AST_LinkEntity *link;
+		Vector_Get(C, 1, &link);
+		link->shortestPath = type;
+	}
+
+	if(buf[0] != '\0' && ctx->ok) {
+		ctx->ok = 0;
+		ctx->errorMsg = strdup(buf);
+	}
+	free(B.strval);
+	A = C;
+}
+
 
 %type deleteClause { AST_DeleteNode *}
 
@@ -396,6 +436,12 @@ link(A) ::= LEFT_ARROW edge(B) DASH . {
 	A->direction = N_RIGHT_TO_LEFT;
 }
 
+// undirected edge
+link(A) ::= DASH edge(B) DASH . {
+	A = B;
+	A->direction = N_DIR_UNKNOWN;
+}
+
 %type edge {AST_LinkEntity*}
 // Empty edge []
 edge(A) ::= LEFT_BRACKET properties(B) edgeLength(C) RIGHT_BRACKET . { 
@@ -481,30 +527,40 @@ properties(A) ::= LEFT_CURLY_BRACKET mapLiteral(B) RIGHT_CURLY_BRACKET. {
 
 %type mapLiteral {Vector*}
 // key:value
-mapLiteral(A) ::= UQSTRING(B) COLON value(C). {
+mapLiteral(A) ::= UQSTRING(B) COLON mapValue(C). {
 	A = NewVector(SIValue*, 2);
 
 	SIValue *key = malloc(sizeof(SIValue));
 	*key = SI_ConstStringVal(B.strval);
 	Vector_Push(A, key);
 
-	SIValue *val = malloc(sizeof(SIValue));
-	*val = C;
-	Vector_Push(A, val);
+	Vector_Push(A, C);
 }
 
-mapLiteral(A) ::= UQSTRING(B) COLON value(C) COMMA mapLiteral(D). {
+mapLiteral(A) ::= UQSTRING(B) COLON mapValue(C) COMMA mapLiteral(D). {
 	SIValue *key = malloc(sizeof(SIValue));
 	*key = SI_ConstStringVal(B.strval);
 	Vector_Push(D, key);
 
-	SIValue *val = malloc(sizeof(SIValue));
-	*val = C;
-	Vector_Push(D, val);
+	Vector_Push(D, C);
 	
 	A = D;
 }
 
+%type mapValue {SIValue*}
+mapValue(A) ::= value(B). {
+	A = malloc(sizeof(SIValue));
+	*A = B;
+}
+
+// Value is set once parameter is bound.
+mapValue(A) ::= DOLLAR UQSTRING(B). {
+	A = malloc(sizeof(SIValue));
+	*A = SI_NullVal();
+	AST_Params_AddMapValue(ctx->params, A, B.strval);
+	free(B.strval);
+}
+
 %type whereClause {AST_WhereNode*}
 
 whereClause(A) ::= . { 
@@ -628,6 +684,12 @@ arithmetic_expression(A) ::= value(B). {
 	A = New_AST_AR_EXP_ConstOperandNode(B);
 }
 
+// $name
+arithmetic_expression(A) ::= DOLLAR UQSTRING(B). {
+	A = New_AST_AR_EXP_ParamOperandNode(AST_Params_Get(ctx->params, B.strval));
+	free(B.strval);
+}
+
 // a.name
 arithmetic_expression(A) ::= variable(B). {
 	A = New_AST_AR_EXP_VariableOperandNode(B->alias, B->property);
@@ -683,6 +745,10 @@ skipClause(A) ::= . {
 skipClause(A) ::= SKIP INTEGER(B). {
 	A = New_AST_SkipNode(B.longval);
 }
+skipClause(A) ::= SKIP DOLLAR UQSTRING(B). {
+	A = New_AST_SkipParamNode(AST_Params_Get(ctx->params, B.strval));
+	free(B.strval);
+}
 
 %type limitClause {AST_LimitNode*}
 
@@ -692,6 +758,10 @@ limitClause(A) ::= . {
 limitClause(A) ::= LIMIT INTEGER(B). {
 	A = New_AST_LimitNode(B.longval);
 }
+limitClause(A) ::= LIMIT DOLLAR UQSTRING(B). {
+	A = New_AST_LimitParamNode(AST_Params_Get(ctx->params, B.strval));
+	free(B.strval);
+}
 
 %type unwindClause {AST_UnwindNode*}
 
@@ -737,7 +807,7 @@ value(A) ::= NULLVAL. { A = SI_NullVal(); }
   		void* pParser = ParseAlloc(malloc);
   		int t = 0;
 
-		parseCtx ctx = {.root = NULL, .ok = 1, .errorMsg = NULL};
+		parseCtx ctx = {.root = NULL, .params = AST_Params_New(), .ok = 1, .errorMsg = NULL};
 
 		while( (t = yylex()) != 0) {
 			Parse(pParser, t, tok, &ctx);
@@ -750,6 +820,182 @@ value(A) ::= NULLVAL. { A = SI_NullVal(); }
 			*err = ctx.errorMsg;
 		}
 		yylex_destroy();
+
+		// Parameters are shared by all AST segments.
+		if(ctx.root) {
+			for(uint i = 0; i < array_len(ctx.root); i++) ctx.root[i]->params = ctx.params;
+		} else {
+			AST_Params_Free(ctx.params);
+		}
 		return ctx.root;
 	}
+
+	/* Token retained by literal extraction. */
+	typedef struct {
+		int type;		// Token type.
+		char *text;		// Token text, quoted if token is a string literal.
+		char *strval;	// String literal value.
+		SIValue value;	// Numeric literal value.
+	} LiteralToken;
+
+	static inline bool _literal_token(int type) {
+		return (type == INTEGER || type == FLOAT || type == STRING);
+	}
+
+	// Returns true if token concludes an operand, e.g. 1 or n.v or (n.v + 1).
+	static inline bool _operand_token(int type) {
+		return (_literal_token(type) || type == UQSTRING ||
+				type == RIGHT_PARENTHESIS || type == RIGHT_BRACKET ||
+				type == TRUE || type == FALSE || type == NULLVAL);
+	}
+
+	// Returns true if token introduces a clause, concluding a WHERE clause.
+	static inline bool _clause_token(int type) {
+		return (type == MATCH || type == RETURN || type == WITH || type == ORDER ||
+				type == SKIP || type == LIMIT || type == UNWIND);
+	}
+
+	// Returns true if token belongs to a query which modifies the graph or calls a procedure.
+	static inline bool _write_token(int type) {
+		return (type == CREATE || type == MERGE || type == DELETE || type == SET ||
+				type == CALL || type == INDEX || type == DROP);
+	}
+
+	static void _free_literal_tokens(LiteralToken *tokens) {
+		for(uint i = 0; i < array_len(tokens); i++) {
+			free(tokens[i].text);
+			free(tokens[i].strval);
+		}
+		array_free(tokens);
+	}
+
+	/* Determine which tokens are extracted, WHERE clauses comparing
+	 * entity IDs are left intact as node by ID seek requires a constant. */
+	static bool *_extracted_literals(LiteralToken *tokens) {
+		uint count = array_len(tokens);
+		bool *extract = calloc(count, sizeof(bool));
+		bool where = false;
+		int map_depth = 0;
+
+		for(uint i = 0; i < count; i++) {
+			int type = tokens[i].type;
+			if(type == WHERE) {
+				where = true;
+				// Look for ID(...) within WHERE clause.
+				for(uint j = i + 1; j + 1 < count && !_clause_token(tokens[j].type); j++) {
+					if(tokens[j].type == UQSTRING && strcasecmp(tokens[j].text, "id") == 0 &&
+					   tokens[j+1].type == LEFT_PARENTHESIS) {
+						where = false;
+						break;
+					}
+				}
+			} else if(_clause_token(type)) {
+				where = false;
+				// SKIP and LIMIT are followed by an integer.
+				if((type == SKIP || type == LIMIT) && i + 1 < count && tokens[i+1].type == INTEGER) {
+					extract[i+1] = true;
+					i++;
+				}
+			} else if(type == LEFT_CURLY_BRACKET) {
+				map_depth++;
+			} else if(type == RIGHT_CURLY_BRACKET) {
+				map_depth--;
+			} else if(_literal_token(type) && (where || map_depth > 0)) {
+				extract[i] = true;
+			}
+		}
+		return extract;
+	}
+
+	char *Query_ExtractLiterals(const char *q, size_t len, AST_Params **values) {
+		yycolumn = 1;
+		yy_scan_bytes(q, len);
+
+		bool eligible = true;
+		size_t text_len = 0;
+		LiteralToken *tokens = array_new(LiteralToken, 32);
+
+		int t = 0;
+		while((t = yylex()) != 0) {
+			LiteralToken token = {.type = t, .text = NULL, .strval = NULL};
+			if(t == UQSTRING) {
+				token.text = tok.strval;
+				// Parameter names might collide with extracted literals.
+				if(array_len(tokens) > 0 && array_tail(tokens).type == DOLLAR &&
+				   strncmp(tok.strval, LITERAL_PARAM_PREFIX, strlen(LITERAL_PARAM_PREFIX)) == 0) {
+					eligible = false;
+				}
+			} else if(t == STRING) {
+				// Strings are written back unescaped, leave quoted text intact.
+				if(strpbrk(tok.strval, "'\"\\")) eligible = false;
+				// Lexer strips string's closing quote.
+				asprintf(&token.text, "%c%s%c", *tok.s, tok.strval, *tok.s);
+				token.strval = tok.strval;
+			} else {
+				token.text = strdup(tok.s);
+				if(t == INTEGER) token.value = SI_LongVal(tok.longval);
+				else if(t == FLOAT) token.value = SI_DoubleVal(tok.dval);
+			}
+			if(_write_token(t)) eligible = false;
+			text_len += strlen(token.text) + 1;
+			tokens = array_append(tokens, token);
+		}
+		yylex_destroy();
+
+		bool *extract = (eligible) ? _extracted_literals(tokens) : NULL;
+		uint count = array_len(tokens);
+		uint extracted = 0;
+		char *normalized = NULL;
+
+		if(extract) {
+			for(uint i = 0; i < count; i++) extracted += extract[i];
+		}
+
+		if(extracted > 0) {
+			// Each literal is replaced by $<prefix><index>.
+			normalized = rm_malloc(text_len + extracted * (strlen(LITERAL_PARAM_PREFIX) + 12) + 1);
+			char *s = normalized;
+			if(!*values) *values = AST_Params_New();
+
+			uint param_idx = 0;
+			for(uint i = 0; i < count; i++) {
+				LiteralToken *token = tokens + i;
+				bool negate = false;
+
+				// Separate tokens by a single space, parameter names follow '$'.
+				if(i > 0 && tokens[i-1].type != DOLLAR) *s++ = ' ';
+
+				// Unary minus is part of the literal, e.g. n.v > -1
+				if(token->type == DASH && i + 1 < count && extract[i+1] &&
+				   tokens[i+1].type != STRING && (i == 0 || !_operand_token(tokens[i-1].type))) {
+					negate = true;
+					token++;
+					i++;
+				}
+
+				if(!extract[i]) {
+					s += sprintf(s, "%s", token->text);
+					continue;
+				}
+
+				char name[strlen(LITERAL_PARAM_PREFIX) + 12];
+				sprintf(name, LITERAL_PARAM_PREFIX "%u", param_idx++);
+				s += sprintf(s, "$%s", name);
+
+				AST_Param *param = AST_Params_Get(*values, name);
+				if(token->type == STRING) {
+					param->value = SI_DuplicateStringVal(token->strval);
+				} else {
+					param->value = token->value;
+					if(negate) param->value = (token->type == INTEGER) ?
+						SI_LongVal(-token->value.longval) : SI_DoubleVal(-token->value.doubleval);
+				}
+			}
+			*s = '\0';
+		}
+
+		free(extract);
+		_free_literal_tokens(tokens);
+		return normalized;
+	}
 }
@@ -360,8 +360,8 @@ static void yy_fatal_error (yyconst char msg[]  );
 	*yy_cp = '\0'; \
 	(yy_c_buf_p) = yy_cp;
 
-#define YY_NUM_RULES 57
-#define YY_END_OF_BUFFER 58
+#define YY_NUM_RULES 58
+#define YY_END_OF_BUFFER 59
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -369,13 +369,13 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static yyconst flex_int16_t yy_accept[155] =
+static yyconst flex_int16_t yy_accept[156] =
     {   0,
-        0,    0,   58,   57,   55,   56,   57,   57,   57,   33,
+        0,    0,   59,   58,   56,   57,   58,   58,   58,   33,
        34,   52,   53,   32,   47,   50,   51,   29,   48,   46,
        44,   45,   30,   30,   30,   30,   30,   30,   30,   30,
        30,   30,   30,   30,   30,   30,   30,   30,   30,   35,
-       36,   37,   54,   38,   55,   43,    0,   31,    0,    0,
+       36,   37,   54,   38,   56,   43,    0,   31,    0,    0,
         0,   41,   49,   28,    0,   29,   42,   40,   39,   30,
        30,   10,   17,   30,   30,   30,   30,   30,   30,   30,
        30,   30,   30,   30,   22,    2,   30,   30,   30,   30,
@@ -387,7 +387,7 @@ static yyconst flex_int16_t yy_accept[155] =
        30,   30,   30,   30,   25,   30,   30,   13,    3,   30,
        30,   16,   30,   30,   30,   30,    4,   21,   20,    5,
        15,   14,   30,   30,   12,   27,    6,    7,   30,    8,
-       24,   30,   11,    0
+       24,   30,   11,   55,    0
     } ;
 
 static yyconst flex_int32_t yy_ec[256] =
@@ -395,7 +395,7 @@ static yyconst flex_int32_t yy_ec[256] =
         1,    1,    1,    1,    1,    1,    1,    1,    2,    3,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    2,    4,    5,    1,    1,    1,    1,    6,    7,
+        1,    2,    4,    5,    1,   71,    1,    1,    6,    7,
         8,    9,   10,   11,   12,   13,   14,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   16,    1,   17,
        18,   19,    1,    1,   20,   21,   22,   23,   24,   25,
@@ -422,7 +422,7 @@ static yyconst flex_int32_t yy_ec[256] =
         1,    1,    1,    1,    1
     } ;
 
-static yyconst flex_int32_t yy_meta[71] =
+static yyconst flex_int32_t yy_meta[72] =
     {   0,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    2,    1,    1,    2,    1,    1,    1,    1,    2,
@@ -430,53 +430,54 @@ static yyconst flex_int32_t yy_meta[71] =
         2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
         2,    2,    1,    1,    1,    2,    2,    2,    2,    2,
         2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
-        2,    2,    2,    2,    2,    2,    2,    1,    1,    1
+        2,    2,    2,    2,    2,    2,    2,    1,    1,    1,
+        1
     } ;
 
-static yyconst flex_int16_t yy_base[160] =
+static yyconst flex_int16_t yy_base[156] =
     {   0,
-        0,    0,  215,  309,  207,  309,  190,   66,   67,  309,
-      309,  309,  309,  309,  188,   59,  309,   62,  309,   64,
-      309,  180,   46,   36,   60,   62,    0,   61,   51,   59,
-       68,   55,   64,   65,   96,   63,   69,  101,   63,  309,
-      309,  309,  309,  309,  145,  309,   88,  309,  128,   95,
-      131,  309,  309,   90,   80,  123,  309,  309,  309,    0,
-      107,  113,    0,  109,  117,  112,  107,  111,  117,  127,
-      120,  115,  121,  127,    0,  136,  124,  125,  132,  125,
-      126,  147,  141,  156,  137,  179,  187,  188,  189,  190,
-        0,    0,  168,  180,  177,  180,  167,  175,  174,  179,
-
-      184,  191,  188,  185,  193,  180,    0,  185,  197,  194,
-      189,  210,  211,    0,  208,  211,    0,  223,    0,  228,
-      213,  217,  229,  233,    0,  223,  224,    0,    0,  228,
-      238,    0,  241,  241,  242,  235,    0,    0,    0,    0,
-        0,    0,  236,  247,    0,    0,    0,    0,  250,    0,
-        0,  237,    0,  309,  300,  302,   83,  304,  306
+        0,    0,    0,   72,   71,    0,   56,   74,  145,    0,
+        0,    0,    0,    0,  198,  205,    0,  206,    0,  210,
+        0,  205,  212,  247,  261,  258,  188,  211,  252,  259,
+      271,  251,  265,  268,  300,  266,  271,  304,  283,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  358,    0,
+      429,    0,    0,  210,    0,    0,    0,    0,    0,    0,
+      293,  298,    0,  305,  477,  472,  467,  471,  475,  484,
+      478,  473,  476,  482,    0,  491,  478,  479,  490,  481,
+      481,  498,  486,  501,    0,    0,    0,    0,    0,    0,
+        0,    0,  501,  506,  515,  521,  509,  515,  516,  530,
+
+      527,  534,  532,  529,  537,  524,    0,  529,  542,  539,
+      534,  541,  540,    0,  535,  536,    0,  548,    0,  553,
+      538,  545,  559,  566,    0,  561,  564,    0,    0,  568,
+      567,    0,  582,  582,  583,  576,    0,    0,    0,    0,
+        0,    0,  577,  588,    0,    0,    0,    0,  591,    0,
+        0,  577,    0,    0,  663
     } ;
 
-static yyconst flex_int16_t yy_def[160] =
+static yyconst flex_int16_t yy_def[156] =
     {   0,
-      154,    1,  154,  154,  154,  154,  154,  155,  156,  154,
-      154,  154,  154,  154,  154,  154,  154,  154,  154,  154,
-      154,  154,  157,  157,  157,  157,  157,  157,  157,  157,
-      157,  157,  157,  157,  157,  157,  157,  157,  157,  154,
-      154,  154,  154,  154,  154,  154,  155,  154,  158,  156,
-      159,  154,  154,  154,  154,  154,  154,  154,  154,  157,
-      157,  157,  157,  157,  157,  157,  157,  157,  157,  157,
-      157,  157,  157,  157,  157,  157,  157,  157,  157,  157,
-      157,  157,  157,  157,  155,  155,  158,  156,  156,  159,
-      157,  157,  157,  157,  157,  157,  157,  157,  157,  157,
-
-      157,  157,  157,  157,  157,  157,  157,  157,  157,  157,
-      157,  157,  157,  157,  157,  157,  157,  157,  157,  157,
-      157,  157,  157,  157,  157,  157,  157,  157,  157,  157,
-      157,  157,  157,  157,  157,  157,  157,  157,  157,  157,
-      157,  157,  157,  157,  157,  157,  157,  157,  157,  157,
-      157,  157,  157,    0,  154,  154,  154,  154,  154
+      155,    1,  155,  155,    4,    4,    4,    1,    1,    4,
+        4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+        4,    4,    4,   23,   24,   24,   24,   27,   27,   27,
+       27,   27,   27,   27,   27,   27,   27,   27,   27,    4,
+        4,    4,    4,    4,    5,    4,    8,    4,    8,    9,
+        9,    4,    4,    4,   54,   18,    4,    4,    4,   27,
+       27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+       27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+       27,   27,   27,   27,    8,    8,   49,    9,    9,   51,
+       27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+
+       27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+       27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+       27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+       27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+       27,   27,   27,   27,   27,   27,   27,   27,   27,   27,
+       27,   27,   27,  155,    0
     } ;
 
-static yyconst flex_int16_t yy_nxt[380] =
-    {   0,
+static yyconst flex_int16_t yy_nxt[735] =
+    {   3,
         4,    5,    6,    7,    8,    9,   10,   11,   12,   13,
        14,   15,   16,   17,   18,   19,   20,   21,   22,   23,
        24,   25,   26,   27,   28,   27,   27,   29,   27,   27,
@@ -484,44 +485,84 @@ static yyconst flex_int16_t yy_nxt[380] =
        27,   39,   40,    4,   41,   23,   24,   25,   26,   27,
        28,   27,   27,   29,   27,   30,   31,   32,   33,   27,
        34,   35,   36,   37,   38,   27,   39,   42,   43,   44,
-       48,   53,   48,   54,   55,   57,   56,   63,   61,   64,
-       69,   58,   62,   70,   60,   66,   71,   72,   77,   67,
-       84,   73,   48,   74,   54,   65,   75,   68,   80,   76,
-
-       48,   81,   63,   61,   54,   64,   69,   62,   70,   49,
-       51,   66,   71,   72,   77,   67,   84,   73,   74,   78,
-       65,   75,   68,   80,   76,   79,   81,   82,   83,   91,
-       47,   49,   86,   50,   92,   55,   89,   56,   51,   93,
-       94,   48,   95,   97,   98,   78,   45,   99,   96,  100,
-       79,  101,  102,   82,   83,   91,  103,  104,  105,  108,
-       92,  106,  107,  109,   93,  110,   94,   95,   97,   98,
-      111,   87,   99,   96,   90,  100,  101,  102,  112,  113,
-       49,  103,  104,   48,  105,  108,  106,  107,  109,   47,
-      110,   86,   50,   48,   48,   89,  111,   59,  114,  115,
-
-      116,  117,  121,  112,  118,  113,   52,   46,   45,  119,
-      120,  122,  123,  124,  154,  125,  126,  154,  127,  128,
-      129,  130,   49,  114,  131,  115,  116,  117,  121,  118,
-       87,   51,   51,   90,  119,  120,  132,  122,  123,  124,
-      125,  133,  126,  127,  128,  134,  129,  130,  135,  131,
-      136,  137,  154,  138,  139,  140,  141,  154,  142,  143,
-      144,  145,  132,  146,  147,  148,  133,  149,  150,  151,
-      134,  152,  154,  135,  153,  154,  136,  137,  138,  139,
-      154,  140,  141,  142,  143,  144,  154,  145,  154,  146,
-      147,  148,  149,  150,  154,  151,  154,  152,  154,  153,
-
-       47,   47,   50,   50,   85,   85,   88,   88,    3,  154,
-      154,  154,  154,  154,  154,  154,  154,  154,  154,  154,
-      154,  154,  154,  154,  154,  154,  154,  154,  154,  154,
-      154,  154,  154,  154,  154,  154,  154,  154,  154,  154,
-      154,  154,  154,  154,  154,  154,  154,  154,  154,  154,
-      154,  154,  154,  154,  154,  154,  154,  154,  154,  154,
-      154,  154,  154,  154,  154,  154,  154,  154,  154,  154,
-      154,  154,  154,  154,  154,  154,  154,  154,  154
+      154,    3,   45,   46,   47,   47,   47,   47,   48,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   49,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   50,   50,   50,   50,   50,
+       48,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   51,   50,
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+
+       50,   50,   50,   50,   50,   50,   50,   50,   50,   50,
+       50,   50,   50,   50,   50,   50,   52,   53,   55,   54,
+       56,   57,   59,   60,   54,    0,   60,   58,    0,   60,
+       69,   60,   60,   60,   60,   60,   60,   60,   60,   60,
+       60,   60,   60,   60,   61,   60,   60,   60,   62,   60,
+       60,   60,   60,   60,   60,    0,   69,   60,   60,   60,
+       60,   60,   60,   60,   60,   60,   60,   60,   60,   61,
+       60,   60,   60,   62,   60,   60,   60,   60,   60,   60,
+       64,   66,    0,   60,   70,   67,   71,    0,   63,   74,
+       72,   77,    0,   68,   73,    0,   65,   75,    0,   60,
+
+       76,   80,   60,   81,   60,    0,   64,   66,   60,   70,
+       84,   67,   71,   63,   74,   91,   72,   77,   68,   92,
+       73,   65,   75,   78,   60,   76,   80,   60,   81,   79,
+       82,   83,    0,    0,    0,   93,   84,    0,    0,    0,
+        0,   91,    0,    0,    0,   92,    0,    0,    0,   78,
+        0,    0,    0,    0,   79,    0,   82,   83,   85,   85,
+       93,   85,   86,   85,   85,   85,   85,   85,   85,   85,
+       85,   85,   85,   85,   85,   85,   85,   85,   85,   85,
+       85,   85,   85,   85,   85,   85,   85,   85,   85,   85,
+       85,   85,   85,   85,   85,   85,   85,   85,   85,   85,
+
+       85,   87,   85,   85,   85,   85,   85,   85,   85,   85,
+       85,   85,   85,   85,   85,   85,   85,   85,   85,   85,
+       85,   85,   85,   85,   85,   85,   85,   85,   85,   88,
+       88,    0,   88,   88,   89,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   90,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+
+       94,    0,   95,   97,   98,   99,  100,    0,   96,  101,
+      102,  103,  104,  105,    0,  106,  107,  108,    0,  109,
+      110,  111,    0,  112,  113,  115,   94,   95,   97,   98,
+       99,  114,  100,   96,  101,  102,  103,  104,  116,  105,
+      106,  107,  117,  108,  109,  110,  118,  111,  112,  119,
+      113,  115,  120,  121,  122,  123,  114,  124,    0,  125,
+      126,    0,  127,  128,  116,  129,  130,  132,  117,  131,
+      133,  118,  134,  135,  119,  136,  137,  120,  138,  121,
+      122,  123,  139,  124,  125,  140,  126,  127,  128,  141,
+      145,  129,  130,  132,  131,  133,  142,  134,  135,  143,
+
+      144,  136,  137,  138,  146,  147,  148,  139,  149,  150,
+      151,  140,  152,    0,  153,  141,  145,    0,    0,    0,
+        0,  142,    0,    0,  143,  144,    0,    0,    0,    0,
+      146,  147,  148,  149,  150,    0,  151,    0,  152,  153,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  155,  155,  155,  155,  155,  155,  155,  155,
+      155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+      155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+      155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+
+      155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+      155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+      155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+      155,  155,  155,  155
     } ;
 
-static yyconst flex_int16_t yy_chk[380] =
-    {   0,
+static yyconst flex_int16_t yy_chk[735] =
+    {   1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
@@ -529,40 +570,80 @@ static yyconst flex_int16_t yy_chk[380] =
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        8,   16,    9,   16,   18,   20,   18,   24,   23,   25,
-       28,   20,   23,   29,  157,   26,   30,   31,   34,   26,
-       39,   31,   47,   32,   55,   25,   33,   26,   36,   33,
-
-       50,   37,   24,   23,   54,   25,   28,   23,   29,    8,
-        9,   26,   30,   31,   34,   26,   39,   31,   32,   35,
-       25,   33,   26,   36,   33,   35,   37,   38,   38,   61,
-       49,   47,   49,   51,   62,   56,   51,   56,   50,   64,
-       65,   85,   66,   67,   68,   35,   45,   69,   66,   70,
-       35,   71,   72,   38,   38,   61,   73,   74,   76,   79,
-       62,   77,   78,   80,   64,   81,   65,   66,   67,   68,
-       82,   49,   69,   66,   51,   70,   71,   72,   83,   84,
-       85,   73,   74,   86,   76,   79,   77,   78,   80,   87,
-       81,   87,   90,   88,   89,   90,   82,   22,   93,   94,
-
-       95,   96,  100,   83,   97,   84,   15,    7,    5,   98,
-       99,  101,  102,  103,    3,  104,  105,    0,  106,  108,
-      109,  110,   86,   93,  111,   94,   95,   96,  100,   97,
-       87,   88,   89,   90,   98,   99,  112,  101,  102,  103,
-      104,  113,  105,  106,  108,  115,  109,  110,  116,  111,
-      118,  120,    0,  121,  122,  123,  124,    0,  126,  127,
-      130,  131,  112,  133,  134,  135,  113,  136,  143,  144,
-      115,  149,    0,  116,  152,    0,  118,  120,  121,  122,
-        0,  123,  124,  126,  127,  130,    0,  131,    0,  133,
-      134,  135,  136,  143,    0,  144,    0,  149,    0,  152,
-
-      155,  155,  156,  156,  158,  158,  159,  159,  154,  154,
-      154,  154,  154,  154,  154,  154,  154,  154,  154,  154,
-      154,  154,  154,  154,  154,  154,  154,  154,  154,  154,
-      154,  154,  154,  154,  154,  154,  154,  154,  154,  154,
-      154,  154,  154,  154,  154,  154,  154,  154,  154,  154,
-      154,  154,  154,  154,  154,  154,  154,  154,  154,  154,
-      154,  154,  154,  154,  154,  154,  154,  154,  154,  154,
-      154,  154,  154,  154,  154,  154,  154,  154,  154
+        1,    4,    5,    7,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+        8,    8,    8,    8,    8,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,   15,   16,   18,   16,
+       18,   20,   22,   23,   54,    0,   23,   20,    0,   27,
+       28,   23,   23,   23,   23,   23,   23,   23,   23,   23,
+       23,   23,   23,   23,   23,   23,   23,   23,   23,   23,
+       23,   23,   23,   23,   27,    0,   28,   23,   23,   23,
+       23,   23,   23,   23,   23,   23,   23,   23,   23,   23,
+       23,   23,   23,   23,   23,   23,   23,   23,   23,   24,
+       25,   26,    0,   24,   29,   26,   30,    0,   24,   32,
+       31,   34,    0,   26,   31,    0,   25,   33,    0,   26,
+
+       33,   36,   25,   37,   24,    0,   25,   26,   24,   29,
+       39,   26,   30,   24,   32,   61,   31,   34,   26,   62,
+       31,   25,   33,   35,   26,   33,   36,   25,   37,   35,
+       38,   38,    0,    0,    0,   64,   39,    0,    0,    0,
+        0,   61,    0,    0,    0,   62,    0,    0,    0,   35,
+        0,    0,    0,    0,   35,    0,   38,   38,   49,   49,
+       64,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   51,
+       51,    0,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+       51,   51,   51,   51,   51,   51,   51,   51,   51,   51,
+
+       65,    0,   66,   67,   68,   69,   70,    0,   66,   71,
+       72,   73,   74,   76,    0,   77,   78,   79,    0,   80,
+       81,   82,    0,   83,   84,   94,   65,   66,   67,   68,
+       69,   93,   70,   66,   71,   72,   73,   74,   95,   76,
+       77,   78,   96,   79,   80,   81,   97,   82,   83,   98,
+       84,   94,   99,  100,  101,  102,   93,  103,    0,  104,
+      105,    0,  106,  108,   95,  109,  110,  112,   96,  111,
+      113,   97,  115,  116,   98,  118,  120,   99,  121,  100,
+      101,  102,  122,  103,  104,  123,  105,  106,  108,  124,
+      131,  109,  110,  112,  111,  113,  126,  115,  116,  127,
+
+      130,  118,  120,  121,  133,  134,  135,  122,  136,  143,
+      144,  123,  149,    0,  152,  124,  131,    0,    0,    0,
+        0,  126,    0,    0,  127,  130,    0,    0,    0,    0,
+      133,  134,  135,  136,  143,    0,  144,    0,  149,  152,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  155,  155,  155,  155,  155,  155,  155,  155,
+      155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+      155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+      155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+
+      155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+      155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+      155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+      155,  155,  155,  155
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -597,7 +678,7 @@ int yycolumn = 1;
     tok.pos = yycolumn; \
     tok.s = yytext;
     /* tok.s = strdup(yytext); */
-#line 601 "lex.yy.c"
+#line 682 "lex.yy.c"
 
 #define INITIAL 0
 
@@ -782,7 +863,7 @@ YY_DECL
 #line 20 "lexer.l"
 
 
-#line 786 "lex.yy.c"
+#line 867 "lex.yy.c"
 
 	if ( !(yy_init) )
 		{
@@ -835,13 +916,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 155 )
+				if ( yy_current_state >= 156 )
 					yy_c = yy_meta[(unsigned int) yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
 			++yy_cp;
 			}
-		while ( yy_base[yy_current_state] != 309 );
+		while ( yy_base[yy_current_state] != 663 );
 
 yy_find_action:
 		yy_act = yy_accept[yy_current_state];
@@ -1152,21 +1233,26 @@ YY_RULE_SETUP
 	YY_BREAK
 case 55:
 YY_RULE_SETUP
-#line 97 "lexer.l"
-/* ignore whitespace */
+#line 96 "lexer.l"
+{ return DOLLAR; } /* Query parameter prefix: $name */
 	YY_BREAK
 case 56:
-/* rule 56 can match eol */
 YY_RULE_SETUP
 #line 98 "lexer.l"
-{ yycolumn = 1; } /* ignore whitespace */
+/* ignore whitespace */
 	YY_BREAK
 case 57:
+/* rule 57 can match eol */
+YY_RULE_SETUP
+#line 99 "lexer.l"
+{ yycolumn = 1; } /* ignore whitespace */
+	YY_BREAK
+case 58:
 YY_RULE_SETUP
-#line 100 "lexer.l"
+#line 101 "lexer.l"
 ECHO;
 	YY_BREAK
-#line 1170 "lex.yy.c"
+#line 1256 "lex.yy.c"
 case YY_STATE_EOF(INITIAL):
 	yyterminate();
 
@@ -1458,7 +1544,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 155 )
+			if ( yy_current_state >= 156 )
 				yy_c = yy_meta[(unsigned int) yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
@@ -1486,11 +1572,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 155 )
+		if ( yy_current_state >= 156 )
 			yy_c = yy_meta[(unsigned int) yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
-	yy_is_jam = (yy_current_state == 154);
+	yy_is_jam = (yy_current_state == 155);
 
 	return yy_is_jam ? 0 : yy_current_state;
 }
@@ -2163,7 +2249,7 @@ void yyfree (void * ptr )
 
 #define YYTABLES_NAME "yytables"
 
-#line 100 "lexer.l"
+#line 101 "lexer.l"
 
 
 
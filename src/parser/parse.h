@@ -11,6 +11,7 @@
 
 typedef struct {
     AST **root;
+    AST_Params *params;     // Parameters referred to by query.
     int ok;
     char *errorMsg;
 } parseCtx;
@@ -10,4 +10,11 @@
 #include "ast.h"
 
 AST **Query_Parse(const char *q, size_t len, char **err);
+
+/* Replaces literals within WHERE clauses, inline property maps, SKIP and LIMIT
+ * with parameters, such that queries differing only by literals are identical.
+ * Returns the rewritten query and adds the literals to values,
+ * returns NULL if query modifies the graph, contains no such literals
+ * or contains strings holding quotes or backslashes. */
+char *Query_ExtractLiterals(const char *q, size_t len, AST_Params **values);
 #endif
@@ -0,0 +1,176 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Redis Labs Source Available License Agreement
+*/
+
+#include "proc_stats.h"
+#include "../value.h"
+#include "../util/arr.h"
+#include "../util/rmalloc.h"
+#include "../graph/graphcontext.h"
+#include <stdio.h>
+
+// CALL db.stats()
+// Yields a row per (entity, statistic, value), entities are described as:
+// graph, :label, ()-[:relation]->(), (:label)-[:relation]->(),
+// ()-[:relation]->(:label) and :label(attribute) for indices.
+
+typedef struct {
+    char *entity;           // Described entity.
+    const char *statistic;  // Statistic name.
+    SIValue value;          // Statistic value.
+} StatsRow;
+
+typedef struct {
+    uint row_idx;       // Current row.
+    StatsRow *rows;     // Collected statistics.
+    SIValue *output;    // Output row.
+} StatsContext;
+
+static void _AddRow(StatsContext *pdata, const char *entity, const char *statistic, SIValue value) {
+    StatsRow row = {.entity = rm_strdup(entity), .statistic = statistic, .value = value};
+    pdata->rows = array_append(pdata->rows, row);
+}
+
+static void _CollectLabelStats(StatsContext *pdata, GraphContext *gc) {
+    char entity[1024];
+    unsigned short label_count = GraphContext_SchemaCount(gc, SCHEMA_NODE);
+    for(int i = 0; i < label_count; i++) {
+        Schema *s = GraphContext_GetSchemaByID(gc, i, SCHEMA_NODE);
+        snprintf(entity, sizeof(entity), ":%s", Schema_GetName(s));
+        _AddRow(pdata, entity, "nodes", SI_LongVal(GraphStatistics_NodeCount(&gc->g->stats, s->id)));
+
+        unsigned short index_count = Schema_IndexCount(s);
+        for(int j = 0; j < index_count; j++) {
+            Index *idx = s->indices[j];
+            snprintf(entity, sizeof(entity), ":%s(%s)", idx->label, idx->attribute);
+            _AddRow(pdata, entity, "numeric_entries", SI_LongVal(Index_EntryCount(idx, T_DOUBLE)));
+            _AddRow(pdata, entity, "numeric_distinct", SI_LongVal(Index_DistinctCount(idx, T_DOUBLE)));
+            _AddRow(pdata, entity, "string_entries", SI_LongVal(Index_EntryCount(idx, T_STRING)));
+            _AddRow(pdata, entity, "string_distinct", SI_LongVal(Index_DistinctCount(idx, T_STRING)));
+        }
+    }
+}
+
+static inline SIValue _Average(uint64_t total, uint64_t count) {
+    return SI_DoubleVal((count) ? (double)total / count : 0);
+}
+
+static void _CollectRelationStats(StatsContext *pdata, GraphContext *gc) {
+    char entity[1024];
+    Graph *g = gc->g;
+    unsigned short relation_count = GraphContext_SchemaCount(gc, SCHEMA_EDGE);
+    for(int i = 0; i < relation_count; i++) {
+        Schema *r = GraphContext_GetSchemaByID(gc, i, SCHEMA_EDGE);
+        const char *relation = Schema_GetName(r);
+        RelationStatistics stats;
+        GraphStatistics_GetRelationStatistics(g, r->id, true, &stats);
+
+        snprintf(entity, sizeof(entity), "()-[:%s]->()", relation);
+        _AddRow(pdata, entity, "edges", SI_LongVal(GraphStatistics_EdgeCount(&g->stats, r->id)));
+        _AddRow(pdata, entity, "pairs", SI_LongVal(stats.pairs));
+        _AddRow(pdata, entity, "sources", SI_LongVal(stats.sources));
+        _AddRow(pdata, entity, "destinations", SI_LongVal(stats.destinations));
+        _AddRow(pdata, entity, "avg_out_degree", _Average(stats.pairs, stats.sources));
+        _AddRow(pdata, entity, "max_out_degree", SI_LongVal(stats.max_out_degree));
+        _AddRow(pdata, entity, "avg_in_degree", _Average(stats.pairs, stats.destinations));
+        _AddRow(pdata, entity, "max_in_degree", SI_LongVal(stats.max_in_degree));
+
+        // Label specific pairs, omit labels not connected by relation.
+        uint label_count = array_len(stats.src_label_pairs);
+        for(uint j = 0; j < label_count; j++) {
+            const char *label = Schema_GetName(GraphContext_GetSchemaByID(gc, j, SCHEMA_NODE));
+            if(stats.src_label_pairs[j]) {
+                snprintf(entity, sizeof(entity), "(:%s)-[:%s]->()", label, relation);
+                _AddRow(pdata, entity, "pairs", SI_LongVal(stats.src_label_pairs[j]));
+            }
+            if(stats.dest_label_pairs[j]) {
+                snprintf(entity, sizeof(entity), "()-[:%s]->(:%s)", relation, label);
+                _AddRow(pdata, entity, "pairs", SI_LongVal(stats.dest_label_pairs[j]));
+            }
+        }
+        RelationStatistics_Free(&stats);
+    }
+}
+
+ProcedureResult Proc_StatsInvoke(ProcedureCtx *ctx, char **args) {
+    if(array_len(args) != 0) return PROCEDURE_ERR;
+
+    GraphContext *gc = GraphContext_GetFromTLS();
+    StatsContext *pdata = rm_malloc(sizeof(StatsContext));
+    pdata->row_idx = 0;
+    pdata->rows = array_new(StatsRow, 16);
+    pdata->output = array_new(SIValue, 6);
+    pdata->output = array_append(pdata->output, SI_ConstStringVal("entity"));
+    pdata->output = array_append(pdata->output, SI_ConstStringVal("")); // Place holder.
+    pdata->output = array_append(pdata->output, SI_ConstStringVal("statistic"));
+    pdata->output = array_append(pdata->output, SI_ConstStringVal("")); // Place holder.
+    pdata->output = array_append(pdata->output, SI_ConstStringVal("value"));
+    pdata->output = array_append(pdata->output, SI_NullVal()); // Place holder.
+
+    _AddRow(pdata, "graph", "nodes", SI_LongVal(Graph_NodeCount(gc->g)));
+    _AddRow(pdata, "graph", "edges", SI_LongVal(Graph_EdgeCount(gc->g)));
+    _CollectLabelStats(pdata, gc);
+    _CollectRelationStats(pdata, gc);
+
+    ctx->privateData = pdata;
+    return PROCEDURE_OK;
+}
+
+SIValue* Proc_StatsStep(ProcedureCtx *ctx) {
+    assert(ctx->privateData);
+
+    StatsContext *pdata = (StatsContext*)ctx->privateData;
+
+    // Depleted?
+    if(pdata->row_idx >= array_len(pdata->rows)) return NULL;
+
+    StatsRow *row = pdata->rows + pdata->row_idx++;
+    pdata->output[1] = SI_ConstStringVal(row->entity);
+    pdata->output[3] = SI_ConstStringVal((char*)row->statistic);
+    pdata->output[5] = row->value;
+    return pdata->output;
+}
+
+ProcedureResult Proc_StatsFree(ProcedureCtx *ctx) {
+    // Clean up.
+    if(ctx->privateData) {
+        StatsContext *pdata = ctx->privateData;
+        uint row_count = array_len(pdata->rows);
+        for(uint i = 0; i < row_count; i++) rm_free(pdata->rows[i].entity);
+        array_free(pdata->rows);
+        array_free(pdata->output);
+        rm_free(ctx->privateData);
+    }
+
+    return PROCEDURE_OK;
+}
+
+ProcedureCtx* Proc_StatsCtx() {
+    void *privateData = NULL;
+    ProcedureOutput **outputs = array_new(ProcedureOutput*, 3);
+    ProcedureOutput *output = rm_malloc(sizeof(ProcedureOutput));
+    output->name = "entity";
+    output->type = T_CONSTSTRING;
+    outputs = array_append(outputs, output);
+
+    output = rm_malloc(sizeof(ProcedureOutput));
+    output->name = "statistic";
+    output->type = T_CONSTSTRING;
+    outputs = array_append(outputs, output);
+
+    output = rm_malloc(sizeof(ProcedureOutput));
+    output->name = "value";
+    output->type = SI_NUMERIC;
+    outputs = array_append(outputs, output);
+
+    ProcedureCtx *ctx = ProcCtxNew("db.stats",
+                                    0,
+                                    outputs,
+                                    Proc_StatsStep,
+                                    Proc_StatsInvoke,
+                                    Proc_StatsFree,
+                                    privateData);
+    return ctx;
+}
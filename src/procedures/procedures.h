@@ -9,3 +9,4 @@
 #include "proc_property_keys.h"
 #include "proc_fulltext_query.h"
 #include "proc_fulltext_create_index.h"
+#include "proc_stats.h"
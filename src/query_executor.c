@@ -54,7 +54,9 @@ static void _inlineProperties(AST *ast) {
             // TODO can update grammar so that this constant is already an ExpressionNode
             // instead of an SIValue
             Vector_Get(properties, j+1, &val);
-            rhs = New_AST_AR_EXP_ConstOperandNode(*val);
+            AST_Param *param = AST_Params_MapValueParam(ast->params, val);
+            if(param) rhs = New_AST_AR_EXP_ParamOperandNode(param);
+            else rhs = New_AST_AR_EXP_ConstOperandNode(*val);
 
             AST_FilterNode *filterNode = New_AST_PredicateNode(lhs, EQ, rhs);
             
@@ -121,6 +121,18 @@ DataBlockIterator *DataBlock_Scan(const DataBlock *dataBlock) {
     return DataBlockIterator_New(startBlock, 0, endPos, 1);
 }
 
+DataBlockIterator *DataBlock_ScanRange(const DataBlock *dataBlock, uint64_t start, uint64_t end) {
+    assert(dataBlock && start <= end);
+
+    // Clip range to datablock's populated positions.
+    uint64_t endPos = dataBlock->itemCount + array_len(dataBlock->deletedIdx);
+    if(end > endPos) end = endPos;
+    if(start >= end) return DataBlockIterator_New(dataBlock->blocks[0], 0, 0, 1);
+
+    Block *startBlock = dataBlock->blocks[start / BLOCK_CAP];
+    return DataBlockIterator_New(startBlock, start, end, 1);
+}
+
 // Make sure datablock can accommodate at least k items.
 void DataBlock_Accommodate(DataBlock *dataBlock, int64_t k) {
     // Compute number of free slots.
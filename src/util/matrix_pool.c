@@ -0,0 +1,91 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Redis Labs Source Available License Agreement
+*/
+
+#include "matrix_pool.h"
+#include "arr.h"
+#include <assert.h>
+#include <string.h>
+#include <pthread.h>
+
+static pthread_key_t _pool_key;
+static pthread_once_t _pool_key_once = PTHREAD_ONCE_INIT;
+
+// Frees pooled matrices, called on thread exit.
+static void _MatrixPool_Free(void *arg) {
+    GrB_Matrix *pool = (GrB_Matrix*)arg;
+    uint count = array_len(pool);
+    for(uint i = 0; i < count; i++) GrB_Matrix_free(pool + i);
+    array_free(pool);
+}
+
+static void _MatrixPool_CreateKey(void) {
+    assert(pthread_key_create(&_pool_key, _MatrixPool_Free) == 0);
+}
+
+// Returns calling thread's pool, ordered from least to most recently returned.
+static GrB_Matrix *_MatrixPool_Get(void) {
+    pthread_once(&_pool_key_once, _MatrixPool_CreateKey);
+    GrB_Matrix *pool = pthread_getspecific(_pool_key);
+    if(!pool) {
+        pool = array_new(GrB_Matrix, MATRIX_POOL_CAP);
+        pthread_setspecific(_pool_key, pool);
+    }
+    return pool;
+}
+
+// Removes the matrix at position idx, preserving pool's order.
+static void _MatrixPool_Remove(GrB_Matrix *pool, uint idx) {
+    uint count = array_len(pool);
+    memmove(pool + idx, pool + idx + 1, sizeof(GrB_Matrix) * (count - idx - 1));
+    array_pop(pool);
+}
+
+GrB_Matrix MatrixPool_Borrow(GrB_Type type, GrB_Index nrows, GrB_Index ncols) {
+    GrB_Matrix *pool = _MatrixPool_Get();
+
+    // Prefer the most recently returned matrix.
+    for(int i = array_len(pool) - 1; i >= 0; i--) {
+        GrB_Type t;
+        GrB_Index r;
+        GrB_Index c;
+        GrB_Matrix m = pool[i];
+        GxB_Matrix_type(&t, m);
+        GrB_Matrix_nrows(&r, m);
+        GrB_Matrix_ncols(&c, m);
+        if(t != type || r != nrows || c != ncols) continue;
+
+        _MatrixPool_Remove(pool, i);
+        return m;
+    }
+
+    GrB_Matrix m;
+    GrB_Matrix_new(&m, type, nrows, ncols);
+    return m;
+}
+
+void MatrixPool_Return(GrB_Matrix *m) {
+    assert(m && *m);
+    GrB_Matrix *pool = _MatrixPool_Get();
+
+    // Evict least recently returned matrix.
+    if(array_len(pool) == MATRIX_POOL_CAP) {
+        GrB_Matrix_free(pool);
+        _MatrixPool_Remove(pool, 0);
+    }
+
+    // Release matrix content, only its header is kept.
+    GrB_Matrix_clear(*m);
+    pool = array_append(pool, *m);
+    pthread_setspecific(_pool_key, pool);
+    *m = NULL;
+}
+
+void MatrixPool_Clear(void) {
+    GrB_Matrix *pool = _MatrixPool_Get();
+    uint count = array_len(pool);
+    for(uint i = 0; i < count; i++) GrB_Matrix_free(pool + i);
+    array_clear(pool);
+}
@@ -0,0 +1,30 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Redis Labs Source Available License Agreement
+*/
+
+#ifndef _MATRIX_POOL_H_
+#define _MATRIX_POOL_H_
+
+#include "../../deps/GraphBLAS/Include/GraphBLAS.h"
+
+#define MATRIX_POOL_CAP 16  // Maximum number of matrices kept by each thread.
+
+/* Per thread pool of workspace matrices, operations borrow a matrix of
+ * a given type and shape instead of creating one, and hand it back once
+ * they're done, sparing matrix creation and destruction for every query.
+ * A matrix may be returned by a thread other than the one borrowing it.
+ * Once a pool is full, its least recently returned matrix is freed. */
+
+// Retrieves an empty matrix of the given type and dimensions
+// from the calling thread's pool, a new matrix is created if none is available.
+GrB_Matrix MatrixPool_Borrow(GrB_Type type, GrB_Index nrows, GrB_Index ncols);
+
+// Clears matrix and hands it over to the calling thread's pool, sets *m to NULL.
+void MatrixPool_Return(GrB_Matrix *m);
+
+// Frees all matrices pooled by the calling thread.
+void MatrixPool_Clear(void);
+
+#endif
@@ -391,6 +391,7 @@ void _update_lower_bound(skiplistIterator *iter, skiplistKey bound, int exclusiv
   if (cmp < 0) {
     // This filter improves the bound
     iter->current = skiplistFindAtLeast(iter->sl, bound, exclusive);
+    if (iter->rangeMin && iter->sl->freeKey) iter->sl->freeKey(iter->rangeMin);
     iter->rangeMin = iter->sl->cloneKey(bound);
     iter->minExclusive = exclusive;
   } else if (cmp == 0 && exclusive && !iter->minExclusive) {
@@ -501,6 +502,24 @@ void skiplistIterate_Reset(skiplistIterator *iter) {
   iter->currentValOffset = 0;
 }
 
+void skiplistIterate_ClearRange(skiplistIterator *iter, skiplist *sl) {
+  // Free bounds using the free routine of the skiplist they were cloned by
+  if (iter->rangeMin && iter->sl->freeKey) {
+    iter->sl->freeKey(iter->rangeMin);
+  }
+  if (iter->rangeMax && iter->sl->freeKey) {
+    iter->sl->freeKey(iter->rangeMax);
+  }
+
+  iter->sl = sl;
+  iter->rangeMin = NULL;
+  iter->rangeMax = NULL;
+  iter->minExclusive = 0;
+  iter->maxExclusive = 0;
+  iter->current = sl->header->level[0].forward;
+  iter->currentValOffset = 0;
+}
+
 void skiplistIterate_Free(skiplistIterator *iter) {
   // Free lower and upper bounds if they exist and we have a free routine
   if (iter->rangeMin && iter->sl->freeKey) {
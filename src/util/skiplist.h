@@ -100,6 +100,8 @@ skiplistIterator* skiplistIterateRange(skiplist *sl, skiplistKey min, skiplistKe
 skiplistIterator* skiplistIterateAll(skiplist *sl);
 
 void skiplistIterate_Reset(skiplistIterator *iter);
+/* Drop iterator bounds, repositioning it at the first element of sl. */
+void skiplistIterate_ClearRange(skiplistIterator *iter, skiplist *sl);
 void skiplistIterate_Free(skiplistIterator *iter);
 
 skiplistVal* skiplistIterator_Next(skiplistIterator *it);
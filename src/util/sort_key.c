@@ -0,0 +1,143 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Redis Labs Source Available License Agreement
+*/
+
+#include "sort_key.h"
+#include "rmalloc.h"
+#include "../graph/entities/graph_entity.h"
+#include <string.h>
+
+// Leading byte of each encoded value, determines order between types.
+#define SORT_KEY_STRING     0x10
+#define SORT_KEY_BOOL       0x20
+#define SORT_KEY_NUMERIC    0x30
+#define SORT_KEY_NODE       0x40
+#define SORT_KEY_EDGE       0x41
+#define SORT_KEY_NULL       0x50
+
+#define SORT_KEY_MIN_CAP 256
+
+static inline void _SortKeyBuffer_Reserve(SortKeyBuffer *buf, size_t n) {
+    if(buf->len + n <= buf->cap) return;
+    size_t cap = buf->cap ? buf->cap : SORT_KEY_MIN_CAP;
+    while(cap < buf->len + n) cap *= 2;
+    buf->data = rm_realloc(buf->data, cap);
+    buf->cap = cap;
+}
+
+static inline void _SortKeyBuffer_PutByte(SortKeyBuffer *buf, unsigned char b) {
+    buf->data[buf->len++] = b;
+}
+
+// Writes v big endian, such that byte order matches numeric order.
+static inline void _SortKeyBuffer_PutUint64(SortKeyBuffer *buf, uint64_t v) {
+    for(int i = 7; i >= 0; i--) buf->data[buf->len++] = (unsigned char)(v >> (i * 8));
+}
+
+// Writes v big endian, such that byte order matches numeric order.
+static inline void _SortKeyBuffer_PutUint16(SortKeyBuffer *buf, uint16_t v) {
+    buf->data[buf->len++] = (unsigned char)(v >> 8);
+    buf->data[buf->len++] = (unsigned char)v;
+}
+
+/* Difference between integer i and d, its nearest double.
+ * Zero unless i can't be represented exactly by a double,
+ * in which case the difference is at most 2^10 in magnitude. */
+static inline int16_t _IntegerResidual(int64_t i, double d) {
+    // (int64_t)d overflows for d = 2^63, nearest double to INT64_MAX.
+    uint64_t rounded = (d >= 9223372036854775808.0) ? (1ULL << 63) : (uint64_t)(int64_t)d;
+    return (int16_t)(int64_t)((uint64_t)i - rounded);
+}
+
+// Maps a double onto an unsigned integer of the same order.
+static inline uint64_t _OrderedDouble(double d) {
+    if(d == 0) d = 0;   // -0.0 and 0.0 are equal.
+    uint64_t u;
+    memcpy(&u, &d, sizeof(u));
+    // Negatives are flipped entirely, positives are placed above them.
+    return (u & (1ULL << 63)) ? ~u : u | (1ULL << 63);
+}
+
+void SortKeyBuffer_Init(SortKeyBuffer *buf) {
+    buf->data = NULL;
+    buf->len = 0;
+    buf->cap = 0;
+}
+
+void SortKeyBuffer_Append(SortKeyBuffer *buf, SIValue v, bool descending) {
+    size_t start = buf->len;
+
+    switch(v.type) {
+        case T_STRING:
+        case T_CONSTSTRING: {
+            // Strings hold no NULL bytes, terminator sorts shorter prefixes first.
+            size_t len = strlen(v.stringval);
+            _SortKeyBuffer_Reserve(buf, len + 2);
+            _SortKeyBuffer_PutByte(buf, SORT_KEY_STRING);
+            memcpy(buf->data + buf->len, v.stringval, len);
+            buf->len += len;
+            _SortKeyBuffer_PutByte(buf, 0);
+            break;
+        }
+        case T_BOOL:
+            _SortKeyBuffer_Reserve(buf, 2);
+            _SortKeyBuffer_PutByte(buf, SORT_KEY_BOOL);
+            _SortKeyBuffer_PutByte(buf, v.longval ? 1 : 0);
+            break;
+        case T_INT64:
+        case T_DOUBLE: {
+            /* Integers and doubles are ordered by numeric value, equal values
+             * share the same key regardless of their type, e.g. 3 and 3.0.
+             * Integers too large to be represented exactly by a double
+             * are ordered by a trailing residual, zero for all other values. */
+            double d = SI_GET_NUMERIC(v);
+            int16_t residual = (v.type == T_INT64) ? _IntegerResidual(v.longval, d) : 0;
+            _SortKeyBuffer_Reserve(buf, 11);
+            _SortKeyBuffer_PutByte(buf, SORT_KEY_NUMERIC);
+            _SortKeyBuffer_PutUint64(buf, _OrderedDouble(d));
+            _SortKeyBuffer_PutUint16(buf, (uint16_t)residual ^ (1U << 15));
+            break;
+        }
+        case T_NODE:
+        case T_EDGE:
+            _SortKeyBuffer_Reserve(buf, 9);
+            _SortKeyBuffer_PutByte(buf, (v.type == T_NODE) ? SORT_KEY_NODE : SORT_KEY_EDGE);
+            _SortKeyBuffer_PutUint64(buf, ENTITY_GET_ID((GraphEntity*)v.ptrval));
+            break;
+        default:
+            // NULL and unorderable types.
+            _SortKeyBuffer_Reserve(buf, 1);
+            _SortKeyBuffer_PutByte(buf, SORT_KEY_NULL);
+            break;
+    }
+
+    if(descending) {
+        for(size_t i = start; i < buf->len; i++) buf->data[i] = ~buf->data[i];
+    }
+}
+
+void SortKeyBuffer_Clear(SortKeyBuffer *buf) {
+    buf->len = 0;
+}
+
+void SortKeyBuffer_Free(SortKeyBuffer *buf) {
+    rm_free(buf->data);
+    SortKeyBuffer_Init(buf);
+}
+
+uint64_t SortKey_Prefix(const unsigned char *key, size_t len) {
+    uint64_t prefix = 0;
+    for(size_t i = 0; i < 8; i++) {
+        prefix <<= 8;
+        if(i < len) prefix |= key[i];
+    }
+    return prefix;
+}
+
+int SortKey_Compare(const unsigned char *a, size_t a_len, const unsigned char *b, size_t b_len) {
+    int rel = memcmp(a, b, (a_len < b_len) ? a_len : b_len);
+    if(rel) return rel;
+    return (a_len > b_len) - (a_len < b_len);
+}
@@ -0,0 +1,47 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Redis Labs Source Available License Agreement
+*/
+
+#ifndef _SORT_KEY_H_
+#define _SORT_KEY_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "../value.h"
+
+/* Sort keys are byte strings whose memcmp order matches the order
+ * SIValue_Order imposes on the values they encode, following Cypher's
+ * orderability string < boolean < numeric < NULL.
+ * Each encoded value is prefix free, such that a tuple of values
+ * is encoded by concatenating the encoding of each of its values. */
+
+/* Buffer holding encoded sort keys. */
+typedef struct {
+    unsigned char *data;    // Encoded keys.
+    size_t len;             // Number of bytes in use.
+    size_t cap;             // Number of bytes allocated.
+} SortKeyBuffer;
+
+// Initialize an empty buffer.
+void SortKeyBuffer_Init(SortKeyBuffer *buf);
+
+/* Appends the encoding of v to buf, when descending is set
+ * encoding is inverted such that greater values come first. */
+void SortKeyBuffer_Append(SortKeyBuffer *buf, SIValue v, bool descending);
+
+// Discards encoded keys, retaining allocated memory.
+void SortKeyBuffer_Clear(SortKeyBuffer *buf);
+
+// Free buffer's memory.
+void SortKeyBuffer_Free(SortKeyBuffer *buf);
+
+// Big endian interpretation of the first 8 bytes of key, zero padded.
+uint64_t SortKey_Prefix(const unsigned char *key, size_t len);
+
+// memcmp-like comparison of keys a and b.
+int SortKey_Compare(const unsigned char *a, size_t a_len, const unsigned char *b, size_t b_len);
+
+#endif
@@ -0,0 +1,200 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Redis Labs Source Available License Agreement
+*/
+
+#include "value_table.h"
+#include "rmalloc.h"
+#include "../graph/entities/graph_entity.h"
+#include "xxhash/xxhash.h"
+#include <assert.h>
+#include <string.h>
+
+// Smallest power of 2 >= n.
+static uint64_t _NextPowerOf2(uint64_t n) {
+    uint64_t p = 1;
+    while(p < n) p <<= 1;
+    return p;
+}
+
+// Normalize string types, constant strings are compared as strings.
+static inline SIType _KeyType(const SIValue v) {
+    return (v.type == T_CONSTSTRING) ? T_STRING : v.type;
+}
+
+static void _ValueTable_Rehash(ValueTable *table, uint64_t slot_count) {
+    rm_free(table->slots);
+    table->slot_count = slot_count;
+    table->slots = rm_calloc(slot_count, sizeof(uint64_t));
+
+    uint64_t mask = slot_count - 1;
+    for(uint64_t i = 0; i < table->entry_count; i++) {
+        uint64_t pos = table->entries[i].hash & mask;
+        while(table->slots[pos]) pos = (pos + 1) & mask;
+        table->slots[pos] = i + 1;
+    }
+}
+
+ValueTable *ValueTable_New(uint key_len, uint64_t expected_count) {
+    ValueTable *table = rm_malloc(sizeof(ValueTable));
+    table->key_len = key_len;
+    table->entry_count = 0;
+    table->entry_cap = (expected_count > 0) ? expected_count : 1;
+    table->entries = rm_malloc(sizeof(ValueTableEntry) * table->entry_cap);
+
+    // Keep load factor at or below 0.5.
+    uint64_t slot_count = _NextPowerOf2(expected_count * 2);
+    if(slot_count < VALUE_TABLE_MIN_SLOTS) slot_count = VALUE_TABLE_MIN_SLOTS;
+    table->slots = NULL;
+    _ValueTable_Rehash(table, slot_count);
+    return table;
+}
+
+uint64_t ValueTable_HashKey(const SIValue *key, uint key_len) {
+    uint64_t hash = 0;
+    for(uint i = 0; i < key_len; i++) {
+        SIValue v = key[i];
+        SIType t = _KeyType(v);
+        const void *data;
+        size_t len;
+        EntityID id;
+        double d;
+
+        switch(t) {
+            case T_NULL:
+                data = NULL;
+                len = 0;
+                break;
+            case T_STRING:
+                data = v.stringval;
+                len = strlen(v.stringval);
+                break;
+            case T_INT64:
+            case T_BOOL:
+                data = &v.longval;
+                len = sizeof(v.longval);
+                break;
+            case T_DOUBLE:
+                // 0.0 and -0.0 are considered equal.
+                d = (v.doubleval == 0) ? 0 : v.doubleval;
+                data = &d;
+                len = sizeof(d);
+                break;
+            case T_NODE:
+            case T_EDGE:
+                id = ENTITY_GET_ID((GraphEntity*)v.ptrval);
+                data = &id;
+                len = sizeof(id);
+                break;
+            case T_PTR:
+                data = &v.ptrval;
+                len = sizeof(v.ptrval);
+                break;
+            default:
+                assert(false);
+        }
+
+        // Mix in value type to differentiate between e.g. 1 and true.
+        hash = XXH64(&t, sizeof(t), hash);
+        if(len) hash = XXH64(data, len, hash);
+    }
+    return hash;
+}
+
+bool ValueTable_KeysEqual(const SIValue *a, const SIValue *b, uint key_len) {
+    for(uint i = 0; i < key_len; i++) {
+        SIType t = _KeyType(a[i]);
+        if(t != _KeyType(b[i])) return false;
+
+        switch(t) {
+            case T_NULL:
+                break;
+            case T_STRING:
+                if(strcmp(a[i].stringval, b[i].stringval) != 0) return false;
+                break;
+            case T_INT64:
+            case T_BOOL:
+                if(a[i].longval != b[i].longval) return false;
+                break;
+            case T_DOUBLE:
+                if(a[i].doubleval != b[i].doubleval) return false;
+                break;
+            case T_NODE:
+            case T_EDGE:
+                if(ENTITY_GET_ID((GraphEntity*)a[i].ptrval) !=
+                   ENTITY_GET_ID((GraphEntity*)b[i].ptrval)) return false;
+                break;
+            default:
+                if(a[i].ptrval != b[i].ptrval) return false;
+                break;
+        }
+    }
+    return true;
+}
+
+ValueTableEntry *ValueTable_Find(const ValueTable *table, const SIValue *key, uint64_t hash) {
+    uint64_t mask = table->slot_count - 1;
+    uint64_t pos = hash & mask;
+
+    while(table->slots[pos]) {
+        ValueTableEntry *entry = table->entries + (table->slots[pos] - 1);
+        if(entry->hash == hash && ValueTable_KeysEqual(entry->key, key, table->key_len)) {
+            return entry;
+        }
+        pos = (pos + 1) & mask;
+    }
+    return NULL;
+}
+
+ValueTableEntry *ValueTable_Insert(ValueTable *table, const SIValue *key, uint64_t hash, void *value) {
+    if(table->entry_count == table->entry_cap) {
+        table->entry_cap *= 2;
+        table->entries = rm_realloc(table->entries, sizeof(ValueTableEntry) * table->entry_cap);
+    }
+
+    // Grow slots once load factor exceeds 0.5.
+    if((table->entry_count + 1) * 2 > table->slot_count) {
+        _ValueTable_Rehash(table, table->slot_count * 2);
+    }
+
+    uint64_t idx = table->entry_count++;
+    ValueTableEntry *entry = table->entries + idx;
+    entry->hash = hash;
+    entry->key = key;
+    entry->value = value;
+
+    uint64_t mask = table->slot_count - 1;
+    uint64_t pos = hash & mask;
+    while(table->slots[pos]) pos = (pos + 1) & mask;
+    table->slots[pos] = idx + 1;
+
+    return entry;
+}
+
+uint64_t ValueTable_Count(const ValueTable *table) {
+    return table->entry_count;
+}
+
+ValueTableEntry *ValueTable_EntryAt(const ValueTable *table, uint64_t idx) {
+    assert(idx < table->entry_count);
+    return table->entries + idx;
+}
+
+void ValueTable_Clear(ValueTable *table, ValueTableFreeFunc free_value) {
+    if(free_value) {
+        for(uint64_t i = 0; i < table->entry_count; i++) {
+            free_value(table->entries[i].value);
+        }
+    }
+    table->entry_count = 0;
+    memset(table->slots, 0, sizeof(uint64_t) * table->slot_count);
+}
+
+void ValueTable_Free(ValueTable *table, ValueTableFreeFunc free_value) {
+    if(!table) return;
+    ValueTable_Clear(table, free_value);
+    rm_free(table->slots);
+    rm_free(table->entries);
+    rm_free(table);
+}
@@ -0,0 +1,66 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Redis Labs Source Available License Agreement
+*/
+
+#ifndef _VALUE_TABLE_H_
+#define _VALUE_TABLE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "../value.h"
+
+#define VALUE_TABLE_MIN_SLOTS 16
+
+typedef void (*ValueTableFreeFunc)(void *value);
+
+/* Entry within a value table,
+ * the key tuple is referenced, not owned by the table. */
+typedef struct {
+    uint64_t hash;          // Hash of key tuple.
+    const SIValue *key;     // Key tuple, key_len values.
+    void *value;            // Value associated with key.
+} ValueTableEntry;
+
+/* Open addressing hash table keyed by tuples of SIValues.
+ * Entries are kept in insertion order within a dense array,
+ * slots map hashes to positions within that array. */
+typedef struct {
+    uint key_len;               // Number of values composing a key.
+    uint64_t *slots;            // Entry index + 1 per slot, 0 marks an empty slot.
+    uint64_t slot_count;        // Number of slots, power of 2.
+    ValueTableEntry *entries;   // Entries in insertion order.
+    uint64_t entry_count;       // Number of entries.
+    uint64_t entry_cap;         // Number of entries table can hold without resizing.
+} ValueTable;
+
+// Create a new value table sized for about expected_count entries.
+ValueTable *ValueTable_New(uint key_len, uint64_t expected_count);
+
+// Hash a key tuple of key_len values.
+uint64_t ValueTable_HashKey(const SIValue *key, uint key_len);
+
+// Returns true if both key tuples hold equal values of the same types.
+bool ValueTable_KeysEqual(const SIValue *a, const SIValue *b, uint key_len);
+
+/* Retrieves the entry mapped to key, NULL if key is missing.
+ * Entries returned by Find and Insert are valid until the next insertion. */
+ValueTableEntry *ValueTable_Find(const ValueTable *table, const SIValue *key, uint64_t hash);
+
+// Adds key to table, key must not be present in table and must outlive its entry.
+ValueTableEntry *ValueTable_Insert(ValueTable *table, const SIValue *key, uint64_t hash, void *value);
+
+// Number of entries in table.
+uint64_t ValueTable_Count(const ValueTable *table);
+
+// Returns the idx entry, in insertion order.
+ValueTableEntry *ValueTable_EntryAt(const ValueTable *table, uint64_t idx);
+
+// Removes all entries, calls free_value on each value if specified.
+void ValueTable_Clear(ValueTable *table, ValueTableFreeFunc free_value);
+
+// Free table, calls free_value on each value if specified.
+void ValueTable_Free(ValueTable *table, ValueTableFreeFunc free_value);
+
+#endif
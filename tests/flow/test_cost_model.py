@@ -0,0 +1,103 @@
+import os
+import sys
+import unittest
+from redisgraph import Graph, Node, Edge
+
+import redis
+sys.path.append(os.path.join(os.path.dirname(__file__), '..'))
+from disposableredis import DisposableRedis
+
+from base import FlowTestsBase
+
+GRAPH_ID = "cost_model"
+redis_graph = None
+country_count = 5
+person_count = 200
+
+def disposable_redis():
+    return DisposableRedis(loadmodule=os.path.dirname(os.path.abspath(__file__)) + '/../../src/redisgraph.so')
+
+class CostModelFlowTest(FlowTestsBase):
+    @classmethod
+    def setUpClass(cls):
+        print "CostModelFlowTest"
+        global redis_graph
+        cls.r = disposable_redis()
+        cls.r.start()
+        redis_con = cls.r.client()
+        redis_graph = Graph(GRAPH_ID, redis_con)
+        cls.populate_graph()
+
+    @classmethod
+    def tearDownClass(cls):
+        cls.r.stop()
+
+    @classmethod
+    def populate_graph(cls):
+        countries = []
+        for i in range(country_count):
+            country = Node(label="country", properties={"v": i})
+            redis_graph.add_node(country)
+            countries.append(country)
+
+        # Every person visits a single country, all persons share the same w.
+        for i in range(person_count):
+            person = Node(label="person", properties={"v": i, "w": 1})
+            redis_graph.add_node(person)
+            redis_graph.add_edge(Edge(person, "visit", countries[i % country_count]))
+        redis_graph.commit()
+
+        # Unlabeled chain passing through a single rare node.
+        redis_graph.query("CREATE (a {v: 0})-[:next]->(b {v: 1})-[:next]->(c:rare {v: 2})-[:next]->(d {v: 3})-[:next]->(e {v: 4})")
+        for i in range(10):
+            redis_graph.query("CREATE ({v: %d})-[:next]->({v: %d})-[:next]->({v: %d})" % (i, i, i))
+
+        redis_graph.query("CREATE INDEX ON :person(v)")
+        redis_graph.query("CREATE INDEX ON :person(w)")
+
+    # Indices are skipped when their filters aren't selective.
+    def test01_index_selectivity(self):
+        query = "MATCH (p:person) WHERE p.w = 1 RETURN count(p)"
+        plan = redis_graph.execution_plan(query)
+        self.assertNotIn("Index Scan", plan)
+        self.assertIn("Label Scan", plan)
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(actual[0][0], person_count)
+
+        # Most selective index is used.
+        query = "MATCH (p:person) WHERE p.w = 1 AND p.v = 7 RETURN p.v"
+        plan = redis_graph.execution_plan(query)
+        self.assertIn("Index Scan", plan)
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(actual[0][0], 7)
+
+    # Patterns produce the same results regardless of their chosen entry point.
+    def test02_entry_points(self):
+        queries = [("MATCH (p:person)-[:visit]->(c:country) RETURN count(p)",
+                    "MATCH (c:country)<-[:visit]-(p:person) RETURN count(p)"),
+                   ("MATCH (p:person)-[:visit]->(c:country) WHERE p.v = 3 RETURN c.v",
+                    "MATCH (c:country)<-[:visit]-(p:person) WHERE p.v = 3 RETURN c.v"),
+                   ("MATCH (p:person)-[:visit]->(c:country)<-[:visit]-(q:person) WHERE q.v = 3 RETURN count(p)",
+                    "MATCH (q:person)-[:visit]->(c:country)<-[:visit]-(p:person) WHERE q.v = 3 RETURN count(p)"),
+                   ("MATCH (p:person)-[:visit]->(c:country) WHERE c.v = 1 AND p.v < 50 RETURN count(p)",
+                    "MATCH (c:country)<-[:visit]-(p:person) WHERE p.v < 50 AND c.v = 1 RETURN count(p)")]
+        for query, reversed_query in queries:
+            expected = redis_graph.query(query).result_set
+            actual = redis_graph.query(reversed_query).result_set
+            self.assertEqual(expected, actual)
+
+        query = "MATCH (p:person)-[:visit]->(c:country)<-[:visit]-(q:person) WHERE q.v = 3 RETURN count(p)"
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(actual[0][0], person_count / country_count)
+
+    # Traversal begins at the selective node in the middle of a pattern.
+    def test03_middle_entry_point(self):
+        query = "MATCH (a)-[:next]->(b)-[:next]->(c:rare)-[:next]->(d)-[:next]->(e) RETURN a.v, b.v, c.v, d.v, e.v"
+        plan = redis_graph.execution_plan(query)
+        self.assertIn("Label Scan", plan)
+        self.assertNotIn("All Node Scan", plan)
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(actual[0], [0, 1, 2, 3, 4])
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,74 @@
+import os
+import sys
+import unittest
+from redisgraph import Graph, Node, Edge
+
+import redis
+sys.path.append(os.path.join(os.path.dirname(__file__), '..'))
+from disposableredis import DisposableRedis
+
+from base import FlowTestsBase
+
+GRAPH_ID = "fused_scan_filters"
+redis_graph = None
+person_count = 100
+
+def disposable_redis():
+    return DisposableRedis(loadmodule=os.path.dirname(os.path.abspath(__file__)) + '/../../src/redisgraph.so')
+
+class FusedScanFiltersFlowTest(FlowTestsBase):
+    @classmethod
+    def setUpClass(cls):
+        print "FusedScanFiltersFlowTest"
+        global redis_graph
+        cls.r = disposable_redis()
+        cls.r.start()
+        redis_con = cls.r.client()
+        redis_graph = Graph(GRAPH_ID, redis_con)
+        cls.populate_graph()
+
+    @classmethod
+    def tearDownClass(cls):
+        cls.r.stop()
+
+    @classmethod
+    def populate_graph(cls):
+        for i in range(person_count):
+            redis_graph.add_node(Node(label="person", properties={"v": i, "name": "p%d" % i}))
+        redis_graph.add_node(Node(label="country", properties={"v": 0}))
+        redis_graph.commit()
+
+    # Filters applied to a label scan are merged into the scan.
+    def test01_label_scan(self):
+        query = "MATCH (p:person) WHERE p.v < 10 OR p.name = 'p50' RETURN count(p)"
+        plan = redis_graph.execution_plan(query)
+        self.assertIn("Filtered Node By Label Scan", plan)
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(actual[0][0], 11)
+
+    # Filters applied to an all node scan are merged into the scan.
+    def test02_all_node_scan(self):
+        query = "MATCH (n) WHERE n.v = 0 RETURN count(n)"
+        plan = redis_graph.execution_plan(query)
+        self.assertIn("Filtered All Node Scan", plan)
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(actual[0][0], 2)
+
+    # Each stream of a cartesian product filters its own nodes.
+    def test03_cartesian_product(self):
+        query = "MATCH (p:person), (c:country) WHERE p.v >= 90 AND c.v = 0 RETURN p.v ORDER BY p.v"
+        plan = redis_graph.execution_plan(query)
+        self.assertEqual(plan.count("Filtered Node By Label Scan"), 2)
+        actual = redis_graph.query(query).result_set
+        self.assertEqual([row[0] for row in actual], range(90, 100))
+
+    # Filters referring to multiple entities remain standalone.
+    def test04_multiple_entities(self):
+        query = "MATCH (p:person), (q:person) WHERE p.v = q.v + 1 RETURN count(p)"
+        plan = redis_graph.execution_plan(query)
+        self.assertIn("Filter", plan.replace("Filtered", ""))
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(actual[0][0], person_count - 1)
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,97 @@
+import os
+import sys
+import unittest
+from redisgraph import Graph, Node, Edge
+
+import redis
+sys.path.append(os.path.join(os.path.dirname(__file__), '..'))
+from disposableredis import DisposableRedis
+
+from base import FlowTestsBase
+
+GRAPH_ID = "literal_extraction"
+redis_graph = None
+
+def disposable_redis():
+    module = os.path.dirname(os.path.abspath(__file__)) + '/../../src/redisgraph.so'
+    return DisposableRedis(loadmodule=(module, 'EXTRACT_LITERALS', '1'))
+
+class LiteralExtractionFlowTest(FlowTestsBase):
+    @classmethod
+    def setUpClass(cls):
+        print "LiteralExtractionFlowTest"
+        global redis_graph
+        cls.r = disposable_redis()
+        cls.r.start()
+        redis_con = cls.r.client()
+        redis_graph = Graph(GRAPH_ID, redis_con)
+        cls.populate_graph()
+
+    @classmethod
+    def tearDownClass(cls):
+        cls.r.stop()
+
+    @classmethod
+    def populate_graph(cls):
+        for i in range(10):
+            node = Node(label="person", properties={"v": i, "name": "p%d" % i})
+            redis_graph.add_node(node)
+        redis_graph.commit()
+
+    # Queries differing only by literals produce their own results.
+    def test_where_literals(self):
+        for i in [-1, 0, 3, 9, 20]:
+            query = "MATCH (n:person) WHERE n.v > %d RETURN n.v ORDER BY n.v" % i
+            actual = redis_graph.query(query).result_set
+            self.assertEqual(actual, [[v] for v in range(max(i+1, 0), 10)])
+
+        for i in range(10):
+            query = "MATCH (n:person) WHERE n.name = 'p%d' RETURN n.v" % i
+            actual = redis_graph.query(query).result_set
+            self.assertEqual(actual, [[i]])
+
+        for i in range(10):
+            query = "MATCH (n:person {v:%d}) RETURN n.name" % i
+            actual = redis_graph.query(query).result_set
+            self.assertEqual(actual, [["p%d" % i]])
+
+        # Node IDs are compared against constants.
+        for i in range(10):
+            query = "MATCH (n:person) WHERE id(n) = %d RETURN n.v" % i
+            actual = redis_graph.query(query).result_set
+            self.assertEqual(actual, [[i]])
+
+    # Strings holding quotes are left within the query.
+    def test_quoted_strings(self):
+        for i in range(3):
+            query = "MATCH (n:person) WHERE n.v = %d RETURN n.v, \"it's\"" % i
+            actual = redis_graph.query(query).result_set
+            self.assertEqual(actual, [[i, "it's"]])
+
+            query = "MATCH (n:person) WHERE n.name = 'p%d' OR n.name = 'say \"hi\"' RETURN n.v" % i
+            actual = redis_graph.query(query).result_set
+            self.assertEqual(actual, [[i]])
+
+    def test_skip_limit_literals(self):
+        for skip in [0, 2, 8, 11]:
+            for limit in [0, 1, 3, 20]:
+                query = "MATCH (n:person) RETURN n.v ORDER BY n.v SKIP %d LIMIT %d" % (skip, limit)
+                actual = redis_graph.query(query).result_set
+                self.assertEqual(actual, [[v] for v in range(10)][skip:skip+limit])
+
+    # Literals and parameters might be mixed.
+    def test_literals_and_params(self):
+        for i in range(5):
+            query = "CYPHER x=%d MATCH (n:person) WHERE n.v >= $x AND n.v < %d RETURN count(n)" % (i, i + 3)
+            actual = redis_graph.query(query).result_set
+            self.assertEqual(actual[0][0], 3)
+
+    # Queries modifying the graph are left intact.
+    def test_write_queries(self):
+        for i in range(3):
+            redis_graph.query("CREATE (:city {id:%d})" % i)
+        actual = redis_graph.query("MATCH (c:city) RETURN c.id ORDER BY c.id").result_set
+        self.assertEqual(actual, [[0], [1], [2]])
+
+if __name__ == '__main__':
+    unittest.main()
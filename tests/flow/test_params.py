@@ -0,0 +1,78 @@
+import os
+import sys
+import unittest
+from redisgraph import Graph, Node, Edge
+
+import redis
+sys.path.append(os.path.join(os.path.dirname(__file__), '..'))
+from disposableredis import DisposableRedis
+
+from base import FlowTestsBase
+
+GRAPH_ID = "params"
+redis_graph = None
+
+def disposable_redis():
+    return DisposableRedis(loadmodule=os.path.dirname(os.path.abspath(__file__)) + '/../../src/redisgraph.so')
+
+class ParamsFlowTest(FlowTestsBase):
+    @classmethod
+    def setUpClass(cls):
+        print "ParamsFlowTest"
+        global redis_graph
+        cls.r = disposable_redis()
+        cls.r.start()
+        redis_con = cls.r.client()
+        redis_graph = Graph(GRAPH_ID, redis_con)
+        cls.populate_graph()
+
+    @classmethod
+    def tearDownClass(cls):
+        cls.r.stop()
+
+    @classmethod
+    def populate_graph(cls):
+        for i in range(10):
+            node = Node(label="person", properties={"v": i, "name": "p%d" % i})
+            redis_graph.add_node(node)
+        redis_graph.commit()
+
+    # Parameterized queries produce the same results as their literal counterparts.
+    def test_param_values(self):
+        queries = [("MATCH (n:person) WHERE n.v > $x RETURN n.v ORDER BY n.v", "x", ["3", "7", "-1", "2.5"]),
+                   ("MATCH (n:person {v:$x}) RETURN n.name", "x", ["0", "4", "11"]),
+                   ("MATCH (n:person) WHERE n.name = $x RETURN n.v", "x", ["'p1'", "\"p5\"", "'none'"]),
+                   ("RETURN $x", "x", ["1", "'str'", "true", "null", "1.5"])]
+        for query, name, values in queries:
+            for value in values:
+                expected = redis_graph.query(query.replace("$" + name, value)).result_set
+                actual = redis_graph.query("CYPHER %s=%s %s" % (name, value, query)).result_set
+                self.assertEqual(expected, actual)
+
+    # Parameters are matched against indexed properties.
+    def test_param_index(self):
+        redis_graph.query("CREATE INDEX ON :person(v)")
+        query = "MATCH (n:person) WHERE n.v = $x RETURN n.name"
+        self.assertIn("Index Scan", redis_graph.execution_plan("CYPHER x=1 " + query))
+        for i in range(10):
+            actual = redis_graph.query("CYPHER x=%d %s" % (i, query)).result_set
+            self.assertEqual(actual[0][0], "p%d" % i)
+
+        # Parameter type differs from previous executions.
+        actual = redis_graph.query("CYPHER x='p1' " + query).result_set
+        self.assertEqual(len(actual), 0)
+
+    # Unbound and malformed parameters are reported as errors.
+    def test_param_errors(self):
+        queries = ["MATCH (n:person) WHERE n.v = $x RETURN n",
+                   "CYPHER y=1 MATCH (n:person) WHERE n.v = $x RETURN n",
+                   "CYPHER x='unterminated MATCH (n) RETURN n"]
+        for query in queries:
+            try:
+                redis_graph.query(query)
+                assert(False)
+            except redis.exceptions.ResponseError:
+                pass
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,105 @@
+import os
+import sys
+import unittest
+from redisgraph import Graph, Node, Edge
+
+import redis
+sys.path.append(os.path.join(os.path.dirname(__file__), '..'))
+from disposableredis import DisposableRedis
+
+from base import FlowTestsBase
+
+GRAPH_ID = "plan_cache"
+redis_graph = None
+
+def disposable_redis():
+    return DisposableRedis(loadmodule=os.path.dirname(os.path.abspath(__file__)) + '/../../src/redisgraph.so')
+
+class PlanCacheFlowTest(FlowTestsBase):
+    @classmethod
+    def setUpClass(cls):
+        print "PlanCacheFlowTest"
+        global redis_graph
+        cls.r = disposable_redis()
+        cls.r.start()
+        redis_con = cls.r.client()
+        redis_graph = Graph(GRAPH_ID, redis_con)
+        cls.populate_graph()
+
+    @classmethod
+    def tearDownClass(cls):
+        cls.r.stop()
+
+    @classmethod
+    def populate_graph(cls):
+        for i in range(10):
+            node = Node(label="person", properties={"v": i})
+            redis_graph.add_node(node)
+        redis_graph.commit()
+
+    # Repeated queries produce the same results.
+    def test_repeated_queries(self):
+        queries = ["MATCH (n:person) RETURN n.v ORDER BY n.v",
+                   "MATCH (n:person) RETURN count(n)",
+                   "MATCH (n:person) RETURN n.v ORDER BY n.v DESC LIMIT 3",
+                   "UNWIND [1,2,3] AS x RETURN x",
+                   "RETURN 1+2"]
+        for query in queries:
+            expected = redis_graph.query(query).result_set
+            for i in range(5):
+                actual = redis_graph.query(query).result_set
+                self.assertEqual(expected, actual)
+
+    # Cached plans must observe modifications made to the graph.
+    def test_plan_invalidation(self):
+        query = "MATCH (n:city) RETURN count(n)"
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(actual[0][0], 0)
+
+        redis_graph.query("CREATE (:city {name:'Tel Aviv'})")
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(actual[0][0], 1)
+
+        query = "MATCH (n:city) RETURN n.name"
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(actual[0][0], "Tel Aviv")
+
+        redis_graph.query("MATCH (n:city) SET n.name = 'Haifa'")
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(actual[0][0], "Haifa")
+
+        # Index creation changes query plan.
+        query = "MATCH (n:person) WHERE n.v = 4 RETURN n.v"
+        self.assertNotIn("Index Scan", redis_graph.execution_plan(query))
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(actual[0][0], 4)
+
+        redis_graph.query("CREATE INDEX ON :person(v)")
+        self.assertIn("Index Scan", redis_graph.execution_plan(query))
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(actual[0][0], 4)
+
+    # Cartesian product mustn't replay records buffered by a previous execution.
+    def test_cartesian_product_rerun(self):
+        query = "MATCH (a:person), (b:person) WHERE a.v = $x AND b.v = $x RETURN a.v, b.v"
+        self.assertIn("Cartesian Product", redis_graph.execution_plan("CYPHER x=1 " + query))
+        for x in [1, 2, 1]:
+            actual = redis_graph.query("CYPHER x=%d %s" % (x, query)).result_set
+            self.assertEqual(actual, [[x, x]])
+
+        # Extracted literals.
+        query = "MATCH (a:person), (b:person) WHERE a.v = %d AND b.v = %d RETURN a.v, b.v"
+        for x in [3, 4]:
+            actual = redis_graph.query(query % (x, x)).result_set
+            self.assertEqual(actual, [[x, x]])
+
+        # Graph modifications.
+        query = "MATCH (a:person), (b:person) WHERE a.v = 20 AND b.v = 20 RETURN a.v, b.v"
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(actual, [])
+        redis_graph.query("CREATE (:person {v: 20})")
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(actual, [[20, 20]])
+
+if __name__ == '__main__':
+    unittest.main()
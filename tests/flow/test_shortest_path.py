@@ -0,0 +1,163 @@
+import os
+import sys
+import unittest
+from redisgraph import Graph, Node, Edge
+
+import redis
+sys.path.append(os.path.join(os.path.dirname(__file__), '..'))
+from disposableredis import DisposableRedis
+
+from base import FlowTestsBase
+
+GRAPH_ID = "shortest_path"
+redis_graph = None
+
+def disposable_redis():
+    return DisposableRedis(loadmodule=os.path.dirname(os.path.abspath(__file__)) + '/../../src/redisgraph.so')
+
+class ShortestPathFlowTest(FlowTestsBase):
+    @classmethod
+    def setUpClass(cls):
+        print "ShortestPathFlowTest"
+        global redis_graph
+        cls.r = disposable_redis()
+        cls.r.start()
+        redis_con = cls.r.client()
+        redis_graph = Graph(GRAPH_ID, redis_con)
+        cls.populate_graph()
+
+    @classmethod
+    def tearDownClass(cls):
+        cls.r.stop()
+
+    @classmethod
+    def populate_graph(cls):
+        nodes = []
+        for i in range(7):
+            node = Node(label="L", properties={"v": i})
+            redis_graph.add_node(node)
+            nodes.append(node)
+
+        # 0 reaches 3 by a path of length 3, and two paths of length 2,
+        # node 6 is isolated.
+        for src, dest in [(0, 1), (1, 2), (2, 3), (0, 4), (4, 3), (0, 5), (5, 3)]:
+            redis_graph.add_edge(Edge(nodes[src], "R", nodes[dest]))
+        redis_graph.commit()
+
+    def test01_shortest_path(self):
+        query = "MATCH (a {v: 0}), (b {v: 3}), shortestPath((a)-[:R*]->(b)) RETURN a.v, b.v"
+        plan = redis_graph.execution_plan(query)
+        self.assertIn("Shortest Path", plan)
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(actual, [[0, 3]])
+
+        # Pattern direction is respected.
+        query = "MATCH (a {v: 0}), (b {v: 3}), shortestPath((b)<-[:R*]-(a)) RETURN a.v, b.v"
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(actual, [[0, 3]])
+
+        query = "MATCH (a {v: 0}), (b {v: 3}), shortestPath((b)-[:R*]->(a)) RETURN a.v, b.v"
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(actual, [])
+
+        # No path.
+        query = "MATCH (a {v: 0}), (b {v: 6}), shortestPath((a)-[:R*]->(b)) RETURN a.v, b.v"
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(actual, [])
+
+    # Each shortest path produces a row.
+    def test02_all_shortest_paths(self):
+        query = "MATCH (a {v: 0}), (b {v: 3}), allShortestPaths((a)-[:R*]->(b)) RETURN count(a)"
+        plan = redis_graph.execution_plan(query)
+        self.assertIn("All Shortest Paths", plan)
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(actual[0][0], 2)
+
+        query = "MATCH (a {v: 0}), (b:L), allShortestPaths((a)-[:R*]->(b)) RETURN b.v, count(b) ORDER BY b.v"
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(actual, [[1, 1], [2, 1], [3, 2], [4, 1], [5, 1]])
+
+    def test03_path_length(self):
+        query = "MATCH (a {v: 0}), (b {v: 3}), allShortestPaths((a)-[:R*..1]->(b)) RETURN count(a)"
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(actual[0][0], 0)
+
+        query = "MATCH (a {v: 0}), (b {v: 3}), allShortestPaths((a)-[:R*..2]->(b)) RETURN count(a)"
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(actual[0][0], 2)
+
+        # Path of length 0.
+        query = "MATCH (a {v: 0}), (b {v: 0}), shortestPath((a)-[:R*0..]->(b)) RETURN count(a)"
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(actual[0][0], 1)
+
+        query = "MATCH (a {v: 0}), (b {v: 0}), shortestPath((a)-[:R*]->(b)) RETURN count(a)"
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(actual[0][0], 0)
+
+    def test04_invalid_queries(self):
+        queries = ["MATCH (a {v: 0}), shortestPath((a)-[:R*]->(b)) RETURN b",
+                   "MATCH (a {v: 0}), (b {v: 3}), shortestPath((a)-[:R*2..]->(b)) RETURN b",
+                   "MATCH (a {v: 0}), (b {v: 3}), longestPath((a)-[:R*]->(b)) RETURN b",
+                   "MATCH (a {v: 0}), (b {v: 3}), (c), shortestPath((a)-[:R*]->(c)-[:R*]->(b)) RETURN b",
+                   "MATCH (a {v: 0})-[:R]-(b) RETURN b",
+                   "CREATE (a)-[:R]-(b)"]
+        for query in queries:
+            try:
+                redis_graph.query(query)
+                assert(False)
+            except redis.exceptions.ResponseError:
+                # Expecting an error.
+                pass
+
+    # Undirected patterns traverse relationships both ways.
+    def test05_undirected(self):
+        query = "MATCH (a {v: 3}), (b {v: 0}), allShortestPaths((a)-[:R*]-(b)) RETURN count(a)"
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(actual[0][0], 2)
+
+        # 1 and 4 are connected through 0, against the direction of (0)-[:R]->(1).
+        query = "MATCH (a {v: 1}), (b {v: 4}), allShortestPaths((a)-[:R*]-(b)) RETURN count(a)"
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(actual[0][0], 1)
+
+        query = "MATCH (a {v: 1}), (b {v: 4}), shortestPath((a)-[:R*]->(b)) RETURN count(a)"
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(actual[0][0], 0)
+
+        query = "MATCH (a {v: 0}), (b:L), shortestPath((a)-[:R*..1]-(b)) RETURN b.v ORDER BY b.v"
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(actual, [[1], [4], [5]])
+
+        # Isolated node remains unreachable.
+        query = "MATCH (a {v: 0}), (b {v: 6}), shortestPath((a)-[:R*]-(b)) RETURN count(a)"
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(actual[0][0], 0)
+
+    # Parallel relationships are distinct paths.
+    def test06_parallel_relationships(self):
+        redis_graph.query("CREATE (:P {v: 10}), (:P {v: 11}), (:P {v: 12})")
+        connect = "MATCH (a:P {v: %d}), (b:P {v: %d}) CREATE (a)-[:T]->(b)"
+        for src, dest in [(10, 11), (10, 11), (11, 12)]:
+            redis_graph.query(connect % (src, dest))
+
+        query = "MATCH (a:P {v: 10}), (b:P {v: 12}), allShortestPaths((a)-[:T*]->(b)) RETURN count(a)"
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(actual[0][0], 2)
+
+        query = "MATCH (a:P {v: 12}), (b:P {v: 10}), allShortestPaths((a)-[:T*]-(b)) RETURN count(a)"
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(actual[0][0], 2)
+
+        query = "MATCH (a:P {v: 10}), (b:P {v: 12}), shortestPath((a)-[:T*]->(b)) RETURN count(a)"
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(actual[0][0], 1)
+
+        # Cached plan observes new relationships.
+        redis_graph.query(connect % (11, 12))
+        query = "MATCH (a:P {v: 10}), (b:P {v: 12}), allShortestPaths((a)-[:T*]->(b)) RETURN count(a)"
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(actual[0][0], 4)
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,74 @@
+import os
+import sys
+import unittest
+from redisgraph import Graph, Node, Edge
+
+import redis
+sys.path.append(os.path.join(os.path.dirname(__file__), '..'))
+from disposableredis import DisposableRedis
+
+from base import FlowTestsBase
+
+GRAPH_ID = "sort_spill"
+NODE_COUNT = 600
+redis_graph = None
+values = []
+
+def disposable_redis():
+    # A tiny threshold, sort spills a run every few records.
+    module = os.path.dirname(os.path.abspath(__file__)) + '/../../src/redisgraph.so'
+    return DisposableRedis(loadmodule=(module, 'SORT_SPILL_THRESHOLD', '2048'))
+
+class SortSpillFlowTest(FlowTestsBase):
+    @classmethod
+    def setUpClass(cls):
+        print "SortSpillFlowTest"
+        global redis_graph
+        cls.r = disposable_redis()
+        cls.r.start()
+        redis_con = cls.r.client()
+        redis_graph = Graph(GRAPH_ID, redis_con)
+        cls.populate_graph()
+
+    @classmethod
+    def tearDownClass(cls):
+        cls.r.stop()
+
+    @classmethod
+    def populate_graph(cls):
+        # Values repeat, integers and doubles share values, e.g. 3 and 3.0
+        for i in range(NODE_COUNT):
+            v = (i * 7) % 50
+            if i % 3 == 0:
+                v = float(v)
+            elif i % 3 == 2:
+                v = v + 0.5
+            values.append([v, i])
+            node = Node(label="item", properties={"v": v, "w": i})
+            redis_graph.add_node(node)
+        redis_graph.commit()
+
+    def test01_order_across_runs(self):
+        query = "MATCH (n:item) RETURN n.v, n.w ORDER BY n.v, n.w"
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(actual, sorted(values))
+
+        query = "MATCH (n:item) RETURN n.v, n.w ORDER BY n.v, n.w DESC"
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(actual, sorted(values, reverse=True))
+
+    # Records sharing a key are all produced, next to one another.
+    def test02_ties(self):
+        query = "MATCH (n:item) RETURN n.v, n.w ORDER BY n.v"
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(len(actual), NODE_COUNT)
+        self.assertEqual([row[0] for row in actual], sorted([row[0] for row in values]))
+        self.assertEqual(sorted([row[1] for row in actual]), range(NODE_COUNT))
+
+    def test03_limit(self):
+        query = "MATCH (n:item) RETURN n.v, n.w ORDER BY n.v, n.w SKIP 10 LIMIT 20"
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(actual, sorted(values)[10:30])
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,100 @@
+import os
+import sys
+import unittest
+from redisgraph import Graph, Node, Edge
+
+import redis
+sys.path.append(os.path.join(os.path.dirname(__file__), '..'))
+from disposableredis import DisposableRedis
+
+from base import FlowTestsBase
+
+GRAPH_ID = "stats"
+redis_graph = None
+
+def disposable_redis():
+    return DisposableRedis(loadmodule=os.path.dirname(os.path.abspath(__file__)) + '/../../src/redisgraph.so')
+
+class StatsFlowTest(FlowTestsBase):
+    @classmethod
+    def setUpClass(cls):
+        print "StatsFlowTest"
+        global redis_graph
+        cls.r = disposable_redis()
+        cls.r.start()
+        redis_con = cls.r.client()
+        redis_graph = Graph(GRAPH_ID, redis_con)
+        cls.populate_graph()
+
+    @classmethod
+    def tearDownClass(cls):
+        cls.r.stop()
+
+    @classmethod
+    def populate_graph(cls):
+        # 3 people, each visiting every one of 2 countries, the first one twice.
+        people = []
+        for i in range(3):
+            person = Node(label="person", properties={"age": i % 2})
+            redis_graph.add_node(person)
+            people.append(person)
+
+        countries = []
+        for name in ["Israel", "Japan"]:
+            country = Node(label="country", properties={"name": name})
+            redis_graph.add_node(country)
+            countries.append(country)
+
+        for person in people:
+            for country in countries:
+                redis_graph.add_edge(Edge(person, "visit", country))
+        redis_graph.add_edge(Edge(people[0], "visit", countries[0]))
+        redis_graph.commit()
+
+    # Collects db.stats() output into a dictionary keyed by (entity, statistic).
+    def get_stats(self):
+        result = redis_graph.query("CALL db.stats()")
+        return {(row[0], row[1]): row[2] for row in result.result_set}
+
+    def test_stats(self):
+        stats = self.get_stats()
+        self.assertEqual(stats[("graph", "nodes")], 5)
+        self.assertEqual(stats[("graph", "edges")], 7)
+        self.assertEqual(stats[(":person", "nodes")], 3)
+        self.assertEqual(stats[(":country", "nodes")], 2)
+
+        visit = "()-[:visit]->()"
+        self.assertEqual(stats[(visit, "edges")], 7)
+        self.assertEqual(stats[(visit, "pairs")], 6)
+        self.assertEqual(stats[(visit, "sources")], 3)
+        self.assertEqual(stats[(visit, "destinations")], 2)
+        self.assertEqual(stats[(visit, "max_out_degree")], 2)
+        self.assertEqual(stats[(visit, "max_in_degree")], 3)
+        self.assertEqual(stats[("(:person)-[:visit]->()", "pairs")], 6)
+        self.assertEqual(stats[("()-[:visit]->(:country)", "pairs")], 6)
+        self.assertNotIn(("(:country)-[:visit]->()", "pairs"), stats)
+
+    # Statistics are kept up to date as the graph is modified.
+    def test_stats_updates(self):
+        redis_graph.query("CREATE (:person {age: 5})")
+        redis_graph.query("CREATE INDEX ON :person(age)")
+        stats = self.get_stats()
+        self.assertEqual(stats[(":person", "nodes")], 4)
+        self.assertEqual(stats[(":person(age)", "numeric_entries")], 4)
+        self.assertEqual(stats[(":person(age)", "numeric_distinct")], 3)
+        self.assertEqual(stats[(":person(age)", "string_entries")], 0)
+
+        redis_graph.query("MATCH (p:person {age: 5}) DELETE p")
+        redis_graph.query("MATCH (:person)-[v:visit]->(:country {name: 'Japan'}) DELETE v")
+        stats = self.get_stats()
+        self.assertEqual(stats[(":person", "nodes")], 3)
+        self.assertEqual(stats[(":person(age)", "numeric_entries")], 3)
+
+        visit = "()-[:visit]->()"
+        self.assertEqual(stats[(visit, "edges")], 4)
+        self.assertEqual(stats[(visit, "pairs")], 3)
+        self.assertEqual(stats[(visit, "destinations")], 1)
+        self.assertEqual(stats[(visit, "max_out_degree")], 1)
+
+if __name__ == '__main__':
+    unittest.main()
@@ -64,6 +64,27 @@ class ValueComparisonTest(FlowTestsBase):
         actual_result = redis_graph.query(query)
         assert(actual_result.result_set == expected[::-1])
 
+    # Integers and floats of equal value tie, later sort keys break the tie.
+    def test_mixed_numeric_order(self):
+        query = """CREATE (:mixed {a: 3, b: 2}), (:mixed {a: 3.0, b: 1}), (:mixed {a: 2.5, b: 3}), (:mixed {a: 3, b: 0})"""
+        redis_graph.query(query)
+
+        query = """MATCH (m:mixed) RETURN m.a, m.b ORDER BY m.a, m.b"""
+        actual_result = redis_graph.query(query)
+        expected = [[2.5, 3],
+                    [3, 0],
+                    [3.0, 1],
+                    [3, 2]]
+        assert(actual_result.result_set == expected)
+
+        query = """MATCH (m:mixed) RETURN m.a, m.b ORDER BY m.a DESC, m.b"""
+        actual_result = redis_graph.query(query)
+        expected = [[3, 0],
+                    [3.0, 1],
+                    [3, 2],
+                    [2.5, 3]]
+        assert(actual_result.result_set == expected)
+
     # From the Cypher specification:
     # "In a mixed set, any numeric value is always considered to be higher than any string value"
     def test_mixed_type_min(self):
@@ -0,0 +1,97 @@
+import os
+import sys
+import unittest
+from redisgraph import Graph, Node, Edge
+
+import redis
+sys.path.append(os.path.join(os.path.dirname(__file__), '..'))
+from disposableredis import DisposableRedis
+
+from base import FlowTestsBase
+
+GRAPH_ID = "var_len_reach"
+redis_graph = None
+node_count = 20
+
+def disposable_redis():
+    return DisposableRedis(loadmodule=os.path.dirname(os.path.abspath(__file__)) + '/../../src/redisgraph.so')
+
+class VarLenReachFlowTest(FlowTestsBase):
+    @classmethod
+    def setUpClass(cls):
+        print "VarLenReachFlowTest"
+        global redis_graph
+        cls.r = disposable_redis()
+        cls.r.start()
+        redis_con = cls.r.client()
+        redis_graph = Graph(GRAPH_ID, redis_con)
+        cls.populate_graph()
+
+    @classmethod
+    def tearDownClass(cls):
+        cls.r.stop()
+
+    @classmethod
+    def populate_graph(cls):
+        nodes = []
+        for i in range(node_count):
+            node = Node(label="L", properties={"v": i})
+            redis_graph.add_node(node)
+            nodes.append(node)
+
+        # Every node is connected to its successor and to the node 3 positions ahead,
+        # forming a cycle with many paths reaching each node, some edges are doubled.
+        for i in range(node_count):
+            redis_graph.add_edge(Edge(nodes[i], "R", nodes[(i + 1) % node_count]))
+            redis_graph.add_edge(Edge(nodes[i], "S", nodes[(i + 3) % node_count]))
+            if i % 4 == 0:
+                redis_graph.add_edge(Edge(nodes[i], "R", nodes[(i + 1) % node_count]))
+        redis_graph.commit()
+
+    # Distinct results of a variable length traversal are computed as reachability.
+    def test01_reach_plan(self):
+        query = "MATCH (a)-[:R*1..3]->(b) RETURN DISTINCT a.v, b.v"
+        plan = redis_graph.execution_plan(query)
+        self.assertIn("Conditional Variable Length Reach", plan)
+
+        # Path multiplicity is required.
+        for query in ["MATCH (a)-[:R*1..3]->(b) RETURN a.v, b.v",
+                      "MATCH (a)-[:R*1..3]->(b) RETURN count(b)",
+                      "MATCH (a)-[:R*2..3]->(b) RETURN DISTINCT a.v, b.v"]:
+            plan = redis_graph.execution_plan(query)
+            self.assertIn("Conditional Variable Length Traverse", plan)
+            self.assertNotIn("Conditional Variable Length Reach", plan)
+
+    # Reachability produces the same rows as distinct paths.
+    def test02_reach_results(self):
+        patterns = ["(a)-[:R*1..3]->(b)",
+                    "(a)-[:R*]->(b)",
+                    "(a)-[:R*0..2]->(b)",
+                    "(a)<-[:R|:S*..3]-(b)",
+                    "(a:L {v: 4})-[*1..4]->(b)",
+                    "(a)-[:R*1..2]->(b)-[:S]->(c)"]
+        for pattern in patterns:
+            query = "MATCH %s RETURN DISTINCT a.v, b.v ORDER BY a.v, b.v" % pattern
+            actual = redis_graph.query(query).result_set
+
+            query = "MATCH %s RETURN a.v, b.v" % pattern
+            expected = sorted(set(tuple(row) for row in redis_graph.query(query).result_set))
+            self.assertEqual([tuple(row) for row in actual], expected)
+
+    # Paths of length 0 are only considered when the minimum length is 0.
+    def test03_source_reachability(self):
+        query = "MATCH (a {v: 0})-[:R*1..2]->(b) RETURN DISTINCT b.v ORDER BY b.v"
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(actual, [[1], [2]])
+
+        query = "MATCH (a {v: 0})-[:R*0..2]->(b) RETURN DISTINCT b.v ORDER BY b.v"
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(actual, [[0], [1], [2]])
+
+        # Source isn't revisited through the cycle.
+        query = "MATCH (a {v: 0})-[:R*]->(b) RETURN DISTINCT b.v ORDER BY b.v"
+        actual = redis_graph.query(query).result_set
+        self.assertEqual(len(actual), node_count - 1)
+
+if __name__ == '__main__':
+    unittest.main()
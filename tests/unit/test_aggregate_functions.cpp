@@ -98,6 +98,45 @@ TEST_F(AggregateTest, PartialCountTest) {
   AR_EXP_Free(arExp);
 }
 
+// Merging partial aggregations should match a single aggregation
+TEST_F(AggregateTest, MergeTest) {
+  Record r = Record_New(0);
+  const char *queries[6] = {"RETURN sum(2)", "RETURN avg(2)", "RETURN count(2)",
+                            "RETURN min(2)", "RETURN max(2)", "RETURN stDev(2)"};
+
+  for (int q = 0; q < 6; q ++) {
+    AR_ExpNode *whole = _exp_from_query(queries[q]);
+    AR_ExpNode *left = _exp_from_query(queries[q]);
+    AR_ExpNode *right = _exp_from_query(queries[q]);
+    ASSERT_TRUE(AR_EXP_Mergeable(whole));
+
+    int num_values = 10;
+    for (int i = 0; i < num_values; i ++) {
+      AR_EXP_Aggregate(whole, r);
+      // Split input between two partial aggregations.
+      if (i % 3) AR_EXP_Aggregate(left, r);
+      else AR_EXP_Aggregate(right, r);
+    }
+
+    AR_EXP_Merge(left, right);
+    AR_EXP_Reduce(whole);
+    AR_EXP_Reduce(left);
+
+    SIValue expected = AR_EXP_Evaluate(whole, r);
+    SIValue merged = AR_EXP_Evaluate(left, r);
+    ASSERT_EQ(SIValue_Compare(expected, merged), 0);
+
+    AR_EXP_Free(whole);
+    AR_EXP_Free(left);
+    AR_EXP_Free(right);
+  }
+
+  // Percentiles can't be merged.
+  AR_ExpNode *perc = _exp_from_query("RETURN percentileDisc(2, 0.5)");
+  ASSERT_FALSE(AR_EXP_Mergeable(perc));
+  AR_EXP_Free(perc);
+}
+
 // TEST_F(AggregateTest, PercentileContTest) {
 //   // Percentiles to check
 //   AR_ExpNode *zero = AR_EXP_NewConstOperandNode(SI_DoubleVal(0));
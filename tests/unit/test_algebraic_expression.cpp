@@ -17,6 +17,7 @@ extern "C" {
 #include "../../src/graph/query_graph.h"
 #include "../../src/util/simple_timer.h"
 #include "../../src/arithmetic/algebraic_expression.h"
+#include "../../src/util/arr.h"
 #include "../../src/util/rmalloc.h"
 #include "../../deps/GraphBLAS/Include/GraphBLAS.h"
 
@@ -914,3 +915,229 @@ TEST_F(AlgebraicExpressionTest, ExpressionExecute) {
     GrB_Matrix_free(&expected);
     GrB_Matrix_free(&res);
 }
+
+TEST_F(AlgebraicExpressionTest, ExpressionExecuteLabels) {
+    size_t exp_count = 0;
+    const char *query = query_no_intermidate_return_nodes;
+    AlgebraicExpression **ae = _build_algebraic_expression(query, &exp_count);
+    AlgebraicExpression *exp = ae[0];
+
+    // Label operands are marked as diagonal, relation operands aren't.
+    for(int i = 0; i < exp->operand_count; i++) {
+        GrB_Matrix operand = exp->operands[i].operand;
+        bool label = (operand == Graph_GetLabelMatrix(g, 0) ||
+                      operand == Graph_GetLabelMatrix(g, 1));
+        ASSERT_EQ(exp->operands[i].diagonal, label);
+    }
+
+    // Compute expected result by multiplying each operand.
+    GrB_Index n = Graph_RequiredMatrixDim(g);
+    GrB_Matrix expected;
+    GrB_Matrix_dup(&expected, exp->operands[0].operand);
+    for(int i = 1; i < exp->operand_count; i++) {
+        GrB_mxm(expected, NULL, NULL, GxB_LOR_LAND_BOOL, expected, exp->operands[i].operand, NULL);
+    }
+
+    GrB_Matrix res;
+    GrB_Matrix_new(&res, GrB_BOOL, n, n);
+    AlgebraicExpression_Execute(exp, res);
+    ASSERT_TRUE(_compare_matrices(res, expected));
+
+    // Clean up
+    AlgebraicExpression_Free(ae[0]);
+    free(ae);
+    GrB_Matrix_free(&expected);
+    GrB_Matrix_free(&res);
+}
+
+TEST_F(AlgebraicExpressionTest, ExpressionExecuteChainOrder) {
+    // F * A * B, where F is dense and A, B hold a single entry,
+    // computing A * B first is cheaper than multiplying left to right.
+    GrB_Index n = 8;
+    GrB_Matrix F;
+    GrB_Matrix A;
+    GrB_Matrix B;
+    GrB_Matrix_new(&F, GrB_BOOL, n, n);
+    GrB_Matrix_new(&A, GrB_BOOL, n, n);
+    GrB_Matrix_new(&B, GrB_BOOL, n, n);
+    for(GrB_Index i = 0; i < n; i++) {
+        for(GrB_Index j = 0; j < n; j++) GrB_Matrix_setElement_BOOL(F, true, i, j);
+    }
+    GrB_Matrix_setElement_BOOL(A, true, 0, 1);
+    GrB_Matrix_setElement_BOOL(B, true, 1, 2);
+
+    AlgebraicExpression *exp = (AlgebraicExpression*)calloc(1, sizeof(AlgebraicExpression));
+    exp->op = AL_EXP_MUL;
+    AlgebraicExpression_AppendTerm(exp, A, false, false);
+    AlgebraicExpression_AppendTerm(exp, B, false, false);
+
+    // Every row of F reaches node 2.
+    GrB_Matrix expected;
+    GrB_Matrix_new(&expected, GrB_BOOL, n, n);
+    for(GrB_Index i = 0; i < n; i++) GrB_Matrix_setElement_BOOL(expected, true, i, 2);
+
+    GrB_Matrix res;
+    GrB_Matrix_new(&res, GrB_BOOL, n, n);
+
+    // Evaluate twice, second evaluation reuses the cached product A * B.
+    for(int i = 0; i < 2; i++) {
+        AlgebraicExpression_PrependTerm(exp, F, false, false);
+        AlgebraicExpression_Execute(exp, res);
+        AlgebraicExpression_RemoveTerm(exp, 0, NULL);
+        ASSERT_TRUE(_compare_matrices(res, expected));
+        ASSERT_EQ(array_len(exp->products), 1);
+    }
+
+    // Clean up
+    AlgebraicExpression_Free(exp);
+    GrB_Matrix_free(&F);
+    GrB_Matrix_free(&A);
+    GrB_Matrix_free(&B);
+    GrB_Matrix_free(&expected);
+    GrB_Matrix_free(&res);
+}
+
+TEST_F(AlgebraicExpressionTest, StructuralMultiplication) {
+    // Rg_structured_bool only considers the pattern of its operands,
+    // explicit false entries connect nodes just like true entries.
+    GrB_Index n = 4;
+    GrB_Matrix A;
+    GrB_Matrix B;
+    GrB_Matrix_new(&A, GrB_BOOL, n, n);
+    GrB_Matrix_new(&B, GrB_BOOL, n, n);
+    GrB_Matrix_setElement_BOOL(A, false, 0, 1);
+    GrB_Matrix_setElement_BOOL(A, true, 0, 2);
+    GrB_Matrix_setElement_BOOL(A, true, 3, 3);
+    GrB_Matrix_setElement_BOOL(B, false, 1, 0);
+    GrB_Matrix_setElement_BOOL(B, true, 2, 0);
+    GrB_Matrix_setElement_BOOL(B, false, 2, 3);
+
+    GrB_Matrix expected;
+    GrB_Matrix_new(&expected, GrB_BOOL, n, n);
+    GrB_Matrix_setElement_BOOL(expected, true, 0, 0);
+    GrB_Matrix_setElement_BOOL(expected, true, 0, 3);
+
+    GrB_Matrix res;
+    GrB_Matrix_new(&res, GrB_BOOL, n, n);
+    GrB_mxm(res, GrB_NULL, GrB_NULL, Rg_structured_bool, A, B, GrB_NULL);
+    ASSERT_TRUE(_compare_matrices(res, expected));
+
+    // Every entry in the product is true.
+    bool v = false;
+    ASSERT_EQ(GrB_Matrix_extractElement_BOOL(&v, res, 0, 3), GrB_SUCCESS);
+    ASSERT_TRUE(v);
+
+    // Clean up
+    GrB_Matrix_free(&A);
+    GrB_Matrix_free(&B);
+    GrB_Matrix_free(&expected);
+    GrB_Matrix_free(&res);
+}
+
+TEST_F(AlgebraicExpressionTest, ExpressionExecuteLabelMask) {
+    GrB_Index n = 4;
+    GrB_Matrix F;
+    GrB_Matrix A;
+    GrB_Matrix L;
+    GrB_Matrix_new(&F, GrB_BOOL, n, n);
+    GrB_Matrix_new(&A, GrB_BOOL, n, n);
+    GrB_Matrix_new(&L, GrB_BOOL, n, n);
+    for(GrB_Index j = 0; j < n; j++) GrB_Matrix_setElement_BOOL(F, true, 0, j);
+    for(GrB_Index j = 0; j < n; j++) GrB_Matrix_setElement_BOOL(A, true, j, j);
+    GrB_Matrix_setElement_BOOL(L, true, 1, 1);
+
+    // F * L, L masks the columns of F.
+    AlgebraicExpression *exp = (AlgebraicExpression*)calloc(1, sizeof(AlgebraicExpression));
+    exp->op = AL_EXP_MUL;
+    AlgebraicExpression_AppendTerm(exp, F, false, false);
+    AlgebraicExpression_AppendTerm(exp, L, false, false);
+    exp->operands[1].diagonal = true;
+
+    GrB_Matrix expected;
+    GrB_Matrix_new(&expected, GrB_BOOL, n, n);
+    GrB_Matrix_setElement_BOOL(expected, true, 0, 1);
+
+    GrB_Matrix res;
+    GrB_Matrix_new(&res, GrB_BOOL, n, n);
+    AlgebraicExpression_Execute(exp, res);
+    ASSERT_TRUE(_compare_matrices(res, expected));
+    ASSERT_EQ(array_len(exp->masks), 1);
+
+    // Label a new node, mask is rebuilt.
+    GrB_Matrix_setElement_BOOL(L, true, 3, 3);
+    GrB_Matrix_setElement_BOOL(expected, true, 0, 3);
+    AlgebraicExpression_Execute(exp, res);
+    ASSERT_TRUE(_compare_matrices(res, expected));
+    ASSERT_EQ(array_len(exp->masks), 1);
+    AlgebraicExpression_Free(exp);
+
+    // L * A, L masks the rows of A.
+    exp = (AlgebraicExpression*)calloc(1, sizeof(AlgebraicExpression));
+    exp->op = AL_EXP_MUL;
+    AlgebraicExpression_AppendTerm(exp, L, false, false);
+    AlgebraicExpression_AppendTerm(exp, A, false, false);
+    exp->operands[0].diagonal = true;
+    GrB_Matrix_clear(expected);
+    GrB_Matrix_setElement_BOOL(expected, true, 1, 1);
+    GrB_Matrix_setElement_BOOL(expected, true, 3, 3);
+    AlgebraicExpression_Execute(exp, res);
+    ASSERT_TRUE(_compare_matrices(res, expected));
+
+    // Clean up
+    AlgebraicExpression_Free(exp);
+    GrB_Matrix_free(&F);
+    GrB_Matrix_free(&A);
+    GrB_Matrix_free(&L);
+    GrB_Matrix_free(&expected);
+    GrB_Matrix_free(&res);
+}
+
+TEST_F(AlgebraicExpressionTest, StructuralLabelMask) {
+    // Label masking composes with structural multiplication,
+    // matching the product computed entirely by Rg_structured_bool.
+    GrB_Index n = 4;
+    GrB_Matrix F;
+    GrB_Matrix R;
+    GrB_Matrix L;
+    GrB_Matrix_new(&F, GrB_BOOL, n, n);
+    GrB_Matrix_new(&R, GrB_BOOL, n, n);
+    GrB_Matrix_new(&L, GrB_BOOL, n, n);
+    GrB_Matrix_setElement_BOOL(F, false, 0, 0);
+    GrB_Matrix_setElement_BOOL(F, true, 1, 1);
+    GrB_Matrix_setElement_BOOL(R, false, 0, 2);
+    GrB_Matrix_setElement_BOOL(R, true, 0, 3);
+    GrB_Matrix_setElement_BOOL(R, true, 1, 2);
+    GrB_Matrix_setElement_BOOL(L, true, 2, 2);
+
+    AlgebraicExpression *exp = (AlgebraicExpression*)calloc(1, sizeof(AlgebraicExpression));
+    exp->op = AL_EXP_MUL;
+    AlgebraicExpression_AppendTerm(exp, F, false, false);
+    AlgebraicExpression_AppendTerm(exp, R, false, false);
+    AlgebraicExpression_AppendTerm(exp, L, false, false);
+    exp->operands[2].diagonal = true;
+
+    GrB_Matrix expected;
+    GrB_Matrix_new(&expected, GrB_BOOL, n, n);
+    GrB_mxm(expected, GrB_NULL, GrB_NULL, Rg_structured_bool, F, R, GrB_NULL);
+    GrB_mxm(expected, GrB_NULL, GrB_NULL, Rg_structured_bool, expected, L, GrB_NULL);
+
+    GrB_Matrix res;
+    GrB_Matrix_new(&res, GrB_BOOL, n, n);
+    AlgebraicExpression_Execute(exp, res);
+    ASSERT_TRUE(_compare_matrices(res, expected));
+
+    // Every entry retained by the mask is true.
+    bool v = false;
+    ASSERT_EQ(GrB_Matrix_extractElement_BOOL(&v, res, 0, 2), GrB_SUCCESS);
+    ASSERT_TRUE(v);
+    ASSERT_EQ(GrB_Matrix_extractElement_BOOL(&v, res, 1, 2), GrB_SUCCESS);
+    ASSERT_TRUE(v);
+
+    // Clean up
+    AlgebraicExpression_Free(exp);
+    GrB_Matrix_free(&F);
+    GrB_Matrix_free(&R);
+    GrB_Matrix_free(&L);
+    GrB_Matrix_free(&expected);
+    GrB_Matrix_free(&res);
+}
@@ -239,3 +239,39 @@ TEST_F(AllPathsTest, TwoLegPaths) {
     AllPathsCtx_Free(ctx);
     Graph_Free(g);
 }
+
+TEST_F(AllPathsTest, ResetContext) {
+    Graph *g = BuildGraph();
+
+    Node src;
+    Graph_GetNode(g, 0, &src);
+    unsigned int minLen = 2;
+    unsigned int maxLen = 2;
+    unsigned int pathsCount = 0;
+    int relationships[] = { GRAPH_NO_RELATION };
+    AllPathsCtx *ctx = AllPathsCtx_New(&src, g, relationships, 1, GRAPH_EDGE_DIR_OUTGOING, minLen, maxLen);
+
+    // Abandon traversal midway, nodes left on path must not affect the next traversal.
+    ASSERT_TRUE(AllPathsCtx_NextPath(ctx) != NULL);
+    AllPathsCtx_Reset(ctx, &src);
+    while(AllPathsCtx_NextPath(ctx)) pathsCount++;
+    // 0,1,2 0,2,1 0,2,3
+    ASSERT_EQ(pathsCount, 3);
+
+    // Traverse from a different source.
+    Graph_GetNode(g, 3, &src);
+    AllPathsCtx_Reset(ctx, &src);
+    Path path;
+    pathsCount = 0;
+    while((path = AllPathsCtx_NextPath(ctx))) {
+        ASSERT_EQ(Path_len(path), 3);
+        ASSERT_EQ(ENTITY_GET_ID(path), 3);
+        ASSERT_EQ(ENTITY_GET_ID(path + 1), 0);
+        pathsCount++;
+    }
+    // 3,0,1 3,0,2
+    ASSERT_EQ(pathsCount, 2);
+
+    AllPathsCtx_Free(ctx);
+    Graph_Free(g);
+}
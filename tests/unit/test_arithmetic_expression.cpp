@@ -796,3 +796,52 @@ TEST_F(ArithmeticTest, ExistsTest) {
   ASSERT_EQ(result.longval, 1);
   AR_EXP_Free(arExp);
 }
+
+TEST_F(ArithmeticTest, CompileTest) {
+  SIValue result;
+  const char *query;
+  AR_ExpNode *arExp;
+  AR_ExpNode *clone;
+  Record r = Record_New(0);
+
+  /* Constant expressions are folded. */
+  query = "RETURN 1+2*3";
+  arExp = _exp_from_query(query);
+  AR_EXP_Compile(arExp);
+  ASSERT_EQ(AR_EXP_GetOperandType(arExp), AR_EXP_CONSTANT);
+  result = AR_EXP_Evaluate(arExp, r);
+  ASSERT_EQ(result.longval, 7);
+  AR_EXP_Free(arExp);
+
+  /* Folded strings are owned by the expression. */
+  query = "RETURN toUpper('a') + 'b'";
+  arExp = _exp_from_query(query);
+  AR_EXP_Compile(arExp);
+  ASSERT_EQ(AR_EXP_GetOperandType(arExp), AR_EXP_CONSTANT);
+  clone = AR_EXP_Clone(arExp);
+  AR_EXP_Free(arExp);
+  result = AR_EXP_Evaluate(clone, r);
+  ASSERT_STREQ(result.stringval, "Ab");
+  AR_EXP_Free(clone);
+
+  /* rand isn't folded. */
+  query = "RETURN rand() + 1";
+  arExp = _exp_from_query(query);
+  AR_EXP_Compile(arExp);
+  ASSERT_EQ(arExp->type, AR_EXP_OP);
+  result = AR_EXP_Evaluate(arExp, r);
+  ASSERT_GE(result.doubleval, 1);
+  ASSERT_LE(result.doubleval, 2);
+  AR_EXP_Free(arExp);
+
+  /* Aggregations are evaluated along with their surrounding expression. */
+  query = "RETURN ABS(-5 + 2 * 1) + SUM(1) * (1 + 1)";
+  arExp = _exp_from_query(query);
+  AR_EXP_Compile(arExp);
+  AR_EXP_Aggregate(arExp, r);
+  AR_EXP_Aggregate(arExp, r);
+  AR_EXP_Reduce(arExp);
+  result = AR_EXP_Evaluate(arExp, r);
+  ASSERT_EQ(result.doubleval, 7);
+  AR_EXP_Free(arExp);
+}
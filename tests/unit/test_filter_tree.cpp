@@ -20,6 +20,7 @@ extern "C" {
 #include "../../src/util/arr.h"
 #include "../../src/util/rmalloc.h"
 #include "../../src/query_executor.h"
+#include "../../src/execution_plan/record.h"
 
 #ifdef __cplusplus
 }
@@ -111,6 +112,15 @@ class FilterTreeTest: public ::testing::Test {
         return tree;
     }
 
+    FT_FilterNode* _build_alias_tree(const char *predicate, AST **ast) {
+        char query[1024];
+        sprintf(query, "MATCH (x) WHERE %s RETURN x", predicate);
+        *ast = _build_ast(query);
+        AST_FilterNode *root = (*ast)->whereNode->filters;
+        FT_FilterNode *tree = BuildFiltersTree(*ast, root);
+        return tree;
+    }
+
     void _compareFilterTreePredicateNode(const FT_FilterNode *a, const FT_FilterNode *b) {
         ASSERT_EQ(a->t, b->t);
         ASSERT_EQ(a->t, FT_N_PRED);
@@ -245,3 +255,100 @@ TEST_F(FilterTreeTest, CollectAliases) {
     Vector_Free(aliases);
     FilterTree_Free(tree);
 }
+
+TEST_F(FilterTreeTest, ApplyFilters) {
+    const char *predicates[7] = {"x < 5", "5 > x", "x = 3", "x != 3", "x >= 3.5", "x = \"b\"", "x < \"c\""};
+    SIValue values[4] = {SI_LongVal(3), SI_DoubleVal(3.5), SI_ConstStringVal((char*)"b"), SI_NullVal()};
+    // Expected result of each predicate for each value.
+    int expectation[7][4] = {
+        {FILTER_PASS, FILTER_PASS, FILTER_FAIL, FILTER_FAIL},
+        {FILTER_PASS, FILTER_PASS, FILTER_FAIL, FILTER_FAIL},
+        {FILTER_PASS, FILTER_FAIL, FILTER_FAIL, FILTER_FAIL},
+        {FILTER_FAIL, FILTER_PASS, FILTER_PASS, FILTER_PASS},
+        {FILTER_FAIL, FILTER_PASS, FILTER_FAIL, FILTER_FAIL},
+        {FILTER_FAIL, FILTER_FAIL, FILTER_PASS, FILTER_FAIL},
+        {FILTER_FAIL, FILTER_FAIL, FILTER_PASS, FILTER_FAIL}
+    };
+
+    for(int i = 0; i < 7; i++) {
+        AST *ast;
+        FT_FilterNode *tree = _build_alias_tree(predicates[i], &ast);
+        ASSERT_TRUE(IsNodePredicate(tree));
+        // Constant is moved to the right-hand side.
+        ASSERT_EQ(AR_EXP_GetOperandType(tree->pred.rhs), AR_EXP_CONSTANT);
+
+        int idx = AST_GetAliasID(ast, (char*)"x");
+        Record r = Record_New(AST_AliasCount(ast));
+        for(int j = 0; j < 4; j++) {
+            Record_AddScalar(r, idx, values[j]);
+            ASSERT_EQ(FilterTree_applyFilters(tree, r), expectation[i][j]);
+        }
+
+        Record_Free(r);
+        FilterTree_Free(tree);
+    }
+}
+
+TEST_F(FilterTreeTest, ApplyParamFilters) {
+    AST *ast;
+    FT_FilterNode *tree = _build_alias_tree("$v <= x", &ast);
+    ASSERT_TRUE(IsNodePredicate(tree));
+    ASSERT_EQ(tree->pred.op, GE);
+    AST_Param *param = AST_Params_Find(ast->params, "v");
+    ASSERT_TRUE(param != NULL);
+
+    int idx = AST_GetAliasID(ast, (char*)"x");
+    Record r = Record_New(AST_AliasCount(ast));
+
+    // Parameter's type changes between executions.
+    param->value = SI_LongVal(3);
+    Record_AddScalar(r, idx, SI_LongVal(3));
+    ASSERT_EQ(FilterTree_applyFilters(tree, r), FILTER_PASS);
+    Record_AddScalar(r, idx, SI_DoubleVal(2.5));
+    ASSERT_EQ(FilterTree_applyFilters(tree, r), FILTER_FAIL);
+
+    param->value = SI_DoubleVal(2.5);
+    ASSERT_EQ(FilterTree_applyFilters(tree, r), FILTER_PASS);
+    Record_AddScalar(r, idx, SI_ConstStringVal((char*)"a"));
+    ASSERT_EQ(FilterTree_applyFilters(tree, r), FILTER_FAIL);
+
+    param->value = SI_ConstStringVal((char*)"a");
+    ASSERT_EQ(FilterTree_applyFilters(tree, r), FILTER_PASS);
+    Record_AddScalar(r, idx, SI_LongVal(3));
+    ASSERT_EQ(FilterTree_applyFilters(tree, r), FILTER_FAIL);
+
+    Record_Free(r);
+    FilterTree_Free(tree);
+}
+
+TEST_F(FilterTreeTest, ApplyFiltersBatch) {
+    AST *ast;
+    FT_FilterNode *tree = _build_alias_tree("(x < 10 OR x >= 90) AND x != 95", &ast);
+    int idx = AST_GetAliasID(ast, (char*)"x");
+
+    const uint count = 100;
+    Record records[count];
+    for(uint i = 0; i < count; i++) {
+        records[i] = Record_New(AST_AliasCount(ast));
+        Record_AddScalar(records[i], idx, SI_LongVal(i));
+    }
+
+    // Select all records but the first.
+    uint64_t selection[FILTER_SELECTION_WORDS(count)];
+    memset(selection, 0, sizeof(selection));
+    for(uint i = 1; i < count; i++) selection[i / 64] |= (1ULL << (i % 64));
+
+    FilterTree_applyFiltersBatch(tree, records, count, selection);
+
+    uint passed = 0;
+    for(uint i = 0; i < count; i++) {
+        bool selected = selection[i / 64] & (1ULL << (i % 64));
+        if(selected) passed++;
+        if(i == 0) ASSERT_FALSE(selected);
+        else ASSERT_EQ(selected, FilterTree_applyFilters(tree, records[i]) == FILTER_PASS);
+    }
+    ASSERT_EQ(passed, 18);
+
+    for(uint i = 0; i < count; i++) Record_Free(records[i]);
+    FilterTree_Free(tree);
+}
@@ -910,3 +910,223 @@ TEST_F(GraphTest, BulkDelete)
     // Clean up.
     Graph_Free(g);
 }
+
+TEST_F(GraphTest, Statistics)
+{
+    Node n[5];
+    Edge e[5];
+    RelationStatistics stats;
+    Graph *g = Graph_New(16, 16);
+
+    Graph_AcquireWriteLock(g);
+
+    int a = Graph_AddLabel(g);
+    int b = Graph_AddLabel(g);
+    int r = Graph_AddRelationType(g);
+
+    Graph_CreateNode(g, a, &n[0]);
+    Graph_CreateNode(g, a, &n[1]);
+    Graph_CreateNode(g, b, &n[2]);
+    Graph_CreateNode(g, b, &n[3]);
+    Graph_CreateNode(g, GRAPH_NO_LABEL, &n[4]);
+
+    /* Connect nodes:
+     * (0)-[r]->(2)
+     * (0)-[r]->(2)
+     * (0)-[r]->(3)
+     * (1)-[r]->(2)
+     * (4)-[r]->(2) */
+    Graph_ConnectNodes(g, ENTITY_GET_ID(&n[0]), ENTITY_GET_ID(&n[2]), r, &e[0]);
+    Graph_ConnectNodes(g, ENTITY_GET_ID(&n[0]), ENTITY_GET_ID(&n[2]), r, &e[1]);
+    Graph_ConnectNodes(g, ENTITY_GET_ID(&n[0]), ENTITY_GET_ID(&n[3]), r, &e[2]);
+    Graph_ConnectNodes(g, ENTITY_GET_ID(&n[1]), ENTITY_GET_ID(&n[2]), r, &e[3]);
+    Graph_ConnectNodes(g, ENTITY_GET_ID(&n[4]), ENTITY_GET_ID(&n[2]), r, &e[4]);
+
+    Graph_ReleaseLock(g);
+
+    ASSERT_EQ(Graph_LabeledNodeCount(g, a), 2);
+    ASSERT_EQ(Graph_LabeledNodeCount(g, b), 2);
+    ASSERT_EQ(GraphStatistics_EdgeCount(&g->stats, r), 5);
+
+    GraphStatistics_GetRelationStatistics(g, r, true, &stats);
+    ASSERT_EQ(stats.pairs, 4);
+    ASSERT_EQ(stats.sources, 3);
+    ASSERT_EQ(stats.destinations, 2);
+    ASSERT_EQ(stats.max_out_degree, 2);
+    ASSERT_EQ(stats.max_in_degree, 3);
+    ASSERT_EQ(stats.src_label_pairs[a], 3);
+    ASSERT_EQ(stats.src_label_pairs[b], 0);
+    ASSERT_EQ(stats.dest_label_pairs[a], 0);
+    ASSERT_EQ(stats.dest_label_pairs[b], 4);
+
+    // Remove (0)-[r]->(3), relation statistics are recomputed.
+    Graph_AcquireWriteLock(g);
+    ASSERT_EQ(Graph_DeleteEdge(g, &e[2]), 1);
+    Graph_ReleaseLock(g);
+
+    ASSERT_EQ(GraphStatistics_EdgeCount(&g->stats, r), 4);
+    RelationStatistics_Free(&stats);
+    GraphStatistics_GetRelationStatistics(g, r, true, &stats);
+    ASSERT_EQ(stats.pairs, 3);
+    ASSERT_EQ(stats.destinations, 1);
+    ASSERT_EQ(stats.max_out_degree, 1);
+    ASSERT_EQ(stats.src_label_pairs[a], 2);
+
+    // Delete node 0, implicitly deleting both of its edges.
+    uint node_deleted = 0;
+    uint edge_deleted = 0;
+    Graph_AcquireWriteLock(g);
+    Graph_BulkDelete(g, &n[0], 1, NULL, 0, &node_deleted, &edge_deleted);
+    Graph_ReleaseLock(g);
+
+    ASSERT_EQ(Graph_LabeledNodeCount(g, a), 1);
+    ASSERT_EQ(Graph_LabeledNodeCount(g, b), 2);
+    ASSERT_EQ(GraphStatistics_EdgeCount(&g->stats, r), 2);
+
+    RelationStatistics_Free(&stats);
+    GraphStatistics_GetRelationStatistics(g, r, true, &stats);
+    ASSERT_EQ(stats.pairs, 2);
+    ASSERT_EQ(stats.sources, 2);
+    ASSERT_EQ(stats.max_in_degree, 2);
+    ASSERT_EQ(stats.src_label_pairs[a], 1);
+    ASSERT_EQ(stats.dest_label_pairs[b], 2);
+
+    // Clean up.
+    RelationStatistics_Free(&stats);
+    Graph_Free(g);
+}
+
+TEST_F(GraphTest, SchemaVersion)
+{
+    Node n;
+    Graph *g = Graph_New(16, 16);
+    uint64_t schema_version = Graph_GetSchemaVersion(g);
+
+    // Introducing a label changes schema version.
+    Graph_AcquireWriteLock(g);
+    int l = Graph_AddLabel(g);
+    Graph_ReleaseLock(g);
+    ASSERT_NE(Graph_GetSchemaVersion(g), schema_version);
+    schema_version = Graph_GetSchemaVersion(g);
+
+    // Populating an empty label is a drift.
+    Graph_AcquireWriteLock(g);
+    for(int i = 0; i < 100; i++) Graph_CreateNode(g, l, &n);
+    Graph_ReleaseLock(g);
+    ASSERT_NE(Graph_GetSchemaVersion(g), schema_version);
+    schema_version = Graph_GetSchemaVersion(g);
+
+    // Small writes change graph version but keep schema version.
+    uint64_t version = Graph_GetVersion(g);
+    Graph_AcquireWriteLock(g);
+    for(int i = 0; i < 5; i++) Graph_CreateNode(g, l, &n);
+    Graph_ReleaseLock(g);
+    ASSERT_NE(Graph_GetVersion(g), version);
+    ASSERT_EQ(Graph_GetSchemaVersion(g), schema_version);
+
+    // Small writes accumulate until statistics drift past tolerance.
+    Graph_AcquireWriteLock(g);
+    for(int i = 0; i < 10; i++) Graph_CreateNode(g, l, &n);
+    Graph_ReleaseLock(g);
+    ASSERT_NE(Graph_GetSchemaVersion(g), schema_version);
+    schema_version = Graph_GetSchemaVersion(g);
+
+    // Introducing a relation type changes schema version.
+    Graph_AcquireWriteLock(g);
+    Graph_AddRelationType(g);
+    Graph_ReleaseLock(g);
+    ASSERT_NE(Graph_GetSchemaVersion(g), schema_version);
+
+    // Clean up.
+    Graph_Free(g);
+}
+
+// Validates transposed relation matrix matches relation matrix.
+static void _ValidateTransposedRelation(Graph *g, int r) {
+    GrB_Matrix R = Graph_GetRelationMatrix(g, r);
+    GrB_Matrix T = Graph_GetTransposedRelationMatrix(g, r);
+
+    GrB_Index n;
+    GrB_Index nvals;
+    GrB_Index tnvals;
+    GrB_Matrix expected;
+    GrB_Matrix_nrows(&n, R);
+    GrB_Matrix_new(&expected, GrB_BOOL, n, n);
+    GrB_transpose(expected, NULL, NULL, R, NULL);
+
+    GrB_Matrix_nrows(&tnvals, T);
+    ASSERT_EQ(tnvals, n);
+    GrB_Matrix_nvals(&nvals, expected);
+    GrB_Matrix_nvals(&tnvals, T);
+    ASSERT_EQ(tnvals, nvals);
+
+    GxB_MatrixTupleIter *it;
+    GxB_MatrixTupleIter_new(&it, expected);
+    while(true) {
+        bool x;
+        bool depleted;
+        GrB_Index row;
+        GrB_Index col;
+        GxB_MatrixTupleIter_next(it, &row, &col, &depleted);
+        if(depleted) break;
+        ASSERT_EQ(GrB_Matrix_extractElement_BOOL(&x, T, row, col), GrB_SUCCESS);
+    }
+
+    GxB_MatrixTupleIter_free(it);
+    GrB_Matrix_free(&expected);
+}
+
+TEST_F(GraphTest, TransposedRelationMatrix)
+{
+    Node n[6];
+    Edge e[6];
+    Graph *g = Graph_New(16, 16);
+
+    Graph_AcquireWriteLock(g);
+    int r = Graph_AddRelationType(g);
+    for(int i = 0; i < 4; i++) Graph_CreateNode(g, GRAPH_NO_LABEL, &n[i]);
+
+    /* Connect nodes:
+     * (0)-[r]->(1)
+     * (0)-[r]->(2)
+     * (1)-[r]->(2) */
+    Graph_ConnectNodes(g, 0, 1, r, &e[0]);
+    Graph_ConnectNodes(g, 0, 2, r, &e[1]);
+    Graph_ConnectNodes(g, 1, 2, r, &e[2]);
+    Graph_ReleaseLock(g);
+
+    // Transposed matrix is created on first access, and reused.
+    GrB_Matrix T = Graph_GetTransposedRelationMatrix(g, r);
+    _ValidateTransposedRelation(g, r);
+    ASSERT_EQ(Graph_GetTransposedRelationMatrix(g, r), T);
+    ASSERT_EQ(Graph_GetTransposedRelationMatrix(g, GRAPH_NO_RELATION), g->_t_adjacency_matrix);
+
+    // Additional nodes and edges, (3)-[r]->(0), (4)-[r]->(3), (5)-[r]->(1).
+    Graph_AcquireWriteLock(g);
+    Graph_CreateNode(g, GRAPH_NO_LABEL, &n[4]);
+    Graph_CreateNode(g, GRAPH_NO_LABEL, &n[5]);
+    Graph_ConnectNodes(g, 3, 0, r, &e[3]);
+    Graph_ConnectNodes(g, 4, 3, r, &e[4]);
+    Graph_ConnectNodes(g, 5, 1, r, &e[5]);
+    Graph_ReleaseLock(g);
+    _ValidateTransposedRelation(g, r);
+
+    // Remove (0)-[r]->(2).
+    Graph_AcquireWriteLock(g);
+    ASSERT_EQ(Graph_DeleteEdge(g, &e[1]), 1);
+    Graph_ReleaseLock(g);
+    _ValidateTransposedRelation(g, r);
+
+    // Delete node 3 and edge (1)-[r]->(2).
+    uint node_deleted = 0;
+    uint edge_deleted = 0;
+    Graph_AcquireWriteLock(g);
+    Graph_BulkDelete(g, &n[3], 1, &e[2], 1, &node_deleted, &edge_deleted);
+    Graph_ReleaseLock(g);
+    ASSERT_EQ(node_deleted, 1);
+    _ValidateTransposedRelation(g, r);
+    ASSERT_EQ(Graph_GetTransposedRelationMatrix(g, r), T);
+
+    // Clean up.
+    Graph_Free(g);
+}
@@ -0,0 +1,77 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Redis Labs Source Available License Agreement
+*/
+
+#include "../../deps/googletest/include/gtest/gtest.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+#include "../../src/util/rmalloc.h"
+#include "../../src/util/matrix_pool.h"
+#ifdef __cplusplus
+}
+#endif
+
+class MatrixPoolTest: public ::testing::Test {
+  protected:
+    static void SetUpTestCase() {
+        // Use the malloc family for allocations
+        Alloc_Reset();
+        ASSERT_EQ(GrB_init(GrB_NONBLOCKING), GrB_SUCCESS);
+        GxB_Global_Option_set(GxB_FORMAT, GxB_BY_ROW); // all matrices in CSR format
+        GxB_Global_Option_set(GxB_HYPER, GxB_NEVER_HYPER); // matrices are never hypersparse
+    }
+
+    static void TearDownTestCase() {
+        MatrixPool_Clear();
+        GrB_finalize();
+    }
+};
+
+TEST_F(MatrixPoolTest, BorrowReturn) {
+    GrB_Matrix m = MatrixPool_Borrow(GrB_BOOL, 16, 100);
+    GrB_Matrix_setElement_BOOL(m, true, 3, 50);
+    GrB_Matrix pooled = m;
+    MatrixPool_Return(&m);
+    ASSERT_TRUE(m == NULL);
+
+    // Shape mismatch, a new matrix is created.
+    GrB_Matrix other = MatrixPool_Borrow(GrB_BOOL, 16, 200);
+    ASSERT_TRUE(other != pooled);
+    GrB_Matrix t = MatrixPool_Borrow(GrB_UINT64, 16, 100);
+    ASSERT_TRUE(t != pooled);
+
+    // Matching shape, pooled matrix is reused, empty.
+    m = MatrixPool_Borrow(GrB_BOOL, 16, 100);
+    ASSERT_TRUE(m == pooled);
+    GrB_Index nvals;
+    GrB_Matrix_nvals(&nvals, m);
+    ASSERT_EQ(nvals, 0);
+
+    // Pool is depleted.
+    GrB_Matrix n = MatrixPool_Borrow(GrB_BOOL, 16, 100);
+    ASSERT_TRUE(n != m);
+
+    MatrixPool_Return(&m);
+    MatrixPool_Return(&n);
+    MatrixPool_Return(&other);
+    MatrixPool_Return(&t);
+    MatrixPool_Clear();
+}
+
+TEST_F(MatrixPoolTest, Eviction) {
+    GrB_Matrix matrices[MATRIX_POOL_CAP + 1];
+    for(int i = 0; i <= MATRIX_POOL_CAP; i++) matrices[i] = MatrixPool_Borrow(GrB_BOOL, 1, i + 1);
+
+    GrB_Matrix last = matrices[MATRIX_POOL_CAP];
+    for(int i = 0; i <= MATRIX_POOL_CAP; i++) MatrixPool_Return(matrices + i);
+
+    // Pool is full, retaining the most recently returned matrices.
+    GrB_Matrix m = MatrixPool_Borrow(GrB_BOOL, 1, MATRIX_POOL_CAP + 1);
+    ASSERT_TRUE(m == last);
+    GrB_Matrix_free(&m);
+    MatrixPool_Clear();
+}
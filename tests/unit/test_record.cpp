@@ -12,6 +12,7 @@ extern "C" {
 
 #include <stdio.h>
 #include "../../src/execution_plan/record.h"
+#include "../../src/execution_plan/record_set.h"
 #include "../../src/util/rmalloc.h"
 #include "../../src/value.h"
 
@@ -52,3 +53,103 @@ TEST_F(RecordTest, RecordToString) {
     rm_free(record_str);
     Record_Free(r);
 }
+
+TEST_F(RecordTest, RecordSetDistinct) {
+    RecordSet *set = RecordSet_New(2);
+    int n = 3000;
+
+    for(int round = 0; round < 2; round++) {
+        for(int i = 0; i < n; i++) {
+            Record r = Record_New(2);
+            // Values repeat every 1500 records.
+            char buf[32];
+            sprintf(buf, "str%d", i % 1500);
+            Record_AddScalar(r, 0, SI_DuplicateStringVal(buf));
+            Record_AddScalar(r, 1, SI_LongVal(i % 1500));
+            bool added = RecordSet_Add(set, r);
+            ASSERT_EQ(added, round == 0 && i < 1500);
+            Record_Free(r);
+        }
+    }
+    ASSERT_EQ(RecordSet_Count(set), 1500);
+
+    // Same value of a different type is a different record.
+    Record r = Record_New(2);
+    Record_AddScalar(r, 0, SI_ConstStringVal("str1"));
+    Record_AddScalar(r, 1, SI_DoubleVal(1));
+    ASSERT_TRUE(RecordSet_Add(set, r));
+    ASSERT_FALSE(RecordSet_Add(set, r));
+
+    RecordSet_Clear(set);
+    ASSERT_EQ(RecordSet_Count(set), 0);
+    ASSERT_TRUE(RecordSet_Add(set, r));
+    Record_Free(r);
+
+    RecordSet_Free(set);
+}
+
+TEST_F(RecordTest, RecordSetEntities) {
+    // Wide enough to require more than a single tag value.
+    int len = 40;
+    Entity entity = {5, 0, NULL};
+    Node n = {0};
+    Edge e = {0};
+    n.entity = &entity;
+    e.entity = &entity;
+    RecordSet *set = RecordSet_New(4);
+
+    // Node 5, edge 5 and integer 5 are all different records.
+    for(int i = 0; i < 2; i++) {
+        Record r = Record_New(len);
+        for(int j = 0; j < len; j++) Record_AddScalar(r, j, SI_LongVal(5));
+        ASSERT_EQ(RecordSet_Add(set, r), i == 0);
+
+        Record_AddNode(r, len - 1, n);
+        ASSERT_EQ(RecordSet_Add(set, r), i == 0);
+
+        Record_AddEdge(r, len - 1, e);
+        ASSERT_EQ(RecordSet_Add(set, r), i == 0);
+
+        Record_AddScalar(r, len - 1, SI_Node(&n));
+        ASSERT_FALSE(RecordSet_Add(set, r));
+        Record_Free(r);
+    }
+    ASSERT_EQ(RecordSet_Count(set), 3);
+
+    RecordSet_Free(set);
+}
+
+TEST_F(RecordTest, RecordSerialization) {
+    FILE *stream = tmpfile();
+    ASSERT_TRUE(stream != NULL);
+
+    Record r = Record_New(5);
+    Record_AddScalar(r, 0, SI_ConstStringVal("Hello"));
+    Record_AddScalar(r, 1, SI_LongVal(-24));
+    Record_AddScalar(r, 2, SI_DoubleVal(0.314));
+    Record_AddScalar(r, 3, SI_NullVal());
+    Record_AddScalar(r, 4, SI_BoolVal(1));
+
+    ASSERT_TRUE(Record_Serialize(r, stream));
+    ASSERT_TRUE(Record_Serialize(r, stream));
+    rewind(stream);
+
+    for(int i = 0; i < 2; i++) {
+        Record clone = Record_Deserialize(stream);
+        ASSERT_TRUE(clone != NULL);
+        ASSERT_EQ(Record_length(clone), Record_length(r));
+        for(int j = 0; j < Record_length(r); j++) {
+            SIValue a = Record_GetScalar(r, j);
+            SIValue b = Record_GetScalar(clone, j);
+            if(a.type == T_NULL) ASSERT_EQ(b.type, T_NULL);
+            else ASSERT_EQ(SIValue_Compare(a, b), 0);
+        }
+        Record_Free(clone);
+    }
+
+    // Stream is depleted.
+    ASSERT_TRUE(Record_Deserialize(stream) == NULL);
+
+    Record_Free(r);
+    fclose(stream);
+}
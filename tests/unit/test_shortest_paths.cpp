@@ -0,0 +1,170 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Redis Labs Source Available License Agreement
+*/
+
+#include "../../deps/googletest/include/gtest/gtest.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "../../src/util/rmalloc.h"
+#include "../../src/algorithms/algorithms.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+class ShortestPathsTest: public ::testing::Test {
+    protected:
+    static void SetUpTestCase()
+    {
+        // Use the malloc family for allocations
+        Alloc_Reset();
+
+        // Initialize GraphBLAS.
+        GrB_init(GrB_NONBLOCKING);
+        GxB_Global_Option_set(GxB_FORMAT, GxB_BY_ROW); // all matrices in CSR format
+        GxB_Global_Option_set(GxB_HYPER, GxB_NEVER_HYPER); // matrices are never hypersparse
+    }
+
+    static void TearDownTestCase()
+    {
+        GrB_finalize();
+    }
+
+    static Graph* BuildGraph()
+    {
+        Edge e;
+        Node n;
+        size_t nodeCount = 7;
+        Graph *g = Graph_New(nodeCount, nodeCount);
+        int r = Graph_AddRelationType(g);
+        int s = Graph_AddRelationType(g);
+        for(int i = 0; i < nodeCount; i++) Graph_CreateNode(g, GRAPH_NO_LABEL, &n);
+
+        /* Connections:
+         * 0 -R-> 1 -R-> 2 -R-> 3
+         * 0 -R-> 4 -R-> 3, 0 is connected to 4 twice
+         * 0 -R-> 5 -R-> 3
+         * 0 -S-> 5
+         * 6 is isolated */
+        Graph_ConnectNodes(g, 0, 1, r, &e);
+        Graph_ConnectNodes(g, 1, 2, r, &e);
+        Graph_ConnectNodes(g, 2, 3, r, &e);
+        Graph_ConnectNodes(g, 0, 4, r, &e);
+        Graph_ConnectNodes(g, 0, 4, r, &e);
+        Graph_ConnectNodes(g, 4, 3, r, &e);
+        Graph_ConnectNodes(g, 0, 5, r, &e);
+        Graph_ConnectNodes(g, 5, 3, r, &e);
+        Graph_ConnectNodes(g, 0, 5, s, &e);
+        return g;
+    }
+
+    static uint64_t Count(Graph *g, int *relations, int relationCount, GRAPH_EDGE_DIR dir,
+                          bool multiEdges, unsigned int maxHops, NodeID src, NodeID dest)
+    {
+        ShortestPathsCtx *ctx = ShortestPathsCtx_New(g, relations, relationCount, dir,
+                                                     multiEdges, 1, maxHops);
+        uint64_t paths = ShortestPathsCtx_Count(ctx, src, dest);
+        ShortestPathsCtx_Free(ctx);
+        return paths;
+    }
+};
+
+TEST_F(ShortestPathsTest, Directed) {
+    Graph *g = BuildGraph();
+    int relations[] = {0};
+
+    // 0 -> 4 -> 3 once, 0 -> 5 -> 3.
+    ASSERT_EQ(Count(g, relations, 1, GRAPH_EDGE_DIR_OUTGOING, false, 10, 0, 3), 2);
+    // 0 -> 4 -> 3 twice, 0 -> 5 -> 3.
+    ASSERT_EQ(Count(g, relations, 1, GRAPH_EDGE_DIR_OUTGOING, true, 10, 0, 3), 3);
+    ASSERT_EQ(Count(g, relations, 1, GRAPH_EDGE_DIR_OUTGOING, true, 10, 0, 2), 1);
+    ASSERT_EQ(Count(g, relations, 1, GRAPH_EDGE_DIR_OUTGOING, true, 10, 3, 0), 0);
+    ASSERT_EQ(Count(g, relations, 1, GRAPH_EDGE_DIR_OUTGOING, true, 10, 0, 6), 0);
+
+    // Parallel relationships of different types.
+    int both[] = {0, 1};
+    ASSERT_EQ(Count(g, both, 2, GRAPH_EDGE_DIR_OUTGOING, true, 10, 0, 3), 4);
+    int any[] = {GRAPH_NO_RELATION};
+    ASSERT_EQ(Count(g, any, 1, GRAPH_EDGE_DIR_OUTGOING, true, 10, 0, 3), 4);
+    ASSERT_EQ(Count(g, any, 1, GRAPH_EDGE_DIR_OUTGOING, false, 10, 0, 3), 2);
+
+    // Unknown relation.
+    ASSERT_EQ(Count(g, relations, 0, GRAPH_EDGE_DIR_OUTGOING, true, 10, 0, 3), 0);
+
+    Graph_Free(g);
+}
+
+TEST_F(ShortestPathsTest, Reversed) {
+    Graph *g = BuildGraph();
+    int relations[] = {0};
+
+    ASSERT_EQ(Count(g, relations, 1, GRAPH_EDGE_DIR_INCOMING, false, 10, 3, 0), 2);
+    ASSERT_EQ(Count(g, relations, 1, GRAPH_EDGE_DIR_INCOMING, true, 10, 3, 0), 3);
+    ASSERT_EQ(Count(g, relations, 1, GRAPH_EDGE_DIR_INCOMING, true, 10, 2, 0), 1);
+    ASSERT_EQ(Count(g, relations, 1, GRAPH_EDGE_DIR_INCOMING, true, 10, 0, 3), 0);
+
+    Graph_Free(g);
+}
+
+TEST_F(ShortestPathsTest, Undirected) {
+    Graph *g = BuildGraph();
+    int relations[] = {0};
+
+    ASSERT_EQ(Count(g, relations, 1, GRAPH_EDGE_DIR_BOTH, true, 10, 3, 0), 3);
+    ASSERT_EQ(Count(g, relations, 1, GRAPH_EDGE_DIR_BOTH, true, 10, 0, 3), 3);
+    // 1 <- 0 -> 4, against the direction of 0 -> 1.
+    ASSERT_EQ(Count(g, relations, 1, GRAPH_EDGE_DIR_BOTH, false, 10, 1, 4), 1);
+    ASSERT_EQ(Count(g, relations, 1, GRAPH_EDGE_DIR_BOTH, true, 10, 1, 4), 2);
+    ASSERT_EQ(Count(g, relations, 1, GRAPH_EDGE_DIR_OUTGOING, true, 10, 1, 4), 0);
+    // 4 and 5 are connected through both 0 and 3.
+    ASSERT_EQ(Count(g, relations, 1, GRAPH_EDGE_DIR_BOTH, true, 10, 4, 5), 3);
+    ASSERT_EQ(Count(g, relations, 1, GRAPH_EDGE_DIR_BOTH, true, 10, 0, 6), 0);
+
+    Graph_Free(g);
+}
+
+TEST_F(ShortestPathsTest, MaxHops) {
+    Graph *g = BuildGraph();
+    int relations[] = {0};
+
+    ASSERT_EQ(Count(g, relations, 1, GRAPH_EDGE_DIR_OUTGOING, true, 1, 0, 3), 0);
+    ASSERT_EQ(Count(g, relations, 1, GRAPH_EDGE_DIR_OUTGOING, true, 2, 0, 3), 3);
+    ASSERT_EQ(Count(g, relations, 1, GRAPH_EDGE_DIR_OUTGOING, true, 1, 0, 4), 2);
+    ASSERT_EQ(Count(g, relations, 1, GRAPH_EDGE_DIR_OUTGOING, true, 1, 1, 2), 1);
+    ASSERT_EQ(Count(g, relations, 1, GRAPH_EDGE_DIR_BOTH, true, 1, 4, 5), 0);
+
+    // Path of length 0.
+    ShortestPathsCtx *ctx = ShortestPathsCtx_New(g, relations, 1, GRAPH_EDGE_DIR_OUTGOING, true, 0, 1);
+    ASSERT_EQ(ShortestPathsCtx_Count(ctx, 0, 0), 1);
+    ShortestPathsCtx_Free(ctx);
+    ASSERT_EQ(Count(g, relations, 1, GRAPH_EDGE_DIR_OUTGOING, true, 1, 0, 0), 0);
+
+    Graph_Free(g);
+}
+
+TEST_F(ShortestPathsTest, Rebind) {
+    Graph *g = BuildGraph();
+    int relations[] = {0};
+    ShortestPathsCtx *ctx = ShortestPathsCtx_New(g, relations, 1, GRAPH_EDGE_DIR_OUTGOING, true, 1, 10);
+    ASSERT_EQ(ShortestPathsCtx_Count(ctx, 0, 3), 3);
+
+    // Edge counts are gathered once, until the context is rebound.
+    Edge e;
+    Node n;
+    Graph_ConnectNodes(g, 5, 3, 0, &e);
+    Graph_CreateNode(g, GRAPH_NO_LABEL, &n);
+    Graph_ConnectNodes(g, 3, 7, 0, &e);
+    ASSERT_EQ(ShortestPathsCtx_Count(ctx, 0, 3), 3);
+
+    ShortestPathsCtx_Rebind(ctx);
+    ASSERT_EQ(ShortestPathsCtx_Count(ctx, 0, 3), 4);
+    ASSERT_EQ(ShortestPathsCtx_Count(ctx, 0, 7), 4);
+
+    ShortestPathsCtx_Free(ctx);
+    Graph_Free(g);
+}
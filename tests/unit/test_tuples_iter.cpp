@@ -373,4 +373,55 @@ TEST_F(TuplesTest, ColumnIteratorEmptyMatrixTest) {
 
     GxB_MatrixTupleIter_free(iter);
     GrB_Matrix_free(&A);
-}
\ No newline at end of file
+}
+TEST_F(TuplesTest, RangeIteratorTest) {
+    //--------------------------------------------------------------------------
+    // Build a 8X8 diagonal matrix
+    //--------------------------------------------------------------------------
+
+    GrB_Index n = 8;
+    GrB_Matrix A = CreateSquareNByNDiagonalMatrix(n);
+    GrB_Index row;
+    GrB_Index col;
+    bool depleted = false;
+    GxB_MatrixTupleIter *iter;
+    GxB_MatrixTupleIter_new(&iter, A);
+
+    //--------------------------------------------------------------------------
+    // Iterate over rows [2, 5).
+    //--------------------------------------------------------------------------
+
+    GxB_MatrixTupleIter_iterate_range(iter, 2, 5);
+    for(GrB_Index i = 2; i < 5; i++) {
+      GxB_MatrixTupleIter_next(iter, &row, &col, &depleted);
+      ASSERT_FALSE(depleted);
+      ASSERT_EQ(row, i);
+      ASSERT_EQ(col, i);
+    }
+    GxB_MatrixTupleIter_next(iter, &row, &col, &depleted);
+    ASSERT_TRUE(depleted);
+
+    //--------------------------------------------------------------------------
+    // Range exceeding matrix dimensions is clipped.
+    //--------------------------------------------------------------------------
+
+    GxB_MatrixTupleIter_iterate_range(iter, 6, 100);
+    for(GrB_Index i = 6; i < n; i++) {
+      GxB_MatrixTupleIter_next(iter, &row, &col, &depleted);
+      ASSERT_FALSE(depleted);
+      ASSERT_EQ(row, i);
+    }
+    GxB_MatrixTupleIter_next(iter, &row, &col, &depleted);
+    ASSERT_TRUE(depleted);
+
+    //--------------------------------------------------------------------------
+    // Empty range.
+    //--------------------------------------------------------------------------
+
+    GxB_MatrixTupleIter_iterate_range(iter, 3, 3);
+    GxB_MatrixTupleIter_next(iter, &row, &col, &depleted);
+    ASSERT_TRUE(depleted);
+
+    GxB_MatrixTupleIter_free(iter);
+    GrB_Matrix_free(&A);
+}
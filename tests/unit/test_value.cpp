@@ -12,6 +12,7 @@ extern "C" {
 
 #include "../../src/value.h"
 #include "../../src/util/rmalloc.h"
+#include "../../src/util/sort_key.h"
 
 #ifdef __cplusplus
 }
@@ -62,3 +63,69 @@ TEST(ValueTest, TestStrings) {
     SIValue_Free(&v);
 }
 
+
+TEST(ValueTest, TestSortKeys) {
+    Alloc_Reset();
+    // Values in ascending order.
+    SIValue values[] = {
+        SI_ConstStringVal((char*)""),
+        SI_ConstStringVal((char*)"a"),
+        SI_ConstStringVal((char*)"ab"),
+        SI_ConstStringVal((char*)"b"),
+        SI_BoolVal(false),
+        SI_BoolVal(true),
+        SI_DoubleVal(-1e300),
+        SI_LongVal(-5),
+        SI_DoubleVal(-0.5),
+        SI_LongVal(0),
+        SI_DoubleVal(0.5),
+        SI_LongVal(2),
+        SI_DoubleVal(2.5),
+        SI_LongVal((1LL << 60)),
+        SI_LongVal((1LL << 60) + 1),
+        SI_LongVal(INT64_MAX),
+        SI_NullVal()
+    };
+    int n = sizeof(values) / sizeof(SIValue);
+
+    for(int d = 0; d < 2; d++) {
+        bool descending = d;
+        for(int i = 0; i < n; i++) {
+            for(int j = 0; j < n; j++) {
+                SortKeyBuffer a, b;
+                SortKeyBuffer_Init(&a);
+                SortKeyBuffer_Init(&b);
+                // Compose two column keys, first column decides order.
+                SortKeyBuffer_Append(&a, values[i], descending);
+                SortKeyBuffer_Append(&a, values[n - 1 - i], descending);
+                SortKeyBuffer_Append(&b, values[j], descending);
+                SortKeyBuffer_Append(&b, values[n - 1 - j], descending);
+
+                int rel = SortKey_Compare(a.data, a.len, b.data, b.len);
+                int expected = (i > j) - (i < j);
+                if(descending) expected = -expected;
+                ASSERT_EQ((rel > 0) - (rel < 0), expected);
+
+                SortKeyBuffer_Free(&a);
+                SortKeyBuffer_Free(&b);
+            }
+        }
+    }
+
+    // Integers and doubles of equal value tie, later columns break the tie.
+    for(int d = 0; d < 2; d++) {
+        bool descending = d;
+        SortKeyBuffer a, b;
+        SortKeyBuffer_Init(&a);
+        SortKeyBuffer_Init(&b);
+        SortKeyBuffer_Append(&a, SI_LongVal(3), descending);
+        SortKeyBuffer_Append(&b, SI_DoubleVal(3), descending);
+        ASSERT_EQ(SortKey_Compare(a.data, a.len, b.data, b.len), 0);
+
+        SortKeyBuffer_Append(&a, SI_LongVal(2), false);
+        SortKeyBuffer_Append(&b, SI_LongVal(1), false);
+        ASSERT_GT(SortKey_Compare(a.data, a.len, b.data, b.len), 0);
+        SortKeyBuffer_Free(&a);
+        SortKeyBuffer_Free(&b);
+    }
+}
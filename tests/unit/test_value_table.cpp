@@ -0,0 +1,79 @@
+/*
+* Copyright 2018-2019 Redis Labs Ltd. and Contributors
+*
+* This file is available under the Redis Labs Source Available License Agreement
+*/
+
+#include "../../deps/googletest/include/gtest/gtest.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+#include "../../src/value.h"
+#include "../../src/util/rmalloc.h"
+#include "../../src/util/value_table.h"
+#ifdef __cplusplus
+}
+#endif
+
+class ValueTableTest: public ::testing::Test {
+  protected:
+    static void SetUpTestCase() {
+      // Use the malloc family for allocations
+      Alloc_Reset();
+    }
+};
+
+TEST_F(ValueTableTest, InsertFind) {
+  // Start small to force several resizes.
+  ValueTable *table = ValueTable_New(2, 1);
+  int n = 1000;
+  SIValue *keys = (SIValue*)malloc(sizeof(SIValue) * 2 * n);
+
+  for(int i = 0; i < n; i++) {
+    keys[i*2] = SI_LongVal(i);
+    keys[i*2+1] = SI_ConstStringVal((char*)((i % 2) ? "odd" : "even"));
+    uint64_t hash = ValueTable_HashKey(keys + i*2, 2);
+    ASSERT_TRUE(ValueTable_Find(table, keys + i*2, hash) == NULL);
+    ValueTable_Insert(table, keys + i*2, hash, (void*)(intptr_t)i);
+  }
+  ASSERT_EQ(ValueTable_Count(table), n);
+
+  for(int i = 0; i < n; i++) {
+    // Lookup using a different copy of the key.
+    SIValue key[2] = {SI_LongVal(i), SI_ConstStringVal((char*)((i % 2) ? "odd" : "even"))};
+    uint64_t hash = ValueTable_HashKey(key, 2);
+    ValueTableEntry *entry = ValueTable_Find(table, key, hash);
+    ASSERT_TRUE(entry != NULL);
+    ASSERT_EQ((intptr_t)entry->value, i);
+
+    // Entries are kept in insertion order.
+    ASSERT_EQ((intptr_t)ValueTable_EntryAt(table, i)->value, i);
+  }
+
+  // Same values of a different type are different keys.
+  SIValue key[2] = {SI_DoubleVal(1), SI_ConstStringVal((char*)"odd")};
+  ASSERT_TRUE(ValueTable_Find(table, key, ValueTable_HashKey(key, 2)) == NULL);
+  key[0] = SI_LongVal(1);
+  key[1] = SI_ConstStringVal((char*)"even");
+  ASSERT_TRUE(ValueTable_Find(table, key, ValueTable_HashKey(key, 2)) == NULL);
+
+  ValueTable_Clear(table, NULL);
+  ASSERT_EQ(ValueTable_Count(table), 0);
+  ASSERT_TRUE(ValueTable_Find(table, keys, ValueTable_HashKey(keys, 2)) == NULL);
+
+  ValueTable_Free(table, NULL);
+  free(keys);
+}
+
+TEST_F(ValueTableTest, NullKeys) {
+  ValueTable *table = ValueTable_New(1, 4);
+  SIValue null_key = SI_NullVal();
+  SIValue zero_key = SI_LongVal(0);
+
+  ValueTable_Insert(table, &null_key, ValueTable_HashKey(&null_key, 1), NULL);
+  ASSERT_TRUE(ValueTable_Find(table, &null_key, ValueTable_HashKey(&null_key, 1)) != NULL);
+  ASSERT_TRUE(ValueTable_Find(table, &zero_key, ValueTable_HashKey(&zero_key, 1)) == NULL);
+
+  ValueTable_Free(table, NULL);
+}